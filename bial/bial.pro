@@ -32,6 +32,10 @@ QMAKE_LFLAGS += -std=c++11
 QMAKE_CXXFLAGS += -DBIAL_EXPLICIT_LIB
 
 #DEFINES += BIAL_IMPLICIT_BIN
+
+# Uncomment to halve the size of bucket queues, limiting them to 2^31 elements. Programs must be compiled with the
+# same flag.
+#QMAKE_CXXFLAGS += -DBIAL_SMALL_VOLUME
 DEFINES += BIAL_EXPLICIT_LIB
 
 QMAKE_CXXFLAGS_RELEASE -= -O2 -O0
@@ -146,6 +150,7 @@ HEADERS += \
     inc/DegeneratedIFT.hpp \
     inc/DFIDE.hpp \
     inc/DicomHeader.hpp \
+    inc/DicomSeries.hpp \
     inc/DiffPathFunction.hpp \
     inc/DiffusionFunction.hpp \
     inc/Display.hpp \
@@ -165,6 +170,7 @@ HEADERS += \
     inc/EdgeRiverBed.hpp \
     inc/Errors.hpp \
     inc/EuclideanDistanceFunction.hpp \
+    inc/Expression.hpp \
     inc/FastBucketQueue.hpp \
     inc/FastDecreasingFifoBucketQueue.hpp \
     inc/FastDecreasingLifoBucketQueue.hpp \
@@ -189,6 +195,7 @@ HEADERS += \
     inc/FilteringMedian.hpp \
     inc/FilteringOptimalAnisotropicDiffusion.hpp \
     inc/Fourier.hpp \
+    inc/FourierPlan.hpp \
     inc/FuzzyCMeans.hpp \
     inc/GDCM.hpp \
     inc/GeodesicPathFunction.hpp \
@@ -220,6 +227,7 @@ HEADERS += \
     inc/ImageEquals.hpp \
     inc/ImageFrame.hpp \
     inc/ImageIFT.hpp \
+    inc/ImageIFTEngine.hpp \
     inc/ImageInterpolation.hpp \
     inc/ImageMerge.hpp \
     inc/ImageResize.hpp \
@@ -237,15 +245,18 @@ HEADERS += \
     inc/KernelRound.hpp \
     inc/KernelSobel.hpp \
     inc/KernelSquare.hpp \
+    inc/KdTreeGraphAdjacency.hpp \
     inc/KnnGraphAdjacency.hpp \
     inc/LocalMaxPathFunction.hpp \
     inc/LSHGraphAdjacency.hpp \
     inc/MarchingCubes.hpp \
     inc/Matrix.hpp \
     inc/MatrixDeterminant.hpp \
+    inc/MatrixFactorization.hpp \
     inc/MatrixIdentity.hpp \
     inc/MatrixInverse.hpp \
     inc/MatrixPolar.hpp \
+    inc/MatrixProduct.hpp \
     inc/MatrixResize.hpp \
     inc/MatrixTranspose.hpp \
     inc/MaxPathFunction.hpp \
@@ -255,9 +266,11 @@ HEADERS += \
     inc/MinPathFunction.hpp \
     inc/MorphologyDilation.hpp \
     inc/MorphologyErosion.hpp \
+    inc/MorphologyLine.hpp \
     inc/MRIModality.hpp \
     inc/MultiImage.hpp \
     inc/NiftiHeader.hpp \
+    inc/OPFClassifier.hpp \
     inc/OPFClusterMatching.hpp \
     inc/OPFHierarchicalClustering.hpp \
     inc/OPFSpatialClustering.hpp \
@@ -270,7 +283,9 @@ HEADERS += \
     inc/PNMHeader.hpp \
     inc/PreEuclideanDistanceFunction.hpp \
     inc/RandomQueue.hpp \
+    inc/RankWindow.hpp \
     inc/RealColor.hpp \
+    inc/Resampling.hpp \
     inc/Sample.hpp \
     inc/SampleRandom.hpp \
     inc/SampleUniform.hpp \
@@ -353,6 +368,7 @@ SOURCES += \
     src/DegeneratedIFT.cpp \
     src/DFIDE.cpp \
     src/DicomHeader.cpp \
+    src/DicomSeries.cpp \
     src/DiffPathFunction.cpp \
     src/DiffusionFunction.cpp \
     src/Display.cpp \
@@ -386,6 +402,7 @@ SOURCES += \
     src/FilteringMedian.cpp \
     src/FilteringOptimalAnisotropicDiffusion.cpp \
     src/Fourier.cpp \
+    src/FourierPlan.cpp \
     src/FuzzyCMeans.cpp \
     src/GeodesicPathFunction.cpp \
     src/Geometrics.cpp \
@@ -431,11 +448,13 @@ SOURCES += \
     src/KernelRound.cpp \
     src/KernelSobel.cpp \
     src/KernelSquare.cpp \
+    src/KdTreeGraphAdjacency.cpp \
     src/KnnGraphAdjacency.cpp \
     src/LocalMaxPathFunction.cpp \
     src/LSHGraphAdjacency.cpp \
     src/MarchingCubes.cpp \
     src/MatrixDeterminant.cpp \
+    src/MatrixFactorization.cpp \
     src/MatrixIdentity.cpp \
     src/MatrixInverse.cpp \
     src/MatrixPolar.cpp \
@@ -448,8 +467,10 @@ SOURCES += \
     src/MinPathFunction.cpp \
     src/MorphologyDilation.cpp \
     src/MorphologyErosion.cpp \
+    src/MorphologyLine.cpp \
     src/MultiImage.cpp \
     src/NiftiHeader.cpp \
+    src/OPFClassifier.cpp \
     src/OPFClusterMatching.cpp \
     src/OPFHierarchicalClustering.cpp \
     src/OPFSpatialClustering.cpp \
@@ -462,7 +483,9 @@ SOURCES += \
     src/PNMHeader.cpp \
     src/PreEuclideanDistanceFunction.cpp \
     src/RandomQueue.cpp \
+    src/RankWindow.cpp \
     src/RealColor.cpp \
+    src/Resampling.cpp \
     src/Sample.cpp \
     src/SampleRandom.cpp \
     src/SampleUniform.cpp \
@@ -146,6 +146,15 @@ namespace Bial {
      * @warning none. 
      */
     bool Increasing( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Fifo attribute value.
+     * @brief Returns whether ties are broken in FIFO (true) or LIFO (false) order.
+     * @warning none.
+     */
+    bool Fifo( ) const;
     
     /**
      * @date 2012/Sep/19 
@@ -194,6 +203,23 @@ namespace Bial {
     void ResetState( );
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  inline bool BucketQueue::Empty( ) const {
+    if( elements == 0 ) {
+      return( true );
+    }
+    return( false );
+  }
+
+  inline BucketState BucketQueue::State( size_t idt ) const {
+    return( identity( idt ).state );
+  }
+
+  inline void BucketQueue::Finished( size_t idt ) {
+    identity( idt ).state = BucketState::REMOVED;
+  }
+
 }
 
 #include "BucketQueue.cpp"
@@ -35,21 +35,33 @@ namespace Bial {
   class IdentityNode {
   public:
     /** @brief  next node */
-    int next;
+    bial_index next;
     /** @brief  prev node */
-    int prev;
+    bial_index prev;
     BucketState state;
     IdentityNode( ) {
       next = -1;
       prev = -1;
       state = BucketState::NOT_VISITED;
     }
+    /**
+     * @brief Returns the number of elements of a queue, if they can be indexed by bial_index. Otherwise, throws
+     * logic_error, so that queue nodes never wrap around.
+     */
+    static size_t CheckedSize( size_t size ) {
+      if( size > static_cast< size_t >( std::numeric_limits< bial_index >::max( ) ) ) {
+        std::string msg( BIAL_ERROR( "Queue of " + std::to_string( size ) + " elements cannot be indexed by " +
+                                     "bial_index. Compile without BIAL_SMALL_VOLUME." ) );
+        throw( std::logic_error( msg ) );
+      }
+      return( size );
+    }
   };
 
   class WeightNode {
   public:
-    int first; /* first node */
-    int last; /* last node */
+    bial_index first; /* first node */
+    bial_index last; /* last node */
     WeightNode( ) {
       first = -1;
       last = -1;
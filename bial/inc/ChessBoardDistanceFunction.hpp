@@ -87,6 +87,7 @@ namespace Bial {
   template< class D >
   double ChessBoardDistanceFunction::Distance( const D *src, const size_t dms ) {
     double dist = 0.0;
+#pragma omp simd reduction( max : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
       if( dist < src[ ftr ] )
         dist = src[ ftr ];
@@ -97,6 +98,7 @@ namespace Bial {
   template< class D >
   double ChessBoardDistanceFunction::Distance( const D *src, const D *tgt, const size_t dms ) {
     double dist = 0.0;
+#pragma omp simd reduction( max : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
       size_t diff_ftr = ( src[ ftr ] > tgt[ ftr ] ) ? src[ ftr ] - tgt[ ftr ] : tgt[ ftr ] - src[ ftr ];
       if( dist < diff_ftr )
@@ -87,9 +87,9 @@ namespace Bial {
   template< class D >
   double CityBlockDistanceFunction::Distance( const D *src, const size_t dms ) {
     double dist = 0.0;
+#pragma omp simd reduction( + : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
-      D src_ftr = ( src[ ftr ] > 0 ) ? src[ ftr ] : -src[ ftr ];
-      dist += src_ftr;
+      dist += std::abs( static_cast< double >( src[ ftr ] ) );
     }
     return( dist );
   }
@@ -97,9 +97,9 @@ namespace Bial {
   template< class D >
   double CityBlockDistanceFunction::Distance( const D *src, const D *tgt, const size_t dms ) {
     double dist = 0.0;
+#pragma omp simd reduction( + : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
-      D diff_ftr = ( src[ ftr ] > tgt[ ftr ] ) ? src[ ftr ] - tgt[ ftr ] : tgt[ ftr ] - src[ ftr ];
-      dist += diff_ftr;
+      dist += std::abs( static_cast< double >( src[ ftr ] ) - static_cast< double >( tgt[ ftr ] ) );
     }
     return( dist );
   }
@@ -23,9 +23,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <complex>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
@@ -37,6 +39,7 @@
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <sstream>
@@ -58,6 +61,14 @@ typedef unsigned long ulint;
 typedef unsigned long long ullint;
 typedef long double ldbl;
 typedef std::complex< double > bial_complex;
+/* Signed index of an image element stored in per-element structures, as bucket queue nodes. It is 64-bit, so that
+ * images may have more than 2^31 elements. Compile with BIAL_SMALL_VOLUME to halve the size of these structures;
+ * then, queues of more than 2^31 elements throw logic_error. */
+#ifdef BIAL_SMALL_VOLUME
+typedef int bial_index;
+#else
+typedef long long bial_index;
+#endif
 /* Defining the standard output functions. */
 
 /**
@@ -338,6 +349,194 @@ namespace Bial {
    */
   std::string MakeDirCommand( const std::string &dirname );
 
+  /**
+   * @brief Library-wide work-stealing scheduler. Parallel kernels split their domain in chunks (tasks) and submit
+   * them to the global pool through Run. Each worker owns a queue of tasks and steals from the others when its own
+   * queue runs dry, so that uneven chunks (masked regions, image borders) do not leave cores idle. The calling thread
+   * also executes tasks while it waits. The number of threads defaults to std::thread::hardware_concurrency( ) and
+   * may be overridden by the BIAL_THREADS environment variable or by SetThreads.
+   */
+  class ThreadPool {
+
+  private:
+    /** @brief A call to Run: task function, number of tasks not finished yet, and first exception thrown. */
+    struct Batch {
+      const std::function< void( size_t, size_t ) > *function;
+      size_t total_tasks;
+      size_t remaining;
+      std::exception_ptr error;
+      std::mutex mutex;
+      std::condition_variable done;
+    };
+    /** @brief A single task: its batch and index. */
+    typedef std::pair< Batch*, size_t > Task;
+    /** @brief Per-worker double ended task queue. */
+    struct TaskQueue {
+      std::deque< Task > tasks;
+      std::mutex mutex;
+    };
+
+    /** @brief Worker threads. The calling thread of Run is not counted here. */
+    std::vector< std::thread > workers;
+    /** @brief One queue per worker. */
+    std::vector< std::unique_ptr< TaskQueue > > queues;
+    /** @brief Number of tasks submitted and not taken from the queues yet. */
+    std::atomic< size_t > pending;
+    /** @brief Set to finish worker threads. */
+    bool stop;
+    /** @brief Lock and condition used to put idle workers to sleep. */
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param threads: Total number of threads, including the caller of Run. 0 selects DefaultThreads( ).
+     * @return none.
+     * @brief Basic constructor. Starts threads - 1 workers.
+     * @warning If a thread can not be created, the pool continues with the ones already created.
+     */
+    explicit ThreadPool( size_t threads = 0 );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @return none.
+     * @brief Destructor. Finishes pending tasks and joins worker threads.
+     * @warning none.
+     */
+    ~ThreadPool( );
+
+    ThreadPool( const ThreadPool & ) = delete;
+    ThreadPool &operator=( const ThreadPool & ) = delete;
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @return Reference to the library-wide pool used by the parallel kernels.
+     * @brief Returns the global pool. It is created on first use.
+     * @warning none.
+     */
+    static ThreadPool &Global( );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @return Number of threads given by BIAL_THREADS environment variable, if set, or by hardware concurrency.
+     * @brief Default number of threads of a pool.
+     * @warning none.
+     */
+    static size_t DefaultThreads( );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @return Total number of threads that execute tasks, including the caller of Run.
+     * @brief Returns the number of threads of the pool.
+     * @warning none.
+     */
+    size_t Threads( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param threads: Total number of threads, including the caller of Run. 0 selects DefaultThreads( ).
+     * @return none.
+     * @brief Restarts the pool with the given number of threads.
+     * @warning Must not be called while Run is being executed.
+     */
+    void SetThreads( size_t threads );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param elements: Number of elements of the domain to be split.
+     * @param granularity: Number of tasks per thread.
+     * @return Number of tasks in which a domain of the given size should be split.
+     * @brief Returns granularity tasks per thread, so that threads finishing earlier have tasks to steal.
+     * @warning none.
+     */
+    size_t Tasks( size_t elements, size_t granularity = 4 ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param total_tasks: Number of tasks.
+     * @param function: Function called as function( task, total_tasks ) for each task in [0, total_tasks).
+     * @return none.
+     * @brief Executes all tasks in parallel and waits for them to finish. The first exception thrown by a task is
+     * rethrown here after all tasks are done.
+     * @warning Calls from inside a task are executed sequentially by the calling thread.
+     */
+    void Run( size_t total_tasks, const std::function< void( size_t, size_t ) > &function );
+
+  private:
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param threads: Total number of threads, including the caller of Run.
+     * @return none.
+     * @brief Creates threads - 1 workers and their queues.
+     * @warning none.
+     */
+    void Start( size_t threads );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @return none.
+     * @brief Wakes and joins all workers.
+     * @warning none.
+     */
+    void Stop( );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param worker: Worker index.
+     * @return none.
+     * @brief Worker main loop: pops own tasks, steals from other queues, or sleeps until new tasks arrive.
+     * @warning none.
+     */
+    void WorkerLoop( size_t worker );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param worker: Worker index.
+     * @param task: Returned task.
+     * @return true if a task was taken from the front of the worker queue.
+     * @brief Takes the next task of the worker's own queue.
+     * @warning none.
+     */
+    bool Pop( size_t worker, Task &task );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param first: Index of the first queue to be visited.
+     * @param task: Returned task.
+     * @return true if a task was stolen from the back of some queue.
+     * @brief Steals a task from any queue, visiting them in circular order starting from first.
+     * @warning none.
+     */
+    bool Steal( size_t first, Task &task );
+
+    /**
+     * @date 2026/Oct/18
+     * @version 1.0.00
+     * @param task: Task to be executed.
+     * @return none.
+     * @brief Executes a task, records its exception, if any, and signals its batch when it is the last one.
+     * @warning none.
+     */
+    void Execute( const Task &task );
+
+  };
+
 #ifdef _WIN32
 #define IS_WINDOWS_PLATFORM
 #endif
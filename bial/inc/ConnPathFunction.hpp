@@ -11,13 +11,12 @@
 #ifndef BIALCONNPATHFUNCTION_H
 #define BIALCONNPATHFUNCTION_H
 
+#include "BucketQueueElements.hpp"
 #include "Common.hpp"
 #include "PathFunction.hpp"
 
 namespace Bial {
 
-  enum class BucketState : char;
-
   template< template< class D > class C, class D >
   class ConnPathFunction : public PathFunction< C, D > {
 
@@ -42,7 +41,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    ConnPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label, 
+    ConnPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor,
+                      bool sequential_label,
                       const C< D > &handicap, const C< D > &component );
 
     /**
@@ -151,6 +151,80 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::RemoveSimple( size_t index, BucketState state ) {
+    COMMENT( "Removing " << index, 4 );
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = 0.0;
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::RemovePredecessor( size_t index, BucketState state ) {
+    COMMENT( "Removing " << index, 4 );
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = 0.0;
+      this->predecessor->operator()( index ) = -1;
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::RemoveLabel( size_t index, BucketState state ) {
+    COMMENT( "Removing " << index, 4 );
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = 0.0;
+      this->label->operator()( index ) = this->next_label;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::RemoveComplete( size_t index, BucketState state ) {
+    COMMENT( "Removing " << index, 4 );
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = 0.0;
+      this->label->operator()( index ) = this->next_label;
+      this->predecessor->operator()( index ) = -1;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
+    return( ( adj_state != BucketState::REMOVED ) &&
+            ( this->value->operator()( index ) < this->value->operator()( adj_index ) ) );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    D prp_value = std::max( this->value->operator()( index ), handicap( adj_index ) );
+    if( ( src_value > prp_value ) && ( component( index ) == component( adj_index ) ) ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool ConnPathFunction< C, D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    D prp_value = std::max( this->value->operator()( index ), handicap( adj_index ) );
+    if( ( src_value > prp_value ) && ( component( index ) == component( adj_index ) ) ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
 }
 
 #include "ConnPathFunction.cpp"
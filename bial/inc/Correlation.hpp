@@ -8,6 +8,7 @@
  */
 
 #include "Common.hpp"
+#include "Vector.hpp"
 
 #ifndef BIALCORRELATION_H
 #define BIALCORRELATION_H
@@ -18,16 +19,92 @@ namespace Bial {
   class Image;
   class Kernel;
 
+  /** @brief Algorithm used by Correlation. */
+  enum class CorrelationMethod : char {
+    Automatic, /* Dense for integer images. The cheapest estimated one for floating point images. */
+    Dense, /* CorrelationThreads. */
+    Separable, /* SeparableCorrelation. The kernel must be separable. */
+    FFT /* CorrelationFFT. */
+  };
+
+  /**
+   * @brief Costs used by the automatic choice of Correlation, in kernel element products per pixel. Each
+   * separable pass costs its 1D kernel length plus CORRELATION_PASS_COST, for copying the lines. The FFT costs
+   * CORRELATION_FFT_COST times the padded size times its logarithm, over the image size. They were measured with
+   * Filtering-CorrelationTime on a single thread of a Xeon server. They only affect speed, as automatic choice is
+   * restricted to floating point images.
+   */
+  const size_t CORRELATION_PASS_COST = 16;
+  const double CORRELATION_FFT_COST = 6.0;
+
   /**
    * @date 2013/Nov/21 
    * @param img: Input image. 
    * @param krn: A kernel. 
+   * @param method: Correlation algorithm. 
    * @return Image with correlation between img and krn. 
-   * @brief Returns an image with correlation between img and krn. 
-   * @warning none. 
+   * @brief Returns an image with correlation between img and krn. Integer images are computed by
+   * CorrelationThreads, unless another method is given, so that their results do not depend on the kernel. For
+   * floating point images, separable kernels, such as box kernels, are computed by SeparableCorrelation, unless
+   * they are so small that the dense correlation is faster, as the 3x3x3 Sobel kernel. Other kernels are computed
+   * by CorrelationFFT if its estimated cost is lower, or by CorrelationThreads otherwise. 
+   * @warning Separable and FFT results differ from CorrelationThreads by rounding errors. As integer results are
+   * truncated, these may change them by one. Gaussian and Gabor kernels are not separable. 
+   */
+  template< class D >
+  Image< D > Correlation( const Image< D > &img, const Kernel &krn,
+                          CorrelationMethod method = CorrelationMethod::Automatic );
+
+  /**
+   * @date 2026/Oct/18
+   * @param krn: A kernel.
+   * @param weights: Returns one 1D kernel per dimension, from -radius to radius, with the radius of the kernel in
+   * that dimension.
+   * @return true if the kernel is separable.
+   * @brief Verifies if the kernel coefficients are the product of one 1D kernel per dimension, that is, if the
+   * coefficients over the bounding box of the kernel, with zeros for missing elements, form a rank one tensor.
+   * @warning Kernels with hyperspheric support, such as Gaussian and Gabor kernels, are not separable, as their
+   * corners are missing.
+   */
+  bool SeparableKernel( const Kernel &krn, std::vector< Vector< double > > &weights );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Input image.
+   * @param weights: One 1D kernel per image dimension, as computed by SeparableKernel.
+   * @return Image with correlation between img and the product of the 1D kernels.
+   * @brief Computes the correlation as one pass of Filtering::GaussianPass per dimension.
+   * @warning Integer results that are within 1e-6 of an integer are taken as that integer before being truncated.
+   */
+  template< class D >
+  Image< D > SeparableCorrelation( const Image< D > &img, const std::vector< Vector< double > > &weights );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Input image.
+   * @param krn: A kernel.
+   * @return Dimensions of the padded image of CorrelationFFT.
+   * @brief Pads each image dimension by the largest kernel displacement in that dimension, to the next length
+   * with a fast transform.
+   * @warning none.
+   */
+  template< class D >
+  Vector< size_t > CorrelationFFTDim( const Image< D > &img, const Kernel &krn );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Input image.
+   * @param krn: A kernel.
+   * @return Image with correlation between img and krn.
+   * @brief Returns an image with correlation between img and krn, computed as the product of their real FFTs. The
+   * image is padded with zeros by the kernel extent, to a length with a fast transform, so that the result is the
+   * same as Correlation, with out of image pixels ignored. Its cost does not depend on the kernel size, so it is
+   * faster than Correlation for large kernels.
+   * @warning Results differ from Correlation by rounding errors. Integer results that are within 1e-6 of an integer
+   * are taken as that integer before being truncated.
    */
   template< class D >
-  Image< D > Correlation( const Image< D > &img, const Kernel &krn );
+  Image< D > CorrelationFFT( const Image< D > &img, const Kernel &krn );
 
   /**
    * @date 2013/Nov/26 
@@ -37,7 +114,9 @@ namespace Bial {
    * @param thread: number of the thread. 
    * @param total_threads: total number of threads. 
    * @return none. 
-   * @brief Multithread implementation of correlation. 
+   * @brief Multithread implementation of correlation. Rows whose pixels have all their adjacents inside the image
+   * are accumulated one kernel element at a time over the whole interior span of the row, so that the inner loop is
+   * vectorized. Border pixels verify each adjacent. 
    * @warning none. 
    */
   template< class D >
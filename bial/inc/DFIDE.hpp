@@ -197,6 +197,38 @@ namespace Bial {
     static double Distance( const C< double > &src, const C< double > &tgt, const size_t src_orig,
                             const size_t tgt_orig, const size_t dms );
 
+    /**
+     * @date 2026/Oct/18
+     * @param src: Source array.
+     * @param tgt: Block of target arrays, stored consecutively.
+     * @param tgt_size: Number of target arrays.
+     * @param dms: Number of dimensions
+     * @param dist: Distances from src to each target array.
+     * @return none.
+     * @brief Computes the distances from src to a block of target arrays. Current distance function is resolved
+     * once per block, and its kernel runs vectorized over the block.
+     * @warning dist must have tgt_size elements. Not checked!
+     */
+    template< class D >
+    static void Distances( const D *src, const D *tgt, const size_t tgt_size, const size_t dms, double *dist );
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Source array.
+     * @param tgt: Target arrays, stored consecutively.
+     * @param rows: Indexes of the target arrays to be compared to src.
+     * @param tgt_size: Number of indexes in rows.
+     * @param dms: Number of dimensions
+     * @param dist: Distances from src to each indexed target array.
+     * @return none.
+     * @brief Computes the distances from src to the indexed target arrays, resolving current distance function
+     * once.
+     * @warning dist must have tgt_size elements. Not checked!
+     */
+    template< class D >
+    static void Distances( const D *src, const D *tgt, const size_t *rows, const size_t tgt_size, const size_t dms,
+                           double *dist );
+
     /**
      * @date 2015/Mar/10
      * @param maximum_distance: Maximum accessed distance for pre computed euclidean distance.
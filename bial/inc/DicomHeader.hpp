@@ -1,237 +1,305 @@
-/* Biomedical Image Analysis Library 
- * See README file in the root instalation directory for more information. 
- */
-
-/**
- * @file DicomHeader.hpp
- * @author Fábio Augusto Menocci Cappabianco 
- * @date 2012/Jun/21 
- * @version 1.0.00
- * @brief
- * Content: Dicom header reader 
- * <br> Description: Reads Dicom file and header containts. Based on Fabio Kawaoka Takase implementation. 
- * <br> Future add-on's: - Translate all comments to English. Reformat code to Bial standard. 
- *                  - Implement data writting. 
- *                  - Implement Nifti Header convertion. 
- */
-
-/*****************************************************************************
-*  File Name        :  TDicom.h
-*  1st Version date :  Aug 2007
-*  Author           :  Fabio Kawaoka Takase
-*  ----------------------------------------------------------------------------
-*  Description :
-*  ^^^^^^^^^^^
-*  TDicom class definition. This class extends the TDynMatrix class, providing
-*  the support to open DICOM files.
-*  ----------------------------------------------------------------------------
-*  Updates:
-*  ^^^^^^^^
-*  2008-03-13:    Adicionadas classes TElementId e TGroupId
-*  ----------------------------------------------------------------------------
-*****************************************************************************/
-
-
-#include "File.hpp"
-#include "Image.hpp"
-
-#ifndef BIALDICOMHEADER_H
-#define BIALDICOMHEADER_H
-
-namespace Bial {
-
-  /** @brief  DICOM DATA ELEMENT */
-  class TElementId {
-
-  private:
-    /** @brief  Element ID */
-    int id;
-    /** @brief  --> tipo == 1 ( std::string ), == 2 float, == 3 int */
-    int valtype;
-    /** @brief  string value */
-    std::string sval;
-    /** @brief  float value */
-    float fval;
-    /** @brief  int value */
-    int ival;
-
-  public:
-    /** @brief  constructor */
-    TElementId( ) try : id( -1 ), sval( std::string( ) ), fval( -1.0f ), ival( -1 ) {
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-
-    /** @brief  altera o valor ( std::string ) e o ID do Element */
-    void set( int newId, std::string data ) {
-      id = newId;
-      sval = data;
-      valtype = 1;
-    }
-
-    /** @brief  altera o valor ( float ) e o ID do Element */
-    void set( int newId, float data ) {
-      id = newId;
-      fval = data;
-      valtype = 2;
-    }
-
-    /** @brief  altera o valor ( int ) e o ID do Element */
-    void set( int newId, int data ) {
-      id = newId;
-      ival = data;
-      valtype = 3;
-    }
-
-    int getId( ) const {
-      return( id );
-    }
-
-    int getValueType( ) const {
-      return( valtype );
-    }
-
-    int getIntValue( ) const {
-      return( ival );
-    }
-
-    float getFloatValue( ) const {
-      return( fval );
-    }
-
-    std::string getStringValue( ) const {
-      return( sval );
-    }
-
-    /* escreve o valor do Element na tela */
-    void print( ) {
-      if( valtype == 1 ) {
-        std::cout << "Elem ID: " << id << " ; Elem Data: " << sval << std::endl;
-      }
-      else if( valtype == 2 ) {
-        std::cout << "Elem ID: " << id << " ; Elem Data: " << fval << std::endl;
-      }
-      else if( valtype == 3 ) {
-        std::cout << "Elem ID: " << id << " ; Elem Data: " << ival << std::endl;
-      }
-    }
-
-  };
-
-  /** @brief  DICOM DATA BLOCK */
-  class TGroupId {
-
-  private:
-    /** @brief  group ID */
-    int id; 
-    std::deque< TElementId > lista; /* deque of Elements */
-
-  public:
-    typedef std::deque< TElementId >::iterator iterator;
-
-    /** @brief  constructor ( ) */
-    TGroupId( ) : id( -1 ), lista( std::deque< TElementId >( ) ) {
-    }
-
-    /** @brief  constructor ( int ID ) */
-    TGroupId( int new_id ) : id( new_id ), lista( std::deque< TElementId >( ) ) {
-    }
-
-    /** @brief  muda o valor de ID do Group */
-    void setId( int id ) {
-      this->id = id;
-    }
-
-    /** @brief  adiciona um Element a list */
-    bool push( int id, TElementId element ) {
-      if( this->id == id ) {
-        lista.push_back( element );
-        return( true );
-      }
-      return( false );
-    }
-
-    /** @brief  posiciona no primeiro Element em list */
-    iterator begin( ) {
-      return( lista.begin( ) );
-    }
-
-    /** @brief  posiciona no ultimo Element em list */
-    iterator end( ) {
-      return( lista.end( ) );
-    }
-
-    /** @brief  retornar o tamanho de list */
-    size_t size( ) const {
-      return( lista.size( ) );
-    }
-
-    /** @brief  retorna o ID do Group */
-    int getId( ) const {
-      return( id );
-    }
-
-  };
-
-  class DicomHeader {
-
-  private:
-    /** @brief  Block list */
-    std::deque< TGroupId > lista; 
-
-    /**
-     * @date 2013/Aug/23 
-     * @param none. 
-     * @return Data according to element type. 
-     * @brief Returns data read from element. 
-     * @warning none. 
-     */
-    std::string readID( );
-    long readInt32( );
-    int readInt16( );
-
-  public:
-    typedef std::deque< TGroupId >::iterator iterator;
-
-    /** @brief  posiciona no primeiro Element em list */
-    iterator begin( ) {
-      return( lista.begin( ) );
-    }
-
-    /** @brief  posiciona no ultimo Element em list */
-    iterator end( ) {
-      return( lista.end( ) );
-    }
-
-    IFile file_pointer;
-    DicomHeader( );
-
-    template< class D >
-    Image< D > readFile( std::string filename );
-
-    void readZeroPadding( );
-
-    void readDICM( );
-
-    template< class D >
-    Image< D > readData( );
-
-    template< class D >
-    Image< D > readImageData( );
-
-    void push( TGroupId group );
-
-    TElementId getElement( int grupo, int elemento );
-  };
-
-}
-
-#include "DicomHeader.cpp"
-
-#endif
+/* Biomedical Image Analysis Library 
+ * See README file in the root instalation directory for more information. 
+ */
+
+/**
+ * @file DicomHeader.hpp
+ * @author Fábio Augusto Menocci Cappabianco 
+ * @date 2012/Jun/21 
+ * @version 1.0.00
+ * @brief
+ * Content: Dicom header reader 
+ * <br> Description: Reads Dicom file and header containts. Based on Fabio Kawaoka Takase implementation. 
+ * <br> Future add-on's: - Translate all comments to English. Reformat code to Bial standard. 
+ *                  - Implement data writting. 
+ *                  - Implement Nifti Header convertion. 
+ */
+
+/*****************************************************************************
+*  File Name        :  TDicom.h
+*  1st Version date :  Aug 2007
+*  Author           :  Fabio Kawaoka Takase
+*  ----------------------------------------------------------------------------
+*  Description :
+*  ^^^^^^^^^^^
+*  TDicom class definition. This class extends the TDynMatrix class, providing
+*  the support to open DICOM files.
+*  ----------------------------------------------------------------------------
+*  Updates:
+*  ^^^^^^^^
+*  2008-03-13:    Adicionadas classes TElementId e TGroupId
+*  ----------------------------------------------------------------------------
+*****************************************************************************/
+
+
+#include "File.hpp"
+#include "Image.hpp"
+
+#ifndef BIALDICOMHEADER_H
+#define BIALDICOMHEADER_H
+
+namespace Bial {
+
+  /** @brief  DICOM DATA ELEMENT */
+  class TElementId {
+
+  private:
+    /** @brief  Element ID */
+    int id;
+    /** @brief  --> tipo == 1 ( std::string ), == 2 float, == 3 int */
+    int valtype;
+    /** @brief  string value */
+    std::string sval;
+    /** @brief  float value */
+    float fval;
+    /** @brief  int value */
+    int ival;
+
+  public:
+    /** @brief  constructor */
+    TElementId( ) try : id( -1 ), sval( std::string( ) ), fval( -1.0f ), ival( -1 ) {
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+
+    /** @brief  altera o valor ( std::string ) e o ID do Element */
+    void set( int newId, std::string data ) {
+      id = newId;
+      sval = data;
+      valtype = 1;
+    }
+
+    /** @brief  altera o valor ( float ) e o ID do Element */
+    void set( int newId, float data ) {
+      id = newId;
+      fval = data;
+      valtype = 2;
+    }
+
+    /** @brief  altera o valor ( int ) e o ID do Element */
+    void set( int newId, int data ) {
+      id = newId;
+      ival = data;
+      valtype = 3;
+    }
+
+    int getId( ) const {
+      return( id );
+    }
+
+    int getValueType( ) const {
+      return( valtype );
+    }
+
+    int getIntValue( ) const {
+      return( ival );
+    }
+
+    float getFloatValue( ) const {
+      return( fval );
+    }
+
+    std::string getStringValue( ) const {
+      return( sval );
+    }
+
+    /* escreve o valor do Element na tela */
+    void print( ) {
+      if( valtype == 1 ) {
+        std::cout << "Elem ID: " << id << " ; Elem Data: " << sval << std::endl;
+      }
+      else if( valtype == 2 ) {
+        std::cout << "Elem ID: " << id << " ; Elem Data: " << fval << std::endl;
+      }
+      else if( valtype == 3 ) {
+        std::cout << "Elem ID: " << id << " ; Elem Data: " << ival << std::endl;
+      }
+    }
+
+  };
+
+  /** @brief  DICOM DATA BLOCK */
+  class TGroupId {
+
+  private:
+    /** @brief  group ID */
+    int id; 
+    std::deque< TElementId > lista; /* deque of Elements */
+
+  public:
+    typedef std::deque< TElementId >::iterator iterator;
+
+    /** @brief  constructor ( ) */
+    TGroupId( ) : id( -1 ), lista( std::deque< TElementId >( ) ) {
+    }
+
+    /** @brief  constructor ( int ID ) */
+    TGroupId( int new_id ) : id( new_id ), lista( std::deque< TElementId >( ) ) {
+    }
+
+    /** @brief  muda o valor de ID do Group */
+    void setId( int id ) {
+      this->id = id;
+    }
+
+    /** @brief  adiciona um Element a list */
+    bool push( int id, TElementId element ) {
+      if( this->id == id ) {
+        lista.push_back( element );
+        return( true );
+      }
+      return( false );
+    }
+
+    /** @brief  posiciona no primeiro Element em list */
+    iterator begin( ) {
+      return( lista.begin( ) );
+    }
+
+    /** @brief  posiciona no ultimo Element em list */
+    iterator end( ) {
+      return( lista.end( ) );
+    }
+
+    /** @brief  retornar o tamanho de list */
+    size_t size( ) const {
+      return( lista.size( ) );
+    }
+
+    /** @brief  retorna o ID do Group */
+    int getId( ) const {
+      return( id );
+    }
+
+  };
+
+  class DicomHeader {
+
+  private:
+    /** @brief  Block list */
+    std::deque< TGroupId > lista; 
+
+    /**
+     * @date 2013/Aug/23 
+     * @param none. 
+     * @return Data according to element type. 
+     * @brief Returns data read from element. 
+     * @warning none. 
+     */
+    std::string readID( );
+    long readInt32( );
+    int readInt16( );
+
+    /** @brief  Transfer syntax of the data set uses explicit value representation. */
+    bool explicit_vr;
+    /** @brief  Position and size in bytes of pixel data read by readHeader. Size is zero if there is no pixel data. */
+    size_t pixel_offset;
+    size_t pixel_bytes;
+    /** @brief  Maximum nesting of sequences and items accepted by readElements. */
+    static const size_t MaxDepth = 64;
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: File contents.
+     * @param pos: Position of the first element.
+     * @param end: Position after the last element.
+     * @param depth: Number of sequences and items enclosing the elements.
+     * @param sequences: true to store elements inside sequences.
+     * @return Position after the last element, or after the item or sequence delimiter that ends them.
+     * @brief Reads data elements from memory, descending into sequences and items. In implicit value
+     * representation, the integers needed to decode pixels are told apart by their tags, and other elements are
+     * read as text.
+     * @warning Throws if sequences and items are nested deeper than MaxDepth.
+     */
+    size_t readElements( const char *data, size_t pos, size_t end, size_t depth, bool sequences );
+
+    /**
+     * @date 2026/Oct/18
+     * @param grupo: Group of the element.
+     * @param element: Element to be stored.
+     * @return none.
+     * @brief Appends element to the last group in list, or to a new group if its group is different.
+     * @warning none.
+     */
+    void storeElement( int grupo, const TElementId &element );
+
+  public:
+    typedef std::deque< TGroupId >::iterator iterator;
+
+    /** @brief  posiciona no primeiro Element em list */
+    iterator begin( ) {
+      return( lista.begin( ) );
+    }
+
+    /** @brief  posiciona no ultimo Element em list */
+    iterator end( ) {
+      return( lista.end( ) );
+    }
+
+    IFile file_pointer;
+    DicomHeader( );
+
+    template< class D >
+    Image< D > readFile( std::string filename );
+
+    void readZeroPadding( );
+
+    void readDICM( );
+
+    template< class D >
+    Image< D > readData( );
+
+    template< class D >
+    Image< D > readImageData( );
+
+    void push( TGroupId group );
+
+    TElementId getElement( int grupo, int elemento );
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: Contents of a Dicom file.
+     * @param size: Size of data in bytes.
+     * @param sequences: true to store the elements inside sequences, as the records of a DICOMDIR. Otherwise,
+     * sequences are skipped.
+     * @return none.
+     * @brief Reads the header from memory up to the pixel data, whose position is kept instead of reading it.
+     * Supports implicit and explicit little endian transfer syntaxes, files without preamble, and sequences of
+     * defined and undefined length.
+     * @warning Big endian and compressed transfer syntaxes are not supported.
+     */
+    void readHeader( const char *data, size_t size, bool sequences = false );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Position and size in bytes of the pixel data in the file given to readHeader.
+     * @brief Returns the location of the pixel data. Size is zero if the file has no pixel data.
+     * @warning none.
+     */
+    size_t getPixelOffset( ) const;
+    size_t getPixelBytes( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param grupo: Group of the element.
+     * @param elemento: Element ID.
+     * @param element: Returns the first element found.
+     * @return true if the element was found.
+     * @brief Searches for an element that may be absent, without throwing.
+     * @warning none.
+     */
+    bool findElement( int grupo, int elemento, TElementId &element );
+  };
+
+}
+
+#include "DicomHeader.cpp"
+
+#endif
@@ -0,0 +1,209 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Reading of Dicom series as volumes.
+ * <br> Future add-on's: compressed transfer syntaxes.
+ */
+
+#include "Common.hpp"
+#include "Vector.hpp"
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#ifndef BIALDICOMSERIES_H
+#define BIALDICOMSERIES_H
+
+namespace Bial {
+
+  template< class D >
+  class Image;
+
+  /**
+   * @brief Series of Dicom slices that compose a volume. The constructor parses the headers of all files of a
+   * directory or DICOMDIR concurrently, keeping for each slice only the location of its pixel data and the
+   * attributes needed to decode it. Slices are sorted by their position along the normal of the slice plane, or by
+   * instance number if they have no position. Read decodes the slices concurrently, straight into the volume.
+   * Parsed series are cached by Open, up to MaxSeries series, so that reopening a series reads only its pixel data.
+   */
+  class DicomSeries {
+
+  private:
+
+    /** @brief Attributes of a slice, parsed from its header. */
+    struct Slice {
+      std::string filename;
+      std::string series_uid;
+      /** @brief Position and size in bytes of the pixel data in file. */
+      size_t pixel_offset;
+      size_t pixel_bytes;
+      size_t rows;
+      size_t columns;
+      size_t bits_allocated;
+      size_t bits_stored;
+      bool is_signed;
+      /** @brief Rescale slope and intercept applied to stored values. */
+      double slope;
+      double intercept;
+      int instance;
+      /** @brief Image position and orientation in patient coordinates. */
+      std::vector< double > position;
+      std::vector< double > orientation;
+      /** @brief Spacing between rows and between columns, followed by slice thickness. */
+      std::vector< double > spacing;
+      /** @brief Position along the normal of the slice plane. */
+      double location;
+    };
+
+    /** @brief Slices in volume order. */
+    std::vector< Slice > slices;
+    /** @brief Pixel size in each dimension of the volume. */
+    Vector< float > pixel_size;
+
+    /** @brief Number of cached series above which unused series are released. */
+    static const size_t MaxSeries = 16;
+    /** @brief Series cached by path and series UID, with the modification time of path, and their lock. */
+    static std::map< std::pair< std::string, std::string >,
+                     std::pair< time_t, std::shared_ptr< const DicomSeries > > > cache;
+    static std::mutex cache_mutex;
+
+    /**
+     * @date 2026/Oct/18
+     * @param filename: Name of a Dicom file.
+     * @param slice: Returns the attributes of the slice.
+     * @return true if the file is a Dicom image supported by Read.
+     * @brief Parses the header of a file.
+     * @warning none.
+     */
+    static bool ReadSlice( const std::string &filename, Slice &slice );
+
+    /**
+     * @date 2026/Oct/18
+     * @param filename: Name of a DICOMDIR file.
+     * @return Names of the image files referenced by the DICOMDIR.
+     * @brief Reads the image records of a DICOMDIR.
+     * @warning none.
+     */
+    static Vector< std::string > ReadDicomDir( const std::string &filename );
+
+    /**
+     * @date 2026/Oct/18
+     * @param slice: Index of the slice.
+     * @param data: Returns the decoded pixels of the slice.
+     * @return none.
+     * @brief Reads the pixel data of a slice, and converts it to the type of the volume applying the rescale slope
+     * and intercept.
+     * @warning none.
+     */
+    template< class D >
+    void ReadPixels( size_t slice, D *data ) const;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param path: A directory with Dicom files, or a DICOMDIR file.
+     * @param series_uid: Series instance UID of the series to be loaded. If empty, the series with most slices is
+     * loaded.
+     * @return none.
+     * @brief Basic constructor. Parses the headers of the files in parallel, selects the series and sorts its slices.
+     * Files that are not Dicom images are ignored.
+     * @warning Slices must have the same size and pixel format.
+     */
+    explicit DicomSeries( const std::string &path, const std::string &series_uid = std::string( ) );
+
+    /**
+     * @date 2026/Oct/18
+     * @param path: A directory with Dicom files, or a DICOMDIR file.
+     * @param series_uid: Series instance UID of the series to be loaded. If empty, the series with most slices is
+     * loaded.
+     * @return Shared series of the given path.
+     * @brief Returns the cached series of the given path, parsing it on first use or if the path was modified after
+     * it was parsed. Thread safe.
+     * @warning Changes to the contents of a file that do not change the modification time of path are not detected.
+     */
+    static std::shared_ptr< const DicomSeries > Open( const std::string &path,
+                                                      const std::string &series_uid = std::string( ) );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Releases all cached series. Series in use remain valid until their last user releases them. Thread
+     * safe.
+     * @warning none.
+     */
+    static void ClearCache( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Number of slices of the series.
+     * @brief Returns the number of slices of the series.
+     * @warning none.
+     */
+    size_t Slices( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param slice: Index of a slice in volume order.
+     * @return Name of the file of the slice.
+     * @brief Returns the name of the file of a slice.
+     * @warning none.
+     */
+    const std::string &FileName( size_t slice ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Series instance UID of the series.
+     * @brief Returns the series instance UID of the series.
+     * @warning none.
+     */
+    const std::string &SeriesUID( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Dimensions and pixel size of the volume.
+     * @brief Returns the dimensions of the volume, as columns, rows and slices, and its pixel size, with the slice
+     * spacing computed from the positions of the slices.
+     * @warning none.
+     */
+    Vector< size_t > Dim( ) const;
+    Vector< float > PixelSize( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return The volume of the series.
+     * @brief Allocates the volume and decodes the slices into it in parallel, each task reading a group of
+     * consecutive slices.
+     * @warning none.
+     */
+    template< class D >
+    Image< D > Read( ) const;
+
+  };
+
+  /**
+   * @date 2026/Oct/18
+   * @param path: A directory with Dicom files, or a DICOMDIR file.
+   * @param series_uid: Series instance UID of the series to be loaded. If empty, the series with most slices is
+   * loaded.
+   * @return The volume of the series.
+   * @brief Reads a Dicom series as a volume, using the cached headers if the series was opened before.
+   * @warning none.
+   */
+  template< class D >
+  Image< D > ReadDicomSeries( const std::string &path, const std::string &series_uid = std::string( ) );
+
+}
+
+#include "DicomSeries.cpp"
+
+#endif
@@ -41,7 +41,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    DiffPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label,
+    DiffPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor,
+                      bool sequential_label,
                       const C< D > &handicap );
 
     /**
@@ -147,6 +147,43 @@ namespace Bial {
     static double Distance( const double *src, const double *tgt, const size_t dms ) {
       return( DERIVED::Distance( src, tgt, dms ) );
     }
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Source array.
+     * @param tgt: Block of target arrays, stored consecutively.
+     * @param tgt_size: Number of target arrays.
+     * @param dms: Number of dimensions
+     * @param dist: Distances from src to each target array.
+     * @return none.
+     * @brief Returns the distances from src to a block of target arrays. The distance function is resolved at
+     * compile time, so that the kernel is inlined and vectorized in the loop over targets.
+     * @warning dist must have tgt_size elements. Not checked!
+     */
+    template< class D >
+    static void Distances( const D *src, const D *tgt, const size_t tgt_size, const size_t dms, double *dist ) {
+      for( size_t row = 0; row < tgt_size; ++row )
+        dist[ row ] = DERIVED::template Distance< D >( src, tgt + row * dms, dms );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Source array.
+     * @param tgt: Target arrays, stored consecutively.
+     * @param rows: Indexes of the target arrays to be compared to src.
+     * @param tgt_size: Number of indexes in rows.
+     * @param dms: Number of dimensions
+     * @param dist: Distances from src to each indexed target array.
+     * @return none.
+     * @brief Returns the distances from src to the indexed target arrays.
+     * @warning dist must have tgt_size elements. Not checked!
+     */
+    template< class D >
+    static void Distances( const D *src, const D *tgt, const size_t *rows, const size_t tgt_size, const size_t dms,
+                           double *dist ) {
+      for( size_t row = 0; row < tgt_size; ++row )
+        dist[ row ] = DERIVED::template Distance< D >( src, tgt + rows[ row ] * dms, dms );
+    }
   };
 
 }
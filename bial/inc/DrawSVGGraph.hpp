@@ -45,7 +45,7 @@ namespace Bial {
    * @warning none.
    */
   template< class D >
-  void SVGDForest( const Image< D > &cost, const Image< int > &pred, const std::string &filename, 
+  void SVGDForest( const Image< D > &cost, const Image< bial_index > &pred, const std::string &filename, 
                    const Image< int > *label = nullptr );
 
 }
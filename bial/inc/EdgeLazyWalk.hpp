@@ -29,7 +29,7 @@ namespace Bial {
      * @warning none. 
      */
     template< class D >
-    std::tuple< Image< D >, Image< int > > LazyWalk( const Image< D > &img, const Vector< bool > &seed );
+    std::tuple< Image< D >, Image< bial_index > > LazyWalk( const Image< D > &img, const Vector< bool > &seed );
 
     /**
      * @date 2015/Jun/09 
@@ -41,8 +41,8 @@ namespace Bial {
      * @warning none. 
      */
     template< class D >
-    std::tuple< Image< D >, Image< int > > LazyWalk( const Image< D > &img, const Image< D > &msk,
-                                                     const Vector< bool > &seed );
+    std::tuple< Image< D >, Image< bial_index > > LazyWalk( const Image< D > &img, const Image< D > &msk,
+                                                            const Vector< bool > &seed );
 
   }
 
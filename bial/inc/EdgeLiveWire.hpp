@@ -31,7 +31,8 @@ namespace Bial {
      * @warning none. 
      */
     template< class D >
-    std::tuple< Image< D >, Image< int > > LiveWire( const Image< D > &img, const Vector< bool > &seed, float weight );
+    std::tuple< Image< D >, Image< bial_index > > LiveWire( const Image< D > &img, const Vector< bool > &seed,
+                                                            float weight );
 
     /**
      * @date 2015/Jun/23 
@@ -45,8 +46,8 @@ namespace Bial {
      * @warning none. 
      */
     template< class D >
-    std::tuple< Image< D >, Image< int > > LiveWire( const Image< D > &img, const Image< D > &msk, 
-                                                     const Vector< bool > &seed, float weight );
+    std::tuple< Image< D >, Image< bial_index > > LiveWire( const Image< D > &img, const Image< D > &msk, 
+                                                            const Vector< bool > &seed, float weight );
 
   }
 
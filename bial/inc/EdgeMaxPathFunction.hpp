@@ -43,7 +43,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    EdgeMaxPathFunction( Image< D > &init_value, Image< int > *init_label, Image< int > *init_predecessor, 
+    EdgeMaxPathFunction( Image< D > &init_value, Image< int > *init_label, Image< bial_index > *init_predecessor, 
                          bool sequential_label, const Image< D > &handicap, bool force_root = false );
 
     /**
@@ -88,6 +88,7 @@ namespace Bial {
   double EuclideanDistanceFunction::Distance( const D *src, const size_t dms ) {
     COMMENT( "Euclidean distance template.", 0 );
     double dist = 0.0;
+#pragma omp simd reduction( + : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
       dist += ( static_cast< double >( src[ ftr ] ) * src[ ftr ] );
     }
@@ -97,9 +98,10 @@ namespace Bial {
   template< class D >
   double EuclideanDistanceFunction::Distance( const D *src, const D *tgt, const size_t dms ) {
     double dist = 0.0;
+#pragma omp simd reduction( + : dist )
     for( size_t ftr = 0; ftr < dms; ++ftr ) {
-      dist += ( ( static_cast< double >( src[ ftr ] ) - static_cast< double >( tgt[ ftr ] ) ) *
-                ( static_cast< double >( src[ ftr ] ) - static_cast< double >( tgt[ ftr ] ) ) );
+      double diff = static_cast< double >( src[ ftr ] ) - static_cast< double >( tgt[ ftr ] );
+      dist += diff * diff;
     }
     return( std::sqrt( dist ) );
   }
@@ -0,0 +1,591 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Lazy element-wise arithmetic of Images and Matrices. Operators +, -, *, and / over images and matrices of
+ * arithmetic types, and over scalars, build expressions instead of images. An expression is evaluated in a single
+ * parallel pass when it is assigned to an image or matrix, or when it is reduced by Maximum or Minimum, with no
+ * intermediate buffers.
+ */
+
+#include "Common.hpp"
+
+#ifndef BIALEXPRESSION_H
+#define BIALEXPRESSION_H
+
+#include "Vector.hpp"
+#include <type_traits>
+
+namespace Bial {
+
+  template< class D >
+  class Image;
+  template< class D >
+  class Matrix;
+
+  /**
+   * @brief Element-wise operations of expressions. Each operation converts its result to the element type of the
+   * expression, as the eager compound operators do, so that lazy and eager evaluation give the same values. product
+   * is set for the operations that denote matrix products between matrices, which are not element-wise.
+   */
+  struct ExpressionAdd {
+    static const bool product = false;
+    template< class D, class L, class R >
+    static D Apply( L left, R right ) {
+      return( static_cast< D >( left + right ) );
+    }
+    template< class N >
+    static void Verify( const N & ) {
+    }
+  };
+
+  struct ExpressionSub {
+    static const bool product = false;
+    template< class D, class L, class R >
+    static D Apply( L left, R right ) {
+      return( static_cast< D >( left - right ) );
+    }
+    template< class N >
+    static void Verify( const N & ) {
+    }
+  };
+
+  struct ExpressionMul {
+    static const bool product = true;
+    template< class D, class L, class R >
+    static D Apply( L left, R right ) {
+      return( static_cast< D >( left * right ) );
+    }
+    template< class N >
+    static void Verify( const N & ) {
+    }
+  };
+
+  class ExpressionScalar;
+
+  struct ExpressionDiv {
+    static const bool product = true;
+    template< class D, class L, class R >
+    static D Apply( L left, R right ) {
+#ifdef BIAL_DEBUG
+      if( right == 0 ) {
+        std::string msg( BIAL_ERROR( "Division by zero." ) );
+        throw( std::logic_error( msg ) );
+      }
+#endif
+      return( static_cast< D >( left / right ) );
+    }
+    template< class N >
+    static void Verify( const N & ) {
+    }
+    static void Verify( const ExpressionScalar &scalar );
+  };
+
+  /** @brief Leaf of expressions: elements of an image or matrix. */
+  template< class D >
+  class ExpressionLeaf {
+  private:
+    const D *data;
+  public:
+    explicit ExpressionLeaf( const D *data ) : data( data ) {
+    }
+    D operator[]( size_t elm ) const {
+      return( data[ elm ] );
+    }
+  };
+
+  /** @brief Leaf of expressions: a scalar, taken as double, as in the eager scalar operators. */
+  class ExpressionScalar {
+  private:
+    double value;
+  public:
+    explicit ExpressionScalar( double value ) : value( value ) {
+    }
+    double operator[]( size_t ) const {
+      return( value );
+    }
+  };
+
+  inline void ExpressionDiv::Verify( const ExpressionScalar &scalar ) {
+    if( scalar[ 0 ] == 0.0 ) {
+      std::string msg( BIAL_ERROR( "Division by zero." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  /** @brief Operation O over the elements of nodes L and R, with result of type D. */
+  template< class D, class O, class L, class R >
+  class ExpressionNode {
+  private:
+    L left;
+    R right;
+  public:
+    ExpressionNode( const L &left, const R &right ) : left( left ), right( right ) {
+    }
+    D operator[]( size_t elm ) const {
+      return( O::template Apply< D >( left[ elm ], right[ elm ] ) );
+    }
+  };
+
+  /**
+   * @brief Element type of an image or matrix, and the error of operands of different dimensions, as thrown by the
+   * eager operators.
+   */
+  template< class C >
+  struct ExpressionValue;
+  template< class D >
+  struct ExpressionValue< Image< D > > {
+    typedef D Type;
+    static const char *Mismatch( ) {
+      return( " All images must have the same dimensions." );
+    }
+  };
+  template< class D >
+  struct ExpressionValue< Matrix< D > > {
+    typedef D Type;
+    static const char *Mismatch( ) {
+      return( "Matrix dimensions do not match." );
+    }
+  };
+
+  /**
+   * @brief Return type T of the eager operators of containers of type D, which are defined for non arithmetic types
+   * only, such as Color. Operators of arithmetic types are lazy.
+   */
+  template< class D, class T >
+  struct ExpressionEager : std::enable_if< !std::is_arithmetic< D >::value, T > {
+  };
+
+  /**
+   * @brief Lazy expression whose elements are computed by node E, with the dimensions of container C, which is an
+   * Image or a Matrix. Images and matrices are constructed and assigned from expressions, evaluating them in a single
+   * pass. Elements are converted to the type of the destination. Maximum and Minimum are computed without storing
+   * the elements.
+   * @warning Expressions keep references to their operands. They must be evaluated before the operands are
+   * destroyed or resized, so that they should not be stored by auto variables.
+   */
+  template< class C, class E >
+  class Expression {
+
+  private:
+
+    typedef typename ExpressionValue< C >::Type D;
+
+    /** @brief Minimum number of elements evaluated in parallel. */
+    static const size_t ParallelSize = 1 << 16;
+
+    const C *shape;
+    E node;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param shape: Image or matrix whose dimensions are those of the expression.
+     * @param node: Root node of the expression.
+     * @return none.
+     * @brief Basic constructor.
+     * @warning none.
+     */
+    Expression( const C &shape, const E &node ) : shape( &shape ), node( node ) {
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Image or matrix whose dimensions are those of the expression.
+     * @brief Returns the image or matrix whose dimensions are those of the expression.
+     * @warning none.
+     */
+    const C &Shape( ) const {
+      return( *shape );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Root node of the expression.
+     * @brief Returns the root node of the expression.
+     * @warning none.
+     */
+    const E &Node( ) const {
+      return( node );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Number of elements of the expression.
+     * @brief Returns the number of elements of the expression.
+     * @warning none.
+     */
+    size_t size( ) const {
+      return( shape->size( ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param dms: A dimension.
+     * @return Size of the given dimension.
+     * @brief Returns the size of the given dimension.
+     * @warning none.
+     */
+    size_t size( size_t dms ) const {
+      return( shape->size( dms ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Number of dimensions of the expression.
+     * @brief Returns the number of dimensions of the expression.
+     * @warning none.
+     */
+    size_t Dims( ) const {
+      return( shape->Dims( ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Vector with the size of each dimension.
+     * @brief Returns the size of each dimension of the expression.
+     * @warning none.
+     */
+    Vector< size_t > Dim( ) const {
+      return( shape->Dim( ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param elm: Index of an element.
+     * @return Value of the given element.
+     * @brief Computes a single element of the expression.
+     * @warning Index is not verified.
+     */
+    D operator[]( size_t elm ) const {
+      return( node[ elm ] );
+    }
+    D operator()( size_t elm ) const {
+      return( node[ elm ] );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: Output buffer with size( ) elements.
+     * @return none.
+     * @brief Computes all elements of the expression, converted to D2, into data. Large expressions are split among
+     * the threads of the global pool.
+     * @warning data may be the buffer of an operand, since each element is read before it is written.
+     */
+    template< class D2 >
+    void Evaluate( D2 *data ) const {
+      size_t elements = size( );
+      const E &root = node;
+      auto function = [ &root, data, elements ]( size_t tsk, size_t total_tasks ) {
+        size_t end = elements * ( tsk + 1 ) / total_tasks;
+        for( size_t elm = elements * tsk / total_tasks; elm < end; ++elm )
+          data[ elm ] = static_cast< D2 >( root[ elm ] );
+      };
+      if( elements < ParallelSize ) {
+        function( 0, 1 );
+        return;
+      }
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( elements ), function );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        function( 0, 1 );
+      }
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Maximum element of the expression.
+     * @brief Computes the maximum element of the expression, without storing the elements.
+     * @warning Expression must not be empty.
+     */
+    D Maximum( ) const {
+      return( Reduce( true ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @return Minimum element of the expression.
+     * @brief Computes the minimum element of the expression, without storing the elements.
+     * @warning Expression must not be empty.
+     */
+    D Minimum( ) const {
+      return( Reduce( false ) );
+    }
+
+  private:
+
+    /**
+     * @date 2026/Oct/18
+     * @param maximum: true for the maximum element, false for the minimum one.
+     * @return Maximum or minimum element of the expression.
+     * @brief Reduces each range of elements in a task, and then the results of the tasks.
+     * @warning Expression must not be empty.
+     */
+    D Reduce( bool maximum ) const {
+      size_t elements = size( );
+      if( elements == 0 ) {
+        std::string msg( BIAL_ERROR( "Empty expression." ) );
+        throw( std::logic_error( msg ) );
+      }
+      const E &root = node;
+      Vector< D > partial;
+      auto function = [ &root, &partial, elements, maximum ]( size_t tsk, size_t total_tasks ) {
+        size_t elm = elements * tsk / total_tasks;
+        size_t end = elements * ( tsk + 1 ) / total_tasks;
+        D res = root[ elm ];
+        if( maximum ) {
+          for( ++elm; elm < end; ++elm ) {
+            D value = root[ elm ];
+            res = value > res ? value : res;
+          }
+        }
+        else {
+          for( ++elm; elm < end; ++elm ) {
+            D value = root[ elm ];
+            res = value < res ? value : res;
+          }
+        }
+        partial[ tsk ] = res;
+      };
+      size_t total_tasks = 1;
+      if( elements >= ParallelSize ) {
+        try {
+          ThreadPool &pool = ThreadPool::Global( );
+          total_tasks = pool.Tasks( elements );
+          partial = Vector< D >( total_tasks );
+          pool.Run( total_tasks, function );
+        }
+        catch( std::exception &e ) {
+          BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+          total_tasks = 1;
+        }
+      }
+      if( total_tasks == 1 ) {
+        partial = Vector< D >( 1 );
+        function( 0, 1 );
+      }
+      D res = partial[ 0 ];
+      for( size_t tsk = 1; tsk < total_tasks; ++tsk )
+        res = maximum ? std::max( res, partial[ tsk ] ) : std::min( res, partial[ tsk ] );
+      return( res );
+    }
+
+  };
+
+  /**
+   * @date 2026/Oct/18
+   * @param first, second: Images, matrices or expressions.
+   * @return true if first and second have the same number of dimensions and the same size in each dimension.
+   * @brief Verifies if the dimensions of two operands match.
+   * @warning none.
+   */
+  template< class A, class B >
+  bool ExpressionSameDimensions( const A &first, const B &second ) {
+    if( ( first.size( ) != second.size( ) ) || ( first.Dims( ) != second.Dims( ) ) )
+      return( false );
+    for( size_t dms = 0; dms < first.Dims( ); ++dms ) {
+      if( first.size( dms ) != second.size( dms ) )
+        return( false );
+    }
+    return( true );
+  }
+
+  /**
+   * @brief Operands of expressions: images and matrices of arithmetic types, expressions and arithmetic scalars.
+   * Container is the image or matrix type of the operand, ExpressionScalar for scalars, and void for other types,
+   * which are not operands.
+   */
+  template< class T, class Enable = void >
+  struct ExpressionOperand {
+    typedef void Container;
+  };
+
+  template< class D >
+  struct ExpressionOperand< Image< D >, typename std::enable_if< std::is_arithmetic< D >::value >::type > {
+    typedef Image< D > Container;
+    typedef ExpressionLeaf< D > Node;
+    static Node Make( const Image< D > &img ) {
+      return( Node( img.Data( ) ) );
+    }
+    static const Container &Shape( const Image< D > &img ) {
+      return( img );
+    }
+  };
+
+  template< class D >
+  struct ExpressionOperand< Matrix< D >, typename std::enable_if< std::is_arithmetic< D >::value >::type > {
+    typedef Matrix< D > Container;
+    typedef ExpressionLeaf< D > Node;
+    static Node Make( const Matrix< D > &mtx ) {
+      return( Node( mtx.Data( ) ) );
+    }
+    static const Container &Shape( const Matrix< D > &mtx ) {
+      return( mtx );
+    }
+  };
+
+  template< class C, class E >
+  struct ExpressionOperand< Expression< C, E > > {
+    typedef C Container;
+    typedef E Node;
+    static Node Make( const Expression< C, E > &expr ) {
+      return( expr.Node( ) );
+    }
+    static const Container &Shape( const Expression< C, E > &expr ) {
+      return( expr.Shape( ) );
+    }
+  };
+
+  template< class S >
+  struct ExpressionOperand< S, typename std::enable_if< std::is_arithmetic< S >::value >::type > {
+    typedef ExpressionScalar Container;
+    typedef ExpressionScalar Node;
+    static Node Make( S scalar ) {
+      return( Node( static_cast< double >( scalar ) ) );
+    }
+  };
+
+  /**
+   * @brief Expression of type Type computing operation O over operands L and R, with the dimensions of container C.
+   * Make verifies the operands and builds the expression.
+   */
+  template< class O, class L, class R, class C >
+  struct ExpressionResult {
+    typedef ExpressionNode< typename ExpressionValue< C >::Type, O, typename ExpressionOperand< L >::Node,
+                            typename ExpressionOperand< R >::Node > Node;
+    typedef Expression< C, Node > Type;
+    static const bool left_shape = std::is_same< typename ExpressionOperand< L >::Container, C >::value;
+    static const bool right_array = !std::is_same< typename ExpressionOperand< R >::Container,
+                                                   ExpressionScalar >::value;
+
+    static const C &Shape( const L &left, const R &, std::true_type ) {
+      return( ExpressionOperand< L >::Shape( left ) );
+    }
+    static const C &Shape( const L &, const R &right, std::false_type ) {
+      return( ExpressionOperand< R >::Shape( right ) );
+    }
+    static bool SameDimensions( const C &shape, const R &right, std::true_type ) {
+      return( ExpressionSameDimensions( shape, ExpressionOperand< R >::Shape( right ) ) );
+    }
+    static bool SameDimensions( const C &, const R &, std::false_type ) {
+      return( true );
+    }
+
+    static Type Make( const L &left, const R &right ) {
+      const C &shape = Shape( left, right, std::integral_constant< bool, left_shape >( ) );
+      if( !SameDimensions( shape, right, std::integral_constant< bool, left_shape && right_array >( ) ) ) {
+        std::string msg( BIAL_ERROR( ExpressionValue< C >::Mismatch( ) ) );
+        throw( std::logic_error( msg ) );
+      }
+      typename ExpressionOperand< R >::Node right_node( ExpressionOperand< R >::Make( right ) );
+      O::Verify( right_node );
+      return( Type( shape, Node( ExpressionOperand< L >::Make( left ), right_node ) ) );
+    }
+  };
+
+  /**
+   * @brief Expression computing operation O over operands L and R, whose containers are LC and RC. Only defined for
+   * the supported combinations of operands: images of the same type, images and scalars, matrices of any types under
+   * element-wise operations, and matrices and scalars on the right side, as the eager operators were.
+   */
+  template< class O, class L, class R, class LC = typename ExpressionOperand< L >::Container,
+            class RC = typename ExpressionOperand< R >::Container, class Enable = void >
+  struct ExpressionBinary {
+  };
+
+  template< class O, class L, class R, class D >
+  struct ExpressionBinary< O, L, R, Image< D >, Image< D > > : ExpressionResult< O, L, R, Image< D > > {
+  };
+
+  template< class O, class L, class R, class D >
+  struct ExpressionBinary< O, L, R, Image< D >, ExpressionScalar > : ExpressionResult< O, L, R, Image< D > > {
+  };
+
+  template< class O, class L, class R, class D >
+  struct ExpressionBinary< O, L, R, ExpressionScalar, Image< D > > : ExpressionResult< O, L, R, Image< D > > {
+  };
+
+  template< class O, class L, class R, class D, class D2 >
+  struct ExpressionBinary< O, L, R, Matrix< D >, Matrix< D2 >, typename std::enable_if< !O::product >::type > :
+    ExpressionResult< O, L, R, Matrix< D > > {
+  };
+
+  template< class O, class L, class R, class D >
+  struct ExpressionBinary< O, L, R, Matrix< D >, ExpressionScalar > : ExpressionResult< O, L, R, Matrix< D > > {
+  };
+
+  /**
+   * @date 2026/Oct/18
+   * @param left, right: Images, matrices, expressions or scalars.
+   * @return Lazy expression of the element-wise sum, difference, product or quotient of the operands.
+   * @brief Builds the expression of the operation. The result is computed when the expression is assigned to an
+   * image or a matrix.
+   * @warning Operands must have the same dimensions. Scalar divisors must not be zero. The expression keeps
+   * pointers to the data of its image and matrix operands, so that it must be assigned to an image or matrix within
+   * the statement that builds it. Storing it, as in auto e = a + b * 2;, leaves e pointing to operands that may be
+   * destroyed or resized before it is evaluated, such as temporaries.
+   */
+  template< class L, class R >
+  typename ExpressionBinary< ExpressionAdd, L, R >::Type operator+( const L &left, const R &right ) {
+    return( ExpressionBinary< ExpressionAdd, L, R >::Make( left, right ) );
+  }
+  template< class L, class R >
+  typename ExpressionBinary< ExpressionSub, L, R >::Type operator-( const L &left, const R &right ) {
+    return( ExpressionBinary< ExpressionSub, L, R >::Make( left, right ) );
+  }
+  template< class L, class R >
+  typename ExpressionBinary< ExpressionMul, L, R >::Type operator*( const L &left, const R &right ) {
+    return( ExpressionBinary< ExpressionMul, L, R >::Make( left, right ) );
+  }
+  template< class L, class R >
+  typename ExpressionBinary< ExpressionDiv, L, R >::Type operator/( const L &left, const R &right ) {
+    return( ExpressionBinary< ExpressionDiv, L, R >::Make( left, right ) );
+  }
+
+  /**
+   * @date 2026/Oct/18
+   * @param dst: Image or matrix.
+   * @param expr: Expression with the dimensions of dst.
+   * @return Reference to dst.
+   * @brief Computes the operation between dst and the expression, element by element, and assigns the result to
+   * dst, in a single pass. Between matrices, *= and /= are matrix products, so that they are defined for images only.
+   * @warning none.
+   */
+  template< class C, class O, class E >
+  C &ExpressionAssign( C &dst, const Expression< C, E > &expr ) {
+    if( !ExpressionSameDimensions( dst, expr ) ) {
+      std::string msg( BIAL_ERROR( ExpressionValue< C >::Mismatch( ) ) );
+      throw( std::logic_error( msg ) );
+    }
+    typedef typename ExpressionValue< C >::Type D;
+    Expression< C, ExpressionNode< D, O, ExpressionLeaf< D >, E > >
+    res( dst, ExpressionNode< D, O, ExpressionLeaf< D >, E >( ExpressionLeaf< D >( dst.Data( ) ), expr.Node( ) ) );
+    res.Evaluate( dst.Data( ) );
+    return( dst );
+  }
+  template< class C, class E >
+  C &operator+=( C &dst, const Expression< C, E > &expr ) {
+    return( ExpressionAssign< C, ExpressionAdd >( dst, expr ) );
+  }
+  template< class C, class E >
+  C &operator-=( C &dst, const Expression< C, E > &expr ) {
+    return( ExpressionAssign< C, ExpressionSub >( dst, expr ) );
+  }
+  template< class D, class E >
+  Image< D > &operator*=( Image< D > &dst, const Expression< Image< D >, E > &expr ) {
+    return( ExpressionAssign< Image< D >, ExpressionMul >( dst, expr ) );
+  }
+  template< class D, class E >
+  Image< D > &operator/=( Image< D > &dst, const Expression< Image< D >, E > &expr ) {
+    return( ExpressionAssign< Image< D >, ExpressionDiv >( dst, expr ) );
+  }
+
+}
+
+#endif
@@ -105,6 +105,123 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  inline size_t FastIncreasingFifoBucketQueue::Index( ldbl value ) {
+    return( static_cast< size_t >( value - minimum ) );
+  }
+
+  inline void FastIncreasingFifoBucketQueue::Insert( size_t idt, ldbl wgt ) {
+    COMMENT( "Current amount of elements prior to insertion: " << this->elements, 3 );
+    COMMENT( "Inserting element: " << idt << ", with weight: " << wgt << ".", 4 );
+    // Trocar esse if por um if condicional de debug.
+    IF_DEBUG( ( this->identity( idt ).state == BucketState::INSERTED ) || 
+        ( this->identity( idt ).state == BucketState::UPDATED ) ) {
+      std::string msg( BIAL_ERROR( "Inserting element that is already in queue." ) );
+      throw( std::logic_error( msg ) );
+    }
+    size_t weight_idx = static_cast< size_t >( wgt - minimum );
+    COMMENT( "Inserting! elements: " << this->elements << ", idt: " << idt << ", minimum: " << minimum << 
+             ", maximum: " << maximum << ", weight_idx: " << weight_idx << ", wgt: " << wgt << ", first: " <<
+             this->weight( weight_idx ).first  << ", last: " << this->weight( weight_idx ).last, 3 );
+    ++( this->elements );
+    if( this->weight( weight_idx ).first == -1 ) {
+      COMMENT( "First element in bucket.", 4 );
+      this->weight( weight_idx ).first = idt;
+      this->identity( idt ).prev = -1;
+    }
+    else {
+      COMMENT( "Middle element in bucket.", 4 );
+      this->identity( this->weight( weight_idx ).last ).next = idt;
+      this->identity( idt ).prev = this->weight( weight_idx ).last;
+    }
+    this->weight( weight_idx ).last = idt;
+    this->identity( idt ).next = -1;
+    if( current > weight_idx )
+      current = weight_idx;
+    this->identity( idt ).state = BucketState::INSERTED;
+  }
+
+  inline size_t FastIncreasingFifoBucketQueue::Remove( ) {
+    COMMENT( "Current amount of elements prior to removal: " << this->elements, 3 );
+    COMMENT( "Check if queue is initialized.", 4 );
+    // Trocar if por if debug.
+    // if( this->elements == 0 ) {
+    //   std::string msg( BIAL_ERROR( "Removing element from empty queue." ) );
+    //   throw( std::underflow_error( msg ) );
+    // }
+    COMMENT( "Removing! elements: " << this->elements << ", minimum: " << minimum << ", maximum: " << maximum, 3 );
+    COMMENT( "Finding next element or returning EMPTY bucket queue.", 4 );
+    COMMENT( "Testing weight index: " << current, 3 );
+    while( this->weight( current ).first == -1 )
+      ++current;
+    COMMENT( "Found index: " << current, 3 );
+    --this->elements;
+    bial_index idt = this->weight( current ).first;
+    bial_index next = this->identity( idt ).next;
+    COMMENT( "Removing idt: " << idt << ", weight_idx: " << current << ", prev: " << 
+             this->identity( idt ).prev << ", next:" << next, 3 );
+    this->weight( current ).first = next;
+    if( next == -1 )
+      this->weight( current ).last = -1;
+    else
+      this->identity( next ).prev = -1;
+    COMMENT( "Remove done.", 3 );
+    return( idt );
+  }
+
+  inline void FastIncreasingFifoBucketQueue::Remove( size_t idt, ldbl wgt ) {
+    COMMENT( "Current amount of elements prior to index removal: " << this->elements, 3 );
+    COMMENT( "Check if queue is initialized.", 4 );
+    if( this->elements == 0 ) {
+      return;
+    }
+    COMMENT( "Removing element " << idt << " with weight " << wgt << ".", 3 );
+    size_t weight_idx = static_cast< size_t >( wgt - minimum );
+    bial_index prev = this->identity( idt ).prev;
+    bial_index next = this->identity( idt ).next;
+    COMMENT( "Removing for update! elements: " << this->elements << ", minimum: " << minimum << ", maximum: " <<
+             maximum << ", idt: " << idt << ", wgt: " << wgt << ", weight_idx: " << weight_idx << ", previous: " <<
+             prev << ", next:" << next << ", first: " << this->weight( weight_idx ).first, 3 );
+    --( this->elements );
+    if( this->weight( weight_idx ).first == static_cast< bial_index >( idt ) ) {
+      COMMENT( "idt is the first element.", 4 );
+      this->weight( weight_idx ).first = next;
+      if( next == -1 ) {
+        COMMENT( "Idt is also the last one.", 4 );
+        this->weight( weight_idx ).last = -1;
+      }
+      else
+        this->identity( next ).prev = -1;
+    }
+    else {
+      COMMENT( "idt is in the middle or it is the last.", 4 );
+      this->identity( prev ).next = next;
+      if( next == -1 ) {
+        COMMENT( "idt is the last element.", 4 );
+        this->weight( weight_idx ).last = prev;
+      }
+      else {
+        COMMENT( "idt in the middle.", 4 );
+        this->identity( next ).prev = prev;
+      }
+    }
+  }
+
+  inline void FastIncreasingFifoBucketQueue::Update( size_t idt, ldbl cur_wgt, ldbl new_wgt ) {
+    if( ( this->identity( idt ).state == BucketState::INSERTED ) || 
+        ( this->identity( idt ).state == BucketState::UPDATED ) ) {
+      COMMENT( "Updating element: " << idt << " from " << cur_wgt << " to " << new_wgt << ".", 3 );
+      Remove( idt, cur_wgt );
+    }
+    else {
+      COMMENT( "Inserting element: " << idt << " with weight: " << new_wgt << ".", 3 );
+    }
+    this->identity( idt ).state = BucketState::REMOVED;
+    Insert( idt, new_wgt );
+    this->identity( idt ).state = BucketState::UPDATED;
+  }
+
 }
 
 #include "FastIncreasingFifoBucketQueue.cpp"
@@ -58,6 +58,20 @@ namespace Bial {
      */
     Feature( size_t elements, size_t features );
 
+    /**
+     * @date 2026/Oct/18
+     * @param new_feature: Features of each element in a line of the matrix. Its data, which may be owned elsewhere,
+     * as a memory mapped file, is adopted by the Feature.
+     * @param new_index: Index of each element.
+     * @param new_label: Label of each element.
+     * @param new_labels: Number of different labels.
+     * @return none.
+     * @brief Constructor from data already loaded, with no copies.
+     * @warning new_index and new_label must have one entry per line of new_feature.
+     */
+    Feature( Matrix< D > &&new_feature, Vector< size_t > &&new_index, Vector< int > &&new_label,
+             size_t new_labels );
+
     /**
      * @date 2014/Oct/22 
      * @param feat: Base feature vector for sampling. 
@@ -41,7 +41,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    FeatureDistanceFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+    FeatureDistanceFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, 
                              bool sequential_label, const Feature< D > &new_feats );
 
     /**
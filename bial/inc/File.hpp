@@ -191,6 +191,15 @@ namespace Bial {
      */
     bool IsGziped( );
 
+    /**
+     * @date 2026/Oct/18 
+     * @param bytes: Buffer size in bytes. 
+     * @return none. 
+     * @brief Sets the size of the gzip decompression buffer. Unread data are kept in the new buffer. 
+     * @warning none. 
+     */
+    void BufferSize( size_t bytes );
+
   };
 
   /* Functions: std::istream non-member functions for IFile 
@@ -290,6 +299,15 @@ namespace Bial {
      */
     bool IsGziped( );
 
+    /**
+     * @date 2026/Oct/18 
+     * @param bytes: Buffer size in bytes. 
+     * @return none. 
+     * @brief Sets the size of the gzip compression block. Pending data are compressed first. 
+     * @warning none. 
+     */
+    void BufferSize( size_t bytes );
+
   };
 
   /* Non-member std::ostream functions definition for OFile */
@@ -300,6 +318,62 @@ namespace Bial {
   OFile &operator<<( OFile &file, const signed char *s );
   OFile &operator<<( OFile &file, const unsigned char *s );
 
+  /**
+   * @brief Read-only file mapped into memory. Pages are loaded on demand, so files larger than the available memory
+   * may be accessed. Mapping is private: writing to the mapped data does not change the file, and only the written
+   * pages are copied to memory.
+   */
+  class MappedFile {
+
+  private:
+
+    char *_data;
+    size_t _size;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param filename: Name of the file to be mapped.
+     * @return none.
+     * @brief Maps the whole file into memory.
+     * @warning Compressed files are mapped as they are stored.
+     */
+    explicit MappedFile( const std::string &filename );
+    MappedFile( const MappedFile &other ) = delete;
+    MappedFile &operator=( const MappedFile &other ) = delete;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Unmaps the file. Data pointers become invalid.
+     * @warning none.
+     */
+    ~MappedFile( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Pointer to the first byte of the file, or file size.
+     * @brief Access to mapped data.
+     * @warning none.
+     */
+    char *data( );
+    const char *data( ) const;
+    size_t size( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return true if the platform supports memory mapped files.
+     * @brief Verifies if files may be mapped into memory.
+     * @warning none.
+     */
+    static bool Supported( );
+
+  };
+
   class File {
   public:
 
@@ -16,24 +16,76 @@
 
 namespace Bial {
 
+  /** @brief Type of the feature values stored in a binary feature file. */
+  enum class FeatureType : uint32_t {
+    INT32 = 1, INT64 = 2, FLOAT32 = 3, FLOAT64 = 4
+  };
+
   namespace FileFeature {
 
+    /** @brief Version of the binary feature format written by Write to .bft files. */
+    const uint32_t VERSION = 1;
+    /** @brief Size in bytes of the header of binary feature files. */
+    const size_t HEADER_SIZE = 64;
+
+    /**
+     * @brief Contents of the header of a feature file. Binary feature files store, after the header, the feature
+     * matrix with the features of each element in sequence, the indexes as 64 bit integers, aligned to 8 bytes, and
+     * the labels as 32 bit integers, all in the byte order of the machine that wrote them. Legacy OPF files store,
+     * after a 12 byte header, a record with index, label and features, as 32 bit floats, for each element.
+     */
+    struct Header {
+      /** @brief Format version. Zero for legacy OPF files. */
+      uint32_t version;
+      /** @brief Type of the stored feature values. FLOAT32 for legacy OPF files. */
+      FeatureType type;
+      /** @brief Number of elements, features and different labels. */
+      size_t elements;
+      size_t features;
+      size_t labels;
+    };
+
+    /**
+     * @date 2026/Oct/18
+     * @param filename: Name of input file. It may be gzip compressed.
+     * @return The header of the file.
+     * @brief Reads the header of a binary or legacy OPF feature file, so that its elements may be loaded in
+     * ranges.
+     * @warning none.
+     */
+    Header ReadHeader( const std::string &filename );
+
     /**
      * @date 2014/Oct/21 
-     * @param filename: Name of input file with .opf extension. 
+     * @param filename: Name of input file, in binary or legacy OPF format. It may be gzip compressed.
      * @return A feature vector. 
-     * @brief Reads data from file and initializes a Feature vector with it. 
+     * @brief Reads data from file and initializes a Feature vector with it. Uncompressed binary files with the
+     * same value type of the Feature are mapped into memory and adopted by the Feature, so that pages are loaded on
+     * demand. Other files are loaded with one read per block of data.
      * @warning none. 
      */
     template< class D >
     Feature< D > Read( const std::string &filename );
 
+    /**
+     * @date 2026/Oct/18
+     * @param filename: Name of input file, in binary or legacy OPF format. It may be gzip compressed.
+     * @param first: First element to be loaded.
+     * @param elements: Number of elements to be loaded.
+     * @return A feature vector with the elements in range [ first, first + elements ).
+     * @brief Reads a range of elements from file, so that large feature sets may be processed in chunks.
+     * @warning Compressed files are decompressed up to the end of the range.
+     */
+    template< class D >
+    Feature< D > Read( const std::string &filename, size_t first, size_t elements );
+
     /**
      * @date 2014/Oct/21 
-     * @param filename: Name of input file with .opf extension. 
+     * @param filename: Name of output file. Files with .bft extension are written in binary feature format, and other
+     * files in legacy OPF format. Files with .gz extension are compressed.
      * @return none. 
-     * @brief Writes data to file. 
-     * @warning none. 
+     * @brief Writes data to file, with one write per block of data.
+     * @warning Legacy OPF format stores values as 32 bit floats.
      */
     template< class D >
     void Write( const Feature< D > &feat, const std::string &filename );
@@ -15,6 +15,7 @@
 namespace Bial {
 
   class NiftiHeader;
+  enum class NiftiType : short;
   template< class D >
   class Image;
 
@@ -28,6 +29,46 @@ namespace Bial {
   template< class D >
   static Image< D > ReadNifti( const std::string &filename );
 
+  /** @brief Size of the buffer used to read and convert compressed Nifti data. */
+  static const size_t NIFTI_CHUNK_BYTES = 1 << 20;
+
+  /**
+   * @date 2026/Oct/18
+   * @param type: Data type in file.
+   * @param src: Data read from file. Need not be aligned.
+   * @param size: Number of elements.
+   * @param swap: Whether to swap the bytes of each element.
+   * @param tgt: Converted data.
+   * @return none.
+   * @brief Swaps bytes and converts Nifti data to image type in a single pass. Non-finite values become zero.
+   * @warning none.
+   */
+  template< class D >
+  static void NiftiConvertData( NiftiType type, const char *src, size_t size, bool swap, D *tgt );
+
+  /**
+   * @date 2026/Oct/18
+   * @param data: Image data.
+   * @param size: Number of elements.
+   * @return none.
+   * @brief Replaces non-finite values by zero. Only changed elements are written, so that mapped pages are not
+   * copied needlessly.
+   * @warning none.
+   */
+  template< class D >
+  static void NiftiScrubData( D *data, size_t size );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Image read from Nifti file.
+   * @param hdr: Nifti header.
+   * @return Image with data scaling of the header applied.
+   * @brief Applies header slope and intercept. Returns img itself if scaling is identity.
+   * @warning img is moved into the result.
+   */
+  template< class D >
+  static Image< D > NiftiScaleData( Image< D > &img, const NiftiHeader &hdr );
+
   /**
    * @date 2012/Jul/03
    * @param img: input image.
@@ -48,9 +89,78 @@ namespace Bial {
 #include "ColorRGB.hpp"
 #include "File.hpp"
 #include "NiftiHeader.hpp"
+#include <cstdint>
+#include <type_traits>
 
 namespace Bial {
 
+  template< class T, class D >
+  void NiftiConvertData( const char *src, size_t size, bool swap, D *tgt ) {
+    for( size_t elm = 0; elm < size; ++elm ) {
+      T value;
+      std::memcpy( &value, src + elm * sizeof( T ), sizeof( T ) );
+      if( swap ) {
+        char *bytes = reinterpret_cast< char* >( &value );
+        std::reverse( bytes, bytes + sizeof( T ) );
+      }
+      if( ( !std::is_integral< T >::value ) && ( !std::isfinite( static_cast< double >( value ) ) ) )
+        tgt[ elm ] = 0;
+      else
+        tgt[ elm ] = static_cast< D >( value );
+    }
+  }
+
+  template< class D >
+  void NiftiConvertData( NiftiType type, const char *src, size_t size, bool swap, D *tgt ) {
+    switch( type ) {
+    case NiftiType::INT32:
+      NiftiConvertData< int >( src, size, swap, tgt );
+      break;
+    case NiftiType::UINT32:
+      NiftiConvertData< unsigned int >( src, size, swap, tgt );
+      break;
+    case NiftiType::INT16:
+      NiftiConvertData< short >( src, size, swap, tgt );
+      break;
+    case NiftiType::UINT16:
+      NiftiConvertData< unsigned short >( src, size, swap, tgt );
+      break;
+    case NiftiType::INT8:
+      NiftiConvertData< char >( src, size, swap, tgt );
+      break;
+    case NiftiType::UINT8:
+      NiftiConvertData< unsigned char >( src, size, swap, tgt );
+      break;
+    case NiftiType::FLOAT32:
+      NiftiConvertData< float >( src, size, swap, tgt );
+      break;
+    case NiftiType::FLOAT64:
+      NiftiConvertData< double >( src, size, swap, tgt );
+      break;
+    default: {
+      std::string msg( BIAL_ERROR( "Unsupported nifti data type." ) );
+      throw( std::logic_error( msg ) );
+    }
+    }
+  }
+
+  template< class D >
+  void NiftiScrubData( D *data, size_t size ) {
+    if( std::is_integral< D >::value )
+      return;
+    for( size_t elm = 0; elm < size; ++elm ) {
+      if( !std::isfinite( static_cast< double >( data[ elm ] ) ) )
+        data[ elm ] = 0;
+    }
+  }
+
+  template< class D >
+  Image< D > NiftiScaleData( Image< D > &img, const NiftiHeader &hdr ) {
+    if( ( hdr.SclSlope( ) > 0.0001 ) && ( ( hdr.SclSlope( ) != 1.0 ) || ( hdr.SclInter( ) != 0.0 ) ) )
+      return( img * hdr.SclSlope( ) + hdr.SclInter( ) );
+    return( std::move( img ) );
+  }
+
   template< >
   Image< Color > ReadNifti( const std::string &filename ) {
     try {
@@ -261,127 +371,83 @@ namespace Bial {
         Image< Color > color_img( ReadNifti< Color >( filename ) );
         return( ColorSpace::ARGBtoGraybyBrightness< D >( color_img ) );
       }
-      Image< D > res( spc_dims, pixel_size );
-      size_t img_size = res.size( );
-      COMMENT( "Getting filename and opening it.", 2 );
+      size_t img_size = 1;
+      for( size_t dms = 0; dms < spc_dims.size( ); ++dms )
+        img_size *= spc_dims[ dms ];
+      COMMENT( "Getting filename.", 2 );
       std::string imgname( NiftiHeader::ExistingDataFileName( filename ) );
       COMMENT( "Image name: " << imgname, 2 );
       std::string extension( File::ToLowerExtension
                              ( filename, static_cast< size_t >
                                ( std::max( 0, static_cast< int >( filename.size( ) ) - 8 ) ) ) );
+      size_t offset = 0;
+      if( extension.rfind( ".nii" ) != std::string::npos )
+        offset = NiftiHeader::NIFTI_HEADER_SIZE + 4u;
+      size_t single_bytes = hdr.BitPix( ) / 8;
+      size_t total_bytes = single_bytes * img_size;
+      bool swap = NiftiHeader::IsSwapped( filename ) && ( single_bytes > 1 );
+      COMMENT( "Is swapped??????????? " << swap, 1 );
+      bool direct = ( !swap ) && ( sizeof( D ) == single_bytes ) &&
+        ( ( std::is_same< D, int >::value && ( hdr.DataType( ) == NiftiType::INT32 ) ) ||
+          ( std::is_same< D, float >::value && ( hdr.DataType( ) == NiftiType::FLOAT32 ) ) ||
+          ( std::is_same< D, double >::value && ( hdr.DataType( ) == NiftiType::FLOAT64 ) ) );
+      std::string data_extension( File::ToLowerExtension( imgname ) );
+      if( ( data_extension.rfind( ".gz" ) == std::string::npos ) && MappedFile::Supported( ) ) {
+        COMMENT( "Uncompressed file. Mapping it into memory.", 0 );
+        std::shared_ptr< MappedFile > mapping( std::make_shared< MappedFile >( imgname ) );
+        if( mapping->size( ) < offset + total_bytes ) {
+          std::string msg( BIAL_ERROR( "Nifti file is shorter than its data. File: " + imgname ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        char *src = mapping->data( ) + offset;
+        if( direct && ( reinterpret_cast< uintptr_t >( src ) % alignof( D ) == 0 ) ) {
+          COMMENT( "Same data type in file and image. Image adopts the mapped data.", 1 );
+          Image< D > res( reinterpret_cast< D* >( src ), spc_dims, mapping );
+          res.PixelSize( pixel_size );
+          NiftiScrubData( res.data( ), img_size );
+          return( NiftiScaleData( res, hdr ) );
+        }
+        COMMENT( "Converting mapped data to image type.", 1 );
+        Image< D > res( spc_dims, pixel_size );
+        NiftiConvertData( hdr.DataType( ), src, img_size, swap, res.data( ) );
+        return( NiftiScaleData( res, hdr ) );
+      }
+      COMMENT( "Compressed file, or mapping not supported. Opening it.", 2 );
+      Image< D > res( spc_dims, pixel_size );
       IFile file;
       file.exceptions( std::ios::eofbit | std::ios::failbit | std::ios::badbit | std::ios::goodbit );
       file.open( imgname );
       COMMENT( "Seeking to the appropriate read position.", 2 );
-      size_t offset;
-      if( extension.rfind( ".nii" ) != std::string::npos ) {
-        offset = NiftiHeader::NIFTI_HEADER_SIZE + 4u;
+      if( offset > 0 )
         file.ignore( offset );
-      }
       COMMENT( "Reading data.", 0 );
-      size_t single_bytes = hdr.BitPix( ) / 8;
-      size_t total_bytes = single_bytes * img_size;
-      char *dataptr = new char[ total_bytes ];
-      file.read( &( dataptr[ 0 ] ), total_bytes ); /* data input */
-      if( ( !file.good( ) ) || file.eof( ) || file.fail( ) || file.bad( ) ) {
+      if( direct ) {
+        COMMENT( "Same data type in file and image. Reading straight into image buffer.", 1 );
+        file.read( reinterpret_cast< char* >( res.data( ) ), total_bytes );
+        if( ( !file.good( ) ) || file.eof( ) || file.fail( ) || file.bad( ) ) {
+          file.close( );
+          std::string msg( BIAL_ERROR( "Error opening/reading Nifti file." ) );
+          throw( std::ios_base::failure( msg ) );
+        }
         file.close( );
-        std::string msg( BIAL_ERROR( "Error opening/reading Nifti file." ) );
-        throw( std::ios_base::failure( msg ) );
+        NiftiScrubData( res.data( ), img_size );
+        return( NiftiScaleData( res, hdr ) );
+      }
+      COMMENT( "Reading and converting data in chunks, so that the file is never entirely in memory.", 1 );
+      size_t chunk_elements = std::max( static_cast< size_t >( 1 ), NIFTI_CHUNK_BYTES / single_bytes );
+      Vector< char > chunk( chunk_elements * single_bytes );
+      for( size_t first = 0; first < img_size; first += chunk_elements ) {
+        size_t elements = std::min( chunk_elements, img_size - first );
+        file.read( chunk.data( ), elements * single_bytes );
+        if( ( !file.good( ) ) || file.eof( ) || file.fail( ) || file.bad( ) ) {
+          file.close( );
+          std::string msg( BIAL_ERROR( "Error opening/reading Nifti file." ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        NiftiConvertData( hdr.DataType( ), chunk.data( ), elements, swap, res.data( ) + first );
       }
       file.close( );
-
-      bool swap = NiftiHeader::IsSwapped( filename );
-      COMMENT( "Is swapped??????????? " << swap, 1 );
-      if( ( swap == true ) && ( single_bytes > 1 ) ) {
-        COMMENT( "Byte swap array if needed.", 1 );
-        NiftiHeader::SwapNBytes( img_size, single_bytes, dataptr );
-      }
-      COMMENT( "Data type conversion.", 2 );
-      switch( hdr.DataType( ) ) {
-      case NiftiType::INT32: {
-        COMMENT( "Int 32.", 1 );
-        int *data = reinterpret_cast< int* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::UINT32: {
-        COMMENT( "UInt 32.", 1 );
-        unsigned int *data = reinterpret_cast< unsigned int* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::INT16: {
-        COMMENT( "Int 16.", 1 );
-        short *data = reinterpret_cast< short* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::UINT16: {
-        COMMENT( "UInt 16.", 1 );
-        unsigned short *data = reinterpret_cast< unsigned short* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::INT8: {
-        COMMENT( "Int 8.", 1 );
-        char *data = reinterpret_cast< char* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::UINT8: {
-        COMMENT( "UInt 8.", 1 );
-        unsigned char *data = reinterpret_cast< unsigned char* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          res( p ) = static_cast< D >( data[ p ] );
-        }
-        break;
-      }
-      case NiftiType::FLOAT32: {
-        COMMENT( "Flt 32.", 1 );
-        float *data = reinterpret_cast< float* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          if( !std::isfinite( data[ p ] ) ) {
-            res( p ) = 0;
-          }
-          else {
-            res( p ) = static_cast< D >( data[ p ] );
-          }
-        }
-        break;
-      }
-      case NiftiType::FLOAT64: {
-        COMMENT( "Flt 64.", 1 );
-        double *data = reinterpret_cast< double* >( dataptr );
-        for( size_t p = 0; p < img_size; ++p ) {
-          if( !std::isfinite( data[ p ] ) ) {
-            res( p ) = 0;
-          }
-          else {
-            res( p ) = static_cast< D >( data[ p ] );
-          }
-        }
-        break;
-      }
-      default: {
-        delete[]( reinterpret_cast< unsigned char* >( dataptr ) );
-        std::string msg( BIAL_ERROR( "Unsupported nifti data type." ) );
-        throw( std::logic_error( msg ) );
-      }
-      }
-      delete[] ( reinterpret_cast< unsigned char* >( dataptr ) );
-      if( hdr.SclSlope( ) > 0.0001 )
-        res = res * hdr.SclSlope( ) + hdr.SclInter( );
-      return( res );
+      return( NiftiScaleData( res, hdr ) );
     }
     catch( std::ios_base::failure &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error opening/reading/closing Nifti file." ) );
@@ -499,7 +565,7 @@ namespace Bial {
         COMMENT( "Converting data to nifti format.", 2 );
         Vector< float > write_data( img_size );
         for( size_t pxl = 0; pxl < img_size; ++pxl ) {
-          write_data[ pxl ] = static_cast< int >( slc_img( pxl ) );
+          write_data[ pxl ] = static_cast< float >( slc_img( pxl ) );
         }
         COMMENT( "Writing data.", 2 );
         file.write( reinterpret_cast< char* >( &write_data[ 0 ] ), write_data.size( ) * sizeof( float ) );
@@ -509,7 +575,7 @@ namespace Bial {
         COMMENT( "Converting data to nifti format.", 2 );
         Vector< double > write_data( img_size );
         for( size_t pxl = 0; pxl < img_size; ++pxl ) {
-          write_data[ pxl ] = static_cast< int >( slc_img( pxl ) );
+          write_data[ pxl ] = static_cast< double >( slc_img( pxl ) );
         }
         COMMENT( "Writing data.", 2 );
         file.write( reinterpret_cast< char* >( &write_data[ 0 ] ), write_data.size( ) * sizeof( double ) );
@@ -45,6 +45,7 @@ namespace Bial {
 #include "ColorRGB.hpp"
 #include "File.hpp"
 #include "Image.hpp"
+#include <type_traits>
 
 namespace Bial {
 
@@ -95,6 +96,10 @@ namespace Bial {
           }
           delete[] data16;
         }
+        else if( ( type == 32 ) && ( std::is_same< D, int >::value ) ) {
+          COMMENT( "Reading 32 bit integer data straight into image buffer.", 2 );
+          file.read( reinterpret_cast< char* >( res.data( ) ), sizeof( int ) * img_size );
+        }
         else if( type == 32 ) {
           COMMENT( "Reading 32 bit integer data.", 2 );
           int *data32;
@@ -105,6 +110,10 @@ namespace Bial {
           }
           delete[] data32;
         }
+        else if( std::is_same< D, float >::value ) { /* if( type == 64 ) */
+          COMMENT( "Reading 32 bit float data straight into image buffer.", 2 );
+          file.read( reinterpret_cast< char* >( res.data( ) ), sizeof( float ) * img_size );
+        }
         else { /* if( type == 64 ) */
           COMMENT( "Reading 32 bit float data.", 2 );
           float *fdata32;
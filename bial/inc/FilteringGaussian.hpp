@@ -16,20 +16,65 @@ namespace Bial {
 
   template< class D >
   class Image;
+  template< class D >
+  class Vector;
 
   namespace Filtering {
 
     /**
      * @date 2013/Nov/22 
      * @param img: Input image. 
-     * @param neighborhood_radius: radius of the neighborhood. 
-     * @return Median filtered image with the given radius. 
-     * @brief Returns the median filtered image with the given radius. 
-     * @warning none. 
+     * @param radius: radius of the kernel. 
+     * @param std_dev: standard deviation of the Gaussian. 
+     * @return Gaussian filtered image. 
+     * @brief Returns the Gaussian filtered image. The kernel is separable, so it is applied as one 1D correlation
+     * per dimension, with integer displacements up to radius. 
+     * @warning The kernel support is the box with side 2 * radius + 1, not the hypersphere of
+     * KernelType::Gaussian. Use Correlation with KernelType::Gaussian for the spherical support. Out of image
+     * elements are ignored, as in Correlation. 
      */
     template< class D >
     Image< D > Gaussian( const Image< D > &img, float radius = 2.0, float std_dev = 2.0 );
 
+    /**
+     * @date 2026/Oct/18 
+     * @param img: Input image. 
+     * @param std_dev: standard deviation of the Gaussian. Must be at least 0.5. 
+     * @return Gaussian filtered image. 
+     * @brief Returns the Gaussian filtered image computed by the recursive filter of Young and van Vliet, with a
+     * forward and a backward third order pass per dimension. The cost does not depend on std_dev. 
+     * @warning The filter approximates a normalized Gaussian of infinite support. Image borders are extended
+     * with the border values. 
+     */
+    template< class D >
+    Image< D > RecursiveGaussian( const Image< D > &img, float std_dev = 2.0 );
+
+    /**
+     * @date 2026/Oct/18 
+     * @param data: Image values. Filtered in place. 
+     * @param dim_size: Size of each dimension of the image. 
+     * @param dim: Dimension to be filtered. 
+     * @param weights: 1D kernel weights, from -radius to radius. 
+     * @return none. 
+     * @brief Correlates all lines of dimension dim with the given 1D kernel. Out of image elements are ignored. 
+     * @warning none. 
+     */
+    void GaussianPass( Vector< double > &data, const Vector< size_t > &dim_size, size_t dim,
+                       const Vector< double > &weights );
+
+    /**
+     * @date 2026/Oct/18 
+     * @param data: Image values. Filtered in place. 
+     * @param dim_size: Size of each dimension of the image. 
+     * @param dim: Dimension to be filtered. 
+     * @param std_dev: standard deviation of the Gaussian. 
+     * @return none. 
+     * @brief Runs the forward and backward recursive Gaussian filters over all lines of dimension dim. 
+     * @warning none. 
+     */
+    void RecursiveGaussianPass( Vector< double > &data, const Vector< size_t > &dim_size, size_t dim,
+                                float std_dev );
+
   }
 
 }
@@ -36,15 +36,19 @@ namespace Bial {
      * @param img: Input image. 
      * @param adj: Adjacency relation. 
      * @param res: Resulting image. 
+     * @param minimum: Minimum value of img. 
+     * @param maximum: Maximum value of img. 
      * @param thread: number of the thread. 
      * @param total_threads: total number of threads. 
      * @return none. 
-     * @brief Multi-thread implementation of the median filtered image with the given radius. 
+     * @brief Multi-thread implementation of the median filtered image with the given radius. Each thread slides a
+     * window along its rows, updating a histogram of values for integer images with short range, or a sorted
+     * buffer otherwise. 
      * @warning none. 
      */
     template< class D >
-    void MedianThreads( const Image< D > &img, const Adjacency &adj, Image< D > &res, size_t thread,
-                        size_t total_threads );
+    void MedianThreads( const Image< D > &img, const Adjacency &adj, Image< D > &res, D minimum, D maximum,
+                        size_t thread, size_t total_threads );
     
   }
 
@@ -23,8 +23,12 @@ namespace Bial {
    * @param img: Input image over which FFT or IFFT is applied.
    * @param forward_transform: true for foward transform and false for the inverse.
    * @return The transformed image.
-   * @brief Computes the forward or inverse 2D-FFT over the input image.
-   * @warning none
+   * @brief Computes the forward or inverse 2D or 3D FFT over the input image. Images of any dimensions are
+   * transformed with no padding, so the result has the dimensions of the input image. The inverse transform is
+   * scaled by the inverse of the number of pixels.
+   * @warning Up to 2026/Oct/18, images were zero padded to power of 2 dimensions and the result had the padded
+   * dimensions. Callers that need them must call ZeroPad first. Centering the spectrum by multiplying the input by
+   * ( -1 )^( x + y + z ) only works for even dimensions. Use FFTShift instead.
    */
   Image< bial_complex > FFT( const Image< bial_complex > &img, bool forward_transform = true );
 
@@ -32,18 +36,60 @@ namespace Bial {
    * @date 2017/Mar/28
    * @param aux: An input row, column, or depth of the image data.
    * @param forward_transform: true for foward transform and false for the inverse.
-   * @return true if transform was executed successfully.
-   * @brief Auxiliar function to computes the forward or inverse FFT over the input image inplace.
+   * @return none.
+   * @brief Auxiliar function to computes the forward or inverse FFT over the input vector inplace. Vectors of any
+   * size are transformed by the cached FourierPlan of their size.
    * @warning none
    */
   void FFT( Vector< bial_complex > &aux, bool forward_transform );
 
+  /**
+   * @date 2026/Oct/18
+   * @param data: Image data. Returns its transform along dimension dms.
+   * @param dim_size: Size of each of the three image dimensions.
+   * @param dms: Dimension to be transformed.
+   * @param forward_transform: true for foward transform and false for the inverse.
+   * @param scale: Factor applied to the transformed values.
+   * @return none.
+   * @brief Computes the FFT of all image lines along dimension dms, in parallel. Lines along dimension 0 are
+   * transformed in place. Lines along the other dimensions are copied in blocks of 16 adjacent lines, so that
+   * reading and writing them goes through whole cache lines.
+   * @warning none
+   */
+  void FFTDimension( bial_complex *data, const Vector< size_t > &dim_size, size_t dms, bool forward_transform,
+                     double scale = 1.0 );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Input real image.
+   * @return Half of the FFT of the input image. Dimension 0 has size( 0 ) / 2 + 1 elements. The other elements are
+   * the complex conjugates of these ones.
+   * @brief Computes the forward FFT of a real image. Pairs of rows are transformed as the real and imaginary parts
+   * of a single complex row and split afterwards, so that the first dimension costs half of a complex transform and
+   * the other dimensions are computed over half of the image.
+   * @warning none
+   */
+  template< class D >
+  Image< bial_complex > RealFFT( const Image< D > &img );
+
+  /**
+   * @date 2026/Oct/18
+   * @param spectrum: Half of the FFT of a real image, as computed by RealFFT.
+   * @param res: Image with the dimensions of the real image. Returns the inverse FFT of spectrum, scaled by the
+   * inverse of the number of pixels. Integer images are rounded to the nearest value.
+   * @return none.
+   * @brief Computes the inverse FFT of the spectrum of a real image.
+   * @warning Dimension 0 of spectrum must have res.size( 0 ) / 2 + 1 elements. The others must match res.
+   */
+  template< class D >
+  void InverseRealFFT( const Image< bial_complex > &spectrum, Image< D > &res );
+
   /**
    * @date 2017/Mar/28
    * @param img: Input image.
    * @return The centralized zero padded image.
    * @brief Pads zeros and centralizes the input image to the closests larger power of 2 dimension sizes.
-   * @warning none
+   * @warning FFT no longer requires power of 2 dimensions.
    */
   template< class D >
   Image< D > ZeroPad( const Image< D > &img );
@@ -58,6 +104,19 @@ namespace Bial {
    */
   template< class D >
   void ZeroUnPad( const Image< D > &src_img, Image< D > &tgt_img );
+
+  /**
+   * @date 2026/Oct/18
+   * @param img: Input image.
+   * @param forward: true to move the origin to the center, and false to move it back.
+   * @return The circularly shifted image.
+   * @brief Circularly shifts each dimension by half of its size, so that the zero frequency of a spectrum computed
+   * by FFT is moved to pixel size / 2 of each dimension. The backward shift undoes the forward one, also for odd
+   * sizes.
+   * @warning none
+   */
+  template< class D >
+  Image< D > FFTShift( const Image< D > &img, bool forward = true );
   
 }
 
@@ -0,0 +1,134 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Precomputed one dimensional discrete Fourier transform of any length.
+ * <br> Future add-on's: none.
+ */
+
+#include "Common.hpp"
+#include "Vector.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+
+#ifndef BIALFOURIERPLAN_H
+#define BIALFOURIERPLAN_H
+
+namespace Bial {
+
+  /**
+   * @brief Plan of the discrete Fourier transform of a given length. Lengths whose prime factors are small are
+   * computed by a mixed-radix Stockham algorithm, with butterflies for radices 2, 3, 4 and 5, and a generic one for
+   * other primes up to MaxRadix. Other lengths are computed by the Bluestein algorithm, as a convolution computed
+   * by a power of two transform. Twiddle factors are computed once, when the plan is created. Plans are read-only
+   * afterwards, so that a single plan is shared by all threads, each one with its own work buffer. Plans are cached
+   * by Plan( length ), up to MaxPlans lengths.
+   */
+  class FourierPlan {
+
+  private:
+
+    /** @brief Largest prime factor computed by the mixed-radix algorithm. */
+    static const size_t MaxRadix = 61;
+    /** @brief Number of cached lengths above which unused plans are released. */
+    static const size_t MaxPlans = 64;
+    /** @brief Plans cached by length, and their lock. */
+    static std::map< size_t, std::shared_ptr< const FourierPlan > > cache;
+    static std::mutex cache_mutex;
+
+    size_t length;
+    /** @brief Radix of each step of the mixed-radix algorithm. */
+    Vector< size_t > radix;
+    /** @brief exp( -2 pi i k / length ), for k in [ 0, length ). */
+    Vector< bial_complex > twiddle;
+    /** @brief Bluestein chirp exp( -pi i k^2 / length ), for k in [ 0, length ). */
+    Vector< bial_complex > chirp;
+    /** @brief Transform of the conjugate chirp, wrapped around the power of two length. */
+    Vector< bial_complex > chirp_spectrum;
+    /** @brief Power of two plan of Bluestein convolution. */
+    std::shared_ptr< const FourierPlan > convolution;
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Input sequence.
+     * @param dst: Output sequence. Different from src.
+     * @return Pointer to the transformed sequence, either src or dst.
+     * @brief Forward mixed-radix transform. src and dst are used as ping-pong buffers.
+     * @warning none.
+     */
+    bial_complex *Stockham( bial_complex *src, bial_complex *dst ) const;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param length: Length of the transform.
+     * @return none.
+     * @brief Basic constructor. Factors the length and computes the twiddle factors.
+     * @warning Length must be positive.
+     */
+    explicit FourierPlan( size_t length );
+
+    /**
+     * @date 2026/Oct/18
+     * @param length: Length of the transform.
+     * @return Shared plan of the given length.
+     * @brief Returns the cached plan of the given length, creating it on first use. Thread safe.
+     * @warning none.
+     */
+    static std::shared_ptr< const FourierPlan > Plan( size_t length );
+
+    /**
+     * @date 2026/Oct/18
+     * @return none.
+     * @brief Releases all cached plans. Plans in use remain valid until their last user releases them. Thread safe.
+     * @warning none.
+     */
+    static void ClearPlans( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param length: Minimum length.
+     * @return The smallest length not smaller than the given one whose prime factors are 2, 3 or 5.
+     * @brief Returns a length with a fast transform, to pad sequences to.
+     * @warning none.
+     */
+    static size_t FastLength( size_t length );
+
+    /**
+     * @date 2026/Oct/18
+     * @return Length of the transform.
+     * @brief Returns the length of the transform.
+     * @warning none.
+     */
+    size_t size( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @return Number of elements of the work buffer of Transform.
+     * @brief Returns the number of elements of the work buffer of Transform.
+     * @warning none.
+     */
+    size_t WorkSize( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: Sequence of size( ) elements. Returns its transform.
+     * @param work: Work buffer of WorkSize( ) elements.
+     * @param forward_transform: true for forward transform and false for the inverse.
+     * @return none.
+     * @brief Computes the forward or inverse transform of data, in place.
+     * @warning The inverse transform is not scaled by 1 / size( ).
+     */
+    void Transform( bial_complex *data, bial_complex *work, bool forward_transform = true ) const;
+
+  };
+
+}
+
+#include "FourierPlan.cpp"
+
+#endif
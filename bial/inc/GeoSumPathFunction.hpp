@@ -11,14 +11,13 @@
 #ifndef BIALGEOSUMPATHFUNCTION_H
 #define BIALGEOSUMPATHFUNCTION_H
 
+#include "BucketQueueElements.hpp"
 #include "Common.hpp"
 #include "Image.hpp"
 #include "PathFunction.hpp"
 
 namespace Bial {
 
-  enum class BucketState : char;
-
   template< class D >
   class GeodesicRestrictionPathFunction : public PathFunction< Image, D > {
 
@@ -67,7 +66,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    GeodesicRestrictionPathFunction( Image< D > &init_value, Image< int > *init_label, Image< int > *init_predecessor, 
+    GeodesicRestrictionPathFunction( Image< D > &init_value, Image< int > *init_label,
+                                     Image< bial_index > *init_predecessor,
                                      bool sequential_label, const Image< D > &handicap, const Image< D > &new_intensity,
                                      const Adjacency &adj, double new_alpha = 0.0, double new_beta = 0.5 );
 
@@ -177,6 +177,121 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::RemoveSimple( size_t, BucketState ) {
+    return( true );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::RemovePredecessor( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->predecessor->operator()( index ) = -1;
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::RemoveLabel( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->label->operator()( index ) = this->next_label;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::RemoveComplete( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->label->operator()( index ) = this->next_label;
+      this->predecessor->operator()( index ) = -1;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
+    return( ( adj_state != BucketState::REMOVED ) &&
+            ( this->value->operator()( index ) < this->value->operator()( adj_index ) ) );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::PropagateDifferential( size_t index, size_t adj_index,
+                                                                           size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    COMMENT( "Computing arc weight.", 3 );
+    double arc_weight = handicap( index ) + handicap( adj_index );
+    COMMENT( "Orienting edges.", 3 );
+    double fraction = 0;
+    // if( intensity[ index ] > intensity[ adj_index ] )
+    //   fraction = std::abs( alpha );
+    // else if( intensity[ index ] < intensity[ adj_index ] )
+    //   fraction = -std::abs( alpha );
+    // if( alpha < 0.0 )
+    //   fraction = -fraction;
+    if( ( intensity[ index ] - intensity[ adj_index ] ) * alpha >= 0.0 )
+      fraction = std::abs( alpha );
+    else
+      fraction = -std::abs( alpha );
+    arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
+    COMMENT( "Suppressing non-zero.", 3 );
+    ++arc_weight;
+    COMMENT( "Computing spacial distance.", 3 );
+    double distance = dists( adj_pos );
+    COMMENT( "Propagated value.", 3 );
+    D prp_value = static_cast< D >( this->value->operator()( index ) + std::pow( arc_weight, beta )
+                                    - 1.0 + distance );
+    COMMENT( "Updating value.", 3 );
+    if( ( src_value > prp_value ) ||
+        ( ( this->predecessor->operator()( adj_index ) == static_cast< bial_index >( index ) ) &&
+          ( this->label->operator()( adj_index ) != this->label->operator()( index ) ) ) ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
+  template< class D >
+  inline bool GeodesicRestrictionPathFunction< D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    COMMENT( "Computing arc weight.", 3 );
+    double arc_weight = handicap( index ) + handicap( adj_index );
+    COMMENT( "Orienting edges.", 3 );
+    double fraction = 0;
+    // if( intensity[ index ] > intensity[ adj_index ] ) {
+    //   fraction = std::abs( alpha );
+    // }
+    // else if( intensity[ index ] < intensity[ adj_index ] ) {
+    //   fraction = -std::abs( alpha );
+    // }
+    // if( alpha < 0.0 ) {
+    //   fraction = -fraction;
+    // }
+    double tmp = ( intensity[ index ] - intensity[ adj_index ] ) * alpha;
+    if( tmp > 0.0 )
+      fraction = std::abs( alpha );
+    else if( tmp < 0.0 )
+      fraction = -std::abs( alpha );
+    arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
+    COMMENT( "Suppressing non-zero.", 3 );
+    ++arc_weight;
+    COMMENT( "Computing spacial distance.", 3 );
+    double distance = dists( adj_pos );
+    COMMENT( "Propagated value.", 3 );
+    D prp_value = static_cast< D >( this->value->operator()( index ) + std::pow( arc_weight, beta )
+                                    - 1.0 + distance );
+    COMMENT( "Updating value.", 3 );
+    if( src_value > prp_value ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
 }
 
 #include "GeoSumPathFunction.cpp"
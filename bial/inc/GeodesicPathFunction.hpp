@@ -46,7 +46,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    GeodesicDistancePathFunction( Image< D > &init_value, Image< int > *init_label, Image< int > *init_predecessor,
+    GeodesicDistancePathFunction( Image< D > &init_value, Image< int > *init_label,
+                                  Image< bial_index > *init_predecessor,
                                   bool sequential_label, const Adjacency &adj, const Image< D > &handicap );
 
     /**
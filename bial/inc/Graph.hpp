@@ -8,6 +8,7 @@
  */
 
 #include "Common.hpp"
+#include "Matrix.hpp"
 #include "Sample.hpp"
 #include "Vector.hpp"
 
@@ -32,6 +33,20 @@ namespace Bial {
     Vector< size_t > ordered;
     Vector< int > label;
     GRAPH_ADJACENCY adjacency;
+    /** @brief Normalized cut of each scale in the last ScaleSweep. */
+    Vector< double > scale_cut;
+    /** @brief Seconds spent in each scale of the last ScaleSweep. (scale, 0: PDF and clustering, 1: cut). */
+    Matrix< double > scale_time;
+
+    /**
+     * @date 2026/Oct/18 
+     * @param scl: Number of scale element. 
+     * @param order_samples: Whether to sort the samples by their clustering value, as required by PropagateLabel. 
+     * @return The number of clusters. 
+     * @brief Computes cluster labels for spectral domain. 
+     * @warning none. 
+     */
+    size_t Clustering( size_t scl, bool order_samples );
 
   public:
 
@@ -118,6 +133,37 @@ namespace Bial {
      */
     double NormalizedCut( size_t spl ) const;
 
+    /**
+     * @date 2026/Oct/18 
+     * @param none. 
+     * @return The scale of minimum normalized cut. 
+     * @brief Clusters the graph at every scale, in increasing order, and returns the scale of minimum normalized
+     * cut. Same result as calling Clustering and NormalizedCut at each scale, but reusing the kmax adjacency of the
+     * graph, skipping the sorting of samples that only PropagateLabel requires, and computing cut weights in
+     * parallel. Cuts and times of each scale are kept in ScaleCut and ScaleTime. Labels are left as those of the
+     * last scale. 
+     * @warning none. 
+     */
+    size_t ScaleSweep( );
+
+    /**
+     * @date 2026/Oct/18 
+     * @param none. 
+     * @return The normalized cut of each scale in the last ScaleSweep. 
+     * @brief Returns the normalized cut of each scale in the last ScaleSweep. 
+     * @warning none. 
+     */
+    const Vector< double > &ScaleCut( ) const;
+
+    /**
+     * @date 2026/Oct/18 
+     * @param none. 
+     * @return Seconds spent in each scale of the last ScaleSweep, with columns for PDF and clustering, and for cut. 
+     * @brief Returns the time spent in each scale of the last ScaleSweep. 
+     * @warning none. 
+     */
+    const Matrix< double > &ScaleTime( ) const;
+
     /**
      * @date 2014/Nov/11 
      * @param label: the labels of the samples to be considered. 
@@ -143,8 +189,8 @@ namespace Bial {
      * @param feature: Feature vector. 
      * @param scl: Number of scale element. 
      * @return none. 
-     * @brief Propagates labels from subsample to samples. Just an interface to call multi-thread, GPU based or
-     * other more specialized methods. 
+     * @brief Propagates labels from subsample to samples. Subsamples are searched by an OPFClassifier, in
+     * parallel. 
      * @warning none. 
      */
     template< class D >
@@ -158,7 +204,8 @@ namespace Bial {
      * @param thread: Thread number. 
      * @param total_threads: Number of threads. 
      * @return none. 
-     * @brief Propagates labels from subsample to samples. 
+     * @brief Propagates labels from subsample to samples, scanning the subsamples in order for every sample. 
+     * Reference for PropagateLabel, which gives the same labels. 
      * @warning none. 
      */
     template< class D >
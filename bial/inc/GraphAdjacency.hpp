@@ -117,6 +117,16 @@ namespace Bial {
      */
     virtual bool ValidNeighbor( size_t src, size_t scl, double distance ) const = 0;
 
+    /**
+     * @date 2026/Oct/18 
+     * @param src: sample index. 
+     * @param scl: Number of scale element. 
+     * @return Radius of src region of influence. 
+     * @brief Returns the largest distance for which ValidNeighbor is true. 
+     * @warning none. 
+     */
+    virtual double Radius( size_t src, size_t scl ) const = 0;
+
   };
 
 }
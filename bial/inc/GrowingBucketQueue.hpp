@@ -120,6 +120,106 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  inline size_t GrowingBucketQueue::Index( ldbl value ) {
+    return( static_cast< size_t >( value / delta ) % weight_size );
+  }
+
+  inline size_t GrowingBucketQueue::Remove( ) {
+    COMMENT( "Current amount of elements prior to removal: " << this->elements, 3 );
+    COMMENT( "Check if queue is initialized.", 4 );
+    if( this->elements == 0 ) {
+      std::string msg( BIAL_ERROR( "Removing element from empty queue." ) );
+      throw( std::underflow_error( msg ) );
+    }
+    COMMENT( "Removing! elements: " << this->elements << ", minimum: " << minimum << ", maximum: " << maximum, 3 );
+    COMMENT( "Finding next element or returning EMPTY bucket queue.", 4 );
+    size_t current_weight;
+    if( increasing ) {
+      current_weight = Index( minimum );
+      COMMENT( "Testing weight index: " << current_weight, 3 );
+      while( this->weight( current_weight ).first == -1 ) {
+        minimum += delta;
+        current_weight = Index( minimum );
+      }
+    }
+    else {
+      current_weight = Index( maximum );
+      COMMENT( "Testing weight index: " << current_weight, 3 );
+      while( this->weight( current_weight ).first == -1 ) {
+        maximum -= delta;
+        current_weight = Index( maximum );
+      }
+    }
+    COMMENT( "Found index: " << current_weight, 3 );
+    --this->elements;
+    bial_index idt = this->weight( current_weight ).first;
+    bial_index next = this->identity( idt ).next;
+    COMMENT( "Removing idt: " << idt << ", weight_idx: " << current_weight << ", prev: " << 
+             this->identity( idt ).prev << ", next:" << next, 3 );
+    this->weight( current_weight ).first = next;
+    if( next == -1 )
+      this->weight( current_weight ).last = -1;
+    else
+      this->identity( next ).prev = -1;
+    COMMENT( "Remove done.", 3 );
+    return( idt );
+  }
+
+  inline void GrowingBucketQueue::Remove( size_t idt, ldbl wgt ) {
+    COMMENT( "Current amount of elements prior to index removal: " << this->elements, 3 );
+    COMMENT( "Check if queue is initialized.", 4 );
+    if( this->elements == 0 ) {
+      return;
+    }
+    COMMENT( "Removing element " << idt << " with weight " << wgt << ".", 3 );
+    size_t weight_idx = Index( wgt );
+    bial_index prev = this->identity( idt ).prev;
+    bial_index next = this->identity( idt ).next;
+    COMMENT( "Removing for update! elements: " << this->elements << ", minimum: " << minimum << ", maximum: " <<
+             maximum << ", idt: " << idt << ", wgt: " << wgt << ", weight_idx: " << weight_idx << ", previous: " <<
+             prev << ", next:" << next << ", first: " << this->weight( weight_idx ).first, 3 );
+    --( this->elements );
+    if( this->weight( weight_idx ).first == static_cast< bial_index >( idt ) ) {
+      COMMENT( "idt is the first element.", 4 );
+      this->weight( weight_idx ).first = next;
+      if( next == -1 ) {
+        COMMENT( "Idt is also the last one.", 4 );
+        this->weight( weight_idx ).last = -1;
+      }
+      else {
+        this->identity( next ).prev = -1;
+      }
+    }
+    else {
+      COMMENT( "idt is in the middle or it is the last.", 4 );
+      this->identity( prev ).next = next;
+      if( next == -1 ) {
+        COMMENT( "idt is the last element.", 4 );
+        this->weight( weight_idx ).last = prev;
+      }
+      else {
+        COMMENT( "idt in the middle.", 4 );
+        this->identity( next ).prev = prev;
+      }
+    }
+  }
+
+  inline void GrowingBucketQueue::Update( size_t idt, ldbl cur_wgt, ldbl new_wgt ) {
+    if( ( this->identity( idt ).state == BucketState::INSERTED ) || 
+        ( this->identity( idt ).state == BucketState::UPDATED ) ) {
+      COMMENT( "Updating element: " << idt << " from " << cur_wgt << " to " << new_wgt << ".", 3 );
+      Remove( idt, cur_wgt );
+    }
+    else {
+      COMMENT( "Inserting element: " << idt << " with weight: " << new_wgt << ".", 3 );
+    }
+    this->identity( idt ).state = BucketState::REMOVED;
+    Insert( idt, new_wgt );
+    this->identity( idt ).state = BucketState::UPDATED;
+  }
+
 }
 
 #include "GrowingBucketQueue.cpp"
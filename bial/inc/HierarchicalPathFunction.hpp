@@ -47,7 +47,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    HierarchicalPathFunction( C< D > &init_value, C< int > &init_label, C< int > *init_predecessor,
+    HierarchicalPathFunction( C< D > &init_value, C< int > &init_label, C< bial_index > *init_predecessor,
                               bool sequential_label, const C< D > &handicap, C< int > *merge_label, 
                               C< int > *split_label );
 
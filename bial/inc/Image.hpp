@@ -9,6 +9,7 @@
 
 #include "Array.hpp"
 #include "Common.hpp"
+#include "Expression.hpp"
 #include "Matrix.hpp"
 #include "PNMHeader.hpp"
 #include "Vector.hpp"
@@ -52,6 +53,11 @@ namespace Bial {
      * @brief Pointer to y_table element in the case of 3D image access by coordinates.
      */
     D ***z_table;
+    /**
+     * @brief Owner of data allocated elsewhere, such as a memory mapped file. Released with the last image
+     * wrapping the data. Empty if the image owns its data or if the data is not managed.
+     */
+    std::shared_ptr< void > owner;
     // /**
     //  * @brief Global index of a y coordinate.
     //  */
@@ -102,15 +108,17 @@ namespace Bial {
      * @date 2015/Set/10
      * @param new_data: Pointer to data allocated elsewhere.
      * @param new_dim: Image dimensions.
+     * @param new_owner: Owner of new_data, kept alive while the image wraps it. Empty if data is not managed.
      * @return none.
      * @brief Basic Constructor. Two to four dimensions. This constructor works as a wrapper for data already 
      * allocated. It will use the same space pointed by new_data to manipulate the image. Use this for compatibility
      * with other data structures, in a easy convertion to Image class.
-     * @warning Data is not deallocated automatcally, since it may be stored in the stack. Also, DO NOT USE this 
-     * constructure in Verbose or Debug compilation mode, as it will try to access invalid memory positions. Just
-     * compile without any Verbosity or Debug flags.
+     * @warning Data is not deallocated automatcally, since it may be stored in the stack, unless new_owner is
+     * given. Also, DO NOT USE this constructure in Verbose or Debug compilation mode, as it will try to access
+     * invalid memory positions. Just compile without any Verbosity or Debug flags.
      */
-    Image( D *new_data, const Vector< size_t > &new_dim );
+    Image( D *new_data, const Vector< size_t > &new_dim,
+           const std::shared_ptr< void > &new_owner = std::shared_ptr< void >( ) );
 
     /**
      * @date 2013/Jun/21
@@ -192,6 +200,19 @@ namespace Bial {
      */
     Image( Image< D > &&img );
 
+    /**
+     * @date 2026/Oct/18
+     * @param expr: Lazy expression over images.
+     * @return none.
+     * @brief Constructor from an expression, evaluated in a single pass. The dimensions and pixel size are those of
+     * the expression. Conversion from expressions of other types is explicit.
+     * @warning none.
+     */
+    template< class E >
+    Image( const Expression< Image< D >, E > &expr );
+    template< class D2, class E >
+    explicit Image( const Expression< Image< D2 >, E > &expr );
+
     /*
      * @date 2014/Oct/12
      * @param none.
@@ -241,6 +262,16 @@ namespace Bial {
     template< class D2 >
     Image< D > &operator=( const Image< D2 > &other );
 
+    /**
+     * @date 2026/Oct/18
+     * @param expr: Lazy expression over images.
+     * @return Reference to this image.
+     * @brief Evaluates the expression into a new buffer, which is assigned to this image.
+     * @warning none.
+     */
+    template< class D2, class E >
+    Image< D > &operator=( const Expression< Image< D2 >, E > &expr );
+
     /**
      * @date 2014/Apr/08
      * @param p: a global index to be acessed.
@@ -352,10 +383,11 @@ namespace Bial {
      * @date 2014/Apr/10
      * @param none.
      * @return iterator begin() of data.
-     * @brief Returns iterator begin() of data.
+     * @brief Returns iterator begin() of data. Iterators are pointers, so that they are valid for images that wrap
+     * mapped or external data, as the ones read by ReadNifti.
      * @warning none.
      */
-    typename std::vector< D >::iterator begin( ) noexcept;
+    D* begin( ) noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -364,7 +396,7 @@ namespace Bial {
      * @brief Returns const_iterator begin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator begin( ) const noexcept;
+    const D* begin( ) const noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -373,7 +405,7 @@ namespace Bial {
      * @brief Returns iterator end() of data.
      * @warning none.
      */
-    typename std::vector< D >::iterator end( ) noexcept;
+    D* end( ) noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -382,7 +414,7 @@ namespace Bial {
      * @brief Returns const_iterator end() of data.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator end( ) const noexcept;
+    const D* end( ) const noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -391,7 +423,7 @@ namespace Bial {
      * @brief Returns the iterator rbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::reverse_iterator rbegin( ) noexcept;
+    std::reverse_iterator< D* > rbegin( ) noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -400,7 +432,7 @@ namespace Bial {
      * @brief Returns const_iterator rbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator rbegin( ) const noexcept;
+    std::reverse_iterator< const D* > rbegin( ) const noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -409,7 +441,7 @@ namespace Bial {
      * @brief Returns iterator rend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::reverse_iterator rend( ) noexcept;
+    std::reverse_iterator< D* > rend( ) noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -418,7 +450,7 @@ namespace Bial {
      * @brief Returns const_iterator rend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator rend( ) const noexcept;
+    std::reverse_iterator< const D* > rend( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -427,7 +459,7 @@ namespace Bial {
      * @brief Returns the iterator cbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator cbegin( ) const noexcept;
+    const D* cbegin( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -436,7 +468,7 @@ namespace Bial {
      * @brief Returns the iterator cend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator cend( ) const noexcept;
+    const D* cend( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -445,7 +477,7 @@ namespace Bial {
      * @brief Returns the iterator crbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator crbegin( ) const noexcept;
+    std::reverse_iterator< const D* > crbegin( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -454,7 +486,7 @@ namespace Bial {
      * @brief Returns the iterator crend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator crend( ) const noexcept;
+    std::reverse_iterator< const D* > crend( ) const noexcept;
 
     /**
      * @date 2014/Apr/10
@@ -922,6 +954,10 @@ namespace Bial {
   template< class D, class O >
   O &operator<<( O &os, const Image< D > &img );
 
+  /* Eager arithmetic operators, defined for images of non arithmetic types, such as Color. Operators over images of
+   * arithmetic types build lazy expressions, declared in Expression.hpp. Compound operators are defined for all
+   * types. */
+
   /**
    * @date 2012/Jul/02
    * @param img1, img2: Input images.
@@ -930,7 +966,7 @@ namespace Bial {
    * @warning Images must have the same dimensions.
    */
   template< class D >
-  Image< D > operator+( const Image< D > &img1, const Image< D > &img2 );
+  typename ExpressionEager< D, Image< D > >::type operator+( const Image< D > &img1, const Image< D > &img2 );
 
   /**
    * @date 2012/Jul/02
@@ -950,7 +986,7 @@ namespace Bial {
    * @warning Images must have the same dimensions.
    */
   template< class D >
-  Image< D > operator-( const Image< D > &img1, const Image< D > &img2 );
+  typename ExpressionEager< D, Image< D > >::type operator-( const Image< D > &img1, const Image< D > &img2 );
 
   /**
    * @date 2012/Jul/02
@@ -970,7 +1006,7 @@ namespace Bial {
    * @warning Images must have the same dimensions.
    */
   template< class D >
-  Image< D > operator*( const Image< D > &img1, const Image< D > &img2 );
+  typename ExpressionEager< D, Image< D > >::type operator*( const Image< D > &img1, const Image< D > &img2 );
 
   /**
    * @date 2012/Jul/02
@@ -990,7 +1026,7 @@ namespace Bial {
    * @warning Images must have the same dimensions.
    */
   template< class D >
-  Image< D > operator/( const Image< D > &img1, const Image< D > &img2 );
+  typename ExpressionEager< D, Image< D > >::type operator/( const Image< D > &img1, const Image< D > &img2 );
 
   /**
    * @date 2012/Jul/02
@@ -1011,9 +1047,9 @@ namespace Bial {
    * @warning none.
    */
   template< class D >
-  Image< D > operator+( const Image< D > &img, double scalar );
+  typename ExpressionEager< D, Image< D > >::type operator+( const Image< D > &img, double scalar );
   template< class D >
-  Image< D > operator+( double scalar, const Image< D > &img );
+  typename ExpressionEager< D, Image< D > >::type operator+( double scalar, const Image< D > &img );
 
   /**
    * @date 2012/Jul/02
@@ -1035,9 +1071,9 @@ namespace Bial {
    * @warning none.
    */
   template< class D >
-  Image< D > operator-( const Image< D > &img, double scalar );
+  typename ExpressionEager< D, Image< D > >::type operator-( const Image< D > &img, double scalar );
   template< class D >
-  Image< D > operator-( double scalar, const Image< D > &img );
+  typename ExpressionEager< D, Image< D > >::type operator-( double scalar, const Image< D > &img );
 
   /**
    * @date 2012/Jul/02
@@ -1059,9 +1095,9 @@ namespace Bial {
    * @warning none.
    */
   template< class D >
-  Image< D > operator*( const Image< D > &img, double scalar );
+  typename ExpressionEager< D, Image< D > >::type operator*( const Image< D > &img, double scalar );
   template< class D >
-  Image< D > operator*( double scalar, const Image< D > &img );
+  typename ExpressionEager< D, Image< D > >::type operator*( double scalar, const Image< D > &img );
 
   /**
    * @date 2012/Jul/02
@@ -1083,9 +1119,9 @@ namespace Bial {
    * @warning none.
    */
   template< class D >
-  Image< D > operator/( const Image< D > &img, double scalar );
+  typename ExpressionEager< D, Image< D > >::type operator/( const Image< D > &img, double scalar );
   template< class D >
-  Image< D > operator/( double scalar, const Image< D > &img );
+  typename ExpressionEager< D, Image< D > >::type operator/( double scalar, const Image< D > &img );
 
   /**
    * @date 2012/Jul/02
@@ -1114,6 +1150,23 @@ namespace Bial {
 
 namespace Bial {
 
+  template< class D > template< class E >
+  Image< D >::Image( const Expression< Image< D >, E > &expr ) :
+    Image( expr.Shape( ).Dim( ), expr.Shape( ).PixelSize( ) ) {
+    expr.Evaluate( qk_data );
+  }
+
+  template< class D > template< class D2, class E >
+  Image< D >::Image( const Expression< Image< D2 >, E > &expr ) :
+    Image( expr.Shape( ).Dim( ), expr.Shape( ).PixelSize( ) ) {
+    expr.Evaluate( qk_data );
+  }
+
+  template< class D > template< class D2, class E >
+  Image< D > &Image< D >::operator=( const Expression< Image< D2 >, E > &expr ) {
+    return( *this = Image< D >( expr ) );
+  }
+
   template< class D > template< class O >
   void Image< D >::PrintPixelSize( O &os ) const {
     size_t dims = Dims( );
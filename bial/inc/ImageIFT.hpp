@@ -25,6 +25,10 @@ namespace Bial {
 
     const Adjacency &adjacency;
     size_t stop_elm;
+    /** @brief True after the first seed edit following a complete run. Queue states were already reset. */
+    bool editing;
+    /** @brief Bucket size of the block queues in parallel mode. Zero for sequential mode. */
+    ldbl block_bucket_size;
 
   public:
 
@@ -46,7 +50,7 @@ namespace Bial {
      * @date 2012/Sep/19
      * @param none.
      * @return none.
-     * @brief Runs IFT algorithm over image.
+     * @brief Runs IFT algorithm over image. IFT is sequential, unless EnableParallel was called.
      * @warning none.
      */
     void Run( );
@@ -69,6 +73,92 @@ namespace Bial {
      */
     void DisableStopElement( );
 
+    /**
+     * @date 2026/Oct/18
+     * @param seeds: Indexes of the new seeds.
+     * @param seed_value: Initial path value of the new seeds.
+     * @return none.
+     * @brief Differential IFT. Inserts new seeds after a run. The next call to Run only reprocesses the elements
+     * whose paths are improved by the new seeds. Value, label, and predecessor maps must be kept from previous run.
+     * @warning Path function must have label and predecessor maps. If labels are not sequential, the label of the
+     * new seeds must be set in the label map by the caller.
+     */
+    void AddSeeds( const Vector< size_t > &seeds, D seed_value );
+
+    /**
+     * @date 2026/Oct/18
+     * @param seeds: Indexes of the seeds to be removed. Elements that are not roots are ignored.
+     * @return none.
+     * @brief Differential IFT. Removes the trees rooted at the given seeds. Their elements get the worst path value
+     * and the elements in the frontier of the removed trees are queued, so that the next call to Run conquers the
+     * removed trees again from the remaining seeds.
+     * @warning Path function must have label and predecessor maps. Elements that are not reached by any remaining
+     * seed keep the worst path value and their previous labels.
+     */
+    void RemoveSeeds( const Vector< size_t > &seeds );
+
+    /**
+     * @date 2026/Oct/18
+     * @param bucket_size: Bucket size of the queues used inside the blocks. Use the bucket size of the main queue.
+     * @return none.
+     * @brief Enables parallel IFT. The image is split into blocks of consecutive rows, one per thread of
+     * ThreadPool::Global( ). Each block runs an IFT restricted to its domain, from the seeds that fall inside it.
+     * Then, a sequential IFT is run from the elements in block borders, repairing paths that cross blocks. All
+     * seeds are initialized as roots before the blocks are processed, in queue order. This is only valid when the
+     * sequential IFT roots all of them too, that is, when no seed has a queued value worse than the best root
+     * value. Otherwise, as in connected components or in watershed from all pixels, where seeds are conquered by
+     * other seeds, the roots are undone and the sequential IFT is run.
+     * @warning Parallel IFT is NOT equivalent to sequential FIFO or LIFO IFT. Only path values, roots, and the
+     * labels of roots are the same, for path functions in which paths are extended from optimum paths and are not
+     * better than their prefixes (e.g. max-arc, sum, and geodesic functions). Elements with more than one optimum
+     * path may get different labels and predecessors, as ties are broken in block order instead of queue order.
+     * Image-IFTTime measures thousands of such elements in watershed and geodesic star over noisy images. Do not
+     * enable it where labels or predecessors of tied elements matter. It is disabled by default and no library
+     * function enables it. Stop element is not supported in parallel mode.
+     */
+    void EnableParallel( ldbl bucket_size = 1.0 );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Disables parallel IFT.
+     * @warning none.
+     */
+    void DisableParallel( );
+
+  private:
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Runs parallel IFT. See EnableParallel.
+     * @warning none.
+     */
+    void ParallelRun( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param begin: First element of the block.
+     * @param end: One past the last element of the block.
+     * @param seeds: Seeds inside the block.
+     * @return none.
+     * @brief Runs IFT restricted to elements in [begin, end), with a local queue.
+     * @warning none.
+     */
+    void BlockRun( size_t begin, size_t end, const Vector< size_t > &seeds );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Sets differential propagation and resets queue states after a complete run, so that elements
+     * processed by the previous run may be conquered again.
+     * @warning none.
+     */
+    void PrepareEdit( );
+
     // template< class D, class D2 >
     // static void ImageIFT( Image< D > &value, const Image< D2 > &mask, const Adjacency &adjacency,
     //                       PathFunction< Image, D > *function, const Vector< bool > *seed = nullptr,
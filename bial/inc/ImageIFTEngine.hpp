@@ -0,0 +1,271 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief IFT algorithm running on Images with path function and bucket queue types known at compile time.
+ */
+
+#include "Adjacency.hpp"
+#include "Common.hpp"
+#include "Image.hpp"
+
+#ifndef BIALIMAGEIFTENGINE_H
+#define BIALIMAGEIFTENGINE_H
+
+#include "AdjacencyIterator.hpp"
+#include "BucketQueue.hpp"
+#include "PathFunction.hpp"
+#include <type_traits>
+
+namespace Bial {
+
+  /**
+   * @brief Calls performed by ImageIFTEngine over path functions. Concrete path functions are called with qualified
+   * names, avoiding virtual dispatch and member function pointers, so that the compiler may inline them. Abstract
+   * path functions keep virtual dispatch. The removal and propagation members of the path functions and bucket
+   * queues used with the engine are defined inline in their headers, so that they are inlined in library builds too.
+   */
+  template< class F, bool dynamic = std::is_abstract< F >::value >
+  struct IFTFunctionCall {
+    static bool RemoveSimple( F &f, size_t index, BucketState state ) {
+      return( f.F::RemoveSimple( index, state ) );
+    }
+    static bool RemovePredecessor( F &f, size_t index, BucketState state ) {
+      return( f.F::RemovePredecessor( index, state ) );
+    }
+    static bool RemoveLabel( F &f, size_t index, BucketState state ) {
+      return( f.F::RemoveLabel( index, state ) );
+    }
+    static bool RemoveComplete( F &f, size_t index, BucketState state ) {
+      return( f.F::RemoveComplete( index, state ) );
+    }
+    static bool Capable( F &f, size_t index, size_t adj_index, BucketState adj_state ) {
+      return( f.F::Capable( index, adj_index, adj_state ) );
+    }
+    static bool Propagate( F &f, size_t index, size_t adj_index, size_t adj_pos ) {
+      return( f.F::Propagate( index, adj_index, adj_pos ) );
+    }
+    static bool PropagateDifferential( F &f, size_t index, size_t adj_index, size_t adj_pos ) {
+      return( f.F::PropagateDifferential( index, adj_index, adj_pos ) );
+    }
+  };
+
+  template< class F >
+  struct IFTFunctionCall< F, true > {
+    static bool RemoveSimple( F &f, size_t index, BucketState state ) {
+      return( f.RemoveSimple( index, state ) );
+    }
+    static bool RemovePredecessor( F &f, size_t index, BucketState state ) {
+      return( f.RemovePredecessor( index, state ) );
+    }
+    static bool RemoveLabel( F &f, size_t index, BucketState state ) {
+      return( f.RemoveLabel( index, state ) );
+    }
+    static bool RemoveComplete( F &f, size_t index, BucketState state ) {
+      return( f.RemoveComplete( index, state ) );
+    }
+    static bool Capable( F &f, size_t index, size_t adj_index, BucketState adj_state ) {
+      return( f.Capable( index, adj_index, adj_state ) );
+    }
+    static bool Propagate( F &f, size_t index, size_t adj_index, size_t adj_pos ) {
+      return( f.Propagate( index, adj_index, adj_pos ) );
+    }
+    static bool PropagateDifferential( F &f, size_t index, size_t adj_index, size_t adj_pos ) {
+      return( f.PropagateDifferential( index, adj_index, adj_pos ) );
+    }
+  };
+
+  /** @brief Calls performed by ImageIFTEngine over bucket queues. Same policy of IFTFunctionCall. */
+  template< class Q, bool dynamic = std::is_abstract< Q >::value >
+  struct IFTQueueCall {
+    static size_t Remove( Q &q ) {
+      return( q.Q::Remove( ) );
+    }
+    static void Update( Q &q, size_t idt, ldbl cur_wgt, ldbl new_wgt ) {
+      q.Q::Update( idt, cur_wgt, new_wgt );
+    }
+  };
+
+  template< class Q >
+  struct IFTQueueCall< Q, true > {
+    static size_t Remove( Q &q ) {
+      return( q.Remove( ) );
+    }
+    static void Update( Q &q, size_t idt, ldbl cur_wgt, ldbl new_wgt ) {
+      q.Update( idt, cur_wgt, new_wgt );
+    }
+  };
+
+  /**
+   * @brief IFT over images in which path function F and bucket queue Q are template parameters. Same algorithm
+   * and interface of ImageIFT, but per-arc calls are resolved at compile time. ImageIFT runs this engine over
+   * PathFunction and BucketQueue base classes.
+   */
+  template< class D, class F, class Q >
+  class ImageIFTEngine {
+
+    Image< D > &value;
+    const Adjacency &adjacency;
+    F *function;
+    Q *queue;
+    size_t stop_elm;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param value: Value map used in path propagation. It contains the input and output values.
+     * @param adjacency: adjacency relation defining neighborhood. Assumes central element being at position 0.
+     * @param function: Function used to initialize and propagate values.
+     * @param queue: Bucket queue to propagate the paths.
+     * @return none.
+     * @brief Constructor of IFT engine to run over images.
+     * @warning Input image and adjacency must have compatible dimensions. F must be the dynamic type of
+     * function, or an abstract class. Otherwise, overridden methods of derived classes are not called.
+     */
+    ImageIFTEngine( Image< D > &value, const Adjacency &adjacency, F *function, Q *queue );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Runs IFT algorithm over image. Removal and propagation variants are selected once, from the maps
+     * given to the path function.
+     * @warning none.
+     */
+    void Run( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param elm: Target element.
+     * @return none.
+     * @brief Enables stop element IFT. Runs until target element is reached.
+     * @warning none.
+     */
+    void EnableStopElement( size_t elm );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Disables stop element IFT. Runs until all elements leave the queue.
+     * @warning none.
+     */
+    void DisableStopElement( );
+
+  private:
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief IFT main loop. remove selects among simple, predecessor, label, and complete removal functions.
+     * @warning none.
+     */
+    template< int remove, bool differential >
+    void Loop( );
+
+  };
+
+  template< class D, class F, class Q >
+  ImageIFTEngine< D, F, Q >::ImageIFTEngine( Image< D > &value, const Adjacency &adjacency, F *function,
+                                             Q *queue ) :
+    value( value ), adjacency( adjacency ), function( function ), queue( queue ), stop_elm( value.size( ) ) {
+    if( value.Dims( ) != adjacency.Dims( ) ) {
+      std::string msg( BIAL_ERROR( "Image and adjacency relation dimensions do not match. Image dimensions: " +
+                                   std::to_string( value.Dims( ) ) + ", adjacency dimensions: " +
+                                   std::to_string( adjacency.Dims( ) ) ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D, class F, class Q >
+  void ImageIFTEngine< D, F, Q >::Run( ) {
+    try {
+      typedef PathFunction< Image, D > PF;
+      bool differential = ( function->PropagateData == &PF::PropagateDifferential );
+      if( function->RemoveData == &PF::RemoveSimple )
+        differential ? Loop< 0, true >( ) : Loop< 0, false >( );
+      else if( function->RemoveData == &PF::RemovePredecessor )
+        differential ? Loop< 1, true >( ) : Loop< 1, false >( );
+      else if( function->RemoveData == &PF::RemoveLabel )
+        differential ? Loop< 2, true >( ) : Loop< 2, false >( );
+      else
+        differential ? Loop< 3, true >( ) : Loop< 3, false >( );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D, class F, class Q >
+  template< int remove, bool differential >
+  void ImageIFTEngine< D, F, Q >::Loop( ) {
+    typedef IFTFunctionCall< F > FC;
+    typedef IFTQueueCall< Q > QC;
+    COMMENT( "Running Image IFT engine. Queue: " << ( queue->Empty( ) ? "empty" : "not empty" ), 0 );
+    AdjacencyIterator adj_itr( value, adjacency );
+    size_t adj_size = adjacency.size( );
+    size_t adj_index;
+    size_t index = std::numeric_limits< size_t >::max( );
+    while( ( !queue->Empty( ) ) && ( index != stop_elm ) ) {
+      index = QC::Remove( *queue );
+      BucketState state = queue->State( index );
+      bool capable;
+      if( remove == 0 )
+        capable = FC::RemoveSimple( *function, index, state );
+      else if( remove == 1 )
+        capable = FC::RemovePredecessor( *function, index, state );
+      else if( remove == 2 )
+        capable = FC::RemoveLabel( *function, index, state );
+      else
+        capable = FC::RemoveComplete( *function, index, state );
+      COMMENT( "Index: " << index << ", value: " << value[ index ] << ", is capable: " <<
+               ( capable ? "true" : "false" ), 4 );
+      queue->Finished( index );
+      if( capable ) {
+        bool interior = adj_itr.Interior( index );
+        for( size_t adj = 0; adj < adj_size; ++adj ) {
+          if( adj_itr.AdjIdx( index, adj, adj_index, interior ) ) {
+            BucketState adj_state = queue->State( adj_index );
+            if( ( adj_state != BucketState::REMOVED ) && ( FC::Capable( *function, index, adj_index, adj_state ) ) ) {
+              COMMENT( "Conquering: " << adj_index, 4 );
+              D previous_value = value[ adj_index ];
+              if( differential ? FC::PropagateDifferential( *function, index, adj_index, adj ) :
+                  FC::Propagate( *function, index, adj_index, adj ) )
+                QC::Update( *queue, adj_index, previous_value, value[ adj_index ] );
+            }
+          }
+        }
+      }
+    }
+  }
+
+  template< class D, class F, class Q >
+  void ImageIFTEngine< D, F, Q >::EnableStopElement( size_t elm ) {
+    stop_elm = elm;
+  }
+
+  template< class D, class F, class Q >
+  void ImageIFTEngine< D, F, Q >::DisableStopElement( ) {
+    stop_elm = value.size( );
+  }
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Exact knn graph adjacency computed by searching a kd-tree over the feature vector.
+ * <br> Future add-on's: none.
+ */
+
+#include "Common.hpp"
+#include "Vector.hpp"
+
+#ifndef BIALKDTREEGRAPHADJACENCY_H
+#define BIALKDTREEGRAPHADJACENCY_H
+
+#include "KnnGraphAdjacency.hpp"
+
+namespace Bial {
+
+  template< class D >
+  class Feature;
+  class Sample;
+
+  /**
+   * @brief Knn graph adjacency with the same arc weights as KnnGraphAdjacency, but computed by searching a kd-tree
+   * instead of comparing all pairs of samples. Arcs of equal weight are ordered by sample index. Nodes split their
+   * samples at the median of the dimension of largest spread, and the search skips the far side of a split
+   * whenever the distance to the split plane is larger than the k-th nearest distance found so far. The bound
+   * holds for all DFIDE distance functions, as they do not decrease with the difference in any dimension. Queries
+   * run in parallel.
+   */
+  class KdTreeGraphAdjacency : public KnnGraphAdjacency {
+
+  private:
+
+    /** @brief Tree node. Samples in [ begin, end ) of the tree order. Leaves have no children ( left == 0 ). */
+    struct KdTreeNode {
+      size_t begin;
+      size_t end;
+      /** @brief Split dimension. */
+      size_t dim;
+      size_t left;
+      size_t right;
+    };
+
+  public:
+
+    /** @brief Maximum number of samples in a tree leaf. */
+    static const size_t LEAF_SIZE = 16;
+
+    static const size_t MAX_SAMPLES;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Maximum number of samples.
+     * @brief Returns the maximum number of samples. Larger than for KnnGraphAdjacency, as building the adjacency
+     * does not take quadratic time.
+     * @warning none.
+     */
+    static size_t MaxSamples( ) {
+      return( MAX_SAMPLES );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param feature: feature vector containing only the subsamples.
+     * @param sample: sample vector.
+     * @param scl_min, scl_max: minimum and maximum scale fractions utilized for clustering. (0.0 - 1.0)
+     * @return none.
+     * @brief Initializes the object, building the kd-tree and searching the kmax nearest neighbors of each
+     * sample.
+     * @warning none.
+     */
+    template< class D >
+    void Initialize( const Feature< D > &feature, const Sample &sample, float scl_min, float scl_max );
+
+  };
+
+}
+
+#include "KdTreeGraphAdjacency.cpp"
+
+#endif
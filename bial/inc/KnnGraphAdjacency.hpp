@@ -24,7 +24,7 @@ namespace Bial {
 
   class KnnGraphAdjacency : public GraphAdjacency< KnnGraphAdjacency > {
 
-  private:
+  protected:
 
     Matrix< size_t > arc;
     Matrix< double > arc_weight;
@@ -33,6 +33,18 @@ namespace Bial {
     Vector< Vector< size_t > > plateau; 
     /** @brief  Just to return for heterogeneous adjacency size. */
     Vector< size_t > null_heterogeneous_size; 
+    /** @brief  Position of src in the arcs of tgt, for each arc from src to tgt, or kmax if there is none. */
+    Matrix< size_t > reverse_rank;
+
+    /**
+     * @date 2026/Oct/18 
+     * @param none. 
+     * @return none. 
+     * @brief Computes reverse_rank from the arcs of all samples, so that checking if an arc is symmetric within
+     * any scale takes constant time. Called at the end of Initialize. 
+     * @warning none. 
+     */
+    void RankReverseArcs( );
 
   public:
 
@@ -102,12 +114,13 @@ namespace Bial {
      * @date 2014/Jun/04 
      * @param feature: Feature vector. 
      * @param scl_min, scl_max: minimum and maximum scale fractions utilized for clustering. (0.0 - 1.0) 
+     * @param max_samples: Maximum number of samples of the graph. Default: MAX_SAMPLES.
      * @return A vector with neighbors based on scl_min and scl_max. 
      * @brief Computes neighbors to be used by Knn algorithm. 
      * @warning 0.0 < scl_min <= scl_max <= 1.0. 
      */
     template< class D >
-    void EstimateK( const Feature< D > &feature, float scl_min, float scl_max );
+    void EstimateK( const Feature< D > &feature, float scl_min, float scl_max, size_t max_samples = MAX_SAMPLES );
 
     /**
      * @date 2013/Oct/17 
@@ -116,7 +129,7 @@ namespace Bial {
      * @param delta: Maximum density distance in a plateau. 
      * @return none. 
      * @brief Complements the k-nn adjacency relation with plateau edges,
-     * avoiding assimetric adjacencies. 
+     * avoiding assimetric adjacencies. Takes time linear in the number of arcs of the scale. 
      * @warning none. 
      */
     Vector< Vector< size_t > > &HeterogeneousAdjacency( const Vector< double > &density, size_t scl, double delta );
@@ -159,6 +172,16 @@ namespace Bial {
      */
     bool ValidNeighbor( size_t src, size_t scl, double distance ) const;
 
+    /**
+     * @date 2026/Oct/18 
+     * @param src: sample index. 
+     * @param scl: Number of scale element. 
+     * @return Radius of src region of influence. 
+     * @brief Returns the largest distance for which ValidNeighbor is true. 
+     * @warning none. 
+     */
+    double Radius( size_t src, size_t scl ) const;
+
   };
 
 }
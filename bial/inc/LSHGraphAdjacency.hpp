@@ -25,11 +25,14 @@ namespace Bial {
   class Feature;
   class Sample;
 
+  /**
+   * @brief Graph adjacency of the samples within a radius, found by locality sensitive hashing. Each object builds
+   * its own LSH index, so that several graphs may be computed at the same time. Queries run in parallel.
+   */
   class LSHGraphAdjacency : public GraphAdjacency< LSHGraphAdjacency > {
 
   private:
 
-    static bool initialized;
     Vector< Vector< size_t > > arc;
     Vector< Vector< double > > arc_weight;
     Vector< double > scale;
@@ -42,22 +45,13 @@ namespace Bial {
 
     static const size_t MAX_SAMPLES;
 
-    /**
-     * @date 2014/Oct/23 
-     * @param none. 
-     * @return none. 
-     * @brief Destructor. Just to free LSH. 
-     * @warning none. 
-     */
-    ~LSHGraphAdjacency( );
-
     /**
      * @date 2014/Oct/23 
      * @param feature: feature vector containing only the subsamples. 
      * @param sample: sample vector. 
      * @param scl_min, scl_max: minimum and maximum scale fractions utilized for clustering. (0.0 - 1.0) 
      * @return none. 
-     * @brief Initializes the object. 
+     * @brief Initializes the object. The LSH index is built for the given samples and freed before returning. 
      * @warning none. 
      */
     template< class D >
@@ -171,6 +165,16 @@ namespace Bial {
      */
     bool ValidNeighbor( size_t src, size_t scl, double distance ) const;
 
+    /**
+     * @date 2026/Oct/18 
+     * @param src: sample index. 
+     * @param scl: Number of scale element. 
+     * @return Radius of src region of influence. 
+     * @brief Returns the largest distance for which ValidNeighbor is true. 
+     * @warning none. 
+     */
+    double Radius( size_t src, size_t scl ) const;
+
   };
 
 }
@@ -35,7 +35,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    LocalMaxPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label );
+    LocalMaxPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor,
+                          bool sequential_label );
 
     /**
      * @date 2015/Jul/20
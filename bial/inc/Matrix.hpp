@@ -15,6 +15,8 @@
 #ifndef BIALMATRIX_H
 #define BIALMATRIX_H
 
+#include "Expression.hpp"
+#include "MatrixProduct.hpp"
 #include "Vector.hpp"
 
 namespace Bial {
@@ -54,6 +56,11 @@ namespace Bial {
     Vector< size_t > dim_size;
     /** @brief  accumulated size of matrix dimensions. */
     Vector< size_t > acc_dim_size;
+    /**
+     * @brief Owner of data allocated elsewhere, such as a memory mapped file. Released with the last matrix
+     * wrapping the data. Empty if the matrix owns its data or if the data is not managed.
+     */
+    std::shared_ptr< void > owner;
 
 
   public:
@@ -80,15 +87,17 @@ namespace Bial {
      * @date 2015/Set/10
      * @param new_data: Pointer to data allocated elsewhere.
      * @param new_dim: Matrix dimensions.
+     * @param new_owner: Owner of new_data, kept alive while the matrix wraps it. Empty if data is not managed.
      * @return none.
      * @brief Basic Constructor. This constructor works as a wrapper for data already allocated. It will use
      * the same space pointed by new_data to manipulate the matrix. Use this for compatibility
      * with other data structures, in a easy convertion to Matrix class.
-     * @warning Data is not deallocated automatcally, since it may be stored in the stack. Also, DO NOT USE this
-     * constructure in Verbose or Debug compilation mode, as it will try to access invalid memory positions. Just
-     * compile without any Verbosity or Debug flags.
+     * @warning Data is not deallocated automatcally, since it may be stored in the stack, unless new_owner is
+     * given. Also, DO NOT USE this constructure in Verbose or Debug compilation mode, as it will try to access
+     * invalid memory positions. Just compile without any Verbosity or Debug flags.
      */
-    Matrix( D *new_data, const Vector< size_t > &new_dim );
+    Matrix( D *new_data, const Vector< size_t > &new_dim,
+            const std::shared_ptr< void > &new_owner = std::shared_ptr< void >( ) );
 
     /**
      * @date 2012/Jun/21
@@ -138,6 +147,17 @@ namespace Bial {
      */
     template< class D2 > Matrix( const Matrix< D2 > &mtx );
 
+    /**
+     * @date 2026/Oct/18
+     * @param expr: Lazy expression over matrices.
+     * @return none.
+     * @brief Constructor from an expression, evaluated in a single pass. Conversion from expressions of other types
+     * is explicit.
+     * @warning none.
+     */
+    template< class E > Matrix( const Expression< Matrix< D >, E > &expr );
+    template< class D2, class E > explicit Matrix( const Expression< Matrix< D2 >, E > &expr );
+
     /**
      * @date 2014/Oct/10
      * @param other: matrix to be assigned.
@@ -166,6 +186,16 @@ namespace Bial {
     template< class D2 >
     Matrix< D > &operator=( const Matrix< D2 > &other );
 
+    /**
+     * @date 2026/Oct/18
+     * @param expr: Lazy expression over matrices.
+     * @return Reference to this matrix.
+     * @brief Evaluates the expression into a new buffer, which is assigned to this matrix.
+     * @warning none.
+     */
+    template< class D2, class E >
+    Matrix< D > &operator=( const Expression< Matrix< D2 >, E > &expr );
+
     /**
      * @date 2012/Jun/21
      * @param other: matrix to be compared.
@@ -213,16 +243,6 @@ namespace Bial {
      */
     Matrix< D > operator--( int );
 
-    /**
-     * @date 2012/Jun/21
-     * @param other: second other.
-     * @return Sum of matrices 'this' and other.
-     * @brief Computes the sum of the matrices 'this' and other and returns the resultant matrix.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
-     */
-    template< class D2 >
-    Matrix< D > operator+( const Matrix< D2 > &other ) const;
-
     /**
      * @date 2012/Jun/21
      * @param other: second other.
@@ -242,16 +262,6 @@ namespace Bial {
      */
     Matrix< D > operator-( ) const;
 
-    /**
-     * @date 2012/Jun/21
-     * @param other: second other.
-     * @return Sum of matrices 'this' and other.
-     * @brief Computes the difference of the matrices 'this' and other and returns the resultant matrix.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
-     */
-    template< class D2 >
-    Matrix< D > operator-( const Matrix< D2 > &other ) const;
-
     /**
      * @date 2012/Jun/21
      * @param other: second other.
@@ -266,8 +276,9 @@ namespace Bial {
      * @date 2012/Jun/21
      * @param other: second other.
      * @return Product of matrices 'this' and other.
-     * @brief Computes the product of the matrices 'this' and other and returns the resultant matrix.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
+     * @brief Computes the product of the matrices 'this' and other and returns the resultant matrix. Uses the
+     * cache-blocked and multi-threaded MatrixOp::Product.
+     * @warning The number of columns of 'this' must match the number of lines of other.
      */
     template< class D2 >
     Matrix< D > operator*( const Matrix< D2 > &other ) const;
@@ -282,15 +293,6 @@ namespace Bial {
     template< class D2 >
     Matrix< D > &operator*=( const Matrix< D2 > &other );
 
-    /**
-     * @date 2012/jul/02
-     * @param scalar: a scalar.
-     * @return Sum of 'this' matrix by the scalar.
-     * @brief Computes the sum of 'this' matrix by the scalar.
-     * @warning none.
-     */
-    Matrix< D > operator+( double scalar ) const;
-
     /**
      * @date 2012/jul/02
      * @param scalar: a scalar.
@@ -300,15 +302,6 @@ namespace Bial {
      */
     Matrix< D > &operator+=( double scalar );
 
-    /**
-     * @date 2012/jul/02
-     * @param scalar: a scalar.
-     * @return Difference between 'this' matrix and the scalar.
-     * @brief Computes the difference between 'this' matrix and the scalar.
-     * @warning none.
-     */
-    Matrix< D > operator-( double scalar ) const;
-
     /**
      * @date 2012/jul/02
      * @param scalar: a scalar.
@@ -318,15 +311,6 @@ namespace Bial {
      */
     Matrix< D > &operator-=( double scalar );
 
-    /**
-     * @date 2012/Jun/21
-     * @param scalar: a scalar.
-     * @return Product of 'this' matrix by the scalar.
-     * @brief Computes the product of 'this' matrix by the scalar.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
-     */
-    Matrix< D > operator*( double scalar ) const;
-
     /**
      * @date 2012/Jun/21
      * @param scalar: a scalar.
@@ -340,8 +324,8 @@ namespace Bial {
      * @date 2012/Jun/21
      * @param other: second other.
      * @return Division of matrices 'this' and other.
-     * @brief Computes the division of the matrices 'this' and other and returns the resultant matrix.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
+     * @brief Computes the product of 'this' by the inverse of other and returns the resultant matrix.
+     * @warning other must be square and not singular, with as many lines as the columns of 'this'.
      */
     template< class D2 >
     Matrix< D > operator/( const Matrix< D2 > &other ) const;
@@ -356,15 +340,6 @@ namespace Bial {
     template< class D2 >
     Matrix< D > &operator/=( const Matrix< D2 > &other );
 
-    /**
-     * @date 2012/Jun/21
-     * @param scalar: a scalar.
-     * @return Division of 'this' matrix by the scalar.
-     * @brief Computes the division of 'this' matrix by the scalar.
-     * @warning 'this' matrix must have the same dimensions of other matrix.
-     */
-    Matrix< D > operator/( double scalar ) const;
-
     /**
      * @date 2012/Jun/21
      * @param scalar: a scalar.
@@ -566,10 +541,11 @@ namespace Bial {
      * @date 2012/Jun/29
      * @param none.
      * @return iterator begin() of data.
-     * @brief Returns iterator begin() of data.
+     * @brief Returns iterator begin() of data. Iterators are pointers, so that they are valid for matrices that wrap
+     * external data, as the ones adopted from mapped feature files.
      * @warning none.
      */
-    typename std::vector< D >::iterator begin( ) noexcept;
+    D* begin( ) noexcept;
 
     /**
      * @date 2012/Jun/29
@@ -578,7 +554,7 @@ namespace Bial {
      * @brief Returns const_iterator begin() of data.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator begin( ) const noexcept;
+    const D* begin( ) const noexcept;
 
     /**
      * @date 2012/Jun/29
@@ -587,7 +563,7 @@ namespace Bial {
      * @brief Returns iterator end() of data.
      * @warning none.
      */
-    typename std::vector< D >::iterator end( ) noexcept;
+    D* end( ) noexcept;
 
     /**
      * @date 2012/Jun/29
@@ -596,7 +572,7 @@ namespace Bial {
      * @brief Returns const_iterator end() of data.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator end( ) const noexcept;
+    const D* end( ) const noexcept;
 
     /**
      * @date 2013/Aug/09
@@ -605,7 +581,7 @@ namespace Bial {
      * @brief Returns the reverse_iterator rbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::reverse_iterator rbegin( ) noexcept;
+    std::reverse_iterator< D* > rbegin( ) noexcept;
 
     /**
      * @date 2013/Aug/09
@@ -614,7 +590,7 @@ namespace Bial {
      * @brief Returns const_reverse_iterator rbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator rbegin( ) const noexcept;
+    std::reverse_iterator< const D* > rbegin( ) const noexcept;
 
     /**
      * @date 2013/Aug/09
@@ -623,7 +599,7 @@ namespace Bial {
      * @brief Returns reverse_iterator rend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::reverse_iterator rend( ) noexcept;
+    std::reverse_iterator< D* > rend( ) noexcept;
 
     /**
      * @date 2013/Aug/09
@@ -632,7 +608,7 @@ namespace Bial {
      * @brief Returns const_reverse_iterator rend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator rend( ) const noexcept;
+    std::reverse_iterator< const D* > rend( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -641,7 +617,7 @@ namespace Bial {
      * @brief Returns the iterator cbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator cbegin( ) const noexcept;
+    const D* cbegin( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -650,7 +626,7 @@ namespace Bial {
      * @brief Returns the iterator cend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_iterator cend( ) const noexcept;
+    const D* cend( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -659,7 +635,7 @@ namespace Bial {
      * @brief Returns the iterator crbegin() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator crbegin( ) const noexcept;
+    std::reverse_iterator< const D* > crbegin( ) const noexcept;
 
     /**
      * @date 2015/Apr/06
@@ -668,7 +644,7 @@ namespace Bial {
      * @brief Returns the iterator crend() of data Vector.
      * @warning none.
      */
-    typename std::vector< D >::const_reverse_iterator crend( ) const noexcept;
+    std::reverse_iterator< const D* > crend( ) const noexcept;
 
     /**
      * @date 2012/Sep/11
@@ -1130,6 +1106,7 @@ namespace Bial {
 /* Implementation  ------------------------------------------------------------------------------------------------------ */
 #include "Adjacency.hpp"
 #include "File.hpp"
+#include "MatrixInverse.hpp"
 
 namespace Bial {
 
@@ -1173,10 +1150,12 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
-  template< class D > Matrix< D >::Matrix( D *new_data, const Vector< size_t > &new_dim ) try
-    : _data( new_data, std::accumulate( new_dim.begin( ), new_dim.end( ), 0 ) ), qk_data( new_data ),
-        _size( std::accumulate( new_dim.begin( ), new_dim.end( ), 0 ) ), dims( new_dim.size( ) ),
-        dim_size( new_dim ), acc_dim_size( new_dim ) {
+  template< class D > Matrix< D >::Matrix( D *new_data, const Vector< size_t > &new_dim,
+                                           const std::shared_ptr< void > &new_owner ) try
+    : _data( new_data, std::accumulate( new_dim.begin( ), new_dim.end( ), static_cast< size_t >( 1 ),
+                                        std::multiplies< size_t >( ) ) ), qk_data( new_data ),
+        _size( _data.size( ) ), dims( new_dim.size( ) ),
+        dim_size( new_dim ), acc_dim_size( new_dim ), owner( new_owner ) {
 
       COMMENT( "Computing dimension accumulated size.", 4 );
       for( size_t dms = 1; dms < acc_dim_size.size( ); ++dms )
@@ -1320,6 +1299,23 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
+  template< class D >
+  template< class E > Matrix< D >::Matrix( const Expression< Matrix< D >, E > &expr ) : Matrix( expr.Dim( ) ) {
+    expr.Evaluate( qk_data );
+  }
+
+  template< class D >
+  template< class D2, class E > Matrix< D >::Matrix( const Expression< Matrix< D2 >, E > &expr ) :
+    Matrix( expr.Dim( ) ) {
+    expr.Evaluate( qk_data );
+  }
+
+  template< class D >
+  template< class D2, class E >
+  Matrix< D > &Matrix< D >::operator=( const Expression< Matrix< D2 >, E > &expr ) {
+    return( *this = Matrix< D >( expr ) );
+  }
+
   template< class D >
   Matrix< D > &Matrix< D >::operator=( const Matrix< D > &other ) {
     try {
@@ -1332,6 +1328,7 @@ namespace Bial {
 
       COMMENT( "Assigning quick access pointers.", 2 );
       qk_data = _data.data( );
+      owner.reset( );
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1367,6 +1364,7 @@ namespace Bial {
       COMMENT( "Assigning data.", 2 );
       for( size_t elm = 0; elm < _size; ++elm )
         QK_DATA( elm ) = static_cast< D >( other.QK_DATA( elm ) );
+      owner.reset( );
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1484,41 +1482,15 @@ namespace Bial {
 
   template< class D >
   template< class D2 >
-  Matrix< D > Matrix< D >::operator+( const Matrix< D2 > &other ) const {
+  Matrix< D > &Matrix< D >::operator+=( const Matrix< D2 > &other ) {
     try {
       if( !SameDimensions( other ) ) {
         std::string msg( BIAL_ERROR( "Matrix dimensions do not match." ) );
         throw( std::logic_error( msg ) );
       }
-      Matrix< D > res( *this );
-      for( size_t elm = 0; elm < res._size; ++elm ) {
-        res.QK_DATA( elm ) += other.QK_DATA( elm );
+      for( size_t elm = 0; elm < _size; ++elm ) {
+        QK_DATA( elm ) += other.QK_DATA( elm );
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  template< class D2 >
-  Matrix< D > &Matrix< D >::operator+=( const Matrix< D2 > &other ) {
-    try {
-      *this = *this + other;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1568,41 +1540,15 @@ namespace Bial {
 
   template< class D >
   template< class D2 >
-  Matrix< D > Matrix< D >::operator-( const Matrix< D2 > &other ) const {
+  Matrix< D > &Matrix< D >::operator-=( const Matrix< D2 > &other ) {
     try {
       if( !SameDimensions( other ) ) {
         std::string msg( BIAL_ERROR( "Matrix dimensions do not match." ) );
         throw( std::logic_error( msg ) );
       }
-      Matrix< D > res( *this );
-      for( size_t elm = 0; elm < res._size; ++elm ) {
-        res.QK_DATA( elm ) -= other.QK_DATA( elm );
+      for( size_t elm = 0; elm < _size; ++elm ) {
+        QK_DATA( elm ) -= other.QK_DATA( elm );
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  template< class D2 >
-  Matrix< D > &Matrix< D >::operator-=( const Matrix< D2 > &other ) {
-    try {
-      *this = *this - other;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1637,15 +1583,8 @@ namespace Bial {
         throw( std::logic_error( msg ) );
       }
       Matrix< D > res( other.dim_size( 0 ), dim_size( 1 ) );
-      for( size_t j = 0; j < res.dim_size( 1 ); ++j ) {
-        for( size_t i = 0; i < res.dim_size( 0 ); ++i ) {
-          res.QK_DATA( j * res.dim_size( 0 ) + i ) = 0.0;
-          for( size_t k = 0; k < dim_size( 0 ); ++k ) {
-            res.QK_DATA( j * res.dim_size( 0 ) + i ) += QK_DATA( j * dim_size( 0 ) + k ) *
-        other.QK_DATA( k * res.dim_size( 0 ) + i );
-          }
-        }
-      }
+      MatrixOp::Product( qk_data, dim_size( 0 ), other.qk_data, other.dim_size( 0 ), res.qk_data, res.dim_size( 0 ),
+                         dim_size( 1 ), dim_size( 0 ), other.dim_size( 0 ) );
       return( res );
     }
     catch( std::bad_alloc &e ) {
@@ -1708,18 +1647,7 @@ namespace Bial {
             "Number of columns of left matrix must match the number of lines of right matrix'." ) );
         throw( std::logic_error( msg ) );
       }
-      Matrix< D > res( dim_size( 0 ), dim_size( 1 ) );
-      Matrix< D > inv = other.Inverse( );
-      for( size_t i = 0; i < res.dim_size( 1 ); i++ ) {
-        for( size_t j = 0; j < res.dim_size( 0 ); j++ ) {
-          res.QK_DATA( i * dim_size( 0 ) + j ) = 0.0;
-          for( size_t k = 0; k < dim_size( 0 ); k++ ) {
-            res.QK_DATA( i * res.dim_size( 0 ) + j ) +=
-              QK_DATA( i * dim_size( 0 ) + k ) * inv.QK_DATA( k * res.dim_size( 0 ) + j );
-          }
-        }
-      }
-      return( Matrix< D >( res ) );
+      return( *this * MatrixOp::Inverse( other ) );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -1765,36 +1693,11 @@ namespace Bial {
   }
 
   template< class D >
-  Matrix< D > Matrix< D >::operator+( double scalar ) const {
+  Matrix< D > &Matrix< D >::operator+=( double scalar ) {
     try {
-      Matrix< D > res( *this );
       for( size_t elm = 0; elm < _size; ++elm ) {
-        res.QK_DATA( elm ) += scalar;
+        QK_DATA( elm ) += scalar;
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  Matrix< D > &Matrix< D >::operator+=( double scalar ) {
-    try {
-      *this = *this + scalar;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1816,36 +1719,11 @@ namespace Bial {
   }
 
   template< class D >
-  Matrix< D > Matrix< D >::operator-( double scalar ) const {
+  Matrix< D > &Matrix< D >::operator-=( double scalar ) {
     try {
-      Matrix< D > res( *this );
       for( size_t elm = 0; elm < _size; ++elm ) {
-        res.QK_DATA( elm ) -= scalar;
+        QK_DATA( elm ) -= scalar;
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  Matrix< D > &Matrix< D >::operator-=( double scalar ) {
-    try {
-      *this = *this - scalar;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1867,36 +1745,11 @@ namespace Bial {
   }
 
   template< class D >
-  Matrix< D > Matrix< D >::operator*( double scalar ) const {
+  Matrix< D > &Matrix< D >::operator*=( double scalar ) {
     try {
-      Matrix< D > res( *this );
       for( size_t elm = 0; elm < _size; ++elm ) {
-        res.QK_DATA( elm ) *= scalar;
+        QK_DATA( elm ) *= scalar;
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  Matrix< D > &Matrix< D >::operator*=( double scalar ) {
-    try {
-      *this = *this * scalar;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -1918,41 +1771,16 @@ namespace Bial {
   }
 
   template< class D >
-  Matrix< D > Matrix< D >::operator/( double scalar ) const {
+  Matrix< D > &Matrix< D >::operator/=( double scalar ) {
     try {
       COMMENT( "Verifying if scalar is not zero.", 2 );
       if( scalar == 0.0 ) {
         std::string msg( BIAL_ERROR( "Division by zero." ) );
         throw( std::logic_error( msg ) );
       }
-      Matrix< D > res( *this );
       for( size_t elm = 0; elm < _size; ++elm ) {
-        res.QK_DATA( elm ) /= scalar;
+        QK_DATA( elm ) /= scalar;
       }
-      return( res );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  Matrix< D > &Matrix< D >::operator/=( double scalar ) {
-    try {
-      *this = *this / scalar;
       return( *this );
     }
     catch( std::bad_alloc &e ) {
@@ -2130,67 +1958,67 @@ namespace Bial {
   }
 
   template< class D >
-  typename std::vector< D >::iterator Matrix< D >::begin( ) noexcept {
+  D* Matrix< D >::begin( ) noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.begin( ) );
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Matrix< D >::begin( ) const noexcept {
+  const D* Matrix< D >::begin( ) const noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.begin( ) );
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::iterator Matrix< D >::end( ) noexcept {
+  D* Matrix< D >::end( ) noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.end( ) );
+    return( qk_data + _size );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Matrix< D >::end( ) const noexcept {
+  const D* Matrix< D >::end( ) const noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.end( ) );
+    return( qk_data + _size );
   }
 
   template< class D >
-  typename std::vector< D >::reverse_iterator Matrix< D >::rbegin( ) noexcept {
-    return( _data.rbegin( ) );
+  std::reverse_iterator< D* > Matrix< D >::rbegin( ) noexcept {
+    return( std::reverse_iterator< D* >( qk_data + _size ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Matrix< D >::rbegin( ) const noexcept {
-    return( _data.rbegin( ) );
+  std::reverse_iterator< const D* > Matrix< D >::rbegin( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data + _size ) );
   }
 
   template< class D >
-  typename std::vector< D >::reverse_iterator Matrix< D >::rend( ) noexcept {
-    return( _data.rend( ) );
+  std::reverse_iterator< D* > Matrix< D >::rend( ) noexcept {
+    return( std::reverse_iterator< D* >( qk_data ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Matrix< D >::rend( ) const noexcept {
-    return( _data.rend( ) );
+  std::reverse_iterator< const D* > Matrix< D >::rend( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Matrix< D >::cbegin( ) const noexcept {
-    return( _data.cbegin( ) );
+  const D* Matrix< D >::cbegin( ) const noexcept {
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Matrix< D >::cend( ) const noexcept {
-    return( _data.cend( ) );
+  const D* Matrix< D >::cend( ) const noexcept {
+    return( qk_data + _size );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Matrix< D >::crbegin( ) const noexcept {
-    return( _data.crbegin( ) );
+  std::reverse_iterator< const D* > Matrix< D >::crbegin( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data + _size ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Matrix< D >::crend( ) const noexcept {
-    return( _data.crend( ) );
+  std::reverse_iterator< const D* > Matrix< D >::crend( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data ) );
   }
 
   template< class D >
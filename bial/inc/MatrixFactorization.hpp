@@ -0,0 +1,87 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief LU and Cholesky factorizations and solution of linear systems.
+ */
+
+#include "Common.hpp"
+
+#ifndef BIALMATRIXFACTORIZATION_H
+#define BIALMATRIXFACTORIZATION_H
+
+#include "Vector.hpp"
+
+namespace Bial {
+
+  namespace MatrixOp {
+
+    /**
+     * @date 2026/Oct/18
+     * @param mat: Input square matrix.
+     * @param lu: Returns L below the diagonal, with implicit unit diagonal, and U on and above the diagonal, so that
+     * L * U is mat with the rows permuted by pivot.
+     * @param pivot: Returns the row of mat that was moved to each row of lu.
+     * @return The sign of the permutation, 1 or -1, or 0 if mat is singular.
+     * @brief Computes the LU factorization with partial pivoting by blocks of LUBlock columns. After each panel is
+     * factorized, the trailing matrix is updated by the cache-blocked product, which holds most of the arithmetic.
+     * @warning 'mat' must be square and 2D. 'lu' is not complete when 'mat' is singular.
+     */
+    template< class D >
+    int LU( const Matrix< D > &mat, Matrix< double > &lu, Vector< size_t > &pivot );
+
+    /**
+     * @date 2026/Oct/18
+     * @param mat: Input symmetric matrix.
+     * @param lower: Returns the lower triangular matrix L so that L * L^T is mat.
+     * @return true if 'mat' is positive definite and the factorization was computed.
+     * @brief Computes the Cholesky factorization of mat. Only the lower triangle of mat is read.
+     * @warning 'mat' must be square and 2D.
+     */
+    template< class D >
+    bool Cholesky( const Matrix< D > &mat, Matrix< double > &lower );
+
+    /**
+     * @date 2026/Oct/18
+     * @param lu: LU factorization computed by LU.
+     * @param pivot: Pivot computed by LU.
+     * @param rhs: Right-hand sides, one per column. Returns the solutions.
+     * @return none.
+     * @brief Solves L * U * X = P * rhs by forward and backward substitution. Columns of rhs are split among the
+     * threads of the global pool.
+     * @warning none.
+     */
+    void LUSolve( const Matrix< double > &lu, const Vector< size_t > &pivot, Matrix< double > &rhs );
+
+    /**
+     * @date 2026/Oct/18
+     * @param lower: Cholesky factorization computed by Cholesky.
+     * @param rhs: Right-hand sides, one per column. Returns the solutions.
+     * @return none.
+     * @brief Solves L * L^T * X = rhs by forward and backward substitution. Columns of rhs are split among the
+     * threads of the global pool.
+     * @warning none.
+     */
+    void CholeskySolve( const Matrix< double > &lower, Matrix< double > &rhs );
+
+    /**
+     * @date 2026/Oct/18
+     * @param mat: Input square matrix.
+     * @param rhs: Right-hand sides, one per column, with as many rows as mat.
+     * @return Matrix X so that mat * X = rhs.
+     * @brief Solves the linear systems by Cholesky factorization when mat is symmetric positive definite, and by LU
+     * factorization otherwise. Computations are in double precision.
+     * @warning 'mat' must be square, 2D and not singular.
+     */
+    template< class D >
+    Matrix< D > Solve( const Matrix< D > &mat, const Matrix< D > &rhs );
+
+  }
+
+}
+
+#include "MatrixFactorization.cpp"
+
+#endif
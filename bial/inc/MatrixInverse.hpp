@@ -32,8 +32,9 @@ namespace Bial {
      * @date 2012/Jun/21
      * @param mat: input matrix.
      * @return none.
-     * @brief Computes LU decomposition based inverse of 'this' matrix, overwriting data Vector.
-     * @warning 'this' matrix must be square and 2D.
+     * @brief Computes LU decomposition based inverse of 'this' matrix, overwriting data Vector. The factorization
+     * uses partial pivoting and is computed in double precision.
+     * @warning 'this' matrix must be square, 2D and not singular.
      */
     template< class D >
     void Inverse( Matrix< D > &mat );
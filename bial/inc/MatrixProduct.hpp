@@ -0,0 +1,158 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Cache-blocked and multi-threaded product of row-major matrix blocks.
+ */
+
+#include "Common.hpp"
+
+#ifndef BIALMATRIXPRODUCT_H
+#define BIALMATRIXPRODUCT_H
+
+namespace Bial {
+
+  namespace MatrixOp {
+
+    /**
+     * @date 2026/Oct/18
+     * @param left: First element of a rows x inner row-major block.
+     * @param left_step: Distance between the first elements of consecutive rows of left.
+     * @param right: First element of an inner x cols row-major block.
+     * @param right_step: Distance between the first elements of consecutive rows of right.
+     * @param res: First element of a rows x cols row-major block. Returns res + left * right, or res - left * right.
+     * @param res_step: Distance between the first elements of consecutive rows of res.
+     * @param rows, inner, cols: Dimensions of the blocks.
+     * @param subtract: If true, the product is subtracted from res. Otherwise, it is added to res.
+     * @return none.
+     * @brief Computes the product of the blocks in panels of ProductInner rows of right and ProductCols columns, which
+     * stay in cache while they are multiplied by groups of four rows of left. The innermost loop runs along the rows
+     * of right and res and is vectorized. Groups of rows of res are split among the threads of the global pool. Each
+     * element of res accumulates the products in increasing order of the inner index, converting to D3 after each
+     * one, as the straightforward triple loop does, so that results are the same.
+     * @warning res must not overlap left or right.
+     */
+    template< class D, class D2, class D3 >
+    void Product( const D *left, size_t left_step, const D2 *right, size_t right_step, D3 *res, size_t res_step,
+                  size_t rows, size_t inner, size_t cols, bool subtract = false );
+
+  }
+
+}
+
+/* Implementation ---------------------------------------------------------------------------------------------------- */
+
+namespace Bial {
+
+  namespace MatrixOp {
+
+    /** @brief Number of rows of right in a panel of Product. */
+    const size_t ProductInner = 128;
+    /** @brief Number of columns of right in a panel of Product. */
+    const size_t ProductCols = 512;
+    /** @brief Minimum number of multiplications computed in parallel. */
+    const size_t ProductParallelSize = 1 << 18;
+
+    /**
+     * @date 2026/Oct/18
+     * @param left, left_step, right, right_step, res, res_step, inner, cols: As in Product.
+     * @param first_row, last_row: Range [ first_row, last_row ) of rows of res computed here.
+     * @return none.
+     * @brief Computes a range of rows of the product. S is set to subtract it from res.
+     * @warning none.
+     */
+    template< bool S, class D, class D2, class D3 >
+    void ProductRows( const D *left, size_t left_step, const D2 *right, size_t right_step, D3 *res, size_t res_step,
+                      size_t first_row, size_t last_row, size_t inner, size_t cols ) {
+      for( size_t k_0 = 0; k_0 < inner; k_0 += ProductInner ) {
+        size_t k_1 = std::min( inner, k_0 + ProductInner );
+        for( size_t j_0 = 0; j_0 < cols; j_0 += ProductCols ) {
+          size_t width = std::min( cols, j_0 + ProductCols ) - j_0;
+          size_t row = first_row;
+          for( ; row + 4 <= last_row; row += 4 ) {
+            D3 *res_0 = res + row * res_step + j_0;
+            D3 *res_1 = res_0 + res_step;
+            D3 *res_2 = res_1 + res_step;
+            D3 *res_3 = res_2 + res_step;
+            const D *lft = left + row * left_step;
+            for( size_t k = k_0; k < k_1; ++k ) {
+              D lft_0 = lft[ k ];
+              D lft_1 = lft[ left_step + k ];
+              D lft_2 = lft[ 2 * left_step + k ];
+              D lft_3 = lft[ 3 * left_step + k ];
+              const D2 *rgt = right + k * right_step + j_0;
+              if( S ) {
+#pragma omp simd
+                for( size_t j = 0; j < width; ++j ) {
+                  res_0[ j ] = static_cast< D3 >( res_0[ j ] - lft_0 * rgt[ j ] );
+                  res_1[ j ] = static_cast< D3 >( res_1[ j ] - lft_1 * rgt[ j ] );
+                  res_2[ j ] = static_cast< D3 >( res_2[ j ] - lft_2 * rgt[ j ] );
+                  res_3[ j ] = static_cast< D3 >( res_3[ j ] - lft_3 * rgt[ j ] );
+                }
+              }
+              else {
+#pragma omp simd
+                for( size_t j = 0; j < width; ++j ) {
+                  res_0[ j ] = static_cast< D3 >( res_0[ j ] + lft_0 * rgt[ j ] );
+                  res_1[ j ] = static_cast< D3 >( res_1[ j ] + lft_1 * rgt[ j ] );
+                  res_2[ j ] = static_cast< D3 >( res_2[ j ] + lft_2 * rgt[ j ] );
+                  res_3[ j ] = static_cast< D3 >( res_3[ j ] + lft_3 * rgt[ j ] );
+                }
+              }
+            }
+          }
+          for( ; row < last_row; ++row ) {
+            D3 *res_0 = res + row * res_step + j_0;
+            const D *lft = left + row * left_step;
+            for( size_t k = k_0; k < k_1; ++k ) {
+              D lft_0 = lft[ k ];
+              const D2 *rgt = right + k * right_step + j_0;
+              if( S ) {
+#pragma omp simd
+                for( size_t j = 0; j < width; ++j )
+                  res_0[ j ] = static_cast< D3 >( res_0[ j ] - lft_0 * rgt[ j ] );
+              }
+              else {
+#pragma omp simd
+                for( size_t j = 0; j < width; ++j )
+                  res_0[ j ] = static_cast< D3 >( res_0[ j ] + lft_0 * rgt[ j ] );
+              }
+            }
+          }
+        }
+      }
+    }
+
+    template< class D, class D2, class D3 >
+    void Product( const D *left, size_t left_step, const D2 *right, size_t right_step, D3 *res, size_t res_step,
+                  size_t rows, size_t inner, size_t cols, bool subtract ) {
+      auto function = [ = ]( size_t tsk, size_t total_tasks ) {
+        size_t groups = ( rows + 3 ) / 4;
+        size_t first_row = 4 * ( groups * tsk / total_tasks );
+        size_t last_row = std::min( rows, 4 * ( groups * ( tsk + 1 ) / total_tasks ) );
+        if( subtract )
+          ProductRows< true >( left, left_step, right, right_step, res, res_step, first_row, last_row, inner, cols );
+        else
+          ProductRows< false >( left, left_step, right, right_step, res, res_step, first_row, last_row, inner, cols );
+      };
+      if( ( rows < 8 ) || ( rows * inner * cols < ProductParallelSize ) ) {
+        function( 0, 1 );
+        return;
+      }
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( std::min( pool.Tasks( rows ), ( rows + 3 ) / 4 ), function );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        function( 0, 1 );
+      }
+    }
+
+  }
+
+}
+
+#endif
@@ -11,13 +11,12 @@
 #ifndef BIALMAXPATHFUNCTION_H
 #define BIALMAXPATHFUNCTION_H
 
+#include "BucketQueueElements.hpp"
 #include "Common.hpp"
 #include "PathFunction.hpp"
 
 namespace Bial {
 
-  enum class BucketState : char;
-
   template< template< class D > class C, class D >
   class MaxPathFunction : public PathFunction< C, D > {
 
@@ -39,7 +38,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    MaxPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label, 
+    MaxPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, bool sequential_label, 
                      const C< D > &handicap );
 
     /**
@@ -158,6 +157,94 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::RemoveSimple( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      COMMENT( "Root.", 3 );
+      this->value->operator()( index ) = handicap( index );
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::RemovePredecessor( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      COMMENT( "Root.", 3 );
+      this->value->operator()( index ) = handicap( index );
+      this->predecessor->operator()( index ) = -1;
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::RemoveLabel( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = handicap( index );
+      this->label->operator()( index ) = this->next_label;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::RemoveComplete( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->value->operator()( index ) = handicap( index );
+      this->label->operator()( index ) = this->next_label;
+      this->predecessor->operator()( index ) = -1;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
+    return( adj_state != BucketState::REMOVED );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
+    IF_DEBUG( ( this->predecessor == nullptr ) || ( this->label == nullptr ) ) {
+      std::string msg( BIAL_ERROR( "Differential propragation requires predecessor and label maps." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    COMMENT( "Propagating!", 4 );
+    D src_value = this->value->operator()( adj_index );
+    D arc_weight = handicap( adj_index );
+    D prp_value = std::max( this->value->operator()( index ), arc_weight );
+    if( ( src_value > prp_value ) ||
+        ( ( this->predecessor->operator()( adj_index ) == static_cast< bial_index >( index ) ) &&
+          ( this->label->operator()( adj_index ) != this->label->operator()( index ) ) ) ) {
+      COMMENT( "propagated!", 4 );
+      this->value->operator()( adj_index ) = prp_value;
+      this->predecessor->operator()( adj_index ) = index;
+      this->label->operator()( adj_index ) = this->label->operator()( index );
+      return( true );
+    }
+    COMMENT( "Not propagated!", 4 );
+    return( false );
+  }
+
+  template< template< class D > class C, class D >
+  inline bool MaxPathFunction< C, D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
+    COMMENT( "Propagating!", 4 );
+    D src_value = this->value->operator()( adj_index );
+    D arc_weight = handicap( adj_index );
+    D prp_value = std::max( this->value->operator()( index ), arc_weight );
+    if( ( ( this->predecessor != nullptr ) &&
+          ( this->predecessor->operator()( adj_index ) == static_cast< bial_index >( index ) ) )
+          || ( src_value > prp_value ) ) {
+      COMMENT( "propagated!", 4 );
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    COMMENT( "Not propagated!", 4 );
+    return( false );
+  }
+
 }
 
 #include "MaxPathFunction.cpp"
@@ -60,7 +60,8 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    MaxSumPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label,
+    MaxSumPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor,
+                        bool sequential_label,
                         const C< D > &new_intensity, const C< D > &handicap, double new_alpha = 0.0,
                         double new_beta = 0.5 );
 
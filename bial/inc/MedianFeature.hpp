@@ -54,15 +54,17 @@ namespace Bial {
    * @param src: Input source matrix to extract features. 
    * @param adj_rel: Adjacency relation of each pixel. 
    * @param res: Resulting feature vector. 
+   * @param minimum: Minimum value of src. 
+   * @param maximum: Maximum value of src. 
    * @param thread: Thread number. 
    * @param total_threads: Number of threads. 
    * @return none. 
-   * @brief Multi-thread implementation of MedianFeature. 
+   * @brief Multi-thread implementation of MedianFeature. Each thread slides a window along its rows. 
    * @warning none. 
    */
   template< class D >
-  void MedianFeatureThread( const Image< D > &src, const Adjacency &adj_rel, Feature< D > &res,
-                            size_t thread, size_t total_threads );
+  void MedianFeatureThread( const Image< D > &src, const Adjacency &adj_rel, Feature< D > &res, D minimum,
+                            D maximum, size_t thread, size_t total_threads );
   
 }
 
@@ -41,7 +41,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    MinPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label, 
+    MinPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, bool sequential_label, 
                      const C< D > &handicap );
 
     /**
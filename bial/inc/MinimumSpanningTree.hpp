@@ -42,7 +42,7 @@ namespace Bial {
      * @warning Working for T1 images. 
      */
     template< template< class D > class C, class D >
-    static void MST( const Feature< D > &feature, C< D > &distance_map, C< int > &predecessor_map );
+    static void MST( const Feature< D > &feature, C< D > &distance_map, C< bial_index > &predecessor_map );
 
   };
 
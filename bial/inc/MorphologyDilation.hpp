@@ -51,7 +51,8 @@ namespace Bial {
      * @param adjacency: Adjacency relation used by dilation opperation. 
      * @return Dilation of input image. 
      * @brief Computes the dilation of input image using input adjacency relation. Interface to call multi-thread,
-     * GPU, FPGA implementations. 
+     * GPU, FPGA implementations. Adjacency relations made of runs along dimension 0, as round ones, are computed by
+     * LineFilter. 
      * @warning none. 
      */
     template< class D >
@@ -106,7 +107,8 @@ namespace Bial {
      * @date 2013/Dec/03 
      * @param image: Input binary image. 
      * @return Dilation of input binary image. 
-     * @brief Computes the dilation of input image using spherical adjacency relation of one pixel of radius. 
+     * @brief Computes the dilation of input image using input adjacency relation. Images with a single nonzero
+     * value and adjacency relations made of runs along dimension 0 are computed by BinaryLineFilter. 
      * @warning none. 
      */
     template< class D >
@@ -0,0 +1,139 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Morphological dilation and erosion decomposed into line passes.
+ */
+
+#ifndef BIALMORPHOLOGYLINE_H
+#define BIALMORPHOLOGYLINE_H
+
+#include "Common.hpp"
+#include "Vector.hpp"
+
+namespace Bial {
+
+  template< class D >
+  class Image;
+  class Adjacency;
+
+  /**
+   * @brief Morphological operations decomposed into line runs of the structuring element along the first
+   * dimension. Each run is dilated or eroded by the van Herk/Gil-Werman algorithm, with three comparisons per pixel
+   * whatever its length. Boxes and lines are further split into one run per dimension. Out of image pixels are
+   * ignored, as in Dilate and Erode.
+   */
+  namespace Morphology {
+
+    /**
+     * @date 2026/Oct/18
+     * @param adjacency: Adjacency relation of up to three dimensions.
+     * @param run: Returns the runs. Four values per run: first and last displacement in dimension 0, and
+     * displacements in dimensions 1 and 2.
+     * @return true if the adjacency relation, together with the origin, is made of contiguous runs along
+     * dimension 0.
+     * @brief Decomposes the adjacency relation into line runs along dimension 0. All round adjacency relations
+     * are.
+     * @warning none.
+     */
+    bool LineRuns( const Adjacency &adjacency, Vector< int > &run );
+
+    /**
+     * @date 2026/Oct/18
+     * @param run: Line runs from LineRuns.
+     * @param low: Returns the first displacement of the box in each of the three dimensions.
+     * @param high: Returns the last displacement of the box in each of the three dimensions.
+     * @return true if the runs form a box.
+     * @brief Verifies if the runs form a box, that is, the product of one interval per dimension. Lines are
+     * boxes, too.
+     * @warning none.
+     */
+    bool LineBox( const Vector< int > &run, Vector< int > &low, Vector< int > &high );
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Line values.
+     * @param size: Number of line elements.
+     * @param low, high: First and last displacement of the window.
+     * @param better: Comparison. std::greater for dilation and std::less for erosion.
+     * @param forward, backward: buffers of size + high - low elements.
+     * @param acc: Accumulated result. Each element is replaced by the best of itself and the in-line elements of
+     * its window.
+     * @return none.
+     * @brief Van Herk/Gil-Werman running maximum or minimum over the window [ elm + low, elm + high ] of each
+     * element.
+     * @warning none.
+     */
+    template< class D, class C >
+    void LineWindow( const D *src, size_t size, int low, int high, C better, D *forward, D *backward, D *acc );
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Rows of cols values, one row per line element.
+     * @param size: Number of line elements.
+     * @param cols: Number of lines, that is, the number of values in each row.
+     * @param low, high: First and last displacement of the window.
+     * @param better: Comparison. std::greater for dilation and std::less for erosion.
+     * @param forward, backward: buffers of ( size + high - low ) * cols elements.
+     * @param acc: Accumulated result, with the layout of src.
+     * @return none.
+     * @brief LineWindow over cols lines at once, one row at a time, so that strided lines are filtered from
+     * contiguous memory.
+     * @warning none.
+     */
+    template< class D, class C >
+    void LineWindowRows( const D *src, size_t size, size_t cols, int low, int high, C better, D *forward,
+                         D *backward, D *acc );
+
+    /**
+     * @date 2026/Oct/18
+     * @param image: Input image.
+     * @param run: Line runs from LineRuns.
+     * @param better: Comparison. std::greater for dilation and std::less for erosion.
+     * @param worst: Value that is not better than any other.
+     * @param result: Copy of the input image. Returns the dilation or erosion of the input image.
+     * @return none.
+     * @brief Computes the dilation or erosion of the input image by the structuring element made of the given
+     * runs, in parallel. Boxes are filtered one dimension at a time. Other runs are joined from the input lines
+     * filtered by each distinct dimension 0 interval, which are computed once for each task.
+     * @warning none.
+     */
+    template< class D, class C >
+    void LineFilter( const Image< D > &image, const Vector< int > &run, C better, D worst, Image< D > &result );
+
+    /**
+     * @date 2026/Oct/18
+     * @param image: Input image.
+     * @param run: Line runs from LineRuns.
+     * @param dilation: true for dilation, false for erosion.
+     * @return Dilation or erosion of input image.
+     * @brief Computes the dilation or erosion of the input image by the structuring element made of the given
+     * runs, in parallel. Same result as Dilate and Erode with the adjacency relation of the runs.
+     * @warning none.
+     */
+    template< class D >
+    Image< D > LineFilter( const Image< D > &image, const Vector< int > &run, bool dilation );
+
+    /**
+     * @date 2026/Oct/18
+     * @param image: Input binary image.
+     * @param run: Line runs from LineRuns.
+     * @param dilation: true for dilation, false for erosion.
+     * @return Dilation or erosion of input binary image.
+     * @brief Computes the dilation or erosion of the input binary image, in parallel, with pixels packed in
+     * 64-bit words along dimension 0. Runs are dilated by shifts and ors of whole words. Dilated pixels get the
+     * largest value of image, and eroded pixels keep their values.
+     * @warning Dilation gives the same result as DilateBin only if all nonzero pixels have the same value.
+     */
+    template< class D >
+    Image< D > BinaryLineFilter( const Image< D > &image, const Vector< int > &run, bool dilation );
+
+  }
+
+}
+
+#include "MorphologyLine.cpp"
+
+#endif
@@ -0,0 +1,127 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Classification of samples by the nodes of an optimum-path forest, searching a kd-tree of the nodes.
+ * <br> Future add-on's: none.
+ */
+
+#include "Common.hpp"
+#include "Vector.hpp"
+
+#ifndef BIALOPFCLASSIFIER_H
+#define BIALOPFCLASSIFIER_H
+
+namespace Bial {
+
+  template< class D >
+  class Feature;
+
+  /**
+   * @brief Labels samples from the nodes of a clustered or trained optimum-path forest. Each node conquers the
+   * samples within its radius. A sample gets the label of the first node in the given order that conquers it, or of
+   * its nearest node if none does. Equal to scanning the nodes in order for every sample, but the nodes are kept in
+   * a kd-tree whose nodes store their bounding box, the largest radius and the first order of their nodes. A search
+   * skips subtrees that are farther than their largest radius, or whose first order is not earlier than the best
+   * conquering node found so far. The bounds hold for all DFIDE distance functions, as they do not decrease with
+   * the difference in any dimension. The classifier is read-only after construction, so samples are labeled in
+   * parallel.
+   */
+  template< class D >
+  class OPFClassifier {
+
+  private:
+
+    /** @brief Tree node. Forest nodes in [ begin, end ) of the tree order. Leaves have no children ( left == 0 ). */
+    struct OPFClassifierNode {
+      size_t begin;
+      size_t end;
+      size_t left;
+      size_t right;
+      /** @brief Smallest order of the forest nodes in the subtree. */
+      size_t first;
+      /** @brief Largest radius of the forest nodes in the subtree. */
+      double max_radius;
+    };
+
+    size_t features;
+    std::vector< OPFClassifierNode > node;
+    /** @brief Bounding box of each tree node. ( node * features + ftr ). */
+    Vector< D > low;
+    Vector< D > high;
+    /** @brief Features, order, label and radius of the forest nodes, in tree order. */
+    Vector< D > point;
+    Vector< size_t > order;
+    Vector< int > label;
+    Vector< double > radius;
+    size_t max_leaf;
+
+    /**
+     * @date 2026/Oct/18
+     * @param sample: features of the sample.
+     * @param clamp: buffer of features elements.
+     * @param distance: buffer of max_leaf elements.
+     * @param stack: buffer for the tree nodes to be visited.
+     * @return The label of the sample.
+     * @brief Classifies a sample, using the given buffers.
+     * @warning none.
+     */
+    int Classify( const D *sample, D *clamp, double *distance,
+                  std::vector< std::pair< size_t, double > > &stack ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param sample: features of the sample.
+     * @param nod: tree node.
+     * @param clamp: buffer of features elements.
+     * @return Lower bound of the distances from the sample to the forest nodes in the tree node.
+     * @brief Computes the distance from the sample to the nearest point of the bounding box of the tree node.
+     * @warning none.
+     */
+    double BoxDistance( const D *sample, size_t nod, D *clamp ) const;
+
+  public:
+
+    /** @brief Maximum number of forest nodes in a tree leaf. */
+    static const size_t LEAF_SIZE = 16;
+
+    /**
+     * @date 2026/Oct/18
+     * @param feature: feature vector.
+     * @param element: feature element of each forest node, in the order nodes conquer samples.
+     * @param node_label: label of each forest node.
+     * @param node_radius: radius of each forest node. A node conquers the samples not farther than its radius.
+     * @return none.
+     * @brief Basic constructor. Builds the kd-tree.
+     * @warning element must not be empty.
+     */
+    OPFClassifier( const Feature< D > &feature, const Vector< size_t > &element, const Vector< int > &node_label,
+                   const Vector< double > &node_radius );
+
+    /**
+     * @date 2026/Oct/18
+     * @param sample: features of the sample.
+     * @return The label of the sample.
+     * @brief Classifies a sample.
+     * @warning none.
+     */
+    int Classify( const D *sample ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param feature: feature vector with the same number of features as the one of the forest.
+     * @return none.
+     * @brief Classifies the feature elements with label -1, in parallel.
+     * @warning none.
+     */
+    void Classify( Feature< D > &feature ) const;
+
+  };
+
+}
+
+#include "OPFClassifier.cpp"
+
+#endif
@@ -25,7 +25,8 @@ namespace Bial {
      * @date 2013/Jul/05 
      * @param feature: Feature vector. 
      * @param scale_min, scale_max: minimum and maximum scale. From 0.0 to 1.0.
-     * @param graph: the graph used to compute OPF. Default: KnnGraph for function with no parameter.
+     * @param graph: the graph used to compute OPF. Default: KnnGraph for function with no parameter. A
+     * Graph< KdTreeGraphAdjacency > gives the same arcs faster, and keeps up to 100000 samples instead of 10000.
      * @return Number of clusters. 
      * @brief Computes OPF clustering based only on the feature space, using sampling and a graph. 
      * @warning scale_min must be smaller than of equal to scale_min. 
@@ -40,7 +41,7 @@ namespace Bial {
      * @date 2014/Apr/30 
      * @param feature: Feature vector. 
      * @param clusters: Number of expected clusters.
-     * @param graph: the graph used to compute OPF.
+     * @param graph: the graph used to compute OPF. Default: KnnGraph for function with no parameter.
      * @return Number of clusters. 
      * @brief Computes OPF clustering based only on the feature space, using sampling and k-nn arcs. 
      * @warning none. 
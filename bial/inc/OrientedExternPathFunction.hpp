@@ -11,14 +11,13 @@
 #ifndef BIALORIENTEDEXTERNPATHFUNCTION_H
 #define BIALORIENTEDEXTERNPATHFUNCTION_H
 
+#include "BucketQueueElements.hpp"
 #include "Common.hpp"
 #include "Image.hpp"
 #include "PathFunction.hpp"
 
 namespace Bial {
 
-  enum class BucketState : char;
-
   template< class D >
   class OrientedExternPathFunction : public PathFunction< Image, D > {
 
@@ -29,7 +28,7 @@ namespace Bial {
     /** @brief  Handicap image. */
     Image< D > handicap;
     /** @brief  Restrictions to geodesic star. Generated by GeodesicRestriction IFT. */
-    Image< int > *geodesic_restriction;
+    Image< bial_index > *geodesic_restriction;
     /** @brief  Orientation weight. 0.0 to 1.0. The higher is the value, the higher is the orientation weight. <br>
      * Default value is 0.0.
      */
@@ -51,9 +50,9 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    OrientedExternPathFunction( Image< D > &init_value, Image< int > &init_label, Image< int > *init_predecessor,
+    OrientedExternPathFunction( Image< D > &init_value, Image< int > &init_label, Image< bial_index > *init_predecessor,
                                 bool sequential_label, const Image< D > &handicap, const Image< D > &new_intensity,
-                                Image< int > *restriction = nullptr, double new_alpha = 0.0 );
+                                Image< bial_index > *restriction = nullptr, double new_alpha = 0.0 );
 
     /**
      * @date 2013/Jul/01
@@ -161,6 +160,128 @@ namespace Bial {
 
   };
 
+  /* Inline member functions used in the inner loops. --------------------------------------------------------------- */
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::RemoveSimple( size_t, BucketState ) {
+    return( true );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::RemovePredecessor( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->predecessor->operator()( index ) = -1;
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::RemoveLabel( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->label->operator()( index ) = this->next_label;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::RemoveComplete( size_t index, BucketState state ) {
+    if( state == BucketState::INSERTED ) {
+      this->label->operator()( index ) = this->next_label;
+      this->predecessor->operator()( index ) = -1;
+      ++( this->next_label );
+    }
+    return( true );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
+    return( ( adj_state != BucketState::REMOVED ) &&
+            ( this->value->operator()( index ) < this->value->operator()( adj_index ) ) );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    COMMENT( "Computing arc weight.", 3 );
+    double arc_weight = handicap( index ) + handicap( adj_index );
+    COMMENT( "Orienting edges.", 3 );
+    double fraction = 0;
+    if( intensity[ index ] > intensity[ adj_index ] ) {
+      fraction = alpha;
+    }
+    else if( intensity[ index ] < intensity[ adj_index ] ) {
+      fraction = -alpha;
+    }
+    if( this->label->operator()( index ) == 0 ) {
+      fraction = -fraction;
+    }
+    arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
+    COMMENT( "Suppressing non-zero.", 3 );
+    ++arc_weight;
+    COMMENT( "Zero weight edges.", 3 );
+    if( geodesic_restriction != nullptr ) {
+      if( ( ( this->label->operator()( index ) != 0 ) &&
+            ( ( *geodesic_restriction )[ index ] == static_cast< bial_index >( adj_index ) ) ) ||
+          ( ( this->label->operator()( index ) == 0 ) &&
+            ( ( *geodesic_restriction )[ adj_index ] == static_cast< bial_index >( index ) ) ) ) {
+        arc_weight = 0;
+      }
+    }
+    ++arc_weight;
+    COMMENT( "Propagated value.", 3 );
+    D prp_value = static_cast< D >( arc_weight );
+    COMMENT( "Updating path value.", 3 );
+    if( src_value > prp_value ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
+  template< class D >
+  inline bool OrientedExternPathFunction< D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
+    D src_value = this->value->operator()( adj_index );
+    COMMENT( "Computing arc weight.", 3 );
+    double arc_weight = handicap( index ) + handicap( adj_index );
+    COMMENT( "Orienting edges.", 3 );
+    double fraction = 0;
+    if( intensity[ index ] > intensity[ adj_index ] ) {
+      fraction = alpha;
+    }
+    else if( intensity[ index ] < intensity[ adj_index ] ) {
+      fraction = -alpha;
+    }
+    if( this->label->operator()( index ) == 0 ) {
+      fraction = -fraction;
+    }
+    arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
+    COMMENT( "Suppressing non-zero.", 3 );
+    ++arc_weight;
+    COMMENT( "Zero weight edges.", 3 );
+    if( geodesic_restriction != nullptr ) {
+      if( ( ( this->label->operator()( index ) != 0 ) &&
+              ( ( *geodesic_restriction )[ index ] == static_cast< bial_index >( adj_index ) ) ) ||
+          ( ( this->label->operator()( index ) == 0 ) &&
+              ( ( *geodesic_restriction )[ adj_index ] == static_cast< bial_index >( index ) ) ) ) {
+        arc_weight = 0;
+      }
+    }
+    ++arc_weight;
+    COMMENT( "Propagated value.", 3 );
+    // D prp_value = static_cast< D >
+    //   ( std::min( static_cast< double >( std::numeric_limits< int >::max( ) ), arc_weight ) );
+    D prp_value = static_cast< D >( arc_weight );
+    COMMENT( "Updating path value.", 3 );
+    if( src_value > prp_value ) {
+      this->value->operator()( adj_index ) = prp_value;
+      ( this->*this->UpdateData )( index, adj_index );
+      return( true );
+    }
+    return( false );
+  }
+
 }
 
 #include "OrientedExternPathFunction.cpp"
@@ -39,8 +39,8 @@ namespace Bial {
     C< D > *value;
     /** @brief  Pointer to label container (Vector, Matrix, Image, etc). */
     C< int > *label;
-    /** @brief  Pointer to predecessor container (Vector, Matrix, Image, etc).  */
-    C< int > *predecessor;
+    /** @brief  Pointer to predecessor container (Vector, Matrix, Image, etc). Indexes are bial_index, -1 for roots. */
+    C< bial_index > *predecessor;
     int next_label;
 
   public:
@@ -60,7 +60,7 @@ namespace Bial {
      * @brief Basic constructor.
      * @warning none.
      */
-    PathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, bool sequential_label );
+    PathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, bool sequential_label );
     
     /**
      * @date 2015/Mar/09
@@ -219,6 +219,42 @@ namespace Bial {
      * @warning none.
      */
     typename PathFunction< C, D >::UpdateFn UpdateFunction( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Pointer to label map, or nullptr if labels are not computed.
+     * @brief Returns the label map.
+     * @warning none.
+     */
+    C< int > *Label( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Pointer to predecessor map, or nullptr if predecessors are not computed.
+     * @brief Returns the predecessor map.
+     * @warning none.
+     */
+    C< bial_index > *Predecessor( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Label of the next root, or -1 if labels are not sequential.
+     * @brief Returns the label of the next root.
+     * @warning none.
+     */
+    int NextLabel( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param new_label: Label of the next root.
+     * @return none.
+     * @brief Sets the label of the next root, to undo rooting elements. Ignored if labels are not sequential.
+     * @warning none.
+     */
+    void NextLabel( int new_label );
   };
 
 }
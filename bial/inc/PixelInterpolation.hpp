@@ -79,6 +79,36 @@ public:
     float operator()( const Image< float > &img, float x, float y, float z ) const;
     double operator()( const Image< double > &img, float x, float y, float z ) const;
 
+    /** @brief Number of samples that contribute to an interpolated value in each dimension. */
+    static const size_t Taps = 1;
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: Image data, with the first dimension varying faster.
+     * @param x_size, y_size, z_size: Image dimensions.
+     * @param x, y, z: Pixel coordinates in original.
+     * @return The nearest pixel interpolation of given coordinates, or zero outside the image.
+     * @brief Non-virtual interpolation, inlined by the resampling functions templated on the interpolation.
+     * @warning none.
+     */
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, float x, float y );
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x, float y, float z );
+
+    /**
+     * @date 2026/Oct/18
+     * @param coord: Coordinate in one dimension.
+     * @param size: Image size in the dimension.
+     * @param index: Returns the index of each of the Taps samples.
+     * @param weight: Returns the weight of each of the Taps samples.
+     * @return false if the coordinate is outside the image.
+     * @brief One dimensional interpolation weights, used by separable resampling.
+     * @warning none.
+     */
+    template< class R >
+    static bool Weights( float coord, size_t size, size_t *index, R *weight );
+
   };
 
 
@@ -105,6 +135,102 @@ public:
     llint operator()( const Image< llint > &img, float x, float y, float z ) const;
     float operator()( const Image< float > &img, float x, float y, float z ) const;
     double operator()( const Image< double > &img, float x, float y, float z ) const;
+
+public:
+
+    /** @brief Number of samples that contribute to an interpolated value in each dimension. */
+    static const size_t Taps = 2;
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: Image data, with the first dimension varying faster.
+     * @param x_size, y_size, z_size: Image dimensions.
+     * @param x, y, z: Pixel coordinates in original.
+     * @return The linear interpolation of given coordinates, or zero outside the image.
+     * @brief Non-virtual interpolation, inlined by the resampling functions templated on the interpolation.
+     * @warning none.
+     */
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, float x, float y );
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x, float y, float z );
+
+    /**
+     * @date 2026/Oct/18
+     * @param coord: Coordinate in one dimension.
+     * @param size: Image size in the dimension.
+     * @param index: Returns the index of each of the Taps samples.
+     * @param weight: Returns the weight of each of the Taps samples.
+     * @return false if the coordinate is outside the image.
+     * @brief One dimensional interpolation weights, used by separable resampling.
+     * @warning none.
+     */
+    template< class R >
+    static bool Weights( float coord, size_t size, size_t *index, R *weight );
+  };
+
+
+  /**
+   * @brief Cubic B-spline interpolation. The interpolated image is the cubic B-spline whose coefficients are given
+   * by Resampling::BSplineCoefficients, so that it passes through the original pixels. Samples beyond the borders are
+   * mirrored.
+   */
+  class CubicBSplineInterpolation : public PixelInterpolation {
+
+public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: B-spline coefficients of an image, as computed by Resampling::BSplineCoefficients.
+     * @param x, y, z: Pixel coordinates in original.
+     * @return The cubic B-spline interpolation of given coordinates.
+     * @brief Computes and returns cubic B-spline interpolation of given coordinates. Resampling functions compute
+     * the coefficients themselves.
+     * @warning Given the image instead of its coefficients, the result is smoothed.
+     */
+    template< class D >
+    D operator()( const Image< D > &img, float x, float y ) const;
+    int operator()( const Image< int > &img, float x, float y ) const;
+    llint operator()( const Image< llint > &img, float x, float y ) const;
+    float operator()( const Image< float > &img, float x, float y ) const;
+    double operator()( const Image< double > &img, float x, float y ) const;
+
+    template< class D >
+    D operator()( const Image< D > &img, float x, float y, float z ) const;
+    int operator()( const Image< int > &img, float x, float y, float z ) const;
+    llint operator()( const Image< llint > &img, float x, float y, float z ) const;
+    float operator()( const Image< float > &img, float x, float y, float z ) const;
+    double operator()( const Image< double > &img, float x, float y, float z ) const;
+
+    /** @brief Number of samples that contribute to an interpolated value in each dimension. */
+    static const size_t Taps = 4;
+
+    /**
+     * @date 2026/Oct/18
+     * @param data: B-spline coefficients, with the first dimension varying faster.
+     * @param x_size, y_size, z_size: Image dimensions.
+     * @param x, y, z: Pixel coordinates in original.
+     * @return The cubic B-spline interpolation of given coordinates, or zero outside the image.
+     * @brief Non-virtual interpolation, inlined by the resampling functions templated on the interpolation.
+     * @warning none.
+     */
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, float x, float y );
+    template< class D >
+    static D Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x, float y, float z );
+
+    /**
+     * @date 2026/Oct/18
+     * @param coord: Coordinate in one dimension.
+     * @param size: Image size in the dimension.
+     * @param index: Returns the index of each of the Taps samples.
+     * @param weight: Returns the weight of each of the Taps samples.
+     * @return false if the coordinate is outside the image.
+     * @brief One dimensional interpolation weights, used by separable resampling.
+     * @warning none.
+     */
+    template< class R >
+    static bool Weights( float coord, size_t size, size_t *index, R *weight );
   };
 
 }
@@ -117,126 +243,192 @@ namespace Bial {
 
   template< class D >
   D NearestInterpolation::operator()( const Image< D > &img, float x, float y ) const {
-    size_t cx = std::round( x );
-    size_t cy = std::round( y );
-    if( img.ValidCoordinate( cx, cy ) )
-      return( img( cx, cy ) );
-    return( 0 );
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), x, y ) );
   }
 
   template< class D >
-  D LinearInterpolation::operator()( const Image< D > &img, float x, float y ) const {
-    try {
-      COMMENT( "Distances from input coordinates to previous discrete coordinate.", 3 );
-      Vector< float > floor_dist = { x, y };
-      Vector< float > ceil_dist = { x, y };
-      Vector< size_t > ceil( 2 );
-      Vector< size_t > floor( 2 );
-      for( size_t dms = 0; dms < 2; ++dms ) {
-        ceil( dms ) = std::ceil( floor_dist( dms ) );
-        floor( dms ) = std::floor( floor_dist( dms ) );
-        if( ceil( dms ) == floor( dms ) ) {
-          if( ceil( dms ) == img.size( dms ) - 1 )
-            --floor( dms );
-          else
-            ++ceil( dms );
-        }
-        COMMENT( "Normalized distance.", 3 );
-        ceil_dist( dms ) = ( ceil( dms ) - floor_dist( dms ) ) / ( ceil( dms ) - floor( dms ) );
-        floor_dist( dms ) = 1.0 - ceil_dist( dms );
-      }
-      COMMENT( "floor: " << floor << ", ceil: " << ceil <<
-               ", floor_dist: " << floor_dist << ", ceil_dist: " << ceil_dist, 3 );
-
-      if( ( img.ValidCoordinate( floor( 0 ), floor( 1 ) ) ) && ( img.ValidCoordinate( ceil( 0 ), ceil( 1 ) ) ) ) {
-        return( img( floor( 0 ), floor( 1 ) ) * ceil_dist( 0 ) * ceil_dist( 1 ) +
-                img( ceil( 0 ), floor( 1 ) ) * floor_dist( 0 ) * ceil_dist( 1 ) +
-                img( floor( 0 ), ceil( 1 ) ) * ceil_dist( 0 ) * floor_dist( 1 ) +
-                img( ceil( 0 ), ceil( 1 ) ) * floor_dist( 0 ) * floor_dist( 1 ) );
-      }
+  D NearestInterpolation::operator()( const Image< D > &img, float x, float y, float z ) const {
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), img.size( 2 ), x, y, z ) );
+  }
+
+  template< class R >
+  inline bool NearestInterpolation::Weights( float coord, size_t size, size_t *index, R *weight ) {
+    COMMENT( "Coordinates that round to -0.0 are valid.", 4 );
+    float rnd = std::round( coord );
+    if( !( rnd >= 0.0f ) || ( rnd >= size ) )
+      return( false );
+    index[ 0 ] = static_cast< size_t >( rnd );
+    weight[ 0 ] = 1;
+    return( true );
+  }
+
+  template< class D >
+  inline D NearestInterpolation::Sample( const D *data, size_t x_size, size_t y_size, float x, float y ) {
+    size_t cx;
+    size_t cy;
+    float w;
+    if( ( !Weights( x, x_size, &cx, &w ) ) || ( !Weights( y, y_size, &cy, &w ) ) )
       return( 0 );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
+    return( data[ cx + x_size * cy ] );
   }
 
   template< class D >
-  D NearestInterpolation::operator()( const Image< D > &img, float x, float y, float z ) const {
-    size_t cx = std::round( x );
-    size_t cy = std::round( y );
-    size_t cz = std::round( z );
-    if( img.ValidCoordinate( cx, cy, cz ) )
-      return( img( cx, cy, cz ) );
-    return( 0 );
+  inline D NearestInterpolation::Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x,
+                                         float y, float z ) {
+    size_t cx;
+    size_t cy;
+    size_t cz;
+    float w;
+    if( ( !Weights( x, x_size, &cx, &w ) ) || ( !Weights( y, y_size, &cy, &w ) ) ||
+        ( !Weights( z, z_size, &cz, &w ) ) )
+      return( 0 );
+    return( data[ cx + x_size * ( cy + y_size * cz ) ] );
+  }
+
+  template< class D >
+  D LinearInterpolation::operator()( const Image< D > &img, float x, float y ) const {
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), x, y ) );
   }
 
   template< class D >
   D LinearInterpolation::operator()( const Image< D > &img, float x, float y, float z ) const {
-    try {
-      COMMENT( "Distances from input coordinates to previous discrete coordinate.", 3 );
-      Vector< float > floor_dist = { x, y, z };
-      Vector< float > ceil_dist = { x, y, z };
-      Vector< size_t > ceil( 3 );
-      Vector< size_t > floor( 3 );
-      for( size_t dms = 0; dms < 3; ++dms ) {
-        ceil( dms ) = std::ceil( floor_dist( dms ) );
-        floor( dms ) = std::floor( floor_dist( dms ) );
-        if( ceil( dms ) == floor( dms ) ) {
-          if( ceil( dms ) == img.size( dms ) - 1 )
-            --floor( dms );
-          else
-            ++ceil( dms );
-        }
-        COMMENT( "Normalized distance.", 3 );
-        ceil_dist( dms ) = ( ceil( dms ) - floor_dist( dms ) ) / ( ceil( dms ) - floor( dms ) );
-        floor_dist( dms ) = 1.0 - ceil_dist( dms );
-      }
-      COMMENT( "floor: " << floor << ", ceil: " << ceil <<
-               ", floor_dist: " << floor_dist << ", ceil_dist: " << ceil_dist, 3 );
-
-      if( ( img.ValidCoordinate( floor( 0 ), floor( 1 ), floor( 2 ) ) ) && 
-          ( img.ValidCoordinate( ceil( 0 ), ceil( 1 ), ceil( 2 ) ) ) ) {
-        return( img( floor( 0 ), floor( 1 ), floor( 2 ) ) * ceil_dist( 0 ) * ceil_dist( 1 ) * ceil_dist( 2 ) +
-                img( ceil( 0 ), floor( 1 ), floor( 2 ) ) * floor_dist( 0 ) * ceil_dist( 1 ) * ceil_dist( 2 ) +
-                img( floor( 0 ), ceil( 1 ), floor( 2 ) ) * ceil_dist( 0 ) * floor_dist( 1 ) * ceil_dist( 2 ) +
-                img( floor( 0 ), floor( 1 ), ceil( 2 ) ) * ceil_dist( 0 ) * ceil_dist( 1 ) * floor_dist( 2 ) +
-                img( ceil( 0 ), ceil( 1 ), floor( 2 ) ) * floor_dist( 0 ) * floor_dist( 1 ) * ceil_dist( 2 ) +
-                img( ceil( 0 ), floor( 1 ), ceil( 2 ) ) * floor_dist( 0 ) * ceil_dist( 1 ) * floor_dist( 2 ) +
-                img( floor( 0 ), ceil( 1 ), ceil( 2 ) ) * ceil_dist( 0 ) * floor_dist( 1 ) * floor_dist( 2 ) +
-                img( ceil( 0 ), ceil( 1 ), ceil( 2 ) ) * floor_dist( 0 ) * floor_dist( 1 ) * floor_dist( 2 ) );
-      }
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), img.size( 2 ), x, y, z ) );
+  }
+
+  template< class R >
+  inline bool LinearInterpolation::Weights( float coord, size_t size, size_t *index, R *weight ) {
+    COMMENT( "Both neighbors must be in the image. The last pixel is interpolated with its predecessor.", 4 );
+    if( !( coord >= 0.0f ) || ( size < 2 ) || ( coord > size - 1 ) )
+      return( false );
+    size_t flr = static_cast< size_t >( coord );
+    if( flr == size - 1 )
+      --flr;
+    index[ 0 ] = flr;
+    index[ 1 ] = flr + 1;
+    float ceil_dist = static_cast< float >( flr + 1 ) - coord;
+    weight[ 0 ] = ceil_dist;
+    weight[ 1 ] = static_cast< float >( 1.0 - ceil_dist );
+    return( true );
+  }
+
+  template< class D >
+  inline D LinearInterpolation::Sample( const D *data, size_t x_size, size_t y_size, float x, float y ) {
+    size_t ix[ 2 ];
+    size_t iy[ 2 ];
+    float wx[ 2 ];
+    float wy[ 2 ];
+    if( ( !Weights( x, x_size, ix, wx ) ) || ( !Weights( y, y_size, iy, wy ) ) )
       return( 0 );
+    const D *row0 = data + x_size * iy[ 0 ];
+    const D *row1 = row0 + x_size;
+    COMMENT( "Same order of operations as the original per-pixel interpolation.", 4 );
+    return( row0[ ix[ 0 ] ] * wx[ 0 ] * wy[ 0 ] + row0[ ix[ 1 ] ] * wx[ 1 ] * wy[ 0 ] +
+            row1[ ix[ 0 ] ] * wx[ 0 ] * wy[ 1 ] + row1[ ix[ 1 ] ] * wx[ 1 ] * wy[ 1 ] );
+  }
+
+  template< class D >
+  inline D LinearInterpolation::Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x,
+                                        float y, float z ) {
+    size_t ix[ 2 ];
+    size_t iy[ 2 ];
+    size_t iz[ 2 ];
+    float wx[ 2 ];
+    float wy[ 2 ];
+    float wz[ 2 ];
+    if( ( !Weights( x, x_size, ix, wx ) ) || ( !Weights( y, y_size, iy, wy ) ) ||
+        ( !Weights( z, z_size, iz, wz ) ) )
+      return( 0 );
+    size_t slice = x_size * y_size;
+    const D *row00 = data + x_size * iy[ 0 ] + slice * iz[ 0 ];
+    const D *row10 = row00 + x_size;
+    const D *row01 = row00 + slice;
+    const D *row11 = row01 + x_size;
+    return( row00[ ix[ 0 ] ] * wx[ 0 ] * wy[ 0 ] * wz[ 0 ] + row00[ ix[ 1 ] ] * wx[ 1 ] * wy[ 0 ] * wz[ 0 ] +
+            row10[ ix[ 0 ] ] * wx[ 0 ] * wy[ 1 ] * wz[ 0 ] + row01[ ix[ 0 ] ] * wx[ 0 ] * wy[ 0 ] * wz[ 1 ] +
+            row10[ ix[ 1 ] ] * wx[ 1 ] * wy[ 1 ] * wz[ 0 ] + row01[ ix[ 1 ] ] * wx[ 1 ] * wy[ 0 ] * wz[ 1 ] +
+            row11[ ix[ 0 ] ] * wx[ 0 ] * wy[ 1 ] * wz[ 1 ] + row11[ ix[ 1 ] ] * wx[ 1 ] * wy[ 1 ] * wz[ 1 ] );
+  }
+
+  template< class D >
+  D CubicBSplineInterpolation::operator()( const Image< D > &img, float x, float y ) const {
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), x, y ) );
+  }
+
+  template< class D >
+  D CubicBSplineInterpolation::operator()( const Image< D > &img, float x, float y, float z ) const {
+    return( Sample( img.data( ), img.size( 0 ), img.size( 1 ), img.size( 2 ), x, y, z ) );
+  }
+
+  template< class R >
+  inline bool CubicBSplineInterpolation::Weights( float coord, size_t size, size_t *index, R *weight ) {
+    if( !( coord >= 0.0f ) || ( coord > size - 1 ) )
+      return( false );
+    size_t flr = static_cast< size_t >( coord );
+    R t = coord - static_cast< R >( flr );
+    R c = 1 - t;
+    weight[ 0 ] = c * c * c / 6;
+    weight[ 1 ] = ( 4 - 6 * t * t + 3 * t * t * t ) / 6;
+    weight[ 3 ] = t * t * t / 6;
+    weight[ 2 ] = 1 - weight[ 0 ] - weight[ 1 ] - weight[ 3 ];
+    COMMENT( "Samples beyond the borders are mirrored about the first and last pixels.", 4 );
+    long period = 2 * ( static_cast< long >( size ) - 1 );
+    for( size_t tap = 0; tap < 4; ++tap ) {
+      long idx = static_cast< long >( flr + tap ) - 1;
+      if( period == 0 )
+        idx = 0;
+      else {
+        idx = std::abs( idx ) % period;
+        if( idx >= static_cast< long >( size ) )
+          idx = period - idx;
+      }
+      index[ tap ] = idx;
     }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
+    return( true );
+  }
+
+  template< class D >
+  inline D CubicBSplineInterpolation::Sample( const D *data, size_t x_size, size_t y_size, float x, float y ) {
+    typedef typename std::conditional< ( sizeof( D ) > 4 ), double, float >::type R;
+    size_t ix[ 4 ];
+    size_t iy[ 4 ];
+    R wx[ 4 ];
+    R wy[ 4 ];
+    if( ( !Weights( x, x_size, ix, wx ) ) || ( !Weights( y, y_size, iy, wy ) ) )
+      return( 0 );
+    R res = 0;
+    for( size_t tpy = 0; tpy < 4; ++tpy ) {
+      const D *row = data + x_size * iy[ tpy ];
+      R acc = row[ ix[ 0 ] ] * wx[ 0 ] + row[ ix[ 1 ] ] * wx[ 1 ] + row[ ix[ 2 ] ] * wx[ 2 ] + row[ ix[ 3 ] ] * wx[ 3 ];
+      res += acc * wy[ tpy ];
     }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
+    return( static_cast< D >( res ) );
+  }
+
+  template< class D >
+  inline D CubicBSplineInterpolation::Sample( const D *data, size_t x_size, size_t y_size, size_t z_size, float x,
+                                              float y, float z ) {
+    typedef typename std::conditional< ( sizeof( D ) > 4 ), double, float >::type R;
+    size_t ix[ 4 ];
+    size_t iy[ 4 ];
+    size_t iz[ 4 ];
+    R wx[ 4 ];
+    R wy[ 4 ];
+    R wz[ 4 ];
+    if( ( !Weights( x, x_size, ix, wx ) ) || ( !Weights( y, y_size, iy, wy ) ) ||
+        ( !Weights( z, z_size, iz, wz ) ) )
+      return( 0 );
+    R res = 0;
+    for( size_t tpz = 0; tpz < 4; ++tpz ) {
+      R plane = 0;
+      for( size_t tpy = 0; tpy < 4; ++tpy ) {
+        const D *row = data + x_size * ( iy[ tpy ] + y_size * iz[ tpz ] );
+        R acc = row[ ix[ 0 ] ] * wx[ 0 ] + row[ ix[ 1 ] ] * wx[ 1 ] + row[ ix[ 2 ] ] * wx[ 2 ] +
+          row[ ix[ 3 ] ] * wx[ 3 ];
+        plane += acc * wy[ tpy ];
+      }
+      res += plane * wz[ tpz ];
     }
+    return( static_cast< D >( res ) );
   }
 
 }
@@ -0,0 +1,221 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Order statistics of a window sliding along image rows. Used by median filter and median features.
+ * <br> Future add-on's: none.
+ */
+
+#include "Common.hpp"
+#include "Vector.hpp"
+
+#ifndef BIALRANKWINDOW_H
+#define BIALRANKWINDOW_H
+
+namespace Bial {
+
+  template< class D >
+  class Image;
+  class Adjacency;
+
+  /**
+   * @brief Multiset of values supporting insertion, removal and k-th smallest element queries. Integer values in
+   * a short range are kept in a histogram with a rank pointer that moves incrementally (Huang). Otherwise, values
+   * are kept in a sorted buffer. Queries of many consecutive ranks walk across the histogram, so they use the
+   * histogram only if the range is not much longer than the capacity.
+   */
+  template< class D >
+  class RankSet {
+
+  private:
+    /** @brief True if values are kept in histogram. */
+    bool histogram;
+    /** @brief Value of the first histogram bin. */
+    D minimum;
+    /** @brief Histogram of values. */
+    Vector< size_t > count;
+    /** @brief Histogram bin of last query and number of elements in bins before it. */
+    size_t bin;
+    size_t below;
+    /** @brief Sorted values. Only the first elements positions are used. */
+    Vector< D > sorted;
+    /** @brief Number of elements in the set. */
+    size_t elements;
+
+  public:
+
+    /** @brief Maximum number of histogram bins. Longer ranges use sorted buffer. */
+    static const size_t histogram_limit = 65536;
+
+    /**
+     * @date 2026/Oct/18
+     * @param minimum: Minimum value to be inserted.
+     * @param maximum: Maximum value to be inserted.
+     * @param capacity: Maximum number of elements in the set at the same time.
+     * @param ranks: Number of consecutive ranks queried at each time.
+     * @return none.
+     * @brief Basic constructor.
+     * @warning Values out of [minimum, maximum] must not be inserted.
+     */
+    RankSet( D minimum, D maximum, size_t capacity, size_t ranks = 1 );
+
+    /**
+     * @date 2026/Oct/18
+     * @param value: Value to be inserted.
+     * @param copies: Number of copies of value to be inserted.
+     * @return none.
+     * @brief Inserts copies of value in the set.
+     * @warning Set capacity must not be exceeded.
+     */
+    void Insert( D value, size_t copies = 1 );
+
+    /**
+     * @date 2026/Oct/18
+     * @param value: Value to be removed.
+     * @param copies: Number of copies of value to be removed.
+     * @return none.
+     * @brief Removes copies of value from the set.
+     * @warning The copies must be in the set.
+     */
+    void Remove( D value, size_t copies = 1 );
+
+    /**
+     * @date 2026/Oct/18
+     * @param old_value: Value to be removed.
+     * @param new_value: Value to be inserted.
+     * @return none.
+     * @brief Replaces one copy of old_value by new_value. In sorted buffer, only the elements between both values
+     * are moved.
+     * @warning old_value must be in the set.
+     */
+    void Replace( D old_value, D new_value );
+
+    /**
+     * @date 2026/Oct/18
+     * @param rank: Rank of the element, starting from 0.
+     * @return The rank-th smallest value in the set.
+     * @brief Returns the rank-th smallest value in the set.
+     * @warning rank must be smaller than the number of elements.
+     */
+    D Rank( size_t rank );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Number of elements in the set.
+     * @brief Returns the number of elements in the set.
+     * @warning none.
+     */
+    size_t size( ) const;
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Removes all elements. Histogram mode takes time proportional to the number of bins.
+     * @warning none.
+     */
+    void Clear( );
+
+  };
+
+  /**
+   * @brief Window given by an adjacency relation sliding along the rows of an image. Moving to the next pixel
+   * removes and inserts only the adjacents in the leaving and entering faces of the adjacency relation. Adjacents
+   * out of the image, or with null mask, are not in the window.
+   */
+  template< class D >
+  class RankWindow {
+
+  private:
+    /** @brief Input image. */
+    const Image< D > &img;
+    /** @brief Mask restricting the adjacents. nullptr for no restriction. */
+    const Image< D > *msk;
+    /** @brief Displacements of the adjacents. Linear displacements are 64-bit, as images may exceed 2^31 pixels. */
+    Vector< int > dx;
+    Vector< int > dy;
+    Vector< int > dz;
+    Vector< llint > displacement;
+    /** @brief Adjacents leaving and entering the window when moving to next pixel in x. */
+    Vector< size_t > leaving;
+    Vector< size_t > entering;
+    /** @brief Indexes of leaving adjacents while moving to next pixel. */
+    Vector< size_t > old_index;
+    /** @brief Adjacents whose y and z coordinates are in the image at current row. */
+    Vector< bool > row_valid;
+    /** @brief Values in the window. */
+    RankSet< D > values;
+    /** @brief Current pixel coordinates. */
+    size_t x;
+    size_t y;
+    size_t z;
+    /** @brief True if window contains the adjacents of current pixel. */
+    bool filled;
+
+  public:
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: Input image.
+     * @param adj: Adjacency relation.
+     * @param minimum: Minimum value of the image.
+     * @param maximum: Maximum value of the image.
+     * @param msk: Mask restricting the adjacents. nullptr for no restriction.
+     * @param ranks: Number of consecutive ranks queried at each pixel.
+     * @return none.
+     * @brief Basic constructor. Window is empty until Row is called.
+     * @warning Image and adjacency must have compatible dimensions.
+     */
+    RankWindow( const Image< D > &img, const Adjacency &adj, D minimum, D maximum, const Image< D > *msk = nullptr,
+                size_t ranks = 1 );
+
+    /**
+     * @date 2026/Oct/18
+     * @param y: Row y coordinate.
+     * @param z: Row z coordinate.
+     * @return none.
+     * @brief Moves the window to the first pixel of the given row.
+     * @warning none.
+     */
+    void Row( size_t y, size_t z );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return none.
+     * @brief Moves the window to the next pixel in current row.
+     * @warning Must not be called at the last pixel of the row.
+     */
+    void Next( );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Set of values in the window.
+     * @brief Returns the set of values in the window. Callers may insert padding values temporarily, as long as
+     * they remove them before moving the window.
+     * @warning none.
+     */
+    RankSet< D > &Values( );
+
+  private:
+
+    /**
+     * @date 2026/Oct/18
+     * @param adj: Position in adjacency relation.
+     * @return Index of adjacent of current pixel, or image size if it is not in the window.
+     * @brief Returns the index of the adjacent of current pixel if it is in the image and in the mask.
+     * @warning none.
+     */
+    size_t Adjacent( size_t adj ) const;
+
+  };
+
+}
+
+#include "RankWindow.cpp"
+
+#endif
@@ -0,0 +1,113 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Image resampling templated on the pixel interpolation.
+ */
+
+#ifndef BIALRESAMPLING_H
+#define BIALRESAMPLING_H
+
+#include "Common.hpp"
+#include "Vector.hpp"
+#include <type_traits>
+
+namespace Bial {
+
+  template< class D >
+  class Image;
+  template< class D >
+  class Matrix;
+  class PixelInterpolation;
+
+  /**
+   * @brief Resampling of images by affine transforms and by scaling. Functions are templated on the interpolation
+   * class, so that the interpolation of each pixel is inlined instead of called through the virtual operator of
+   * PixelInterpolation. Coordinates are stepped along output rows, and rows are resampled in parallel. Scaling and
+   * translation are resampled one dimension at a time, with the interpolation weights of each output row, column
+   * and slice computed once.
+   */
+  namespace Resampling {
+
+    /** @brief Type of intermediate results: float, or double for 64-bit pixel types. */
+    template< class D >
+    using Real = typename std::conditional< ( sizeof( D ) > 4 ), double, float >::type;
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: Input image.
+     * @return Cubic B-spline coefficients of the input image.
+     * @brief Computes the coefficients of the cubic B-spline that interpolates the input image, by the recursive
+     * filter of Unser, one dimension at a time, in parallel. Borders are mirrored, as in CubicBSplineInterpolation.
+     * @warning none.
+     */
+    template< class D >
+    Image< Real< D > > BSplineCoefficients( const Image< D > &img );
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: Input image.
+     * @param transform: 3x3 matrix for 2D images or 4x4 matrix for 3D images, as in Geometrics::AffineTransform.
+     * @return Transformed image, with the dimensions of the input image.
+     * @brief Same result as Geometrics::AffineTransform with interpolation I, up to float rounding of the
+     * coordinates. Transforms with no rotation or shear are resampled by Separable.
+     * @warning none.
+     */
+    template< class I, class D >
+    Image< D > Affine( const Image< D > &img, const Matrix< float > &transform );
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: Input image.
+     * @param dim: Dimensions of the output image.
+     * @param pixel_size: Pixel size of the output image.
+     * @param scale, translation: Output pixel of coordinate u in a dimension is interpolated from coordinate
+     * u * scale + translation of the input image, for each dimension of the input image.
+     * @return Resampled image.
+     * @brief Resamples the image one dimension at a time, in parallel. Each pass interpolates the rows of the
+     * previous one with precomputed indexes and weights. Nearest interpolation copies pixels directly.
+     * @warning none.
+     */
+    template< class I, class D >
+    Image< D > Separable( const Image< D > &img, const Vector< size_t > &dim, const Vector< float > &pixel_size,
+                          const Vector< double > &scale, const Vector< double > &translation );
+
+    /**
+     * @date 2026/Oct/18
+     * @param img: Input image.
+     * @param transform: 3x3 matrix for 2D images or 4x4 matrix for 3D images.
+     * @param interpolation: Pixel interpolation.
+     * @param res: Returns the transformed image.
+     * @return false if interpolation is not NearestInterpolation, LinearInterpolation or
+     * CubicBSplineInterpolation. Then, the caller must interpolate pixel by pixel.
+     * @brief Calls Affine with the type of the interpolation.
+     * @warning none.
+     */
+    template< class D >
+    bool Affine( const Image< D > &img, const Matrix< float > &transform, const PixelInterpolation &interpolation,
+                 Image< D > &res );
+
+    /**
+     * @date 2026/Oct/18
+     * @param img, dim, pixel_size, scale, translation: As in Separable.
+     * @param interpolation: Pixel interpolation.
+     * @param res: Returns the resampled image.
+     * @return false if interpolation is not NearestInterpolation, LinearInterpolation or
+     * CubicBSplineInterpolation. Then, the caller must interpolate pixel by pixel.
+     * @brief Calls Separable with the type of the interpolation.
+     * @warning none.
+     */
+    template< class D >
+    bool Separable( const Image< D > &img, const Vector< size_t > &dim, const Vector< float > &pixel_size,
+                    const Vector< double > &scale, const Vector< double > &translation,
+                    const PixelInterpolation &interpolation, Image< D > &res );
+
+  }
+
+}
+
+#include "Resampling.cpp"
+
+#endif
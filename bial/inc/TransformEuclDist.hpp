@@ -16,6 +16,8 @@ namespace Bial {
 
   template< class D >
   class Image;
+  template< class D >
+  class Vector;
 
   namespace Transform {
     
@@ -23,8 +25,9 @@ namespace Bial {
      * @date 2015/May/21
      * @param border: Border of binary image.
      * @return Distance map from the Euclidean distance transform.
-     * @brief Computes the Euclidean distance transform, starting from border pixels.
-     * @warning This function should use pixel dimensions but is not using yet.
+     * @brief Computes the exact Euclidean distance transform, starting from border pixels. Distances are in the
+     * units of the pixel size of border.
+     * @warning Pixels are given sqrt( INT_MAX ) if border has no nonzero pixels.
      */
     template< class D >
     Image< D > EDT( const Image< D > &border );
@@ -34,12 +37,43 @@ namespace Bial {
      * @param border: Border of binary image.
      * @param mask: Binary image.
      * @return Distance map from the Euclidean distance transform.
-     * @brief Computes the Euclidean distance transform, starting from border pixels inside the mask region.
-     * @warning This function should use pixel dimensions but is not using yet.
+     * @brief Computes the exact Euclidean distance transform, starting from border pixels inside the mask region.
+     * Distances are in the units of the pixel size of border. Pixels outside the mask are set to 0.
+     * @warning Distances are straight line distances to the nearest border pixel in the mask, even if the line
+     * leaves the mask. Pixels are given sqrt( INT_MAX ) if no border pixel is in the mask.
      */
     template< class D >
     Image< D > EDT( const Image< D > &border, const Image< D > &mask );
 
+    /**
+     * @date 2026/Oct/18
+     * @param border: Border of binary image.
+     * @param mask: Binary image.
+     * @param root: Returns the index of the nearest border pixel of each pixel in the mask, and -1 elsewhere.
+     * @return Distance map from the Euclidean distance transform.
+     * @brief Computes the exact Euclidean distance transform, starting from border pixels inside the mask region,
+     * and the nearest border pixel of each pixel. Same distances as EDT( border, mask ).
+     * @warning Pixels are given root -1 if no border pixel is in the mask.
+     */
+    template< class D >
+    Image< D > EDT( const Image< D > &border, const Image< D > &mask, Image< bial_index > &root );
+
+    /**
+     * @date 2026/Oct/18
+     * @param sqr_dist: Squared distances. Infinite for pixels that are not reached yet. Transformed in place.
+     * @param root: Nearest root of each pixel. Updated in place. Ignored if empty.
+     * @param dim_size: Size of each dimension of the image.
+     * @param dim: Dimension to be transformed.
+     * @param pixel_size: Pixel size in dimension dim.
+     * @return none.
+     * @brief Computes the lower envelope of the parabolas rooted at each pixel of all lines of dimension dim, in
+     * parallel. Running it over all dimensions of the squared distances of the roots, 0 at roots and infinite
+     * elsewhere, gives the squared Euclidean distance transform.
+     * @warning none.
+     */
+    void EDTPass( Vector< double > &sqr_dist, Vector< bial_index > &root, const Vector< size_t > &dim_size,
+                  size_t dim, float pixel_size );
+
   }
 
 }
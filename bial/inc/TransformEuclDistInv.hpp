@@ -23,11 +23,13 @@ namespace Bial {
      * @date 2014/Jan/07
      * @param border: Border of binary image.
      * @param mask: Binary image.
-     * @param root_dist: Minimum distance to a root pixel .
-     * @return The root map of the inverse paths to a pixel that is at root_dist distance from the border.
-     * @brief Computes the distance transform and then follows the paths backwards to a pixel that is at root_dist
-     * distance from the border.
-     * @warning This function should use pixel dimensions but is not using yet.
+     * @param root_dist: Minimum distance to a root pixel, in the units of the pixel size of border.
+     * @return Root map. Each pixel in the mask gets the index of its nearest root, and pixels outside the mask get 0.
+     * @brief Computes the distance transform from the border. Roots are the pixels in the mask at root_dist or more
+     * from the border, or the deepest pixels if none is that deep. The nearest root of each pixel is given by the
+     * distance transform from the roots.
+     * @warning Nearest roots are at straight line distance, even if the line leaves the mask. Root indexes are stored
+     * as D, so that float maps are exact only for images of up to 2^24 pixels.
      */
     template< class D >
     Image< D > InverseEDT( const Image< D > &border, const Image< D > &mask, int root_dist );
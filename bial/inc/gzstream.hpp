@@ -32,27 +32,45 @@
 #define GZSTREAM_H
 
 #include "Common.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <vector>
 #include <zlib.h>
 
 namespace Bial {
 
+  /*
+   * Input is read by gzread through a large buffer, and large reads are decompressed straight into the caller
+   * memory. Output is compressed by blocks in parallel, as in pigz: each block is a raw deflate stream primed with
+   * the last 32KB of the previous block and ended with a sync flush, so that the concatenation of blocks is a
+   * single gzip member.
+   */
   class gzstreambuf : public std::streambuf {
 private:
-    static const int bufferSize = 47 + 256; /* size of data buff */
-    /* totals 512 bytes under g++ for igzstream at the end. */
-    gzFile file; /* file handle for compressed file */
-    char buffer[ bufferSize ]; /* data buffer */
+    static const size_t putback = 4; /* size of putback area of input buffer */
+    static const size_t window = 32768; /* deflate window size, used as dictionary of next block */
+    gzFile file; /* file handle for compressed input file */
+    std::ofstream raw; /* file handle for compressed output file */
+    std::vector< char > buffer; /* data buffer */
+    size_t buffer_size; /* size of input buffer and of output compression blocks */
     char opened; /* open/close state of stream */
     int mode; /* I/O mode */
+    int level; /* compression level */
+    std::vector< std::vector< char > > blocks; /* compressed output blocks */
+    std::vector< uLong > block_crc; /* CRC-32 of uncompressed output blocks */
+    std::vector< char > dictionary; /* last uncompressed output bytes, up to window size */
+    uLong crc; /* CRC-32 of all uncompressed output */
+    uLong total; /* size of all uncompressed output, modulo 2^32 */
     int flush_buffer( );
+    bool deflate_block( const char *data, size_t size, const char *dict, size_t dict_size, int flush,
+                        std::vector< char > &out );
 public:
-    gzstreambuf( ) try : opened( 0 ) {
-      setp( buffer, buffer + ( bufferSize - 1 ) );
-      setg( buffer + 4, /* beginning of putback area */
-            buffer + 4, /* read position */
-            buffer + 4 ); /* end position */
+    static const size_t default_buffer_size = 131072; /* default size of buffers and compression blocks */
+    gzstreambuf( ) try : buffer_size( default_buffer_size ), opened( 0 ), mode( 0 ),
+      level( Z_DEFAULT_COMPRESSION ), crc( 0 ), total( 0 ) {
+      setp( nullptr, nullptr );
+      setg( nullptr, nullptr, nullptr );
       /* ASSERT: both input & output capabilities will not be used together */
     }
     catch( std::ios_base::failure &e ) {
@@ -77,18 +95,37 @@ public:
       throw( std::logic_error( msg ) );
     }
 
+    /*
+     * Size of input buffer and of output compression blocks. On an open output stream, pending data are compressed
+     * first. On an open input stream, unread data are kept; the internal buffer of zlib keeps its size.
+     */
+    void BufferSize( size_t size );
+    size_t BufferSize( ) const {
+      return( buffer_size );
+    }
+    /* Compression level from 0 to 9, or Z_DEFAULT_COMPRESSION. */
+    void Level( int compression_level ) {
+      level = compression_level;
+    }
+
     bool is_open( ) const {
       return( opened );
     }
     gzstreambuf* open( const char *name, int open_mode );
     gzstreambuf* close( );
     ~gzstreambuf( ) {
-      close( );
+      try {
+        close( );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to close file. Exception: " << e.what( ) );
+      }
     }
 
     virtual int overflow( int c = EOF );
     virtual int underflow( );
     virtual int sync( );
+    virtual std::streamsize xsgetn( char *s, std::streamsize n );
   };
 
   class gzstreambase : virtual public std::ios {
@@ -445,18 +482,34 @@ namespace Bial {
           ( ( mode & std::ios::in ) && ( mode & std::ios::out ) ) ) {
         return( ( gzstreambuf* ) 0 );
       }
-      char fmode[ 10 ];
-      char *fmodeptr = fmode;
       if( mode & std::ios::in ) {
-        *fmodeptr++ = 'r';
+        file = gzopen( name, "rb" );
+        if( file == 0 ) {
+          return( ( gzstreambuf* ) 0 );
+        }
+        gzbuffer( file, buffer_size );
+        buffer.resize( buffer_size + putback );
+        setg( buffer.data( ) + putback, buffer.data( ) + putback, buffer.data( ) + putback );
       }
       else if( mode & std::ios::out ) {
-        *fmodeptr++ = 'w';
-      }
-      *fmodeptr++ = 'b';
-      *fmodeptr = '\0';
-      file = gzopen( name, fmode );
-      if( file == 0 ) {
+        raw.open( name, std::ios::out | std::ios::binary | std::ios::trunc );
+        if( !raw.is_open( ) ) {
+          return( ( gzstreambuf* ) 0 );
+        }
+        COMMENT( "Writing gzip header: deflate method, no flags nor time stamp, Unix OS.", 2 );
+        const char header[ 10 ] = { '\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, 3 };
+        raw.write( header, 10 );
+        COMMENT( "Output buffer holds one compression block per thread.", 2 );
+        size_t threads = ThreadPool::Global( ).Threads( );
+        buffer.resize( buffer_size * threads );
+        blocks.resize( threads );
+        block_crc.resize( threads );
+        dictionary.clear( );
+        crc = crc32( 0L, Z_NULL, 0 );
+        total = 0;
+        setp( buffer.data( ), buffer.data( ) + buffer.size( ) - 1 );
+      }
+      else {
         return( ( gzstreambuf* ) 0 );
       }
       opened = 1;
@@ -487,16 +540,35 @@ namespace Bial {
   inline gzstreambuf* gzstreambuf::close( ) {
     try {
       if( is_open( ) ) {
-        sync( );
         opened = 0;
-        if( gzclose( file ) == Z_OK ) {
+        if( mode & std::ios::in ) {
+          setg( nullptr, nullptr, nullptr );
+          if( gzclose( file ) == Z_OK ) {
+            return( this );
+          }
+          return( ( gzstreambuf* ) 0 );
+        }
+        bool done = ( flush_buffer( ) != EOF );
+        COMMENT( "Writing final empty deflate block and gzip trailer with CRC-32 and size.", 2 );
+        std::vector< char > last;
+        done = done && deflate_block( nullptr, 0, nullptr, 0, Z_FINISH, last );
+        char trailer[ 8 ];
+        for( size_t byte = 0; byte < 4; ++byte ) {
+          trailer[ byte ] = static_cast< char >( ( crc >> ( 8 * byte ) ) & 0xff );
+          trailer[ byte + 4 ] = static_cast< char >( ( total >> ( 8 * byte ) ) & 0xff );
+        }
+        raw.write( last.data( ), last.size( ) );
+        raw.write( trailer, 8 );
+        raw.close( );
+        setp( nullptr, nullptr );
+        if( ( done ) && ( !raw.fail( ) ) ) {
           return( this );
         }
       }
       return( ( gzstreambuf* ) 0 );
     }
     catch( std::ios_base::failure &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while writing file." ) );
       throw( std::ios_base::failure( msg ) );
     }
     catch( std::bad_alloc &e ) {
@@ -526,20 +598,21 @@ namespace Bial {
         return( EOF );
       }
       /* Josuttis' implementation of inbuf */
-      int n_putback = gptr( ) - eback( );
-      if( n_putback > 4 ) {
-        n_putback = 4;
+      size_t n_putback = gptr( ) - eback( );
+      if( n_putback > putback ) {
+        n_putback = putback;
       }
-      memcpy( buffer + ( 4 - n_putback ), gptr( ) - n_putback, n_putback );
+      char *base = buffer.data( );
+      memmove( base + ( putback - n_putback ), gptr( ) - n_putback, n_putback );
 
-      int num = gzread( file, buffer + 4, bufferSize - 4 );
+      int num = gzread( file, base + putback, buffer_size );
       if( num <= 0 ) { /* ERROR or EOF */
         return( EOF );
       }
       /* reset buffer pointers */
-      setg( buffer + ( 4 - n_putback ), /* beginning of putback area */
-            buffer + 4, /* read position */
-            buffer + 4 + num ); /* end of buffer */
+      setg( base + ( putback - n_putback ), /* beginning of putback area */
+            base + putback, /* read position */
+            base + putback + num ); /* end of buffer */
 
       /* return next character */
       return( *reinterpret_cast< unsigned char* >( gptr( ) ) );
@@ -566,21 +639,146 @@ namespace Bial {
     }
   }
 
+  inline std::streamsize gzstreambuf::xsgetn( char *s, std::streamsize n ) { /* used for input buffer only */
+    try {
+      COMMENT( "Copying buffered data.", 4 );
+      std::streamsize done = std::min< std::streamsize >( n, egptr( ) - gptr( ) );
+      if( done > 0 ) {
+        memcpy( s, gptr( ), done );
+        gbump( done );
+      }
+      if( ( done == n ) || !( mode & std::ios::in ) || !opened ) {
+        return( done );
+      }
+      if( static_cast< size_t >( n - done ) < buffer_size ) {
+        return( done + std::streambuf::xsgetn( s + done, n - done ) );
+      }
+      COMMENT( "Decompressing large reads straight into the destination.", 4 );
+      while( done < n ) {
+        unsigned chunk = static_cast< unsigned >( std::min< std::streamsize >( n - done, 1 << 30 ) );
+        int num = gzread( file, s + done, chunk );
+        if( num <= 0 ) {
+          break;
+        }
+        done += num;
+      }
+      char *base = buffer.data( );
+      size_t n_putback = std::min( static_cast< size_t >( done ), static_cast< size_t >( putback ) );
+      memcpy( base + ( putback - n_putback ), s + done - n_putback, n_putback );
+      setg( base + ( putback - n_putback ), base + putback, base + putback );
+      return( done );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  inline bool gzstreambuf::deflate_block( const char *data, size_t size, const char *dict, size_t dict_size,
+                                          int flush, std::vector< char > &out ) {
+    z_stream strm;
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    if( deflateInit2( &strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) {
+      return( false );
+    }
+    if( ( dict_size > 0 ) &&
+        ( deflateSetDictionary( &strm, reinterpret_cast< const Bytef* >( dict ), dict_size ) != Z_OK ) ) {
+      deflateEnd( &strm );
+      return( false );
+    }
+    out.resize( deflateBound( &strm, size ) + 16 );
+    strm.next_in = reinterpret_cast< Bytef* >( const_cast< char* >( data ) );
+    strm.avail_in = size;
+    size_t produced = 0;
+    int res;
+    do {
+      if( produced == out.size( ) ) {
+        out.resize( 2 * out.size( ) );
+      }
+      strm.next_out = reinterpret_cast< Bytef* >( out.data( ) + produced );
+      strm.avail_out = out.size( ) - produced;
+      res = deflate( &strm, flush );
+      produced = out.size( ) - strm.avail_out;
+    } while( ( res == Z_OK ) && ( ( strm.avail_in > 0 ) || ( strm.avail_out == 0 ) ) );
+    out.resize( produced );
+    deflateEnd( &strm );
+    return( ( res == Z_OK ) || ( res == Z_STREAM_END ) || ( res == Z_BUF_ERROR ) );
+  }
+
   inline int gzstreambuf::flush_buffer( ) {
     try {
       /*
        * Separate the writing of the buffer from overflow() and
        * sync( ) operation.
        */
-      int w = std::streambuf::pptr( ) - std::streambuf::pbase( );
-      if( gzwrite( file, std::streambuf::pbase( ), w ) != w ) {
+      char *base = std::streambuf::pbase( );
+      size_t w = std::streambuf::pptr( ) - base;
+      if( w == 0 ) {
+        return( 0 );
+      }
+      size_t total_blocks = ( w + buffer_size - 1 ) / buffer_size;
+      COMMENT( "Compressing " << total_blocks << " blocks in parallel.", 4 );
+      bool done = true;
+      ThreadPool::Global( ).Run( total_blocks, [ & ]( size_t blk, size_t ) {
+          const char *data = base + blk * buffer_size;
+          size_t size = std::min( buffer_size, w - blk * buffer_size );
+          const char *dict = data - std::min( static_cast< size_t >( window ), blk * buffer_size );
+          size_t dict_size = data - dict;
+          if( blk == 0 ) {
+            dict = dictionary.data( );
+            dict_size = dictionary.size( );
+          }
+          block_crc[ blk ] = crc32( 0L, reinterpret_cast< const Bytef* >( data ), size );
+          if( !deflate_block( data, size, dict, dict_size, Z_SYNC_FLUSH, blocks[ blk ] ) ) {
+            done = false;
+          }
+        } );
+      if( !done ) {
+        return( EOF );
+      }
+      COMMENT( "Writing blocks in order and combining their CRC-32.", 4 );
+      for( size_t blk = 0; blk < total_blocks; ++blk ) {
+        raw.write( blocks[ blk ].data( ), blocks[ blk ].size( ) );
+        size_t size = std::min( buffer_size, w - blk * buffer_size );
+        crc = crc32_combine( crc, block_crc[ blk ], size );
+        total += size;
+      }
+      COMMENT( "Keeping last window of data as dictionary of next block.", 4 );
+      if( w >= window ) {
+        dictionary.assign( base + w - window, base + w );
+      }
+      else {
+        dictionary.insert( dictionary.end( ), base, base + w );
+        if( dictionary.size( ) > window ) {
+          dictionary.erase( dictionary.begin( ), dictionary.end( ) - window );
+        }
+      }
+      setp( base, std::streambuf::epptr( ) );
+      if( raw.fail( ) ) {
         return( EOF );
       }
-      pbump( -w );
       return( w );
     }
     catch( std::ios_base::failure &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while writing file." ) );
       throw( std::ios_base::failure( msg ) );
     }
     catch( std::bad_alloc &e ) {
@@ -616,7 +814,7 @@ namespace Bial {
       return( c );
     }
     catch( std::ios_base::failure &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while writing file." ) );
       throw( std::ios_base::failure( msg ) );
     }
     catch( std::bad_alloc &e ) {
@@ -637,17 +835,49 @@ namespace Bial {
     }
   }
 
-  inline int gzstreambuf::sync( ) {
+  inline int gzstreambuf::sync( ) { /* used for output buffer only */
+    /*
+     * Pending output is compressed and written, ending with a sync flush, so that all data written so far can be
+     * decompressed. Each flush ends the current blocks, so frequent flushes, as by std::endl, reduce compression.
+     */
+    if( !( mode & std::ios::out ) || !opened ) {
+      return( 0 );
+    }
+    if( ( flush_buffer( ) == EOF ) || raw.flush( ).fail( ) ) {
+      return( -1 );
+    }
+    return( 0 );
+  }
+
+  inline void gzstreambuf::BufferSize( size_t size ) {
     try {
-      if( std::streambuf::pptr( ) && ( std::streambuf::pptr( ) > std::streambuf::pbase( ) ) ) {
+      size = std::max( size, static_cast< size_t >( window ) );
+      if( ( opened ) && ( mode & std::ios::out ) ) {
+        COMMENT( "Compressing pending data with the previous block size.", 2 );
         if( flush_buffer( ) == EOF ) {
-          return( -1 );
+          throw( std::runtime_error( BIAL_ERROR( "Could not compress pending data." ) ) );
         }
+        buffer_size = size;
+        buffer.resize( buffer_size * blocks.size( ) );
+        setp( buffer.data( ), buffer.data( ) + buffer.size( ) - 1 );
+      }
+      else if( ( opened ) && ( mode & std::ios::in ) ) {
+        COMMENT( "Moving unread data and putback area to the new buffer.", 2 );
+        size_t n_putback = std::min( static_cast< size_t >( gptr( ) - eback( ) ), static_cast< size_t >( putback ) );
+        size_t unread = egptr( ) - gptr( );
+        std::vector< char > pending( gptr( ) - n_putback, egptr( ) );
+        buffer_size = size;
+        buffer.resize( std::max( buffer_size, unread ) + putback );
+        char *base = buffer.data( );
+        memcpy( base + ( putback - n_putback ), pending.data( ), pending.size( ) );
+        setg( base + ( putback - n_putback ), base + putback, base + putback + unread );
+      }
+      else {
+        buffer_size = size;
       }
-      return( 0 );
     }
     catch( std::ios_base::failure &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while writing file." ) );
       throw( std::ios_base::failure( msg ) );
     }
     catch( std::bad_alloc &e ) {
@@ -698,28 +928,12 @@ namespace Bial {
   }
 
   inline gzstreambase::~gzstreambase( ) {
+    /* Destructors must not throw. Errors of a file not closed explicitly are reported as warnings. */
     try {
       buf.close( );
     }
-    catch( std::ios_base::failure &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "I/O error while reading file." ) );
-      throw( std::ios_base::failure( msg ) );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
+    catch( std::exception &e ) {
+      BIAL_WARNING( "Failed to close file. Exception: " << e.what( ) );
     }
   }
 
@@ -20,11 +20,31 @@
 #ifndef LSH_INCLUDED
 #define LSH_INCLUDED
 
-void LSH_Init(const IntT *dataStream, IntT nElems, IntT nCarac, 
-              RealT *radiusList, IntT nRadius);
+// An LSH index over a data set. Several indices may exist at the same
+// time. Building and freeing an index are serialized internally.
+typedef struct _LSHIndexT *PLSHIndexT;
 
-IntT LSH_Query(IntT pointIndex, RealT maxRadius, IntT *queryPoints, RealT *queryDistances);
+// The temporary vectors of the queries of one thread on an index.
+// Queries on the same index with different query objects may run
+// concurrently.
+typedef struct _LSHQueryT *PLSHQueryT;
 
-void LSH_Free();
+// Builds an index over the <nElems> points of dimension <nCarac> in
+// <dataStream>, for each of the <nRadius> radii in <radiusList>. The
+// points are not copied, so <dataStream> must outlive the index. The
+// radii are copied.
+PLSHIndexT LSH_Init(const IntT *dataStream, IntT nElems, IntT nCarac, 
+                    const RealT *radiusList, IntT nRadius);
+
+PLSHQueryT LSH_NewQuery(PLSHIndexT index);
+
+// Writes the indices and distances of the points within <maxRadius> of
+// the data set point <pointIndex>, nearest first, and returns their
+// number. Both arrays must hold <nElems> - 1 values.
+IntT LSH_Query(PLSHQueryT query, IntT pointIndex, RealT maxRadius, IntT *queryPoints, RealT *queryDistances);
+
+void LSH_FreeQuery(PLSHQueryT query);
+
+void LSH_Free(PLSHIndexT index);
 
 #endif
@@ -141,6 +141,18 @@ typedef struct _RNearNeighborStructT {
   IntT sizeMarkedPoints;
 } RNearNeighborStructT, *PRNearNeighborStructT;
 
+// The temporary vectors of a query operation. Queries running at the
+// same time on the same R-NN structure must use different buffers,
+// since the ones inside the structure are shared.
+typedef struct _RNNQueryBuffersT {
+  // Same as the fields with the same names in <RNearNeighborStructT>.
+  Uns32T **pointULSHVectors;
+  Uns32T **precomputedHashesOfULSHs;
+  RealT *reducedPoint;
+  BooleanT *markedPoints;
+  Int32T *markedPointsIndeces;
+} RNNQueryBuffersT, *PRNNQueryBuffersT;
+
 void printRNNParameters(FILE *output, RNNParametersT parameters);
 
 RNNParametersT readRNNParameters(FILE *input);
@@ -157,6 +169,12 @@ void setResultReporting(PRNearNeighborStructT nnStruct, BooleanT reportingStoppe
 
 void addNewPointToPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT point);
 
+PRNNQueryBuffersT newRNNQueryBuffers(PRNearNeighborStructT nnStruct);
+
+void freeRNNQueryBuffers(PRNearNeighborStructT nnStruct, PRNNQueryBuffersT buffers);
+
+Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT query, PPointT *(&result), IntT &resultSize, PRNNQueryBuffersT buffers, IntT &nDistComps);
+
 Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT query, PPointT *(&result), IntT &resultSize);
 
 #endif
@@ -637,7 +637,7 @@ GeneralizedPGBucket getGBucket(PUHashStructureT uhash, IntT nBucketVectorPieces,
     while(p != NULL && 
 	  (p->controlValue1 != control1)) {
       p = p->nextGBucketInChain;
-      nBucketsInChains++;
+      // nBucketsInChains is not counted, since queries may run concurrently.
     }
     result.llGBucket = p;
     return result;
@@ -30,34 +30,42 @@
 #include "SelfTuning.hpp"
 #include "NearNeighbors.hpp"
 #include "LSH.hpp"
+#include <mutex>
 
 #define N_SAMPLE_QUERY_POINTS 100
 
-// The data set containing all the points.
-PPointT *dataSetPoints = NULL;
-// Number of points in the data set.
-IntT nPoints = 0;
-// The dimension of the points.
-IntT pointsDimension = 0;
-// The value of parameter R (a near neighbor of a point <q> is any
-// point <p> from the data set that is the within distance
-// <thresholdR>).
-//RealT thresholdR = 1.0;
-
 // The succes probability of each point (each near neighbor is
 // reported by the algorithm with probability <successProbability>).
-RealT successProbability = 0.9;
-
-// Same as <thresholdR>, only an array of R's (for the case when
-// multiple R's are specified).
-RealT *listOfRadii = NULL;
-IntT nRadii = 0;
-
-RealT *memRatiosForNNStructs = NULL;
-
-PRNearNeighborStructT *nnStructs = NULL;
-
-inline PPointT readPointFromStream(const IntT *dataStream){
+const RealT successProbability = 0.9;
+
+// Building and freeing indices use the global random generator,
+// tuning statistics and memory accounting, so they are serialized.
+static std::mutex initMutex;
+
+typedef struct _LSHIndexT {
+  // The data set containing all the points.
+  PPointT *dataSetPoints;
+  // Number of points in the data set.
+  IntT nPoints;
+  // The dimension of the points.
+  IntT pointsDimension;
+  // The radii of the R-NN structures, in increasing order.
+  RealT *listOfRadii;
+  IntT nRadii;
+  PRNearNeighborStructT *nnStructs;
+} LSHIndexT;
+
+typedef struct _LSHQueryT {
+  PLSHIndexT index;
+  // Temporary vectors for each R-NN structure.
+  PRNNQueryBuffersT *buffers;
+  // Results, large enough to hold all points, so that they are never
+  // resized.
+  PPointT *result;
+  PPointAndRealTStructT *distToNN;
+} LSHQueryT;
+
+inline PPointT readPointFromStream(const IntT *dataStream, IntT pointsDimension){
   PPointT p;
   RealT sqrLength = 0;
   FAILIF(NULL == (p = (PPointT)MALLOC(sizeof(PointT))));
@@ -73,18 +81,18 @@ inline PPointT readPointFromStream(const IntT *dataStream){
 // Reads in the data set points from <memory> in the array
 // <dataSetPoints>. Each point get a unique number in the field
 // <index> to be easily indentifiable.
-void readDataSetFromStream(const IntT *dataStream){
-  FAILIF(NULL == (dataSetPoints = (PPointT*)MALLOC(nPoints * sizeof(PPointT))));
-  for(IntT i = 0; i < nPoints; i++){
-    dataSetPoints[i] = readPointFromStream(&dataStream[i * pointsDimension]);
-    dataSetPoints[i]->index = i;
+void readDataSetFromStream(PLSHIndexT index, const IntT *dataStream){
+  FAILIF(NULL == (index->dataSetPoints = (PPointT*)MALLOC(index->nPoints * sizeof(PPointT))));
+  for(IntT i = 0; i < index->nPoints; i++){
+    index->dataSetPoints[i] = readPointFromStream(&dataStream[i * index->pointsDimension], index->pointsDimension);
+    index->dataSetPoints[i]->index = i;
   }
 }
 
 // Tranforming <memRatiosForNNStructs> from
 // <memRatiosForNNStructs[i]=ratio of mem/total mem> to
 // <memRatiosForNNStructs[i]=ratio of mem/mem left for structs i,i+1,...>.
-void transformMemRatios(){
+void transformMemRatios(RealT *memRatiosForNNStructs, IntT nRadii){
   RealT sum = 0;
   for(IntT i = nRadii - 1; i >= 0; i--){
     sum += memRatiosForNNStructs[i];
@@ -105,33 +113,41 @@ int compareInt32T(const void *a, const void *b){
   The function computes the R-NN data structure optimal
   parameters and/or construct the R-NN data structure.
  */      
-void LSH_Init(const IntT *dataStream, IntT nElems, IntT nCarac, 
-              RealT *radiusList, IntT nRadius){
-  // Parse part of the command-line parameters.
-  nPoints = nElems;
-  pointsDimension = nCarac;
-
-  nRadii = nRadius; 
-  ASSERT(nRadii > 0);
-  FAILIF(NULL == (listOfRadii = radiusList));
-  FAILIF(NULL == (memRatiosForNNStructs = (RealT*)MALLOC(nRadii * sizeof(RealT))));
+PLSHIndexT LSH_Init(const IntT *dataStream, IntT nElems, IntT nCarac, 
+                    const RealT *radiusList, IntT nRadius){
+  std::lock_guard< std::mutex > lock(initMutex);
+  // Memory used by other indices does not count in the budget of
+  // this one.
+  MemVarT initialMemory = totalAllocatedMemory;
+
+  PLSHIndexT index;
+  FAILIF(NULL == (index = (PLSHIndexT)MALLOC(sizeof(LSHIndexT))));
+  index->nPoints = nElems;
+  index->pointsDimension = nCarac;
+
+  index->nRadii = nRadius; 
+  ASSERT(index->nRadii > 0);
+  FAILIF(NULL == (index->listOfRadii = (RealT*)MALLOC(index->nRadii * sizeof(RealT))));
+  RealT *memRatiosForNNStructs = NULL;
+  FAILIF(NULL == (memRatiosForNNStructs = (RealT*)MALLOC(index->nRadii * sizeof(RealT))));
 
   printf("computing mem ration for radius\n");
-  for(IntT i = 0; i < nRadii; i++){
-    ASSERT(listOfRadii[i] > 0);
-    memRatiosForNNStructs[i] = 1.0 / nRadii;
+  for(IntT i = 0; i < index->nRadii; i++){
+    index->listOfRadii[i] = radiusList[i];
+    ASSERT(index->listOfRadii[i] > 0);
+    memRatiosForNNStructs[i] = 1.0 / index->nRadii;
     ASSERT(memRatiosForNNStructs[i] > 0);
   }
-  DPRINTF("No. radii: %d\n", nRadii);
+  DPRINTF("No. radii: %d\n", index->nRadii);
 
-  if (nPoints > static_cast< int >( MAX_N_POINTS ) ) {
-    printf("Error: the structure supports at most %d points (%d were specified).\n", MAX_N_POINTS, nPoints);
-    fprintf(ERROR_OUTPUT, "Error: the structure supports at most %d points (%d were specified).\n", MAX_N_POINTS, nPoints);
+  if (index->nPoints > static_cast< int >( MAX_N_POINTS ) ) {
+    printf("Error: the structure supports at most %d points (%d were specified).\n", MAX_N_POINTS, index->nPoints);
+    fprintf(ERROR_OUTPUT, "Error: the structure supports at most %d points (%d were specified).\n", MAX_N_POINTS, index->nPoints);
     exit(1);
   }
 
   printf("reading data from stream\n");
-  readDataSetFromStream(dataStream);
+  readDataSetFromStream(index, dataStream);
   DPRINTF("Allocated memory (after reading data set): %lld\n", totalAllocatedMemory);
 
   // Generate a sample query set for computing the optimal parameters.
@@ -142,104 +158,130 @@ void LSH_Init(const IntT *dataStream, IntT nElems, IntT nCarac,
   // Choose several data set points for the sample query points.
   printf("selecting samples\n");
   for(IntT i = 0; i < nSampleQueries; i++){
-	sampleQueries[i] = dataSetPoints[genRandomInt(0, nPoints - 1)];
+	sampleQueries[i] = index->dataSetPoints[genRandomInt(0, index->nPoints - 1)];
   }
 
   // Compute the array sampleQBoundaryIndeces that specifies how to
   // segregate the sample query points according to their distance
   // to NN.
   printf("sorting samples\n");
-  sortQueryPointsByRadii(pointsDimension,
+  sortQueryPointsByRadii(index->pointsDimension,
 			   nSampleQueries,
 			   sampleQueries,
-			   nPoints,
-			   dataSetPoints,
-			   nRadii,
-			   listOfRadii,
+			   index->nPoints,
+			   index->dataSetPoints,
+			   index->nRadii,
+			   index->listOfRadii,
 			   sampleQBoundaryIndeces);
 
-  FAILIF(NULL == (nnStructs = (PRNearNeighborStructT*)MALLOC(nRadii * sizeof(PRNearNeighborStructT))));
+  FAILIF(NULL == (index->nnStructs = (PRNearNeighborStructT*)MALLOC(index->nRadii * sizeof(PRNearNeighborStructT))));
   // Determine the R-NN DS parameters, construct the DS and run the queries.
   printf("transforming memory ratios\n");
-  transformMemRatios();
+  transformMemRatios(memRatiosForNNStructs, index->nRadii);
   printf("LHS hash functions\n");
-  for(IntT i = 0; i < nRadii; i++){
+  for(IntT i = 0; i < index->nRadii; i++){
     // XXX: segregate the sample queries...
-    nnStructs[i] = initSelfTunedRNearNeighborWithDataSet(listOfRadii[i], 
+    MemVarT usedMemory = totalAllocatedMemory - initialMemory;
+    index->nnStructs[i] = initSelfTunedRNearNeighborWithDataSet(index->listOfRadii[i], 
 							   successProbability, 
-							   nPoints, 
-							   pointsDimension, 
-							   dataSetPoints, 
+							   index->nPoints, 
+							   index->pointsDimension, 
+							   index->dataSetPoints, 
 							   nSampleQueries, 
 							   sampleQueries, 
-							   (MemVarT)((availableTotalMemory - totalAllocatedMemory) * memRatiosForNNStructs[i]));
+							   (MemVarT)((availableTotalMemory - usedMemory) * memRatiosForNNStructs[i]));
+  }
+  FREE(memRatiosForNNStructs);
+  return index;
+}
+
+
+PLSHQueryT LSH_NewQuery(PLSHIndexT index){
+  ASSERT(index != NULL);
+  PLSHQueryT query;
+  FAILIF(NULL == (query = (PLSHQueryT)malloc(sizeof(LSHQueryT))));
+  query->index = index;
+  FAILIF(NULL == (query->buffers = (PRNNQueryBuffersT*)malloc(index->nRadii * sizeof(PRNNQueryBuffersT))));
+  for(IntT r = 0; r < index->nRadii; r++){
+    query->buffers[r] = newRNNQueryBuffers(index->nnStructs[r]);
   }
+  FAILIF(NULL == (query->result = (PPointT*)malloc(index->nPoints * sizeof(PPointT))));
+  FAILIF(NULL == (query->distToNN = (PPointAndRealTStructT*)malloc(index->nPoints * sizeof(PPointAndRealTStructT))));
+  return query;
 }
 
 
 /*
   Runs the queries on the data structure.
  */
-IntT LSH_Query(IntT pointIndex, RealT maxRadius, IntT *queryPoints, RealT *queryDistances){
+IntT LSH_Query(PLSHQueryT query, IntT pointIndex, RealT maxRadius, IntT *queryPoints, RealT *queryDistances){
+  PLSHIndexT index = query->index;
+  ASSERT(pointIndex >= 0 && pointIndex < index->nPoints);
   IntT querySize = 0;
 
-  IntT resultSize = nPoints;
-  PPointT *result = (PPointT*)MALLOC(nPoints * sizeof(*result));
-
-  PPointT queryPoint = nullptr; // Fabio: changed here to avoid unitialized value warning diring compilation.
-  for(IntT i = 0; i < nPoints; i++){
-    if(dataSetPoints[i]->index == pointIndex){
-      queryPoint = dataSetPoints[i];
-    }	
-  }
+  IntT resultSize = index->nPoints;
+  PPointT queryPoint = index->dataSetPoints[pointIndex];
 
   // get the near neighbors.
   IntT r = 0;
-  while(r < nRadii && listOfRadii[r] < maxRadius){
+  while(r < index->nRadii - 1 && index->listOfRadii[r] < maxRadius){
     r++;	
   }
-  IntT nNNs = 0;
-  nNNs = getRNearNeighbors(nnStructs[r], queryPoint, result, resultSize);
+  IntT nDistComps = 0;
+  IntT nNNs = getNearNeighborsFromPRNearNeighborStruct(index->nnStructs[r], queryPoint, query->result, resultSize, query->buffers[r], nDistComps);
 
   if (nNNs > 0){
 	// compute the distances to the found NN, and sort according to the distance
-    PPointAndRealTStructT *distToNN = NULL;
-	FAILIF(NULL == (distToNN = (PPointAndRealTStructT*)MALLOC(nNNs * sizeof(*distToNN))));
+    PPointAndRealTStructT *distToNN = query->distToNN;
 	for(IntT p = 0; p < nNNs; p++){
-	  distToNN[p].ppoint = result[p];
-	  distToNN[p].real = distance(pointsDimension, queryPoint, result[p]);
+	  distToNN[p].ppoint = query->result[p];
+	  distToNN[p].real = distance(index->pointsDimension, queryPoint, query->result[p]);
 	}
 	qsort(distToNN, nNNs, sizeof(*distToNN), comparePPointAndRealTStructT);
 
-	// report the points
-    // FAILIF(NULL == (*queryPoints = (IntT*)MALLOC(nNNs * sizeof(IntT))));	
-    // FAILIF(NULL == (*queryDistances = (RealT*)MALLOC(nNNs * sizeof(RealT))));	
-    for(IntT j = 1; j < nNNs; j++){
+	// report the points, skipping the query point itself.
+    for(IntT j = 0; j < nNNs; j++){
       ASSERT(distToNN[j].ppoint != NULL);
-      if(distToNN[j].real <= maxRadius){
+      if(distToNN[j].ppoint->index != pointIndex && distToNN[j].real <= maxRadius){
         queryPoints[querySize] = distToNN[j].ppoint->index;
         queryDistances[querySize] = distToNN[j].real;
 		querySize++;
       }
 	}
-    FREE(distToNN);
   }
-  FREE(result);
 
   return querySize;
 }
 
 
-void LSH_Free(){
-  IntT i;
-  for(i = 0; i < nRadii; i++){
-    freePRNearNeighborStruct(nnStructs[i]);
+void LSH_FreeQuery(PLSHQueryT query){
+  if (query == NULL){
+    return;
   }
-  for(i = 0; i < nPoints; i++){
-    FREE(dataSetPoints[i]);
+  for(IntT r = 0; r < query->index->nRadii; r++){
+    freeRNNQueryBuffers(query->index->nnStructs[r], query->buffers[r]);
   }
-  FREE(memRatiosForNNStructs); 
-  FREE(dataSetPoints);
-  // XXX: should ideally free the other stuff as well.
+  free(query->buffers);
+  free(query->result);
+  free(query->distToNN);
+  free(query);
 }
 
+
+void LSH_Free(PLSHIndexT index){
+  if (index == NULL){
+    return;
+  }
+  std::lock_guard< std::mutex > lock(initMutex);
+  IntT i;
+  for(i = 0; i < index->nRadii; i++){
+    freePRNearNeighborStruct(index->nnStructs[i]);
+  }
+  for(i = 0; i < index->nPoints; i++){
+    FREE(index->dataSetPoints[i]);
+  }
+  FREE(index->nnStructs);
+  FREE(index->listOfRadii);
+  FREE(index->dataSetPoints);
+  FREE(index);
+}
@@ -429,31 +429,85 @@ inline void computeULSH(PRNearNeighborStructT nnStruct, IntT gNumber, RealT *poi
   }
 }
 
-inline void preparePointAdding(PRNearNeighborStructT nnStruct, PUHashStructureT uhash, PPointT point){
+// Computes the <u> functions of <point> and their hashes into
+// <buffers>.
+inline void preparePointHashes(PRNearNeighborStructT nnStruct, PUHashStructureT uhash, PPointT point, PRNNQueryBuffersT buffers){
   ASSERT(nnStruct != NULL);
   ASSERT(uhash != NULL);
   ASSERT(point != NULL);
+  ASSERT(buffers != NULL);
 
   TIMEV_START(timeComputeULSH);
   for(IntT d = 0; d < nnStruct->dimension; d++){
-    nnStruct->reducedPoint[d] = point->coordinates[d] / nnStruct->parameterR;
+    buffers->reducedPoint[d] = point->coordinates[d] / nnStruct->parameterR;
   }
 
   // Compute all ULSH functions.
   for(IntT i = 0; i < nnStruct->nHFTuples; i++){
-    computeULSH(nnStruct, i, nnStruct->reducedPoint, nnStruct->pointULSHVectors[i]);
+    computeULSH(nnStruct, i, buffers->reducedPoint, buffers->pointULSHVectors[i]);
   }
 
   // Compute data for <precomputedHashesOfULSHs>.
   if (USE_SAME_UHASH_FUNCTIONS) {
     for(IntT i = 0; i < nnStruct->nHFTuples; i++){
-      precomputeUHFsForULSH(uhash, nnStruct->pointULSHVectors[i], nnStruct->hfTuplesLength, nnStruct->precomputedHashesOfULSHs[i]);
+      precomputeUHFsForULSH(uhash, buffers->pointULSHVectors[i], nnStruct->hfTuplesLength, buffers->precomputedHashesOfULSHs[i]);
     }
   }
 
   TIMEV_END(timeComputeULSH);
 }
 
+// Returns the temporary vectors of the structure itself.
+inline RNNQueryBuffersT structQueryBuffers(PRNearNeighborStructT nnStruct){
+  RNNQueryBuffersT buffers;
+  buffers.pointULSHVectors = nnStruct->pointULSHVectors;
+  buffers.precomputedHashesOfULSHs = nnStruct->precomputedHashesOfULSHs;
+  buffers.reducedPoint = nnStruct->reducedPoint;
+  buffers.markedPoints = nnStruct->markedPoints;
+  buffers.markedPointsIndeces = nnStruct->markedPointsIndeces;
+  return buffers;
+}
+
+inline void preparePointAdding(PRNearNeighborStructT nnStruct, PUHashStructureT uhash, PPointT point){
+  RNNQueryBuffersT buffers = structQueryBuffers(nnStruct);
+  preparePointHashes(nnStruct, uhash, point, &buffers);
+}
+
+// Allocates the temporary vectors for queries on <nnStruct>. Memory is
+// not accounted in <totalAllocatedMemory>, so that buffers may be
+// allocated by concurrent threads.
+PRNNQueryBuffersT newRNNQueryBuffers(PRNearNeighborStructT nnStruct){
+  ASSERT(nnStruct != NULL);
+  PRNNQueryBuffersT buffers;
+  FAILIF(NULL == (buffers = (PRNNQueryBuffersT)malloc(sizeof(RNNQueryBuffersT))));
+  FAILIF(NULL == (buffers->pointULSHVectors = (Uns32T**)malloc(nnStruct->nHFTuples * sizeof(Uns32T*))));
+  FAILIF(NULL == (buffers->precomputedHashesOfULSHs = (Uns32T**)malloc(nnStruct->nHFTuples * sizeof(Uns32T*))));
+  for(IntT i = 0; i < nnStruct->nHFTuples; i++){
+    FAILIF(NULL == (buffers->pointULSHVectors[i] = (Uns32T*)malloc(nnStruct->hfTuplesLength * sizeof(Uns32T))));
+    FAILIF(NULL == (buffers->precomputedHashesOfULSHs[i] = (Uns32T*)malloc(N_PRECOMPUTED_HASHES_NEEDED * sizeof(Uns32T))));
+  }
+  FAILIF(NULL == (buffers->reducedPoint = (RealT*)malloc(nnStruct->dimension * sizeof(RealT))));
+  FAILIF(NULL == (buffers->markedPoints = (BooleanT*)calloc(nnStruct->nPoints + 1, sizeof(BooleanT))));
+  FAILIF(NULL == (buffers->markedPointsIndeces = (Int32T*)malloc((nnStruct->nPoints + 1) * sizeof(Int32T))));
+  return buffers;
+}
+
+void freeRNNQueryBuffers(PRNearNeighborStructT nnStruct, PRNNQueryBuffersT buffers){
+  if (buffers == NULL){
+    return;
+  }
+  for(IntT i = 0; i < nnStruct->nHFTuples; i++){
+    free(buffers->pointULSHVectors[i]);
+    free(buffers->precomputedHashesOfULSHs[i]);
+  }
+  free(buffers->pointULSHVectors);
+  free(buffers->precomputedHashesOfULSHs);
+  free(buffers->reducedPoint);
+  free(buffers->markedPoints);
+  free(buffers->markedPointsIndeces);
+  free(buffers);
+}
+
 // Paramaters with names:   PRNearNeighborStructT nnStruct, IntT i, IntT &firstIndex, IntT &secondIndex, PPointT point
 inline void batchAddRequest(PRNearNeighborStructT, IntT, IntT &, IntT &, PPointT){
 //   Uns32T *(gVector[4]);
@@ -533,9 +587,9 @@ void addNewPointToPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT p
 }
 
 // Returns TRUE iff |p1-p2|_2^2 <= threshold
-inline BooleanT isDistanceSqrLeq(IntT dimension, PPointT p1, PPointT p2, RealT threshold){
+inline BooleanT isDistanceSqrLeq(IntT dimension, PPointT p1, PPointT p2, RealT threshold, IntT &nDistComps){
   RealT result = 0;
-  nOfDistComps++;
+  nDistComps++;
 
   TIMEV_START(timeDistanceComputation);
   for (IntT i = 0; i < dimension; i++){
@@ -575,40 +629,33 @@ inline BooleanT isDistanceSqrLeq(IntT dimension, PPointT p1, PPointT p2, RealT t
 // point within distance <parameterR>. Each near neighbor from the
 // data set is returned is returned with a certain probability,
 // dependent on <parameterK>, <parameterL>, and <parameterT>. The
-// returned points are kept in the array <result>. If result is not
-// allocated, it will be allocated to at least some minimum size
-// (RESULT_INIT_SIZE). If number of returned points is bigger than the
-// size of <result>, then the <result> is resized (to up to twice the
-// number of returned points). The return value is the number of
-// points found.
-Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT query, PPointT *(&result), Int32T &resultSize){
+// returned points are kept in the array <result>, which must be
+// allocated. If number of returned points is bigger than the size of
+// <result>, then the <result> is resized (to up to twice the number of
+// returned points). The return value is the number of points found.
+//
+// The temporary vectors of the query are in <buffers>, and the number
+// of distance computations is added to <nDistComps>. The query touches no shared state, so that queries with
+// different <buffers> may run concurrently. Resizing <result> is not
+// accounted in <totalAllocatedMemory>.
+Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT query, PPointT *(&result), Int32T &resultSize, PRNNQueryBuffersT buffers, IntT &nDistComps){
   ASSERT(nnStruct != NULL);
   ASSERT(query != NULL);
-  ASSERT(nnStruct->reducedPoint != NULL);
-  ASSERT(!nnStruct->useUfunctions || nnStruct->pointULSHVectors != NULL);
+  ASSERT(buffers != NULL);
+  ASSERT(result != NULL);
 
   PPointT point = query;
 
-  if (result == NULL){
-    resultSize = RESULT_INIT_SIZE;
-    FAILIF(NULL == (result = (PPointT*)MALLOC(resultSize * sizeof(PPointT))));
-  }
-  
-  preparePointAdding(nnStruct, nnStruct->hashedBuckets[0], point);
+  preparePointHashes(nnStruct, nnStruct->hashedBuckets[0], point, buffers);
 
   Uns32T precomputedHashesOfULSHs[nnStruct->nHFTuples][N_PRECOMPUTED_HASHES_NEEDED];
   for(IntT i = 0; i < nnStruct->nHFTuples; i++){
     for(IntT j = 0; j < N_PRECOMPUTED_HASHES_NEEDED; j++){
-      precomputedHashesOfULSHs[i][j] = nnStruct->precomputedHashesOfULSHs[i][j];
+      precomputedHashesOfULSHs[i][j] = buffers->precomputedHashesOfULSHs[i][j];
     }
   }
   TIMEV_START(timeTotalBuckets);
 
-  BooleanT oldTimingOn = timingOn;
-  if (noExpensiveTiming) {
-    timingOn = FALSE;
-  }
-  
   // Initialize the counters for defining the pair of <u> functions used for <g> functions.
   IntT firstUComp = 0;
   IntT secondUComp = 1;
@@ -651,20 +698,20 @@ Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct,
 	  //TIMEV_START(timeDistanceComputation);
 	  Int32T candidatePIndex = bucketEntry->pointIndex;
 	  PPointT candidatePoint = nnStruct->points[candidatePIndex];
-	  if (isDistanceSqrLeq(nnStruct->dimension, point, candidatePoint, nnStruct->parameterR2) && nnStruct->reportingResult){
+	  if (isDistanceSqrLeq(nnStruct->dimension, point, candidatePoint, nnStruct->parameterR2, nDistComps) && nnStruct->reportingResult){
 	    //TIMEV_END(timeDistanceComputation);
-	    if (nnStruct->markedPoints[candidatePIndex] == FALSE) {
+	    if (buffers->markedPoints[candidatePIndex] == FALSE) {
 	      //TIMEV_START(timeResultStoring);
 	      // a new R-NN point was found (not yet in <result>).
 	      if (nNeighbors >= resultSize){
 		// run out of space => resize the <result> array.
 		resultSize = 2 * resultSize;
-		result = (PPointT*)REALLOC(result, resultSize * sizeof(PPointT));
+		FAILIF(NULL == (result = (PPointT*)realloc(result, resultSize * sizeof(PPointT))));
 	      }
 	      result[nNeighbors] = candidatePoint;
 	      nNeighbors++;
-	      nnStruct->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
-	      nnStruct->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
+	      buffers->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
+	      buffers->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
 	      nMarkedPoints++;
 	      //TIMEV_END(timeResultStoring);
 	    }
@@ -728,27 +775,27 @@ Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct,
 	  CR_ASSERT(candidatePIndex >= 0 && candidatePIndex < nnStruct->nPoints);
 	  done = (hybridPoint + index)->point.isLastPoint == 1 ? TRUE : FALSE;
 	  index++;
-	  if (nnStruct->markedPoints[candidatePIndex] == FALSE){
+	  if (buffers->markedPoints[candidatePIndex] == FALSE){
 	    // mark the point first.
-	    nnStruct->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
-	    nnStruct->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
+	    buffers->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
+	    buffers->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
 	    nMarkedPoints++;
 
 	    PPointT candidatePoint = nnStruct->points[candidatePIndex];
-	    if (isDistanceSqrLeq(nnStruct->dimension, point, candidatePoint, nnStruct->parameterR2) && nnStruct->reportingResult){
-	      //if (nnStruct->markedPoints[candidatePIndex] == FALSE) {
+	    if (isDistanceSqrLeq(nnStruct->dimension, point, candidatePoint, nnStruct->parameterR2, nDistComps) && nnStruct->reportingResult){
+	      //if (buffers->markedPoints[candidatePIndex] == FALSE) {
 	      // a new R-NN point was found (not yet in <result>).
 	      //TIMEV_START(timeResultStoring);
 	      if (nNeighbors >= resultSize){
 		// run out of space => resize the <result> array.
 		resultSize = 2 * resultSize;
-		result = (PPointT*)REALLOC(result, resultSize * sizeof(PPointT));
+		FAILIF(NULL == (result = (PPointT*)realloc(result, resultSize * sizeof(PPointT))));
 	      }
 	      result[nNeighbors] = candidatePoint;
 	      nNeighbors++;
 	      //TIMEV_END(timeResultStoring);
-	      //nnStruct->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
-	      //nnStruct->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
+	      //buffers->markedPointsIndeces[nMarkedPoints] = candidatePIndex;
+	      //buffers->markedPoints[candidatePIndex] = TRUE; // do not include more points with the same index
 	      //nMarkedPoints++;
 	      //}
 	    }
@@ -765,15 +812,44 @@ Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct,
     
   }
 
-  timingOn = oldTimingOn;
   TIMEV_END(timeTotalBuckets);
 
   // we need to clear the array nnStruct->nearPoints for the next query.
   for(Int32T i = 0; i < nMarkedPoints; i++){
-    ASSERT(nnStruct->markedPoints[nnStruct->markedPointsIndeces[i]] == TRUE);
-    nnStruct->markedPoints[nnStruct->markedPointsIndeces[i]] = FALSE;
+    ASSERT(buffers->markedPoints[buffers->markedPointsIndeces[i]] == TRUE);
+    buffers->markedPoints[buffers->markedPointsIndeces[i]] = FALSE;
   }
   DPRINTF("nMarkedPoints: %d\n", nMarkedPoints);
 
   return nNeighbors;
 }
+
+// Returns the near neighbors of <query> with the temporary vectors of
+// <nnStruct>, as above, and updates the global statistics. If <result>
+// is not allocated, it is allocated to RESULT_INIT_SIZE points.
+Int32T getNearNeighborsFromPRNearNeighborStruct(PRNearNeighborStructT nnStruct, PPointT query, PPointT *(&result), Int32T &resultSize){
+  ASSERT(nnStruct != NULL);
+  ASSERT(nnStruct->reducedPoint != NULL);
+  ASSERT(!nnStruct->useUfunctions || nnStruct->pointULSHVectors != NULL);
+
+  if (result == NULL){
+    resultSize = RESULT_INIT_SIZE;
+    FAILIF(NULL == (result = (PPointT*)MALLOC(resultSize * sizeof(PPointT))));
+  }
+  Int32T oldResultSize = resultSize;
+  BooleanT oldTimingOn = timingOn;
+  if (noExpensiveTiming) {
+    timingOn = FALSE;
+  }
+  RNNQueryBuffersT buffers = structQueryBuffers(nnStruct);
+  IntT nDistComps = 0;
+  Int32T nNeighbors = getNearNeighborsFromPRNearNeighborStruct(nnStruct, query, result, resultSize, &buffers, nDistComps);
+  timingOn = oldTimingOn;
+  nOfDistComps += nDistComps;
+  // Resizing doubles <result>, accounted as by REALLOC.
+  for(Int32T size = 2 * oldResultSize; size <= resultSize; size *= 2){
+    totalAllocatedMemory += size * sizeof(PPointT) / 3;
+  }
+
+  return nNeighbors;
+}
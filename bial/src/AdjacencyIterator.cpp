@@ -29,7 +29,7 @@ namespace Bial {
   AdjacencyIterator::AdjacencyIterator( const Image< D > &img, const Adjacency &adj ) try :
     relation( adj.Relation( ) ), x_size( img.size( 0 ) ), y_size( img.size( 1 ) ), z_size( img.size( 2 ) ),
       xy_size( img.Displacement( 1 ) ), img_size( img.size( ) ), adj_size( adj.size( ) ), dims( img.Dims( ) ), 
-      displacement( adj.size( ) ) {
+      displacement( adj.size( ) ), x_min( 0 ), x_max( 0 ), y_min( 0 ), y_max( 0 ), z_min( 0 ), z_max( 0 ) {
       IF_DEBUG( dims != adj.Dims( ) ) {
         std::string msg( BIAL_ERROR( "Image and adjacency dimensions do not match." ) );
         throw( std::logic_error( msg ) );
@@ -45,6 +45,22 @@ namespace Bial {
           displacement[ adj_idx ] += adj( adj_idx, dms ) * acc_dim_size;
         acc_dim_size = img.Displacement( dms );
       }
+      COMMENT( "Computing interior box, whose pixels have all adjacents inside the image.", 3 );
+      size_t *box_min[ 3 ] = { &x_min, &y_min, &z_min };
+      size_t *box_max[ 3 ] = { &x_max, &y_max, &z_max };
+      const size_t dim_size[ 3 ] = { x_size, y_size, z_size };
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        int min_rel = 0;
+        int max_rel = 0;
+        for( size_t adj_idx = 0; adj_idx < adj_size; ++adj_idx ) {
+          min_rel = std::min( min_rel, relation( dms, adj_idx ) );
+          max_rel = std::max( max_rel, relation( dms, adj_idx ) );
+        }
+        if( static_cast< size_t >( max_rel - min_rel ) < dim_size[ dms ] ) {
+          *box_min[ dms ] = static_cast< size_t >( -min_rel );
+          *box_max[ dms ] = dim_size[ dms ] - static_cast< size_t >( max_rel );
+        }
+      }
     }
   catch( std::bad_alloc &e ) {
     std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -81,7 +97,7 @@ namespace Bial {
     }
   }
 
-  int AdjacencyIterator::Displacement( size_t adj_position ) const {
+  bial_index AdjacencyIterator::Displacement( size_t adj_position ) const {
     try {
       return( displacement( adj_position ) );
     }
@@ -103,9 +119,9 @@ namespace Bial {
     try {
       COMMENT( "Computing coordinates.", 4 );
       size_t rel_base_index = ( adj_position << 1 ) + adj_position; // rel_base_index = adj_position * 3
-      div_t div_pos_by_x = std::div( static_cast< int >( src_index ), static_cast< int >( x_size ) );
-      size_t x = static_cast< size_t >( div_pos_by_x.rem + relation[ rel_base_index ] );
-      size_t y = static_cast< size_t >( div_pos_by_x.quot + relation[ rel_base_index + 1 ] );
+      size_t src_y = src_index / x_size;
+      size_t x = src_index - src_y * x_size + relation[ rel_base_index ];
+      size_t y = src_y + relation[ rel_base_index + 1 ];
       COMMENT( "Checking if coordinates are valid.", 4 );
       if( ( x >= x_size ) || ( y >= y_size ) )
         return( false );
@@ -160,11 +176,12 @@ namespace Bial {
     try {
       COMMENT( "Computing coordinates.", 4 );
       size_t rel_base_index = ( adj_position << 1 ) + adj_position;  // rel_base_index = adj_position * 3
-      div_t div_pos_by_xy = std::div( static_cast< int >( src_index ), static_cast< int >( xy_size ) );
-      div_t div_rem_by_x =  std::div( div_pos_by_xy.rem, static_cast< int >( x_size ) );
-      size_t x = static_cast< size_t >( div_rem_by_x.rem + relation[ rel_base_index ] );
-      size_t y = static_cast< size_t >( div_rem_by_x.quot + relation[ rel_base_index + 1 ] );
-      size_t z = static_cast< size_t >( div_pos_by_xy.quot + relation[ rel_base_index + 2 ] );
+      size_t src_z = src_index / xy_size;
+      size_t src_xy = src_index - src_z * xy_size;
+      size_t src_y = src_xy / x_size;
+      size_t x = src_xy - src_y * x_size + relation[ rel_base_index ];
+      size_t y = src_y + relation[ rel_base_index + 1 ];
+      size_t z = src_z + relation[ rel_base_index + 2 ];
       COMMENT( "Checking if coordinates are valid: " << x << ", " << y << ", " << z, 4 );
       if( ( x >= x_size ) || ( y >= y_size ) || ( z >= z_size ) )
         return( false );
@@ -43,7 +43,7 @@ namespace Bial {
                                         MRIModality modality ) {
       try {
         COMMENT( "Brain histogram.", 0 );
-        Signal hst = SignalType::Histogram( img * msk );
+        Signal hst = SignalType::Histogram( Image< D >( img * msk ) );
         hst[ 0 ] = 0.0;
         Image< D > res( msk );
 
@@ -109,41 +109,78 @@ namespace Bial {
         Adjacency input_adj = AdjacencyType::HyperEllipsoid( input_radius );
         //Adjacency large_adj = AdjacencyType::HyperEllipsoid( large_radius );
         Image< D > res( msk );
-        COMMENT( "Creating histogram of potential reference pixel region.", 0 );
-        size_t histo_size = ( img * cln_msk ).Maximum( ) + 1;
-        Signal histo( histo_size );
-        COMMENT( "Computing the bias estimation scene.", 0 );
-        AdjacencyIterator adj_itr( img, input_adj );
-        size_t adj_size = input_adj.size( );
+        COMMENT( "Collecting distinct roots of masked pixels. Pixels sharing a root share the same estimation.", 0 );
         size_t img_size = img.size( );
-        size_t adj_pxl;
+        Vector< size_t > root_slot( img_size, img_size );
+        Vector< size_t > roots;
         for( size_t pxl = 0; pxl < img_size; ++pxl ) {
           if( msk[ pxl ] != 0 ) {
-            size_t total_voxels = 0;
             size_t root = edt[ pxl ];
+            if( root_slot[ root ] == img_size ) {
+              root_slot[ root ] = roots.size( );
+              roots.push_back( root );
+            }
+          }
+        }
+        COMMENT( "Histogram size of potential reference pixel region.", 0 );
+        size_t histo_size = ( img * cln_msk ).Maximum( ) + 1;
+        size_t kernel_size = 5 + std::round( histo_size / 1000.0 );
+        COMMENT( "Computing the bias estimation of each root.", 0 );
+        AdjacencyIterator adj_itr( img, input_adj );
+        size_t adj_size = input_adj.size( );
+        size_t root_size = roots.size( );
+        Vector< double > root_bias( root_size, 0.0 );
+        Vector< size_t > root_voxels( root_size, 0 );
+        auto estimate = [ & ]( size_t thread, size_t total_threads ) {
+          Signal histo( histo_size );
+          Vector< size_t > used_bins( adj_size );
+          size_t adj_pxl;
+          size_t first = root_size * thread / total_threads;
+          size_t last = root_size * ( thread + 1 ) / total_threads;
+          for( size_t slot = first; slot < last; ++slot ) {
+            size_t root = roots[ slot ];
+            size_t total_voxels = 0;
+            size_t used = 0;
             COMMENT( "Looking for the best value in each adjacency.", 4 );
             for( size_t idx = 0; idx < adj_size; ++idx ) {
               if( ( adj_itr.AdjIdx( root, idx, adj_pxl ) ) && ( cln_msk[ adj_pxl ] != 0 ) ) {
+                size_t bin = static_cast< size_t >( img[ adj_pxl ] );
+                if( histo[ bin ] == 0 )
+                  used_bins[ used++ ] = bin;
                 ++total_voxels;
-                ++histo[ img[ adj_pxl ] ];
+                ++histo[ bin ];
               }
             }
             COMMENT( "Getting histogram clipped value to avoid outliers.", 4 );
-            if( total_voxels == 0 ) {
-              res[ pxl ] = img[ pxl ];
-            }
-            else {
-              size_t kernel_size = 5 + std::round( histo.size( ) / 1000.0 );
-              if( modality == MRIModality::T1 ) {
-                res[ pxl ] = SignalOp::HighHysteresis( histo, kernel_size, 0.2, 0.3 );
-              }
-              else {
-                res[ pxl ] = SignalOp::LowHysteresis( histo, kernel_size, 0.2, 0.3 );
-              }
-            }
-            for( size_t bin = 0; bin < histo_size; ++bin ) {
-              histo[ bin ] = 0;
+            root_voxels[ slot ] = total_voxels;
+            if( total_voxels != 0 ) {
+              if( modality == MRIModality::T1 )
+                root_bias[ slot ] = SignalOp::HighHysteresis( histo, kernel_size, 0.2, 0.3 );
+              else
+                root_bias[ slot ] = SignalOp::LowHysteresis( histo, kernel_size, 0.2, 0.3 );
             }
+            COMMENT( "Clearing only the used bins.", 4 );
+            for( size_t bin = 0; bin < used; ++bin )
+              histo[ used_bins[ bin ] ] = 0;
+          }
+        };
+        try {
+          ThreadPool &pool = ThreadPool::Global( );
+          pool.Run( pool.Tasks( root_size ), estimate );
+        }
+        catch( std::exception &e ) {
+          BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+          estimate( 0, 1 );
+        }
+        COMMENT( "Assigning root estimations to masked pixels. Pixels whose root has no clean adjacent keep their "
+                 "intensities.", 0 );
+        for( size_t pxl = 0; pxl < img_size; ++pxl ) {
+          if( msk[ pxl ] != 0 ) {
+            size_t slot = root_slot[ static_cast< size_t >( edt[ pxl ] ) ];
+            if( root_voxels[ slot ] == 0 )
+              res[ pxl ] = img[ pxl ];
+            else
+              res[ pxl ] = root_bias[ slot ];
           }
         }
         COMMENT( "Computing the mean to smooth the bias field.", 0 );
@@ -29,8 +29,8 @@
 namespace Bial {
 
   BucketQueue::BucketQueue( size_t size, bool increasing_order, bool fifo_tie ) try :
-    identity( Vector< IdentityNode >( size, IdentityNode( ) ) ), weight( Vector< WeightNode >( 1 ) ), elements( 0 ),
-      increasing( increasing_order ), fifo( fifo_tie ) {
+    identity( Vector< IdentityNode >( IdentityNode::CheckedSize( size ), IdentityNode( ) ) ),
+      weight( Vector< WeightNode >( 1 ) ), elements( 0 ), increasing( increasing_order ), fifo( fifo_tie ) {
     }
   catch( std::bad_alloc &e ) {
     std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -49,13 +49,6 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
-  bool BucketQueue::Empty( ) const {
-    if( elements == 0 ) {
-      return( true );
-    }
-    return( false );
-  }
-
   size_t BucketQueue::Elements( ) const {
     return( elements );
   }
@@ -64,18 +57,8 @@ namespace Bial {
     return( increasing );
   }
 
-  BucketState BucketQueue::State( size_t idt ) const {
-    try {
-      return( identity( idt ).state );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
+  bool BucketQueue::Fifo( ) const {
+    return( fifo );
   }
 
   void BucketQueue::State( size_t idt, BucketState new_state ) {
@@ -92,20 +75,6 @@ namespace Bial {
     }
   }
 
-  void BucketQueue::Finished( size_t idt ) {
-    try {
-      identity( idt ).state = BucketState::REMOVED;
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
   size_t BucketQueue::Buckets( ) const {
     return( weight.size( ) );
   }
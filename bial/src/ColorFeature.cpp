@@ -42,15 +42,10 @@ namespace Bial {
       Feature< D > res( elements, features );
       COMMENT( "Computing median features.", 0 );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &ColorFeatureThread< D >, std::ref( src ), std::ref( adj_rel ),
-                                          std::ref( res ), thd, total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( src.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          ColorFeatureThread( src, adj_rel, res, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
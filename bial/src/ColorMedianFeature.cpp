@@ -24,7 +24,7 @@
 #include "Color.hpp"
 #include "Feature.hpp"
 #include "Image.hpp"
-#include "SortingSort.hpp"
+#include <algorithm>
 
 namespace Bial {
 
@@ -48,15 +48,10 @@ namespace Bial {
       Feature< D > res( elements, features );
       COMMENT( "Computing median features.", 0 );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &ColorMedianFeatureThread< D >, std::ref( src ), std::ref( adj_rel ),
-                                          std::ref( res ), thd, total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( src.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          ColorMedianFeatureThread( src, adj_rel, res, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
@@ -113,14 +108,20 @@ namespace Bial {
       COMMENT( "Computing median pixels.", 0 );
       Vector< double > median( adj_size );
       Vector< size_t > index( adj_size );
+      Vector< size_t > order( adj_size );
       size_t adj_base = ( adj_size / 2 ) - ( features / ( 2 * 3 ) );
       size_t adj_elm = 0;
       size_t tgt_elm = 0;
       AdjacencyIterator adj_itr( src, adj_rel );
+      auto closer = [ & ]( size_t fst, size_t snd ) {
+        return( median[ fst ] < median[ snd ] );
+      };
       for( size_t src_elm = 0; src_elm < src.size( ); ++src_elm ) {
         if( msk[ src_elm ] != 0 ) {
           COMMENT( "Computing the sum of the distances of all channels from adjacent to source pixels.", 4 );
           for( size_t adj = 0; adj < adj_size; ++adj ) {
+            order( adj ) = adj;
+            median( adj ) = 0;
             if( ( adj_itr.AdjIdx( src_elm, adj, adj_elm ) ) && ( msk[ adj_elm ] != 0 ) ) {
               index( adj ) = adj_elm;
               for( size_t chn = 1; chn < 4; ++chn ) {
@@ -129,20 +130,20 @@ namespace Bial {
                 median( adj ) += ( adj_value > src_value ) ? adj_value - src_value : src_value - adj_value;
               }
             }
-            else {
+            else
               index( adj ) = src_elm;
-              median( adj ) = 0;
-            }
           }
-          COMMENT( "Sorting the distances.", 4 );
-          Sorting::Sort( index, Sorting::Sort( median ) );
+          COMMENT( "Selecting the median distances. Only the feature ranks are sorted.", 4 );
+          std::nth_element( order.begin( ), order.begin( ) + adj_base, order.end( ), closer );
+          std::partial_sort( order.begin( ) + adj_base, order.begin( ) + adj_base + features / 3, order.end( ),
+                             closer );
           COMMENT( "Getting the features from the median distances.", 4 );
           for( size_t ftr = 0; ftr < features / 3; ++ftr ) {
             for( size_t chn = 1; chn < 4; ++chn )
-              res( tgt_elm, ftr * 3 + ( chn - 1 ) ) = src( index( adj_base + ftr ) )( chn );
-            res.Index( tgt_elm ) = src_elm;
-            ++tgt_elm;
+              res( tgt_elm, ftr * 3 + ( chn - 1 ) ) = src( index( order( adj_base + ftr ) ) )( chn );
           }
+          res.Index( tgt_elm ) = src_elm;
+          ++tgt_elm;
         }
       }
       return( res );
@@ -177,16 +178,22 @@ namespace Bial {
       COMMENT( "Computing median features.", 2 );
       Vector< double > median( adj_size );
       Vector< size_t > index( adj_size );
+      Vector< size_t > order( adj_size );
       size_t adj_base = ( adj_size / 2 ) - ( features / ( 2 * 3 ) );
       size_t adj_elm;
       AdjacencyIterator adj_itr( src, adj_rel );
+      auto closer = [ & ]( size_t fst, size_t snd ) {
+        return( median[ fst ] < median[ snd ] );
+      };
       for( size_t src_elm = min_index; src_elm < max_index; ++src_elm ) {
         COMMENT( "Setting index.", 4 );
         res.Index( src_elm ) = src_elm;
         COMMENT( "Computing the sum of the distances of all channels from adjacent to source pixels.", 4 );
+        bool interior = adj_itr.Interior( src_elm );
         for( size_t adj = 0; adj < adj_size; ++adj ) {
-          COMMENT( "Computing index of elements.", 4 );
-          if( adj_itr.AdjIdx( src_elm, adj, adj_elm ) ) {
+          order( adj ) = adj;
+          median( adj ) = 0;
+          if( adj_itr.AdjIdx( src_elm, adj, adj_elm, interior ) ) {
             index( adj ) = adj_elm;
             for( size_t chn = 1; chn < 4; ++chn ) {
               D adj_value = src( adj_elm )( chn );
@@ -194,17 +201,17 @@ namespace Bial {
               median( adj ) += ( adj_value > src_value ) ? adj_value - src_value : src_value - adj_value;
             }
           }
-          else {
+          else
             index( adj ) = src_elm;
-            median( adj ) = 0;
-          }
         }
-        COMMENT( "Sorting the distances.", 4 );
-        Sorting::Sort( index, Sorting::Sort( median ) );
+        COMMENT( "Selecting the median distances. Only the feature ranks are sorted.", 4 );
+        std::nth_element( order.begin( ), order.begin( ) + adj_base, order.end( ), closer );
+        std::partial_sort( order.begin( ) + adj_base, order.begin( ) + adj_base + features / 3, order.end( ),
+                           closer );
         COMMENT( "Getting the features from the median distances.", 4 );
         for( size_t ftr = 0; ftr < features / 3; ++ftr ) {
           for( size_t chn = 1; chn < 4; ++chn )
-            res( src_elm, ftr * 3 + ( chn - 1 ) ) = src( index( adj_base + ftr ) )( chn );
+            res( src_elm, ftr * 3 + ( chn - 1 ) ) = src( index( order( adj_base + ftr ) ) )( chn );
         }
       }
     }
@@ -97,6 +97,198 @@ namespace Bial {
 
 #endif
 
+  /** @brief Set while the current thread executes a pool task, so that nested calls to Run execute inline. */
+  static thread_local bool thread_pool_task = false;
+
+  ThreadPool::ThreadPool( size_t threads ) : pending( 0 ), stop( false ) {
+    Start( threads == 0 ? DefaultThreads( ) : threads );
+  }
+
+  ThreadPool::~ThreadPool( ) {
+    Stop( );
+  }
+
+  ThreadPool &ThreadPool::Global( ) {
+    static ThreadPool pool;
+    return( pool );
+  }
+
+  size_t ThreadPool::DefaultThreads( ) {
+    const char *env = std::getenv( "BIAL_THREADS" );
+    if( env != nullptr ) {
+      long threads = std::strtol( env, nullptr, 10 );
+      if( threads > 0 ) {
+        return( static_cast< size_t >( threads ) );
+      }
+      BIAL_WARNING( "Invalid BIAL_THREADS value: " << env << ". Using hardware concurrency." );
+    }
+    size_t threads = std::thread::hardware_concurrency( );
+    return( threads == 0 ? 1 : threads );
+  }
+
+  size_t ThreadPool::Threads( ) const {
+    return( workers.size( ) + 1 );
+  }
+
+  void ThreadPool::SetThreads( size_t threads ) {
+    Stop( );
+    Start( threads == 0 ? DefaultThreads( ) : threads );
+  }
+
+  size_t ThreadPool::Tasks( size_t elements, size_t granularity ) const {
+    if( workers.empty( ) ) {
+      return( 1 );
+    }
+    size_t tasks = Threads( ) * std::max( granularity, static_cast< size_t >( 1 ) );
+    return( std::max( std::min( tasks, elements ), static_cast< size_t >( 1 ) ) );
+  }
+
+  void ThreadPool::Run( size_t total_tasks, const std::function< void( size_t, size_t ) > &function ) {
+    if( total_tasks == 0 ) {
+      return;
+    }
+    if( ( workers.empty( ) ) || ( total_tasks == 1 ) || ( thread_pool_task ) ) {
+      COMMENT( "Running " << total_tasks << " tasks in the calling thread.", 3 );
+      for( size_t tsk = 0; tsk < total_tasks; ++tsk ) {
+        function( tsk, total_tasks );
+      }
+      return;
+    }
+    COMMENT( "Distributing " << total_tasks << " tasks in contiguous blocks among the worker queues.", 3 );
+    Batch batch;
+    batch.function = &function;
+    batch.total_tasks = total_tasks;
+    batch.remaining = total_tasks;
+    {
+      std::lock_guard< std::mutex > lock( sleep_mutex );
+      pending += total_tasks;
+    }
+    size_t total_queues = queues.size( );
+    for( size_t que = 0; que < total_queues; ++que ) {
+      size_t min_tsk = que * total_tasks / total_queues;
+      size_t max_tsk = ( que + 1 ) * total_tasks / total_queues;
+      std::lock_guard< std::mutex > lock( queues[ que ]->mutex );
+      for( size_t tsk = min_tsk; tsk < max_tsk; ++tsk ) {
+        queues[ que ]->tasks.push_back( Task( &batch, tsk ) );
+      }
+    }
+    wake.notify_all( );
+    COMMENT( "Calling thread helps while its batch is not finished.", 3 );
+    Task task;
+    size_t first = 0;
+    while( Steal( first, task ) ) {
+      Execute( task );
+      first = ( first + 1 ) % total_queues;
+      std::lock_guard< std::mutex > lock( batch.mutex );
+      if( batch.remaining == 0 ) {
+        break;
+      }
+    }
+    std::unique_lock< std::mutex > lock( batch.mutex );
+    batch.done.wait( lock, [ &batch ]( ) {
+        return( batch.remaining == 0 );
+      } );
+    if( batch.error ) {
+      std::rethrow_exception( batch.error );
+    }
+  }
+
+  void ThreadPool::Start( size_t threads ) {
+    stop = false;
+    size_t total_workers = std::max( threads, static_cast< size_t >( 1 ) ) - 1;
+    for( size_t wkr = 0; wkr < total_workers; ++wkr ) {
+      queues.push_back( std::unique_ptr< TaskQueue >( new TaskQueue( ) ) );
+    }
+    for( size_t wkr = 0; wkr < total_workers; ++wkr ) {
+      try {
+        workers.push_back( std::thread( &ThreadPool::WorkerLoop, this, wkr ) );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to create thread " << wkr << ". Exception: " << e.what( ) );
+        break;
+      }
+    }
+    COMMENT( "Discarding the queues of threads that could not be created.", 2 );
+    queues.resize( workers.size( ) );
+  }
+
+  void ThreadPool::Stop( ) {
+    {
+      std::lock_guard< std::mutex > lock( sleep_mutex );
+      stop = true;
+    }
+    wake.notify_all( );
+    for( size_t wkr = 0; wkr < workers.size( ); ++wkr ) {
+      workers[ wkr ].join( );
+    }
+    workers.clear( );
+    queues.clear( );
+  }
+
+  void ThreadPool::WorkerLoop( size_t worker ) {
+    Task task;
+    while( true ) {
+      if( ( Pop( worker, task ) ) || ( Steal( worker + 1, task ) ) ) {
+        Execute( task );
+        continue;
+      }
+      std::unique_lock< std::mutex > lock( sleep_mutex );
+      wake.wait( lock, [ this ]( ) {
+          return( ( stop ) || ( pending > 0 ) );
+        } );
+      if( ( stop ) && ( pending == 0 ) ) {
+        return;
+      }
+    }
+  }
+
+  bool ThreadPool::Pop( size_t worker, Task &task ) {
+    TaskQueue &queue = *queues[ worker ];
+    std::lock_guard< std::mutex > lock( queue.mutex );
+    if( queue.tasks.empty( ) ) {
+      return( false );
+    }
+    task = queue.tasks.front( );
+    queue.tasks.pop_front( );
+    --pending;
+    return( true );
+  }
+
+  bool ThreadPool::Steal( size_t first, Task &task ) {
+    size_t total_queues = queues.size( );
+    for( size_t idx = 0; idx < total_queues; ++idx ) {
+      TaskQueue &queue = *queues[ ( first + idx ) % total_queues ];
+      std::lock_guard< std::mutex > lock( queue.mutex );
+      if( !queue.tasks.empty( ) ) {
+        task = queue.tasks.back( );
+        queue.tasks.pop_back( );
+        --pending;
+        return( true );
+      }
+    }
+    return( false );
+  }
+
+  void ThreadPool::Execute( const Task &task ) {
+    Batch &batch = *task.first;
+    bool nested = thread_pool_task;
+    thread_pool_task = true;
+    try {
+      ( *batch.function )( task.second, batch.total_tasks );
+    }
+    catch( ... ) {
+      std::lock_guard< std::mutex > lock( batch.mutex );
+      if( !batch.error ) {
+        batch.error = std::current_exception( );
+      }
+    }
+    thread_pool_task = nested;
+    std::lock_guard< std::mutex > lock( batch.mutex );
+    if( --batch.remaining == 0 ) {
+      batch.done.notify_all( );
+    }
+  }
+
 #ifdef BIAL_DEBUG
   int verbose = BIAL_DEBUG;
 #else
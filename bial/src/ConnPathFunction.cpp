@@ -29,7 +29,8 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  ConnPathFunction< C, D >::ConnPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+  ConnPathFunction< C, D >::ConnPathFunction( C< D > &init_value, C< int > *init_label,
+                                              C< bial_index > *init_predecessor,
                                               bool sequential_label, const C< D > &handicap, const C< D > &component ) 
     try : PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ), 
             component( component ) {
@@ -99,204 +100,6 @@ namespace Bial {
     }
   }
 
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::RemoveSimple( size_t index, BucketState state ) {
-    try {
-      COMMENT( "Removing " << index, 4 );
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = 0.0;
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::RemovePredecessor( size_t index, BucketState state ) {
-    try {
-      COMMENT( "Removing " << index, 4 );
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = 0.0;
-        this->predecessor->operator()( index ) = -1;
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::RemoveLabel( size_t index, BucketState state ) {
-    try {
-      COMMENT( "Removing " << index, 4 );
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = 0.0;
-        this->label->operator()( index ) = this->next_label;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::RemoveComplete( size_t index, BucketState state ) {
-    try {
-      COMMENT( "Removing " << index, 4 );
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = 0.0;
-        this->label->operator()( index ) = this->next_label;
-        this->predecessor->operator()( index ) = -1;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  inline bool ConnPathFunction< C, D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
-    try {
-      return( ( adj_state != BucketState::REMOVED ) &&
-              ( this->value->operator()( index ) < this->value->operator()( adj_index ) ) );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      D src_value = this->value->operator()( adj_index );
-      D prp_value = std::max( this->value->operator()( index ), handicap( adj_index ) );
-      if( ( src_value > prp_value ) && ( component( index ) == component( adj_index ) ) ) {
-        this->value->operator()( adj_index ) = prp_value;
-        ( this->*this->UpdateData )( index, adj_index );
-        return( true );
-      }
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool ConnPathFunction< C, D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      D src_value = this->value->operator()( adj_index );
-      D prp_value = std::max( this->value->operator()( index ), handicap( adj_index ) );
-      if( ( src_value > prp_value ) && ( component( index ) == component( adj_index ) ) ) {
-        this->value->operator()( adj_index ) = prp_value;
-        ( this->*this->UpdateData )( index, adj_index );
-        return( true );
-      }
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
   template< template< class D > class C, class D >
   bool ConnPathFunction< C, D >::Increasing( ) {
     return( true );
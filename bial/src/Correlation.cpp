@@ -21,32 +21,68 @@
 #ifdef BIAL_DEBUG
 #include "FileImage.hpp"
 #endif
+#include "FilteringGaussian.hpp"
+#include "Fourier.hpp"
+#include "FourierPlan.hpp"
 #include "Image.hpp"
 #include "Kernel.hpp"
 
 namespace Bial {
 
+  /** @brief Resulting pixel. Integer results that are within 1e-6 of an integer are taken as that integer, so that
+   * rounding errors of separable and FFT correlations are not truncated to the next lower integer. */
   template< class D >
-  Image< D > Correlation( const Image< D > &img, const Kernel &krn ) {
+  inline D CorrelationValue( double val ) {
+    if( std::is_integral< D >::value && ( std::abs( val - std::round( val ) ) < 1.0e-6 ) )
+      return( static_cast< D >( std::round( val ) ) );
+    return( static_cast< D >( val ) );
+  }
+
+  template< class D >
+  Image< D > Correlation( const Image< D > &img, const Kernel &krn, CorrelationMethod method ) {
     try {
       if( img.Dims( ) != krn.Dims( ) ) {
         std::string msg( BIAL_ERROR( "Image and kernel dimensions do not match." ) );
         throw( std::logic_error( msg ) );
       }
+      if( method == CorrelationMethod::Separable ) {
+        std::vector< Vector< double > > weights;
+        if( !SeparableKernel( krn, weights ) ) {
+          std::string msg( BIAL_ERROR( "Kernel is not separable." ) );
+          throw( std::logic_error( msg ) );
+        }
+        return( SeparableCorrelation( img, weights ) );
+      }
+      if( method == CorrelationMethod::FFT )
+        return( CorrelationFFT( img, krn ) );
+      if( ( method == CorrelationMethod::Automatic ) && ( !std::is_integral< D >::value ) ) {
+        COMMENT( "Costs in kernel element products per pixel.", 1 );
+        std::vector< Vector< double > > weights;
+        if( SeparableKernel( krn, weights ) ) {
+          size_t separable_cost = 0;
+          for( size_t dms = 0; dms < weights.size( ); ++dms )
+            separable_cost += weights[ dms ].size( ) + CORRELATION_PASS_COST;
+          if( separable_cost < krn.size( ) ) {
+            COMMENT( "Separable kernel.", 1 );
+            return( SeparableCorrelation( img, weights ) );
+          }
+        }
+        Vector< size_t > pad_dim( CorrelationFFTDim( img, krn ) );
+        double padded = 1.0;
+        for( size_t dms = 0; dms < pad_dim.size( ); ++dms )
+          padded *= pad_dim[ dms ];
+        if( CORRELATION_FFT_COST * padded * std::log2( padded ) < static_cast< double >( img.size( ) ) * krn.size( ) ) {
+          COMMENT( "Large kernel.", 1 );
+          return( CorrelationFFT( img, krn ) );
+        }
+      }
       COMMENT( "Creating resulting image.", 1 );
       Image< D > result( img );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        COMMENT( "Starting threads.", 1 );
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads.push_back( std::thread( &CorrelationThreads< D >, std::ref( img ), std::ref( krn ),
-                                          std::ref( result ), thd, total_threads ) );
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          COMMENT( "Merging.", 1 );
-          threads( thd ).join( );
-        }
-        COMMENT( "Finished threads.", 1 );
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( img.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          CorrelationThreads( img, krn, result, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
@@ -76,6 +112,218 @@ namespace Bial {
     }
   }
 
+  bool SeparableKernel( const Kernel &krn, std::vector< Vector< double > > &weights ) {
+    try {
+      size_t dims = krn.Dims( );
+      COMMENT( "Bounding box of the kernel, centered at the origin.", 2 );
+      Vector< int > radius( dims, 0 );
+      for( size_t idx = 0; idx < krn.size( ); ++idx ) {
+        for( size_t dms = 0; dms < dims; ++dms )
+          radius[ dms ] = std::max( radius[ dms ], std::abs( krn( idx, dms ) ) );
+      }
+      Vector< size_t > side( dims );
+      Vector< size_t > stride( dims );
+      size_t box = 1;
+      for( size_t dms = 0; dms < dims; ++dms ) {
+        side[ dms ] = 2 * radius[ dms ] + 1;
+        stride[ dms ] = box;
+        box *= side[ dms ];
+      }
+      if( box > 64 * krn.size( ) + 4096 ) {
+        COMMENT( "Sparse kernel. Not worth verifying.", 2 );
+        return( false );
+      }
+      Vector< double > coef( box, 0.0 );
+      for( size_t idx = 0; idx < krn.size( ); ++idx ) {
+        size_t pos = 0;
+        for( size_t dms = 0; dms < dims; ++dms )
+          pos += ( krn( idx, dms ) + radius[ dms ] ) * stride[ dms ];
+        coef[ pos ] += krn.Value( idx );
+      }
+      COMMENT( "The 1D kernels are the lines of the box through its largest coefficient.", 2 );
+      size_t pivot = 0;
+      for( size_t pos = 1; pos < box; ++pos ) {
+        if( std::abs( coef[ pos ] ) > std::abs( coef[ pivot ] ) )
+          pivot = pos;
+      }
+      if( coef[ pivot ] == 0.0 )
+        return( false );
+      weights.assign( dims, Vector< double >( ) );
+      for( size_t dms = 0; dms < dims; ++dms ) {
+        size_t crd = ( pivot / stride[ dms ] ) % side[ dms ];
+        size_t line = pivot - crd * stride[ dms ];
+        weights[ dms ] = Vector< double >( side[ dms ] );
+        for( size_t elm = 0; elm < side[ dms ]; ++elm ) {
+          weights[ dms ][ elm ] = coef[ line + elm * stride[ dms ] ];
+          if( dms != 0 )
+            weights[ dms ][ elm ] /= coef[ pivot ];
+        }
+      }
+      COMMENT( "Verifying that the product of the 1D kernels gives all coefficients.", 2 );
+      double tolerance = 1.0e-6 * std::abs( coef[ pivot ] );
+      for( size_t pos = 0; pos < box; ++pos ) {
+        double product = 1.0;
+        for( size_t dms = 0; dms < dims; ++dms )
+          product *= weights[ dms ][ ( pos / stride[ dms ] ) % side[ dms ] ];
+        if( std::abs( product - coef[ pos ] ) > tolerance )
+          return( false );
+      }
+      return( true );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > SeparableCorrelation( const Image< D > &img, const std::vector< Vector< double > > &weights ) {
+    try {
+      if( img.Dims( ) != weights.size( ) ) {
+        std::string msg( BIAL_ERROR( "Image dimensions and number of 1D kernels do not match." ) );
+        throw( std::logic_error( msg ) );
+      }
+      Vector< size_t > dim_size( img.Dim( ) );
+      Vector< double > data( img.size( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        data[ pxl ] = static_cast< double >( img[ pxl ] );
+      for( size_t dim = 0; dim < img.Dims( ); ++dim ) {
+        if( ( weights[ dim ].size( ) != 1 ) || ( weights[ dim ][ 0 ] != 1.0 ) )
+          Filtering::GaussianPass( data, dim_size, dim, weights[ dim ] );
+      }
+      Image< D > res( img.Dim( ), img.PixelSize( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        res[ pxl ] = CorrelationValue< D >( data[ pxl ] );
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Vector< size_t > CorrelationFFTDim( const Image< D > &img, const Kernel &krn ) {
+    try {
+      Vector< size_t > pad_dim( img.Dim( ) );
+      for( size_t dms = 0; dms < img.Dims( ); ++dms ) {
+        int low = 0;
+        int high = 0;
+        for( size_t idx = 0; idx < krn.size( ); ++idx ) {
+          low = std::min( low, krn( idx, dms ) );
+          high = std::max( high, krn( idx, dms ) );
+        }
+        pad_dim[ dms ] = FourierPlan::FastLength( img.size( dms ) + std::max( high, -low ) );
+      }
+      return( pad_dim );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > CorrelationFFT( const Image< D > &img, const Kernel &krn ) {
+    try {
+      if( img.Dims( ) != krn.Dims( ) ) {
+        std::string msg( BIAL_ERROR( "Image and kernel dimensions do not match." ) );
+        throw( std::logic_error( msg ) );
+      }
+      size_t dims = img.Dims( );
+      COMMENT( "Padding each dimension by the kernel extent, so that the circular correlation does not wrap.", 1 );
+      Vector< size_t > pad_dim( CorrelationFFTDim( img, krn ) );
+      Image< double > padded( pad_dim, img.PixelSize( ) );
+      for( size_t z = 0; z < img.size( 2 ); ++z ) {
+        for( size_t y = 0; y < img.size( 1 ); ++y ) {
+          for( size_t x = 0; x < img.size( 0 ); ++x )
+            padded( x, y, z ) = static_cast< double >( img( x, y, z ) );
+        }
+      }
+      COMMENT( "Mirrored kernel, wrapped around the padded image.", 1 );
+      Image< double > mirror( pad_dim, img.PixelSize( ) );
+      for( size_t idx = 0; idx < krn.size( ); ++idx ) {
+        Vector< size_t > crd( 3, 0 );
+        for( size_t dms = 0; dms < dims; ++dms ) {
+          int size = static_cast< int >( padded.size( dms ) );
+          crd[ dms ] = static_cast< size_t >( ( size - krn( idx, dms ) % size ) % size );
+        }
+        mirror( crd[ 0 ], crd[ 1 ], crd[ 2 ] ) += krn.Value( idx );
+      }
+      COMMENT( "Multiplying the spectra.", 1 );
+      Image< bial_complex > spectrum( RealFFT( padded ) );
+      Image< bial_complex > krn_spectrum( RealFFT( mirror ) );
+      for( size_t elm = 0; elm < spectrum.size( ); ++elm ) {
+        const bial_complex &a = spectrum[ elm ];
+        const bial_complex &b = krn_spectrum[ elm ];
+        spectrum[ elm ] = bial_complex( a.real( ) * b.real( ) - a.imag( ) * b.imag( ),
+                                        a.real( ) * b.imag( ) + a.imag( ) * b.real( ) );
+      }
+      InverseRealFFT( spectrum, padded );
+      COMMENT( "Cropping the result.", 1 );
+      Image< D > result( img );
+      for( size_t z = 0; z < img.size( 2 ); ++z ) {
+        for( size_t y = 0; y < img.size( 1 ); ++y ) {
+          for( size_t x = 0; x < img.size( 0 ); ++x )
+            result( x, y, z ) = CorrelationValue< D >( padded( x, y, z ) );
+        }
+      }
+      return( result );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
   template< class D >
   void CorrelationThreads( const Image< D > &img, const Kernel &krn, Image< D > &res, size_t thread, 
                            size_t total_threads ) {
@@ -87,13 +335,72 @@ namespace Bial {
       size_t min_index = thread * img_size / total_threads;
       size_t max_index = ( thread + 1 ) * img_size / total_threads;
       COMMENT( "Running algorithm from " << min_index << " to " << max_index - 1, 1 );
-      for( size_t pxl = min_index; pxl < max_index; ++pxl ) {
-        double sum = 0.0;
-        for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) )
-            sum += static_cast< double >( img[ adj_pxl ] ) * krn.Value( idx );
+      COMMENT( "Kernel extent, index displacements and coefficients.", 1 );
+      Vector< size_t > size( 3, 1 );
+      for( size_t dms = 0; dms < img.Dims( ); ++dms )
+        size[ dms ] = img.size( dms );
+      Vector< llint > low( 3, 0 );
+      Vector< llint > high( 3, 0 );
+      Vector< llint > offset( adj_size, 0 );
+      Vector< double > weight( adj_size );
+      for( size_t idx = 0; idx < adj_size; ++idx ) {
+        llint stride = 1;
+        for( size_t dms = 0; dms < krn.Dims( ); ++dms ) {
+          llint dlt = krn( idx, dms );
+          low[ dms ] = std::min( low[ dms ], dlt );
+          high[ dms ] = std::max( high[ dms ], dlt );
+          offset[ idx ] += dlt * stride;
+          stride *= size[ dms ];
+        }
+        weight[ idx ] = krn.Value( idx );
+      }
+      llint x_min = -low[ 0 ];
+      llint x_max = static_cast< llint >( size[ 0 ] ) - high[ 0 ];
+      Vector< double > acc( size[ 0 ] );
+      const D *data = img.Data( );
+      for( size_t row = min_index / size[ 0 ]; row * size[ 0 ] < max_index; ++row ) {
+        size_t row_pxl = row * size[ 0 ];
+        llint y = row % size[ 1 ];
+        llint z = row / size[ 1 ];
+        size_t begin = std::max( row_pxl, min_index ) - row_pxl;
+        size_t end = std::min( row_pxl + size[ 0 ], max_index ) - row_pxl;
+        size_t span_begin = end;
+        size_t span_end = end;
+        if( ( y + low[ 1 ] >= 0 ) && ( y + high[ 1 ] < static_cast< llint >( size[ 1 ] ) ) &&
+            ( z + low[ 2 ] >= 0 ) && ( z + high[ 2 ] < static_cast< llint >( size[ 2 ] ) ) &&
+            ( x_min < x_max ) ) {
+          span_begin = std::min( std::max( static_cast< size_t >( x_min ), begin ), end );
+          span_end = std::max( std::min( static_cast< size_t >( x_max ), end ), span_begin );
+        }
+        COMMENT( "Interior span: one kernel element at a time over the whole span.", 4 );
+        size_t span = span_end - span_begin;
+        if( span > 0 ) {
+          std::fill( acc.begin( ), acc.begin( ) + span, 0.0 );
+          for( size_t idx = 0; idx < adj_size; ++idx ) {
+            const D *src = data + ( static_cast< llint >( row_pxl + span_begin ) + offset[ idx ] );
+            double wgt = weight[ idx ];
+            double *sum = &acc[ 0 ];
+            for( size_t elm = 0; elm < span; ++elm )
+              sum[ elm ] += static_cast< double >( src[ elm ] ) * wgt;
+          }
+          for( size_t elm = 0; elm < span; ++elm )
+            res[ row_pxl + span_begin + elm ] = static_cast< D >( acc[ elm ] );
+        }
+        COMMENT( "Border pixels.", 4 );
+        for( size_t x = begin; x < end; ++x ) {
+          if( x == span_begin ) {
+            x = span_end;
+            if( x == end )
+              break;
+          }
+          size_t pxl = row_pxl + x;
+          double sum = 0.0;
+          for( size_t idx = 0; idx < adj_size; ++idx ) {
+            if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) )
+              sum += static_cast< double >( img[ adj_pxl ] ) * krn.Value( idx );
+          }
+          res[ pxl ] = static_cast< D >( sum );
         }
-        res[ pxl ] = static_cast< D >( sum );
       }
       COMMENT( "Finishing.", 1 );
     }
@@ -121,19 +428,35 @@ namespace Bial {
   
 #ifdef BIAL_EXPLICIT_Correlation
 
-  template Image< int > Correlation( const Image< int > &img, const Kernel &krn );
+  template Image< int > Correlation( const Image< int > &img, const Kernel &krn, CorrelationMethod method );
+  template Image< int > CorrelationFFT( const Image< int > &img, const Kernel &krn );
+  template Image< int > SeparableCorrelation( const Image< int > &img,
+                                             const std::vector< Vector< double > > &weights );
+  template Vector< size_t > CorrelationFFTDim( const Image< int > &img, const Kernel &krn );
   template void CorrelationThreads( const Image< int > &img, const Kernel &krn, Image< int > &res, size_t thread, 
                                     size_t total_threads );
 
-  template Image< llint > Correlation( const Image< llint > &img, const Kernel &krn );
+  template Image< llint > Correlation( const Image< llint > &img, const Kernel &krn, CorrelationMethod method );
+  template Image< llint > CorrelationFFT( const Image< llint > &img, const Kernel &krn );
+  template Image< llint > SeparableCorrelation( const Image< llint > &img,
+                                             const std::vector< Vector< double > > &weights );
+  template Vector< size_t > CorrelationFFTDim( const Image< llint > &img, const Kernel &krn );
   template void CorrelationThreads( const Image< llint > &img, const Kernel &krn, Image< llint > &res, size_t thread,
                                     size_t total_threads );
 
-  template Image< float > Correlation( const Image< float > &img, const Kernel &krn );
+  template Image< float > Correlation( const Image< float > &img, const Kernel &krn, CorrelationMethod method );
+  template Image< float > CorrelationFFT( const Image< float > &img, const Kernel &krn );
+  template Image< float > SeparableCorrelation( const Image< float > &img,
+                                             const std::vector< Vector< double > > &weights );
+  template Vector< size_t > CorrelationFFTDim( const Image< float > &img, const Kernel &krn );
   template void CorrelationThreads( const Image< float > &img, const Kernel &krn, Image< float > &res, size_t thread,
                                     size_t total_threads );
 
-  template Image< double > Correlation( const Image< double > &img, const Kernel &krn );
+  template Image< double > Correlation( const Image< double > &img, const Kernel &krn, CorrelationMethod method );
+  template Image< double > CorrelationFFT( const Image< double > &img, const Kernel &krn );
+  template Image< double > SeparableCorrelation( const Image< double > &img,
+                                             const std::vector< Vector< double > > &weights );
+  template Vector< size_t > CorrelationFFTDim( const Image< double > &img, const Kernel &krn );
   template void CorrelationThreads( const Image< double > &img, const Kernel &krn, Image< double > &res, size_t thread,
                                     size_t total_threads );
 
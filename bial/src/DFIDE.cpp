@@ -602,6 +602,49 @@ namespace Bial {
     return( ( *DFIDE::DoubleDistancePtrTgt )( src.data( ) + src_orig, tgt.data( ) + tgt_orig, dms ) );
   }
 
+  template< class D >
+  void DFIDE::Distances( const D *src, const D *tgt, const size_t tgt_size, const size_t dms, double *dist ) {
+    switch( distance_function_type ) {
+        case DistanceFunctionType::Euclidean:
+        EuclideanDistanceFunction::Distances< D >( src, tgt, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::PreEuclidean:
+        PreEuclideanDistanceFunction::Distances< D >( src, tgt, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::SquareEuclidean:
+        SquareEuclideanDistanceFunction::Distances< D >( src, tgt, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::CityBlock:
+        CityBlockDistanceFunction::Distances< D >( src, tgt, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::ChessBoard:
+        ChessBoardDistanceFunction::Distances< D >( src, tgt, tgt_size, dms, dist );
+        break;
+    }
+  }
+
+  template< class D >
+  void DFIDE::Distances( const D *src, const D *tgt, const size_t *rows, const size_t tgt_size, const size_t dms,
+                         double *dist ) {
+    switch( distance_function_type ) {
+        case DistanceFunctionType::Euclidean:
+        EuclideanDistanceFunction::Distances< D >( src, tgt, rows, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::PreEuclidean:
+        PreEuclideanDistanceFunction::Distances< D >( src, tgt, rows, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::SquareEuclidean:
+        SquareEuclideanDistanceFunction::Distances< D >( src, tgt, rows, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::CityBlock:
+        CityBlockDistanceFunction::Distances< D >( src, tgt, rows, tgt_size, dms, dist );
+        break;
+        case DistanceFunctionType::ChessBoard:
+        ChessBoardDistanceFunction::Distances< D >( src, tgt, rows, tgt_size, dms, dist );
+        break;
+    }
+  }
+
   inline void DFIDE::SetEuclideanDistanceFunction( ) {
     distance_function_type = DistanceFunctionType::Euclidean;
     CharDistancePtr = &EuclideanDistanceFunction::Distance;
@@ -816,6 +859,27 @@ namespace Bial {
 
 #ifdef BIAL_EXPLICIT_DFIDE
 
+  template void DFIDE::Distances( const uchar *src, const uchar *tgt, const size_t tgt_size, const size_t dms,
+                                  double *dist );
+  template void DFIDE::Distances( const int *src, const int *tgt, const size_t tgt_size, const size_t dms,
+                                  double *dist );
+  template void DFIDE::Distances( const llint *src, const llint *tgt, const size_t tgt_size, const size_t dms,
+                                  double *dist );
+  template void DFIDE::Distances( const float *src, const float *tgt, const size_t tgt_size, const size_t dms,
+                                  double *dist );
+  template void DFIDE::Distances( const double *src, const double *tgt, const size_t tgt_size, const size_t dms,
+                                  double *dist );
+  template void DFIDE::Distances( const uchar *src, const uchar *tgt, const size_t *rows, const size_t tgt_size,
+                                  const size_t dms, double *dist );
+  template void DFIDE::Distances( const int *src, const int *tgt, const size_t *rows, const size_t tgt_size,
+                                  const size_t dms, double *dist );
+  template void DFIDE::Distances( const llint *src, const llint *tgt, const size_t *rows, const size_t tgt_size,
+                                  const size_t dms, double *dist );
+  template void DFIDE::Distances( const float *src, const float *tgt, const size_t *rows, const size_t tgt_size,
+                                  const size_t dms, double *dist );
+  template void DFIDE::Distances( const double *src, const double *tgt, const size_t *rows, const size_t tgt_size,
+                                  const size_t dms, double *dist );
+
   template double DFIDE::Distance( const Feature< int > &src, const size_t orig, const size_t dms );
   template double DFIDE::Distance( const Feature< int > &src, const size_t src_orig, const size_t tgt_orig,
                                    const size_t dms );
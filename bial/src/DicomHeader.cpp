@@ -39,7 +39,8 @@
 
 namespace Bial {
 
-  DicomHeader::DicomHeader( ) : lista( std::deque< TGroupId >( ) ) {
+  DicomHeader::DicomHeader( ) : lista( std::deque< TGroupId >( ) ), explicit_vr( true ), pixel_offset( 0 ),
+    pixel_bytes( 0 ) {
   }
 
   void DicomHeader::push( TGroupId group ) {
@@ -202,6 +203,214 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
+  bool DicomHeader::findElement( int grupo, int elemento, TElementId &element ) {
+    for( iterator it = lista.begin( ); it != lista.end( ); ++it ) {
+      if( it->getId( ) == grupo ) {
+        for( TGroupId::iterator ig = it->begin( ); ig != it->end( ); ++ig ) {
+          if( ig->getId( ) == elemento ) {
+            element = *ig;
+            return( true );
+          }
+        }
+      }
+    }
+    return( false );
+  }
+
+  size_t DicomHeader::getPixelOffset( ) const {
+    return( pixel_offset );
+  }
+
+  size_t DicomHeader::getPixelBytes( ) const {
+    return( pixel_bytes );
+  }
+
+  void DicomHeader::storeElement( int grupo, const TElementId &element ) {
+    if( lista.empty( ) || ( lista.back( ).getId( ) != grupo ) ) {
+      lista.push_back( TGroupId( grupo ) );
+    }
+    lista.back( ).push( grupo, element );
+  }
+
+  /** @brief Little endian unsigned integers from memory, independently of the byte order of the machine. */
+  static inline uint32_t DicomUInt16( const char *data ) {
+    const unsigned char *byte = reinterpret_cast< const unsigned char* >( data );
+    return( static_cast< uint32_t >( byte[ 0 ] ) | ( static_cast< uint32_t >( byte[ 1 ] ) << 8 ) );
+  }
+
+  static inline uint32_t DicomUInt32( const char *data ) {
+    return( DicomUInt16( data ) | ( DicomUInt16( data + 2 ) << 16 ) );
+  }
+
+  /** @brief Value representation of the binary elements read in implicit value representation. Empty for text. */
+  static inline const char *DicomImplicitVR( int group, int element ) {
+    if( element == 0x0000 ) {
+      return( "UL" );
+    }
+    if( group == 0x0028 ) {
+      switch( element ) {
+      case 0x0002: // Samples per pixel.
+      case 0x0010: // Rows.
+      case 0x0011: // Columns.
+      case 0x0100: // Bits allocated.
+      case 0x0101: // Bits stored.
+      case 0x0102: // High bit.
+      case 0x0103: // Pixel representation.
+        return( "US" );
+      }
+    }
+    return( "" );
+  }
+
+  size_t DicomHeader::readElements( const char *data, size_t pos, size_t end, size_t depth, bool sequences ) {
+    const uint32_t undefined = 0xFFFFFFFF;
+    if( depth > MaxDepth ) {
+      std::string msg( BIAL_ERROR( "Corrupted Dicom file. Sequences are nested too deeply." ) );
+      throw( std::logic_error( msg ) );
+    }
+    while( pos + 8 <= end ) {
+      int igroup = static_cast< int >( DicomUInt16( data + pos ) );
+      int isub = static_cast< int >( DicomUInt16( data + pos + 2 ) );
+      if( igroup == 0xFFFE ) {
+        COMMENT( "Item and delimiters have no value representation.", 4 );
+        uint32_t length = DicomUInt32( data + pos + 4 );
+        pos += 8;
+        if( ( isub == 0xE00D ) || ( isub == 0xE0DD ) ) {
+          return( pos );
+        }
+        size_t item_end = ( length == undefined ) ? end : std::min( end, pos + length );
+        size_t next = readElements( data, pos, item_end, depth + 1, sequences );
+        pos = ( length == undefined ) ? next : item_end;
+        continue;
+      }
+      std::string vr;
+      uint32_t length;
+      if( explicit_vr || ( igroup == 0x0002 ) ) {
+        vr.assign( data + pos + 4, 2 );
+        if( ( vr == "OB" ) || ( vr == "OW" ) || ( vr == "OF" ) || ( vr == "OD" ) || ( vr == "OL" ) ||
+            ( vr == "SQ" ) || ( vr == "UT" ) || ( vr == "UN" ) || ( vr == "UC" ) || ( vr == "UR" ) ) {
+          if( pos + 12 > end ) {
+            break;
+          }
+          length = DicomUInt32( data + pos + 8 );
+          pos += 12;
+        }
+        else {
+          length = DicomUInt16( data + pos + 6 );
+          pos += 8;
+        }
+      }
+      else {
+        COMMENT( "Implicit value representation. Decimal and integer strings, as rescale slope, are text.", 4 );
+        length = DicomUInt32( data + pos + 4 );
+        pos += 8;
+        vr = ( length == undefined ) ? "SQ" : DicomImplicitVR( igroup, isub );
+      }
+      if( ( igroup == 0x7FE0 ) && ( isub == 0x0010 ) && ( depth == 0 ) ) {
+        if( length == undefined ) {
+          std::string msg( BIAL_ERROR( "Compressed Dicom pixel data is not supported." ) );
+          throw( std::logic_error( msg ) );
+        }
+        if( pos + length > end ) {
+          std::string msg( BIAL_ERROR( "Corrupted Dicom image. Pixel data exceeds file size." ) );
+          throw( std::logic_error( msg ) );
+        }
+        pixel_offset = pos;
+        pixel_bytes = length;
+        return( end );
+      }
+      if( ( vr == "SQ" ) || ( length == undefined ) ) {
+        size_t sequence_end = ( length == undefined ) ? end : std::min( end, pos + length );
+        size_t next = readElements( data, pos, sequence_end, depth + 1, sequences );
+        pos = ( length == undefined ) ? next : sequence_end;
+        continue;
+      }
+      if( pos + length > end ) {
+        std::string msg( BIAL_ERROR( "Corrupted Dicom file. Element exceeds file size." ) );
+        throw( std::logic_error( msg ) );
+      }
+      if( ( depth == 0 ) || sequences ) {
+        TElementId element;
+        const char *value = data + pos;
+        if( ( vr == "US" ) && ( length >= 2 ) ) {
+          element.set( isub, static_cast< int >( DicomUInt16( value ) ) );
+        }
+        else if( ( vr == "SS" ) && ( length >= 2 ) ) {
+          element.set( isub, static_cast< int >( static_cast< int16_t >( DicomUInt16( value ) ) ) );
+        }
+        else if( ( ( vr == "UL" ) || ( vr == "SL" ) ) && ( length >= 4 ) ) {
+          element.set( isub, static_cast< int >( DicomUInt32( value ) ) );
+        }
+        else if( ( vr == "FL" ) && ( length >= 4 ) ) {
+          float fvalue;
+          uint32_t bits = DicomUInt32( value );
+          std::memcpy( &fvalue, &bits, sizeof( float ) );
+          element.set( isub, fvalue );
+        }
+        else {
+          COMMENT( "Text values lose their padding, so that UIDs and codes may be compared.", 4 );
+          size_t size = length;
+          while( ( size > 0 ) && ( ( value[ size - 1 ] == ' ' ) || ( value[ size - 1 ] == '\0' ) ) ) {
+            --size;
+          }
+          element.set( isub, std::string( value, size ) );
+        }
+        storeElement( igroup, element );
+        if( ( igroup == 0x0002 ) && ( isub == 0x0010 ) ) {
+          std::string syntax( element.getStringValue( ) );
+          if( syntax == "1.2.840.10008.1.2" ) {
+            explicit_vr = false;
+          }
+          else if( syntax == "1.2.840.10008.1.2.2" ) {
+            std::string msg( BIAL_ERROR( "Big endian Dicom transfer syntax is not supported." ) );
+            throw( std::logic_error( msg ) );
+          }
+          else {
+            explicit_vr = true;
+          }
+        }
+      }
+      pos += length;
+    }
+    return( end );
+  }
+
+  void DicomHeader::readHeader( const char *data, size_t size, bool sequences ) {
+    try {
+      lista.clear( );
+      pixel_offset = 0;
+      pixel_bytes = 0;
+      size_t pos = 0;
+      if( ( size >= 132 ) && ( std::string( data + 128, 4 ) == "DICM" ) ) {
+        pos = 132;
+      }
+      else if( size < 8 ) {
+        std::string msg( BIAL_ERROR( "Corrupted Dicom file. File is too small." ) );
+        throw( std::logic_error( msg ) );
+      }
+      COMMENT( "Without meta information, value representation is explicit if it looks like one.", 4 );
+      explicit_vr = ( pos == 132 ) || ( std::isupper( static_cast< unsigned char >( data[ pos + 4 ] ) ) &&
+                                        std::isupper( static_cast< unsigned char >( data[ pos + 5 ] ) ) );
+      readElements( data, pos, size, 0, sequences );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
   template< class D >
   Image< D > DicomHeader::readImageData( ) {
     try {
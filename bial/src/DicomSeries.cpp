@@ -0,0 +1,568 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Reading of Dicom series as volumes.
+ */
+
+#ifndef BIALDICOMSERIES_C
+#define BIALDICOMSERIES_C
+
+#include "DicomSeries.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_DicomSeries )
+#define BIAL_EXPLICIT_DicomSeries
+#endif
+
+#if defined ( BIAL_EXPLICIT_DicomSeries ) || ( BIAL_IMPLICIT_BIN )
+
+#include "DicomHeader.hpp"
+#include "File.hpp"
+#include "Image.hpp"
+#include <map>
+#include <sys/stat.h>
+
+namespace Bial {
+
+  std::map< std::pair< std::string, std::string >, std::pair< time_t, std::shared_ptr< const DicomSeries > > >
+  DicomSeries::cache;
+  std::mutex DicomSeries::cache_mutex;
+
+  /** @brief Numeric values of an element, either binary or a backslash separated decimal string. */
+  static std::vector< double > DicomValues( const TElementId &element ) {
+    std::vector< double > res;
+    if( element.getValueType( ) == 2 ) {
+      res.push_back( element.getFloatValue( ) );
+    }
+    else if( element.getValueType( ) == 3 ) {
+      res.push_back( element.getIntValue( ) );
+    }
+    else {
+      std::string text( element.getStringValue( ) );
+      for( size_t pos = 0; pos < text.size( ); ) {
+        size_t next = std::min( text.find( '\\', pos ), text.size( ) );
+        res.push_back( std::atof( text.substr( pos, next - pos ).c_str( ) ) );
+        pos = next + 1;
+      }
+    }
+    return( res );
+  }
+
+  /** @brief Integer value of an element, or default_value if it is absent. */
+  static int DicomInt( DicomHeader &dhdr, int group, int element, int default_value ) {
+    TElementId value;
+    if( !dhdr.findElement( group, element, value ) ) {
+      return( default_value );
+    }
+    std::vector< double > values( DicomValues( value ) );
+    return( values.empty( ) ? default_value : static_cast< int >( values[ 0 ] ) );
+  }
+
+  /** @brief Numeric values of an element, or default_values if it is absent or has less values. */
+  static std::vector< double > DicomDoubles( DicomHeader &dhdr, int group, int element,
+                                             const std::vector< double > &default_values ) {
+    TElementId value;
+    if( !dhdr.findElement( group, element, value ) ) {
+      return( default_values );
+    }
+    std::vector< double > values( DicomValues( value ) );
+    if( values.size( ) < default_values.size( ) ) {
+      return( default_values );
+    }
+    values.resize( default_values.size( ) );
+    return( values );
+  }
+
+  /** @brief Reads the whole file into buffer, where it can not be mapped into memory. */
+  static void DicomFileContents( const std::string &filename, std::vector< char > &buffer ) {
+    std::ifstream file;
+    file.exceptions( std::fstream::failbit | std::fstream::badbit );
+    file.open( filename, std::ios::in | std::ios::binary | std::ios::ate );
+    buffer.resize( static_cast< size_t >( file.tellg( ) ) );
+    file.seekg( 0, std::ios::beg );
+    file.read( buffer.data( ), buffer.size( ) );
+    file.close( );
+  }
+
+  bool DicomSeries::ReadSlice( const std::string &filename, Slice &slice ) {
+    try {
+      DicomHeader dhdr;
+      if( MappedFile::Supported( ) ) {
+        COMMENT( "Only the pages of the header are loaded from the mapped file.", 4 );
+        MappedFile file( filename );
+        dhdr.readHeader( file.data( ), file.size( ) );
+      }
+      else {
+        std::vector< char > buffer;
+        DicomFileContents( filename, buffer );
+        dhdr.readHeader( buffer.data( ), buffer.size( ) );
+      }
+      slice.filename = filename;
+      slice.pixel_offset = dhdr.getPixelOffset( );
+      slice.pixel_bytes = dhdr.getPixelBytes( );
+      slice.rows = DicomInt( dhdr, 0x0028, 0x0010, 0 );
+      slice.columns = DicomInt( dhdr, 0x0028, 0x0011, 0 );
+      slice.bits_allocated = DicomInt( dhdr, 0x0028, 0x0100, 16 );
+      slice.bits_stored = DicomInt( dhdr, 0x0028, 0x0101, static_cast< int >( slice.bits_allocated ) );
+      slice.is_signed = DicomInt( dhdr, 0x0028, 0x0103, 0 ) == 1;
+      COMMENT( "Only single frame gray level images are supported.", 4 );
+      if( ( slice.pixel_bytes == 0 ) || ( slice.rows == 0 ) || ( slice.columns == 0 ) ||
+          ( DicomInt( dhdr, 0x0028, 0x0002, 1 ) != 1 ) || ( DicomInt( dhdr, 0x0028, 0x0008, 1 ) != 1 ) ||
+          ( ( slice.bits_allocated != 8 ) && ( slice.bits_allocated != 16 ) && ( slice.bits_allocated != 32 ) ) ||
+          ( slice.bits_stored == 0 ) || ( slice.bits_stored > slice.bits_allocated ) ||
+          ( slice.pixel_bytes < slice.rows * slice.columns * slice.bits_allocated / 8 ) ) {
+        return( false );
+      }
+      TElementId uid;
+      slice.series_uid = dhdr.findElement( 0x0020, 0x000E, uid ) ? uid.getStringValue( ) : std::string( );
+      slice.slope = DicomDoubles( dhdr, 0x0028, 0x1053, { 1.0 } )[ 0 ];
+      slice.intercept = DicomDoubles( dhdr, 0x0028, 0x1052, { 0.0 } )[ 0 ];
+      if( slice.slope == 0.0 ) {
+        slice.slope = 1.0;
+      }
+      slice.instance = DicomInt( dhdr, 0x0020, 0x0013, 0 );
+      TElementId position;
+      if( dhdr.findElement( 0x0020, 0x0032, position ) ) {
+        slice.position = DicomDoubles( dhdr, 0x0020, 0x0032, { 0.0, 0.0, 0.0 } );
+      }
+      slice.orientation = DicomDoubles( dhdr, 0x0020, 0x0037, { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0 } );
+      std::vector< double > pixel_spacing( DicomDoubles( dhdr, 0x0028, 0x0030, { 1.0, 1.0 } ) );
+      slice.spacing = { pixel_spacing[ 0 ], pixel_spacing[ 1 ], DicomDoubles( dhdr, 0x0018, 0x0050, { 0.0 } )[ 0 ] };
+      slice.location = 0.0;
+      return( true );
+    }
+    catch( std::exception &e ) {
+      COMMENT( "Skipping " << filename << ", that is not a supported Dicom image: " << e.what( ), 2 );
+      return( false );
+    }
+  }
+
+  Vector< std::string > DicomSeries::ReadDicomDir( const std::string &filename ) {
+    try {
+      DicomHeader dhdr;
+      if( MappedFile::Supported( ) ) {
+        MappedFile file( filename );
+        dhdr.readHeader( file.data( ), file.size( ), true );
+      }
+      else {
+        std::vector< char > buffer;
+        DicomFileContents( filename, buffer );
+        dhdr.readHeader( buffer.data( ), buffer.size( ), true );
+      }
+      size_t separator = filename.find_last_of( "/\\" );
+      std::string directory( separator == std::string::npos ? std::string( ) : filename.substr( 0, separator + 1 ) );
+      COMMENT( "Records are items of a sequence. Each record type precedes the file it references.", 2 );
+      Vector< std::string > res;
+      std::string record_type;
+      for( DicomHeader::iterator grp = dhdr.begin( ); grp != dhdr.end( ); ++grp ) {
+        if( grp->getId( ) != 0x0004 ) {
+          continue;
+        }
+        for( TGroupId::iterator elm = grp->begin( ); elm != grp->end( ); ++elm ) {
+          if( elm->getId( ) == 0x1430 ) {
+            record_type = elm->getStringValue( );
+          }
+          else if( ( elm->getId( ) == 0x1500 ) && ( record_type == "IMAGE" ) ) {
+            std::string file_id( elm->getStringValue( ) );
+            std::replace( file_id.begin( ), file_id.end( ), '\\', DIR_SEPARATOR );
+            std::string path( directory + file_id );
+            if( !std::ifstream( path ).good( ) ) {
+              COMMENT( "Media file systems may present file IDs in lower case.", 3 );
+              std::transform( file_id.begin( ), file_id.end( ), file_id.begin( ), ::tolower );
+              path = directory + file_id;
+            }
+            res.push_back( path );
+          }
+        }
+      }
+      return( res );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error reading DICOMDIR file." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  DicomSeries::DicomSeries( const std::string &path, const std::string &series_uid ) try : slices( ),
+    pixel_size( 3, 1.0f ) {
+    COMMENT( "Listing the files of the series.", 2 );
+    Vector< std::string > files;
+    struct stat status;
+    if( ( stat( path.c_str( ), &status ) == 0 ) && ( ( status.st_mode & S_IFMT ) == S_IFDIR ) ) {
+      Vector< std::string > names( Directory::ListFiles( path ) );
+      for( size_t fl = 0; fl < names.size( ); ++fl ) {
+        std::string name( names[ fl ] );
+        std::transform( name.begin( ), name.end( ), name.begin( ), ::toupper );
+        if( name == "DICOMDIR" ) {
+          files = ReadDicomDir( path + DIR_SEPARATOR + names[ fl ] );
+          break;
+        }
+        files.push_back( path + DIR_SEPARATOR + names[ fl ] );
+      }
+    }
+    else {
+      files = ReadDicomDir( path );
+    }
+    COMMENT( "Parsing headers in parallel.", 2 );
+    std::vector< Slice > parsed( files.size( ) );
+    std::vector< char > valid( files.size( ), 0 );
+    auto parse = [ &files, &parsed, &valid ]( size_t tsk, size_t total_tasks ) {
+      size_t last = files.size( ) * ( tsk + 1 ) / total_tasks;
+      for( size_t fl = files.size( ) * tsk / total_tasks; fl < last; ++fl ) {
+        valid[ fl ] = ReadSlice( files[ fl ], parsed[ fl ] );
+      }
+    };
+    ThreadPool &pool = ThreadPool::Global( );
+    try {
+      pool.Run( pool.Tasks( files.size( ) ), parse );
+    }
+    catch( std::exception &e ) {
+      BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+      parse( 0, 1 );
+    }
+    COMMENT( "Selecting the series.", 2 );
+    std::string selected( series_uid );
+    if( selected.empty( ) ) {
+      std::map< std::string, size_t > count;
+      size_t most = 0;
+      for( size_t fl = 0; fl < files.size( ); ++fl ) {
+        if( valid[ fl ] && ( ++count[ parsed[ fl ].series_uid ] > most ) ) {
+          most = count[ parsed[ fl ].series_uid ];
+          selected = parsed[ fl ].series_uid;
+        }
+      }
+    }
+    for( size_t fl = 0; fl < files.size( ); ++fl ) {
+      if( valid[ fl ] && ( parsed[ fl ].series_uid == selected ) ) {
+        slices.push_back( std::move( parsed[ fl ] ) );
+      }
+    }
+    if( slices.empty( ) ) {
+      std::string msg( BIAL_ERROR( "No supported Dicom image of the series found in " + path + "." ) );
+      throw( std::logic_error( msg ) );
+    }
+    COMMENT( "Sorting slices by their position along the normal of the slice plane.", 2 );
+    const std::vector< double > &ori( slices[ 0 ].orientation );
+    double normal[ 3 ] = {
+      ori[ 1 ] * ori[ 5 ] - ori[ 2 ] * ori[ 4 ],
+      ori[ 2 ] * ori[ 3 ] - ori[ 0 ] * ori[ 5 ],
+      ori[ 0 ] * ori[ 4 ] - ori[ 1 ] * ori[ 3 ]
+    };
+    bool positioned = true;
+    for( Slice &slice : slices ) {
+      if( slice.position.empty( ) ) {
+        positioned = false;
+      }
+      else {
+        slice.location = slice.position[ 0 ] * normal[ 0 ] + slice.position[ 1 ] * normal[ 1 ] +
+          slice.position[ 2 ] * normal[ 2 ];
+      }
+    }
+    if( positioned ) {
+      std::stable_sort( slices.begin( ), slices.end( ), [ ]( const Slice &a, const Slice &b ) {
+          return( a.location < b.location );
+        } );
+    }
+    else {
+      std::stable_sort( slices.begin( ), slices.end( ), [ ]( const Slice &a, const Slice &b ) {
+          return( a.instance < b.instance );
+        } );
+    }
+    for( const Slice &slice : slices ) {
+      if( ( slice.rows != slices[ 0 ].rows ) || ( slice.columns != slices[ 0 ].columns ) ||
+          ( slice.bits_allocated != slices[ 0 ].bits_allocated ) || ( slice.bits_stored != slices[ 0 ].bits_stored ) ||
+          ( slice.is_signed != slices[ 0 ].is_signed ) ) {
+        std::string msg( BIAL_ERROR( "Slices of Dicom series have different sizes or pixel formats. Slice: " +
+                                     slice.filename ) );
+        throw( std::logic_error( msg ) );
+      }
+    }
+    COMMENT( "Pixel spacing holds the spacing between rows first.", 2 );
+    pixel_size[ 0 ] = static_cast< float >( slices[ 0 ].spacing[ 1 ] );
+    pixel_size[ 1 ] = static_cast< float >( slices[ 0 ].spacing[ 0 ] );
+    double slice_spacing = 0.0;
+    if( positioned && ( slices.size( ) > 1 ) ) {
+      slice_spacing = ( slices.back( ).location - slices.front( ).location ) / ( slices.size( ) - 1 );
+    }
+    if( slice_spacing <= 0.0 ) {
+      slice_spacing = slices[ 0 ].spacing[ 2 ] > 0.0 ? slices[ 0 ].spacing[ 2 ] : 1.0;
+    }
+    pixel_size[ 2 ] = static_cast< float >( slice_spacing );
+  }
+  catch( std::ios_base::failure &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error reading Dicom series." ) );
+    throw( std::ios_base::failure( msg ) );
+  }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( const std::out_of_range &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+    throw( std::out_of_range( msg ) );
+  }
+  catch( const std::logic_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+    throw( std::logic_error( msg ) );
+  }
+
+  std::shared_ptr< const DicomSeries > DicomSeries::Open( const std::string &path, const std::string &series_uid ) {
+    try {
+      struct stat status;
+      time_t modified = ( stat( path.c_str( ), &status ) == 0 ) ? status.st_mtime : 0;
+      std::pair< std::string, std::string > key( path, series_uid );
+      {
+        std::lock_guard< std::mutex > lock( cache_mutex );
+        auto found = cache.find( key );
+        if( ( found != cache.end( ) ) && ( found->second.first == modified ) ) {
+          return( found->second.second );
+        }
+      }
+      COMMENT( "Parsing the series outside the lock, so that other series may be opened meanwhile.", 2 );
+      std::shared_ptr< const DicomSeries > series( std::make_shared< DicomSeries >( path, series_uid ) );
+      std::lock_guard< std::mutex > lock( cache_mutex );
+      if( ( cache.size( ) >= MaxSeries ) && ( cache.find( key ) == cache.end( ) ) ) {
+        COMMENT( "Releasing series used only by the cache.", 2 );
+        for( auto itr = cache.begin( ); itr != cache.end( ); ) {
+          if( itr->second.second.use_count( ) == 1 ) {
+            itr = cache.erase( itr );
+          }
+          else {
+            ++itr;
+          }
+        }
+      }
+      cache[ key ] = std::make_pair( modified, series );
+      return( series );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error reading Dicom series." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void DicomSeries::ClearCache( ) {
+    std::lock_guard< std::mutex > lock( cache_mutex );
+    cache.clear( );
+  }
+
+  size_t DicomSeries::Slices( ) const {
+    return( slices.size( ) );
+  }
+
+  const std::string &DicomSeries::FileName( size_t slice ) const {
+    return( slices.at( slice ).filename );
+  }
+
+  const std::string &DicomSeries::SeriesUID( ) const {
+    return( slices[ 0 ].series_uid );
+  }
+
+  Vector< size_t > DicomSeries::Dim( ) const {
+    return( Vector< size_t >( { slices[ 0 ].columns, slices[ 0 ].rows, slices.size( ) } ) );
+  }
+
+  Vector< float > DicomSeries::PixelSize( ) const {
+    return( pixel_size );
+  }
+
+  /**
+   * @brief Converts size stored values of type S to D. Bits above bits_stored are discarded, extending the sign
+   * of signed values.
+   */
+  template< class S, class D >
+  static void DicomConvert( const char *src, D *dst, size_t size, size_t bits_stored, double slope,
+                            double intercept ) {
+    typedef typename std::make_unsigned< S >::type U;
+    const size_t shift = 8 * sizeof( S ) - bits_stored;
+    const bool rescale = ( slope != 1.0 ) || ( intercept != 0.0 );
+    for( size_t elm = 0; elm < size; ++elm ) {
+      U bits;
+      std::memcpy( &bits, src + elm * sizeof( S ), sizeof( S ) );
+      S value = static_cast< S >( static_cast< U >( bits << shift ) ) >> shift;
+      if( rescale ) {
+        dst[ elm ] = static_cast< D >( value * slope + intercept );
+      }
+      else {
+        dst[ elm ] = static_cast< D >( value );
+      }
+    }
+  }
+
+  template< class D >
+  void DicomSeries::ReadPixels( size_t slice, D *data ) const {
+    const Slice &slc( slices[ slice ] );
+    size_t size = slc.rows * slc.columns;
+    size_t bytes = size * slc.bits_allocated / 8;
+    std::vector< char > buffer;
+    std::unique_ptr< MappedFile > mapped;
+    const char *src;
+    if( MappedFile::Supported( ) ) {
+      mapped.reset( new MappedFile( slc.filename ) );
+      if( mapped->size( ) < slc.pixel_offset + bytes ) {
+        std::string msg( BIAL_ERROR( "Dicom file was truncated after its header was read: " + slc.filename ) );
+        throw( std::ios_base::failure( msg ) );
+      }
+      src = mapped->data( ) + slc.pixel_offset;
+    }
+    else {
+      IFile file;
+      file.exceptions( std::fstream::failbit | std::fstream::badbit );
+      file.open( slc.filename, std::ios::in | std::ios::binary );
+      file.seekg( slc.pixel_offset );
+      buffer.resize( bytes );
+      file.read( buffer.data( ), bytes );
+      file.close( );
+      src = buffer.data( );
+    }
+    if( slc.bits_allocated == 8 ) {
+      if( slc.is_signed )
+        DicomConvert< int8_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+      else
+        DicomConvert< uint8_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+    }
+    else if( slc.bits_allocated == 16 ) {
+      if( slc.is_signed )
+        DicomConvert< int16_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+      else
+        DicomConvert< uint16_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+    }
+    else {
+      if( slc.is_signed )
+        DicomConvert< int32_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+      else
+        DicomConvert< uint32_t >( src, data, size, slc.bits_stored, slc.slope, slc.intercept );
+    }
+  }
+
+  template< class D >
+  Image< D > DicomSeries::Read( ) const {
+    try {
+      COMMENT( "Allocating the volume and decoding each slice into its place.", 2 );
+      Image< D > res( Dim( ), PixelSize( ) );
+      D *data = res.data( );
+      size_t slice_size = slices[ 0 ].rows * slices[ 0 ].columns;
+      auto decode = [ this, data, slice_size ]( size_t tsk, size_t total_tasks ) {
+        size_t last = slices.size( ) * ( tsk + 1 ) / total_tasks;
+        for( size_t slc = slices.size( ) * tsk / total_tasks; slc < last; ++slc ) {
+          ReadPixels( slc, data + slc * slice_size );
+        }
+      };
+      ThreadPool &pool = ThreadPool::Global( );
+      try {
+        pool.Run( pool.Tasks( slices.size( ) ), decode );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        decode( 0, 1 );
+      }
+      return( res );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error reading Dicom series." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > ReadDicomSeries( const std::string &path, const std::string &series_uid ) {
+    try {
+      return( DicomSeries::Open( path, series_uid )->Read< D >( ) );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error reading Dicom series." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+#ifdef BIAL_EXPLICIT_DicomSeries
+
+  template Image< int > DicomSeries::Read( ) const;
+  template Image< int > ReadDicomSeries( const std::string &path, const std::string &series_uid );
+
+  template Image< llint > DicomSeries::Read( ) const;
+  template Image< llint > ReadDicomSeries( const std::string &path, const std::string &series_uid );
+
+  template Image< float > DicomSeries::Read( ) const;
+  template Image< float > ReadDicomSeries( const std::string &path, const std::string &series_uid );
+
+  template Image< double > DicomSeries::Read( ) const;
+  template Image< double > ReadDicomSeries( const std::string &path, const std::string &series_uid );
+
+#endif
+
+}
+
+#endif
+
+#endif
@@ -115,7 +115,7 @@ namespace Bial {
   }
 
   template< class D >
-  void SVGDForest( const Image< D > &cost, const Image< int > &pred, const std::string &filename, 
+  void SVGDForest( const Image< D > &cost, const Image< bial_index > &pred, const std::string &filename, 
                    const Image< int > *label ) {
     size_t img_xsize = cost.size( 0 );
     size_t img_ysize = cost.size( 1 );
@@ -180,7 +180,7 @@ namespace Bial {
           short red = ( *label )( pxl ) % 256;
           short green = ( ( *label )( pxl ) / 256 ) % 256;
           short blue = ( ( *label )( pxl ) / ( 256 * 256 ) ) % 256;
-          if( ( pred( pxl ) == -1 ) || ( pred( pxl ) == static_cast< int >( pxl ) ) )
+          if( ( pred( pxl ) == -1 ) || ( pred( pxl ) == static_cast< bial_index >( pxl ) ) )
             file << "  <circle cx=\"" << x_pos << "\" cy=\"" << y_pos << "\" r=\"1.5\" fill=\"#"
                  << std::hex << ( red < 10 ? "0" : "" ) << red << ( green < 10 ? "0" : "" ) << green
                  << ( blue < 10 ? "0" : "" ) << blue << std::dec << "\" />" << std::endl;
@@ -190,7 +190,7 @@ namespace Bial {
                  << ( blue < 10 ? "0" : "" ) << blue << std::dec << "\" />" << std::endl;
         }
         else {
-          if( ( pred( pxl ) == -1 ) || ( pred( pxl ) == static_cast< int >( pxl ) ) )
+          if( ( pred( pxl ) == -1 ) || ( pred( pxl ) == static_cast< bial_index >( pxl ) ) )
             file << "  <circle cx=\"" << x_pos << "\" cy=\"" << y_pos << "\" r=\"1.5\" fill=\"black\" />" << std::endl;
           else
             file << "  <circle cx=\"" << x_pos << "\" cy=\"" << y_pos << "\" r=\"1\" fill=\"black\" />" << std::endl;
@@ -221,13 +221,13 @@ namespace Bial {
   template void SVGDGraph( const Image< double > &vertex, const Adjacency &adj, const std::string &filename,
                            const Vector< bool > *seed, const Image< int > *label);
 
-  template void SVGDForest( const Image< int > &cost, const Image< int > &pred, const std::string &filename,
+  template void SVGDForest( const Image< int > &cost, const Image< bial_index > &pred, const std::string &filename,
                             const Image< int > *label );
-  template void SVGDForest( const Image< llint > &cost, const Image< int > &pred, const std::string &filename,
+  template void SVGDForest( const Image< llint > &cost, const Image< bial_index > &pred, const std::string &filename,
                             const Image< int > *label );
-  template void SVGDForest( const Image< float > &cost, const Image< int > &pred, const std::string &filename,
+  template void SVGDForest( const Image< float > &cost, const Image< bial_index > &pred, const std::string &filename,
                             const Image< int > *label );
-  template void SVGDForest( const Image< double > &cost, const Image< int > &pred, const std::string &filename,
+  template void SVGDForest( const Image< double > &cost, const Image< bial_index > &pred, const std::string &filename,
                             const Image< int > *label );
 
 #endif
@@ -25,14 +25,14 @@
 #include "FastIncreasingFifoBucketQueue.hpp"
 #include "GradientMorphological.hpp"
 #include "Image.hpp"
-#include "ImageIFT.hpp"
+#include "ImageIFTEngine.hpp"
 #include "IntensityGlobals.hpp"
 #include "MaxPathFunction.hpp"
 
 namespace Bial {
 
   template< class D >
-  std::tuple< Image< D >, Image< int > > Edge::LazyWalk( const Image< D > &img, const Vector< bool > &seed ) {
+  std::tuple< Image< D >, Image< bial_index > > Edge::LazyWalk( const Image< D > &img, const Vector< bool > &seed ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad( Gradient::Morphological( img ) );
     COMMENT( "Computing gradient complement.", 0 );
@@ -42,7 +42,7 @@ namespace Bial {
     Image< D > handicap( grad );
     grad += delta;
     D maximum = grad.Maximum( );
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     MaxPathFunction< Image, D > pf( grad, nullptr, &predecessor, false, handicap );
     Adjacency adj( AdjacencyType::HyperSpheric( 1.9, img.Dims( ) ) );
     size_t size = grad.size( );
@@ -53,14 +53,14 @@ namespace Bial {
       else
         grad( elm ) = std::numeric_limits< D >::max( );
     }
-    ImageIFT< D > ift( grad, adj, &pf, &queue );
+    ImageIFTEngine< D, MaxPathFunction< Image, D >, FastIncreasingFifoBucketQueue > ift( grad, adj, &pf, &queue );
     ift.Run( );
     COMMENT( "Returning maps.", 0 );
     return( std::tie( grad, predecessor ) );
   }
 
   template< class D >
-  std::tuple< Image< D >, Image< int > > 
+  std::tuple< Image< D >, Image< bial_index > > 
   Edge::LazyWalk( const Image< D > &img, const Image< D > &msk, const Vector< bool > &seed ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad = Gradient::Morphological( img );
@@ -71,7 +71,7 @@ namespace Bial {
     Image< D > handicap( grad );
     grad += delta;
     D maximum = grad.Maximum( );
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     MaxPathFunction< Image, D > pf( grad, nullptr, &predecessor, false, handicap );
     Adjacency adj( AdjacencyType::HyperSpheric( 1.9, img.Dims( ) ) );
     size_t size = grad.size( );
@@ -84,7 +84,7 @@ namespace Bial {
       else
         grad( elm ) = std::numeric_limits< D >::max( );
     }
-    ImageIFT< D > ift( grad, adj, &pf, &queue );
+    ImageIFTEngine< D, MaxPathFunction< Image, D >, FastIncreasingFifoBucketQueue > ift( grad, adj, &pf, &queue );
     ift.Run( );
     COMMENT( "Returning maps.", 0 );
     return( std::tie( grad, predecessor ) );
@@ -92,24 +92,24 @@ namespace Bial {
 
 #ifdef BIAL_EXPLICIT_EdgeLazyWalk
 
-  template std::tuple< Image< int >, Image< int > > 
+  template std::tuple< Image< int >, Image< bial_index > > 
   Edge::LazyWalk( const Image< int > &img, const Vector< bool > &seed );
-  template std::tuple< Image< int >, Image< int > > 
+  template std::tuple< Image< int >, Image< bial_index > > 
   Edge::LazyWalk( const Image< int > &img, const Image< int > &msk, const Vector< bool > &seed );
 
-  template std::tuple< Image< llint >, Image< int > > 
+  template std::tuple< Image< llint >, Image< bial_index > > 
   Edge::LazyWalk( const Image< llint > &img, const Vector< bool > &seed );
-  template std::tuple< Image< llint >, Image< int > > 
+  template std::tuple< Image< llint >, Image< bial_index > > 
   Edge::LazyWalk( const Image< llint > &img, const Image< llint > &msk, const Vector< bool > &seed );
 
-  template std::tuple< Image< float >, Image< int > > 
+  template std::tuple< Image< float >, Image< bial_index > > 
   Edge::LazyWalk( const Image< float > &img, const Vector< bool > &seed );
-  template std::tuple< Image< float >, Image< int > > 
+  template std::tuple< Image< float >, Image< bial_index > > 
   Edge::LazyWalk( const Image< float > &img, const Image< float > &msk, const Vector< bool > &seed );
 
-  template std::tuple< Image< double >, Image< int > > 
+  template std::tuple< Image< double >, Image< bial_index > > 
   Edge::LazyWalk( const Image< double > &img, const Vector< bool > &seed );
-  template std::tuple< Image< double >, Image< int > > 
+  template std::tuple< Image< double >, Image< bial_index > > 
   Edge::LazyWalk( const Image< double > &img, const Image< double > &msk, const Vector< bool > &seed );
 
 #endif
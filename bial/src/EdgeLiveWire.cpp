@@ -31,7 +31,7 @@
 
 namespace Bial {
 
-  template< class D > std::tuple< Image< D >, Image< int > > 
+  template< class D > std::tuple< Image< D >, Image< bial_index > > 
   Edge::LiveWire( const Image< D > &img, const Vector< bool > &seed, float weight ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad( Gradient::Morphological( img ) );
@@ -52,7 +52,7 @@ namespace Bial {
     D delta = 1;
     Image< D > handicap( grad );
     grad += delta;
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     MaxSumPathFunction< Image, D > pf( grad, nullptr, &predecessor, false, img, handicap, 0.0, delta );
     COMMENT( "Computing IFT.", 0 );
     COMMENT( "Weight parameter is the control of the lazy-runner. Set it to a value lower than 1.0 for Live-Wire "
@@ -71,7 +71,7 @@ namespace Bial {
     return( std::tie( grad, predecessor ) );
   }
 
-  template< class D > std::tuple< Image< D >, Image< int > > 
+  template< class D > std::tuple< Image< D >, Image< bial_index > > 
   Edge::LiveWire( const Image< D > &img, const Image< D > &msk, const Vector< bool > &seed, float weight ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad( Gradient::Morphological( img ) );
@@ -92,7 +92,7 @@ namespace Bial {
     D delta = 1;
     Image< D > handicap( grad );
     grad += delta;
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     MaxSumPathFunction< Image, D > pf( grad, nullptr, &predecessor, false, img, handicap, 0.0, delta );
     COMMENT( "Computing IFT.", 0 );
     COMMENT( "Weight parameter is the control of the lazy-runner. Set it to a value lower than 1.0 for Live-Wire "
@@ -115,29 +115,31 @@ namespace Bial {
 
 #ifdef BIAL_EXPLICIT_EdgeLiveWire
 
-  template std::tuple< Image< int >, Image< int > > Edge::LiveWire( const Image< int > &img,
-                                                                    const Vector< bool > &seed, float weight );
-  template std::tuple< Image< int >, Image< int > > Edge::LiveWire( const Image< int > &img,
-                                                                    const Image< int > &msk,
-                                                                    const Vector< bool > &seed, float weight );
-
-  template std::tuple< Image< llint >, Image< int > > Edge::LiveWire( const Image< llint > &img,
-                                                                      const Vector< bool > &seed, float weight );
-  template std::tuple< Image< llint >, Image< int > > Edge::LiveWire( const Image< llint > &img,
-                                                                      const Image< llint > &msk,
-                                                                      const Vector< bool > &seed, float weight );
-
-  template std::tuple< Image< float >, Image< int > > Edge::LiveWire( const Image< float > &img,
-                                                                      const Vector< bool > &seed, float weight );
-  template std::tuple< Image< float >, Image< int > > Edge::LiveWire( const Image< float > &img,
-                                                                      const Image< float > &msk,
-                                                                      const Vector< bool > &seed, float weight );
-
-  template std::tuple< Image< double >, Image< int > > Edge::LiveWire( const Image< double > &img,
-                                                                       const Vector< bool > &seed, float weight );
-  template std::tuple< Image< double >, Image< int > > Edge::LiveWire( const Image< double > &img,
-                                                                       const Image< double > &msk,
-                                                                       const Vector< bool > &seed, float weight );
+  template std::tuple< Image< int >, Image< bial_index > > Edge::LiveWire( const Image< int > &img,
+                                                                           const Vector< bool > &seed, float weight );
+  template std::tuple< Image< int >, Image< bial_index > > Edge::LiveWire( const Image< int > &img,
+                                                                           const Image< int > &msk,
+                                                                           const Vector< bool > &seed, float weight );
+
+  template std::tuple< Image< llint >, Image< bial_index > > Edge::LiveWire( const Image< llint > &img,
+                                                                             const Vector< bool > &seed, float weight );
+  template std::tuple< Image< llint >, Image< bial_index > > Edge::LiveWire( const Image< llint > &img,
+                                                                             const Image< llint > &msk,
+                                                                             const Vector< bool > &seed, float weight );
+
+  template std::tuple< Image< float >, Image< bial_index > > Edge::LiveWire( const Image< float > &img,
+                                                                             const Vector< bool > &seed, float weight );
+  template std::tuple< Image< float >, Image< bial_index > > Edge::LiveWire( const Image< float > &img,
+                                                                             const Image< float > &msk,
+                                                                             const Vector< bool > &seed, float weight );
+
+  template std::tuple< Image< double >, Image< bial_index > > Edge::LiveWire( const Image< double > &img,
+                                                                              const Vector< bool > &seed,
+                                                                              float weight );
+  template std::tuple< Image< double >, Image< bial_index > > Edge::LiveWire( const Image< double > &img,
+                                                                              const Image< double > &msk,
+                                                                              const Vector< bool > &seed,
+                                                                              float weight );
 
 #endif
 
@@ -30,7 +30,7 @@ namespace Bial {
 
   template< class D >
   EdgeMaxPathFunction< D >::EdgeMaxPathFunction( Image< D > &init_value, Image< int > *init_label,
-                                                 Image< int > *init_predecessor, bool sequential_label, 
+                                                 Image< bial_index > *init_predecessor, bool sequential_label, 
                                                  const Image< D > &handicap, bool force_root ) try :
     PathFunction< Image, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ), 
       force_root( force_root ) {
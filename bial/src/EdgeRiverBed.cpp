@@ -32,12 +32,12 @@
 namespace Bial {
 
   template< class D >
-  std::tuple< Image< D >, Image< int > > Edge::RiverBed( const Image< D > &img, const Vector< bool > &seed ) {
+  std::tuple< Image< D >, Image< bial_index > > Edge::RiverBed( const Image< D > &img, const Vector< bool > &seed ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad = Gradient::Morphological( img );
     COMMENT( "Computing gradient complement.", 0 );
     Intensity::Complement( grad );
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     COMMENT( "Computing IFT.", 0 );
     LocalMaxPathFunction< Image, D > pf( grad, nullptr, &predecessor, false );
     size_t size = grad.size( );
@@ -51,14 +51,14 @@ namespace Bial {
   }
 
   template< class D >
-  std::tuple< Image< D >, Image< int > > 
+  std::tuple< Image< D >, Image< bial_index > > 
   Edge::RiverBed( const Image< D > &img, const Image< D > &msk, const Vector< bool > &seed ) {
     COMMENT( "Computing gradient.", 0 );
     Image< D > grad = Gradient::Morphological( img );
     COMMENT( "Computing gradient complement.", 0 );
     Intensity::Complement( grad );
     // DEBUG_WRITE( grad.DataMatrix( ), "grad_rb", 4 );
-    Image< int > predecessor( img.Dim( ), img.PixelSize( ) );
+    Image< bial_index > predecessor( img.Dim( ), img.PixelSize( ) );
     COMMENT( "Computing IFT.", 0 );
     LocalMaxPathFunction< Image, D > pf( grad, nullptr, &predecessor, false );
     size_t size = img.size( );
@@ -77,29 +77,29 @@ namespace Bial {
 
 #ifdef BIAL_EXPLICIT_EdgeRiverBed
 
-  template std::tuple< Image< int >, Image< int > > Edge::RiverBed( const Image< int > &img, 
-                                                                    const Vector< bool > &seed );
-  template std::tuple< Image< int >, Image< int > > Edge::RiverBed( const Image< int > &img,
-                                                                    const Image< int > &msk,
-                                                                    const Vector< bool > &seed );
-
-  template std::tuple< Image< llint >, Image< int > > Edge::RiverBed( const Image< llint > &img,
-                                                                      const Vector< bool > &seed );
-  template std::tuple< Image< llint >, Image< int > > Edge::RiverBed( const Image< llint > &img,
-                                                                      const Image< llint > &msk,
-                                                                      const Vector< bool > &seed );
-
-  template std::tuple< Image< float >, Image< int > > Edge::RiverBed( const Image< float > &img,
-                                                                      const Vector< bool > &seed );
-  template std::tuple< Image< float >, Image< int > > Edge::RiverBed( const Image< float > &img,
-                                                                      const Image< float > &msk,
-                                                                      const Vector< bool > &seed );
-
-  template std::tuple< Image< double >, Image< int > > Edge::RiverBed( const Image< double > &img,
-                                                                       const Vector< bool > &seed );
-  template std::tuple< Image< double >, Image< int > > Edge::RiverBed( const Image< double > &img,
-                                                                       const Image< double > &msk,
-                                                                       const Vector< bool > &seed );
+  template std::tuple< Image< int >, Image< bial_index > > Edge::RiverBed( const Image< int > &img, 
+                                                                           const Vector< bool > &seed );
+  template std::tuple< Image< int >, Image< bial_index > > Edge::RiverBed( const Image< int > &img,
+                                                                           const Image< int > &msk,
+                                                                           const Vector< bool > &seed );
+
+  template std::tuple< Image< llint >, Image< bial_index > > Edge::RiverBed( const Image< llint > &img,
+                                                                             const Vector< bool > &seed );
+  template std::tuple< Image< llint >, Image< bial_index > > Edge::RiverBed( const Image< llint > &img,
+                                                                             const Image< llint > &msk,
+                                                                             const Vector< bool > &seed );
+
+  template std::tuple< Image< float >, Image< bial_index > > Edge::RiverBed( const Image< float > &img,
+                                                                             const Vector< bool > &seed );
+  template std::tuple< Image< float >, Image< bial_index > > Edge::RiverBed( const Image< float > &img,
+                                                                             const Image< float > &msk,
+                                                                             const Vector< bool > &seed );
+
+  template std::tuple< Image< double >, Image< bial_index > > Edge::RiverBed( const Image< double > &img,
+                                                                              const Vector< bool > &seed );
+  template std::tuple< Image< double >, Image< bial_index > > Edge::RiverBed( const Image< double > &img,
+                                                                              const Image< double > &msk,
+                                                                              const Vector< bool > &seed );
 
 #endif
 
@@ -117,8 +117,8 @@ namespace Bial {
         --current;
       COMMENT( "Found index: " << current, 3 );
       --this->elements;
-      int idt = this->weight( current ).first;
-      int next = this->identity( idt ).next;
+      bial_index idt = this->weight( current ).first;
+      bial_index next = this->identity( idt ).next;
       COMMENT( "Removing idt: " << idt << ", weight_idx: " << current << ", prev: " << 
                this->identity( idt ).prev << ", next:" << next, 3 );
       this->weight( current ).first = next;
@@ -156,13 +156,13 @@ namespace Bial {
       }
       COMMENT( "Removing element " << idt << " with weight " << wgt << ".", 3 );
       size_t weight_idx = static_cast< size_t >( wgt - minimum );
-      int prev = this->identity( idt ).prev;
-      int next = this->identity( idt ).next;
+      bial_index prev = this->identity( idt ).prev;
+      bial_index next = this->identity( idt ).next;
       COMMENT( "Removing for update! elements: " << this->elements << ", minimum: " << minimum << ", maximum: " <<
                maximum << ", idt: " << idt << ", wgt: " << wgt << ", weight_idx: " << weight_idx << ", previous: " <<
                prev << ", next:" << next << ", first: " << this->weight( weight_idx ).first, 3 );
       --( this->elements );
-      if( this->weight( weight_idx ).first == static_cast< int >( idt ) ) {
+      if( this->weight( weight_idx ).first == static_cast< bial_index >( idt ) ) {
         COMMENT( "idt is the first element.", 4 );
         this->weight( weight_idx ).first = next;
         if( next == -1 ) {
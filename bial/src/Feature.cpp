@@ -47,6 +47,33 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
+  template< class D >
+  Feature< D >::Feature( Matrix< D > &&new_feature, Vector< size_t > &&new_index, Vector< int > &&new_label,
+                         size_t new_labels ) try
+    : feature( std::move( new_feature ) ), index( std::move( new_index ) ), label( std::move( new_label ) ),
+      nlabels( new_labels ) {
+      if( ( feature.Dims( ) != 2 ) || ( index.size( ) != feature.size( 1 ) ) || ( label.size( ) != feature.size( 1 ) ) ) {
+        std::string msg( BIAL_ERROR( "Index and label sizes must match the number of elements of the features." ) );
+        throw( std::logic_error( msg ) );
+      }
+    }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( const std::out_of_range &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+    throw( std::out_of_range( msg ) );
+  }
+  catch( const std::logic_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+    throw( std::logic_error( msg ) );
+  }
+
   template< class D > template< class D2 > 
   Feature< D >::Feature( const Feature< D2 > &feat, const Sample &sample ) try 
     : Feature( sample.size( ), feat.feature.size( 0 ) ) {
@@ -32,7 +32,7 @@ namespace Bial {
 
   template< template< class D > class C, class D > 
   FeatureDistanceFunction< C, D >::FeatureDistanceFunction( C< D > &init_value, C< int > *init_label, 
-                                                            C< int > *init_predecessor, bool sequential_label, 
+                                                            C< bial_index > *init_predecessor, bool sequential_label, 
                                                             const Feature< D > &new_feats ) try : 
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), feats( new_feats ) {
     }
@@ -19,6 +19,14 @@
 
 #if defined ( BIAL_EXPLICIT_File ) || ( BIAL_IMPLICIT_BIN )
 
+#ifndef IS_WINDOWS_PLATFORM
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Bial {
 
   /* Terminal -------------------------------------------------------------------- */
@@ -1929,6 +1937,10 @@ namespace Bial {
     return( gziped );
   }
 
+  void IFile::BufferSize( size_t bytes ) {
+    gz_file.rdbuf( )->BufferSize( bytes );
+  }
+
   /* IFile non-member functions. */
 
   IFile &getline( IFile &file, std::string &str, char delim ) {
@@ -3503,6 +3515,10 @@ namespace Bial {
     return( gziped );
   }
 
+  void OFile::BufferSize( size_t bytes ) {
+    gz_file.rdbuf( )->BufferSize( bytes );
+  }
+
   /* OFile non-member functions. */
 
   OFile &operator<<( OFile &file, char c ) {
@@ -3721,6 +3737,79 @@ namespace Bial {
     }
   }
 
+  /* MappedFile ---------------------------------------------------------------------------- */
+
+  MappedFile::MappedFile( const std::string &filename ) try : _data( nullptr ), _size( 0 ) {
+#ifdef IS_WINDOWS_PLATFORM
+    std::string msg( BIAL_ERROR( "Memory mapped files are not supported in this platform. File: " + filename ) );
+    throw( std::runtime_error( msg ) );
+#else
+    int descriptor = ::open( filename.c_str( ), O_RDONLY );
+    if( descriptor < 0 ) {
+      std::string msg( BIAL_ERROR( "Could not open file " + filename + ": " + std::strerror( errno ) ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    struct stat status;
+    if( fstat( descriptor, &status ) != 0 ) {
+      ::close( descriptor );
+      std::string msg( BIAL_ERROR( "Could not get size of file " + filename + ": " + std::strerror( errno ) ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    _size = static_cast< size_t >( status.st_size );
+    if( _size > 0 ) {
+      COMMENT( "Private writable mapping: written pages are copied, file is not changed.", 2 );
+      void *address = mmap( nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0 );
+      if( address == MAP_FAILED ) {
+        ::close( descriptor );
+        std::string msg( BIAL_ERROR( "Could not map file " + filename + ": " + std::strerror( errno ) ) );
+        throw( std::ios_base::failure( msg ) );
+      }
+      _data = static_cast< char* >( address );
+    }
+    COMMENT( "Mapping remains valid after closing the descriptor.", 2 );
+    ::close( descriptor );
+#endif
+  }
+  catch( std::ios_base::failure &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error mapping file." ) );
+    throw( std::ios_base::failure( msg ) );
+  }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+
+  MappedFile::~MappedFile( ) {
+#ifndef IS_WINDOWS_PLATFORM
+    if( _data != nullptr )
+      munmap( _data, _size );
+#endif
+  }
+
+  char *MappedFile::data( ) {
+    return( _data );
+  }
+
+  const char *MappedFile::data( ) const {
+    return( _data );
+  }
+
+  size_t MappedFile::size( ) const {
+    return( _size );
+  }
+
+  bool MappedFile::Supported( ) {
+#ifdef IS_WINDOWS_PLATFORM
+    return( false );
+#else
+    return( true );
+#endif
+  }
+
   /* File ---------------------------------------------------------------------------------- */
 
   std::string File::Extension( const std::string &filename, size_t pos ) {
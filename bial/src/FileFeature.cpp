@@ -20,45 +20,319 @@
 
 #include "File.hpp"
 #include "Feature.hpp"
+#include <cstring>
 
 namespace Bial {
 
-  template< class D >
-  Feature< D > FileFeature::Read( const std::string &filename ) {
+  namespace FileFeature {
+
+    /** @brief Identification of binary feature files. */
+    const char MAGIC[ 8 ] = { 'B', 'I', 'A', 'L', 'F', 'T', 'R', '\0' };
+    /** @brief Written in the byte order of the machine, to detect files written with another byte order. */
+    const uint32_t ORDER_MARK = 0x01020304;
+    /** @brief Size in bytes of the header of legacy OPF files. */
+    const size_t OPF_HEADER_SIZE = 3 * sizeof( int32_t );
+
+    /**
+     * @date 2026/Oct/18
+     * @param none.
+     * @return Type code of D in binary feature files.
+     * @brief Maps the value type of a Feature to the type code stored in binary feature files.
+     * @warning Throws logic_error for unsupported types.
+     */
+    template< class D >
+    FeatureType TypeOf( ) {
+      if( std::is_same< D, int >::value )
+        return( FeatureType::INT32 );
+      if( std::is_same< D, llint >::value )
+        return( FeatureType::INT64 );
+      if( std::is_same< D, float >::value )
+        return( FeatureType::FLOAT32 );
+      if( std::is_same< D, double >::value )
+        return( FeatureType::FLOAT64 );
+      std::string msg( BIAL_ERROR( "Unsupported feature value type." ) );
+      throw( std::logic_error( msg ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param type: Type code.
+     * @return Size in bytes of the values of the given type.
+     * @brief Size of the feature values stored in binary feature files.
+     * @warning none.
+     */
+    size_t TypeSize( FeatureType type ) {
+      if( ( type == FeatureType::INT32 ) || ( type == FeatureType::FLOAT32 ) )
+        return( 4 );
+      return( 8 );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param hdr: Header of a binary feature file.
+     * @return Position of the indexes or of the labels in the file.
+     * @brief Positions of the blocks of a binary feature file.
+     * @warning none.
+     */
+    size_t IndexOffset( const Header &hdr ) {
+      size_t offset = HEADER_SIZE + hdr.elements * hdr.features * TypeSize( hdr.type );
+      return( ( offset + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) * sizeof( uint64_t ) );
+    }
+
+    size_t LabelOffset( const Header &hdr ) {
+      return( IndexOffset( hdr ) + hdr.elements * sizeof( uint64_t ) );
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param src: Stored values, not necessarily aligned.
+     * @param size: Number of values.
+     * @param dst: Returns the converted values.
+     * @return none.
+     * @brief Converts a block of stored values of type S to D.
+     * @warning none.
+     */
+    template< class S, class D >
+    void ConvertBlock( const char *src, size_t size, D *dst ) {
+      for( size_t elm = 0; elm < size; ++elm ) {
+        S value;
+        std::memcpy( &value, src + elm * sizeof( S ), sizeof( S ) );
+        dst[ elm ] = static_cast< D >( value );
+      }
+    }
+
+    template< class D >
+    void ConvertBlock( FeatureType type, const char *src, size_t size, D *dst ) {
+      switch( type ) {
+      case FeatureType::INT32:
+        ConvertBlock< int32_t >( src, size, dst );
+        break;
+      case FeatureType::INT64:
+        ConvertBlock< int64_t >( src, size, dst );
+        break;
+      case FeatureType::FLOAT32:
+        ConvertBlock< float >( src, size, dst );
+        break;
+      case FeatureType::FLOAT64:
+        ConvertBlock< double >( src, size, dst );
+        break;
+      }
+    }
+
+    /**
+     * @date 2026/Oct/18
+     * @param file: Opened file.
+     * @param position: Current position in file. Returns the position after the block.
+     * @param offset: Position of the block.
+     * @param data: Returns the block.
+     * @param bytes: Size of the block.
+     * @return none.
+     * @brief Reads a block of the file with a single read. Compressed files are read up to the block, since they do
+     * not support random access.
+     * @warning none.
+     */
+    void ReadBlock( IFile &file, size_t &position, size_t offset, char *data, size_t bytes ) {
+      if( offset != position ) {
+        if( file.IsGziped( ) )
+          file.ignore( offset - position );
+        else
+          file.seekg( offset );
+      }
+      file.read( data, bytes );
+      position = offset + bytes;
+    }
+
+  }
+
+  FileFeature::Header FileFeature::ReadHeader( const std::string &filename ) {
     try {
       COMMENT( "Opening file.", 1 );
       IFile file;
       file.exceptions( std::fstream::failbit | std::fstream::badbit );
       file.open( filename );
+      char buffer[ HEADER_SIZE ];
+      file.read( buffer, OPF_HEADER_SIZE );
+      Header hdr;
+      if( std::memcmp( buffer, MAGIC, sizeof( MAGIC ) ) != 0 ) {
+        COMMENT( "Legacy OPF file. Reading nodes, classes and feats.", 1 );
+        int32_t values[ 3 ];
+        std::memcpy( values, buffer, OPF_HEADER_SIZE );
+        if( ( values[ 0 ] < 0 ) || ( values[ 1 ] < 0 ) || ( values[ 2 ] < 0 ) ) {
+          std::string msg( BIAL_ERROR( "Invalid feature file header. File: " + filename ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        hdr.version = 0;
+        hdr.type = FeatureType::FLOAT32;
+        hdr.elements = values[ 0 ];
+        hdr.labels = values[ 1 ];
+        hdr.features = values[ 2 ];
+      }
+      else {
+        COMMENT( "Binary feature file.", 1 );
+        file.read( buffer + OPF_HEADER_SIZE, HEADER_SIZE - OPF_HEADER_SIZE );
+        uint32_t byte_order;
+        uint32_t type;
+        uint64_t sizes[ 3 ];
+        std::memcpy( &hdr.version, buffer + 8, sizeof( uint32_t ) );
+        std::memcpy( &byte_order, buffer + 12, sizeof( uint32_t ) );
+        std::memcpy( &type, buffer + 16, sizeof( uint32_t ) );
+        std::memcpy( sizes, buffer + 24, sizeof( sizes ) );
+        if( byte_order != ORDER_MARK ) {
+          std::string msg( BIAL_ERROR( "Feature file written with a different byte order. File: " + filename ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        if( ( hdr.version == 0 ) || ( hdr.version > VERSION ) ) {
+          std::string msg( BIAL_ERROR( "Unsupported feature file version " + std::to_string( hdr.version ) +
+                                       ". File: " + filename ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        if( ( type < static_cast< uint32_t >( FeatureType::INT32 ) ) ||
+            ( type > static_cast< uint32_t >( FeatureType::FLOAT64 ) ) ) {
+          std::string msg( BIAL_ERROR( "Invalid feature value type. File: " + filename ) );
+          throw( std::ios_base::failure( msg ) );
+        }
+        hdr.type = static_cast< FeatureType >( type );
+        hdr.elements = sizes[ 0 ];
+        hdr.features = sizes[ 1 ];
+        hdr.labels = sizes[ 2 ];
+      }
+      COMMENT( "elements: " << hdr.elements << ", labels: " << hdr.labels << ", features: " << hdr.features, 2 );
+      file.close( );
+      return( hdr );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error opening/reading/closing file." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
 
-      COMMENT( "Reading header information: nodes, classes and feats.", 1 );
-      int nnodes;
-      file.read( reinterpret_cast< char* >( &nnodes ), sizeof( int ) );
-      int nlabels;
-      file.read( reinterpret_cast< char* >( &nlabels ), sizeof( int ) );
-      int nfeats;
-      file.read( reinterpret_cast< char* >( &nfeats ), sizeof( int ) );
-      COMMENT( "nnodes: " << nnodes << ", nlabels: " << nlabels << ", nfeats: " << nfeats, 2 );
-      Feature< D > feat( nnodes, nfeats );
-      feat.Labels( nlabels );
+  template< class D >
+  Feature< D > FileFeature::Read( const std::string &filename ) {
+    try {
+      return( FileFeature::Read< D >( filename, 0, FileFeature::ReadHeader( filename ).elements ) );
+    }
+    catch( std::ios_base::failure &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error opening/reading/closing file." ) );
+      throw( std::ios_base::failure( msg ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
       
-      COMMENT( "Reading the features.", 1 );
-      int index;
-      int label;
-      float ffeat;
-      for( size_t elm = 0; elm < static_cast< size_t >( nnodes ); ++elm ) {
-        file.read( reinterpret_cast< char* >( &index ), sizeof( int ) );
-        feat.Index( elm ) = elm; /* Ignoring index. It must be sequential starting at 0. */
-        file.read( reinterpret_cast< char* >( &label ), sizeof( int ) );
-        feat.Label( elm ) = label;
-        for( size_t ftr = 0; ftr < static_cast< size_t >( nfeats ); ++ftr ) {
-          file.read( reinterpret_cast< char* >( &ffeat ), sizeof( float ) );
-          feat( elm, ftr ) = static_cast< D >( ffeat );
+  template< class D >
+  Feature< D > FileFeature::Read( const std::string &filename, size_t first, size_t elements ) {
+    try {
+      Header hdr( FileFeature::ReadHeader( filename ) );
+      if( first + elements > hdr.elements ) {
+        std::string msg( BIAL_ERROR( "Range of elements exceeds the " + std::to_string( hdr.elements ) +
+                                     " elements of file " + filename ) );
+        throw( std::out_of_range( msg ) );
+      }
+      size_t features = hdr.features;
+      Matrix< D > feature;
+      Vector< size_t > index( elements );
+      Vector< int > label( elements );
+      if( hdr.version == 0 ) {
+        COMMENT( "Legacy OPF file. Reading the records of the range at once.", 1 );
+        size_t record = 2 * sizeof( int32_t ) + features * sizeof( float );
+        Vector< char > buffer( elements * record );
+        IFile file;
+        file.exceptions( std::fstream::failbit | std::fstream::badbit );
+        file.open( filename );
+        size_t position = 0;
+        ReadBlock( file, position, OPF_HEADER_SIZE + first * record, buffer.data( ), buffer.size( ) );
+        file.close( );
+        feature = Matrix< D >( features, elements );
+        for( size_t elm = 0; elm < elements; ++elm ) {
+          const char *src = buffer.data( ) + elm * record;
+          index[ elm ] = first + elm; /* Ignoring index. It must be sequential starting at 0. */
+          std::memcpy( &label[ elm ], src + sizeof( int32_t ), sizeof( int32_t ) );
+          ConvertBlock< float >( src + 2 * sizeof( int32_t ), features, feature.Data( ) + elm * features );
         }
       }
-      COMMENT( "Closing and returning.", 1 );
-      file.close( );
-      return( feat );
+      else {
+        size_t value_size = TypeSize( hdr.type );
+        size_t feature_offset = HEADER_SIZE + first * features * value_size;
+        size_t index_offset = IndexOffset( hdr ) + first * sizeof( uint64_t );
+        size_t label_offset = LabelOffset( hdr ) + first * sizeof( int32_t );
+        bool same_type = ( hdr.type == TypeOf< D >( ) );
+        if( ( File::ToLowerExtension( filename ).rfind( ".gz" ) == std::string::npos ) && MappedFile::Supported( ) ) {
+          COMMENT( "Uncompressed file. Mapping it into memory.", 1 );
+          std::shared_ptr< MappedFile > mapping( std::make_shared< MappedFile >( filename ) );
+          if( mapping->size( ) < LabelOffset( hdr ) + hdr.elements * sizeof( int32_t ) ) {
+            std::string msg( BIAL_ERROR( "Feature file is shorter than its data. File: " + filename ) );
+            throw( std::ios_base::failure( msg ) );
+          }
+          char *src = mapping->data( ) + feature_offset;
+          if( same_type && ( elements > 0 ) && ( reinterpret_cast< uintptr_t >( src ) % alignof( D ) == 0 ) ) {
+            COMMENT( "Same value type in file and Feature. Feature adopts the mapped data.", 1 );
+            feature = Matrix< D >( reinterpret_cast< D* >( src ), Vector< size_t >( { features, elements } ),
+                                   mapping );
+          }
+          else {
+            COMMENT( "Converting mapped data to Feature type.", 1 );
+            feature = Matrix< D >( features, elements );
+            ConvertBlock( hdr.type, src, elements * features, feature.Data( ) );
+          }
+          ConvertBlock< uint64_t >( mapping->data( ) + index_offset, elements, index.data( ) );
+          ConvertBlock< int32_t >( mapping->data( ) + label_offset, elements, label.data( ) );
+        }
+        else {
+          COMMENT( "Compressed file, or mapping not supported. Reading each block at once.", 1 );
+          IFile file;
+          file.exceptions( std::fstream::failbit | std::fstream::badbit );
+          file.open( filename );
+          size_t position = 0;
+          feature = Matrix< D >( features, elements );
+          if( same_type ) {
+            ReadBlock( file, position, feature_offset, reinterpret_cast< char* >( feature.Data( ) ),
+                       elements * features * value_size );
+          }
+          else {
+            Vector< char > buffer( elements * features * value_size );
+            ReadBlock( file, position, feature_offset, buffer.data( ), buffer.size( ) );
+            ConvertBlock( hdr.type, buffer.data( ), elements * features, feature.Data( ) );
+          }
+          Vector< char > buffer( elements * sizeof( uint64_t ) );
+          ReadBlock( file, position, index_offset, buffer.data( ), buffer.size( ) );
+          ConvertBlock< uint64_t >( buffer.data( ), elements, index.data( ) );
+          ReadBlock( file, position, label_offset, buffer.data( ), elements * sizeof( int32_t ) );
+          ConvertBlock< int32_t >( buffer.data( ), elements, label.data( ) );
+          file.close( );
+        }
+      }
+      COMMENT( "Returning.", 1 );
+      return( Feature< D >( std::move( feature ), std::move( index ), std::move( label ), hdr.labels ) );
     }
     catch( std::ios_base::failure &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Error opening/reading/closing file." ) );
@@ -90,24 +364,60 @@ namespace Bial {
       file.exceptions( std::fstream::failbit | std::fstream::badbit );
       file.open( filename );
 
-      size_t nnodes = feat.Elements( );
-      size_t nlabels = feat.Labels( );
-      size_t feats = feat.Features( );
-      COMMENT( "Writing header information: nodes, classes and feats.", 1 );
-      file.write( reinterpret_cast< char* >( &nnodes ), sizeof( int ) );
-      file.write( reinterpret_cast< char* >( &nlabels ), sizeof( int ) );
-      file.write( reinterpret_cast< char* >( &feats ), sizeof( int ) );
-
-      COMMENT( "Writing the features.", 1 );
-      for( size_t elm = 0; elm < nnodes; ++elm ) {
-        int index = feat.Index( elm );
-        file.write( reinterpret_cast< char* >( &index ), sizeof( int ) );
-        int label = feat.Label( elm );
-        file.write( reinterpret_cast< char* >( &label ), sizeof( int ) );
-        for( size_t ftr = 0; ftr < feats; ++ftr ) {
-          float feature = feat( elm, ftr );
-          file.write( reinterpret_cast< char* >( &feature ), sizeof( float ) );
+      size_t elements = feat.Elements( );
+      size_t features = feat.Features( );
+      if( File::ToLowerExtension( filename ).find( ".bft" ) == std::string::npos ) {
+        COMMENT( "Legacy OPF file. Writing header information: nodes, classes and feats, and the records at once.", 1 );
+        size_t record = 2 * sizeof( int32_t ) + features * sizeof( float );
+        Vector< char > buffer( OPF_HEADER_SIZE + elements * record );
+        int32_t values[ 3 ] = {
+          static_cast< int32_t >( elements ), static_cast< int32_t >( feat.Labels( ) ),
+          static_cast< int32_t >( features )
+        };
+        std::memcpy( buffer.data( ), values, OPF_HEADER_SIZE );
+        for( size_t elm = 0; elm < elements; ++elm ) {
+          char *dst = buffer.data( ) + OPF_HEADER_SIZE + elm * record;
+          int32_t index = static_cast< int32_t >( feat.Index( elm ) );
+          int32_t label = feat.Label( elm );
+          std::memcpy( dst, &index, sizeof( int32_t ) );
+          std::memcpy( dst + sizeof( int32_t ), &label, sizeof( int32_t ) );
+          dst += 2 * sizeof( int32_t );
+          for( size_t ftr = 0; ftr < features; ++ftr ) {
+            float value = static_cast< float >( feat( elm, ftr ) );
+            std::memcpy( dst + ftr * sizeof( float ), &value, sizeof( float ) );
+          }
         }
+        file.write( buffer.data( ), buffer.size( ) );
+      }
+      else {
+        COMMENT( "Binary feature file. Writing header, features, indexes and labels.", 1 );
+        Header hdr;
+        hdr.version = VERSION;
+        hdr.type = TypeOf< D >( );
+        hdr.elements = elements;
+        hdr.features = features;
+        hdr.labels = feat.Labels( );
+        char header[ HEADER_SIZE ] = { };
+        uint32_t type = static_cast< uint32_t >( hdr.type );
+        uint64_t sizes[ 3 ] = { elements, features, hdr.labels };
+        std::memcpy( header, MAGIC, sizeof( MAGIC ) );
+        std::memcpy( header + 8, &hdr.version, sizeof( uint32_t ) );
+        std::memcpy( header + 12, &ORDER_MARK, sizeof( uint32_t ) );
+        std::memcpy( header + 16, &type, sizeof( uint32_t ) );
+        std::memcpy( header + 24, sizes, sizeof( sizes ) );
+        file.write( header, HEADER_SIZE );
+        size_t bytes = elements * features * sizeof( D );
+        file.write( reinterpret_cast< const char* >( feat.FeatureVector( ).Data( ) ), bytes );
+        const char padding[ sizeof( uint64_t ) ] = { };
+        file.write( padding, IndexOffset( hdr ) - HEADER_SIZE - bytes );
+        Vector< uint64_t > index( elements );
+        for( size_t elm = 0; elm < elements; ++elm )
+          index[ elm ] = feat.Index( elm );
+        file.write( reinterpret_cast< const char* >( index.data( ) ), elements * sizeof( uint64_t ) );
+        Vector< int32_t > label( elements );
+        for( size_t elm = 0; elm < elements; ++elm )
+          label[ elm ] = feat.Label( elm );
+        file.write( reinterpret_cast< const char* >( label.data( ) ), elements * sizeof( int32_t ) );
       }
       COMMENT( "Closing and returning.", 1 );
       file.close( );
@@ -141,6 +451,11 @@ namespace Bial {
   template Feature< float > FileFeature::Read( const std::string &filename );
   template Feature< double > FileFeature::Read( const std::string &filename );
 
+  template Feature< int > FileFeature::Read( const std::string &filename, size_t first, size_t elements );
+  template Feature< llint > FileFeature::Read( const std::string &filename, size_t first, size_t elements );
+  template Feature< float > FileFeature::Read( const std::string &filename, size_t first, size_t elements );
+  template Feature< double > FileFeature::Read( const std::string &filename, size_t first, size_t elements );
+
   template void FileFeature::Write( const Feature< int > &feat, const std::string &filename );
   template void FileFeature::Write( const Feature< llint > &feat, const std::string &filename );
   template void FileFeature::Write( const Feature< float > &feat, const std::string &filename );
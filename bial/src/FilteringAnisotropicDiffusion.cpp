@@ -86,16 +86,10 @@ namespace Bial {
       for( size_t itr = 0; itr < iterations; ++itr ) {
         COMMENT( "Computing diffusion filter.", 2 );
         try {
-          size_t total_threads = 12;
-          Vector< std::thread > threads;
-          for( size_t thd = 0; thd < total_threads; ++thd ) {
-            threads.push_back( std::thread( &AnisotropicDiffusionThread< D >, std::ref( img ), std::ref( res ),
-                                            integration_constant, diff_func, kappa, std::ref( adj ), thd,
-                                            total_threads ) );
-          }
-          for( size_t thd = 0; thd < total_threads; ++thd ) {
-            threads( thd ).join( );
-          }
+          ThreadPool &pool = ThreadPool::Global( );
+          pool.Run( pool.Tasks( img.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+            AnisotropicDiffusionThread( img, res, integration_constant, diff_func, kappa, adj, tsk, tasks );
+          } );
         }
         catch( std::exception &e ) {
           BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
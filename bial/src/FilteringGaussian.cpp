@@ -18,12 +18,11 @@
 
 #if defined ( BIAL_EXPLICIT_FilteringGaussian ) || ( BIAL_IMPLICIT_BIN )
 
-#include "Correlation.hpp"
 #ifdef BIAL_DEBUG
 #include "FileImage.hpp"
 #endif
 #include "Image.hpp"
-#include "KernelGaussian.hpp"
+#include "Vector.hpp"
 
 namespace Bial {
 
@@ -38,10 +37,170 @@ namespace Bial {
         std::string msg( BIAL_ERROR( "Standard deviation must be greater than 0.0. Given: " + std::to_string( std_dev ) ) );
         throw( std::logic_error( msg ) );
       }
-      COMMENT( "Kernel generation.", 1 );
-      Kernel krn( KernelType::Gaussian( img.Dims( ), radius, std_dev ) );
-      COMMENT( "Running correlation.", 1 );
-      return( Correlation( img, krn ) );
+      COMMENT( "1D kernel generation. Amplitude of each dimension is the N-D amplitude root.", 1 );
+      int discrete_radius = static_cast< int >( radius );
+      double amplitude = 1.0 / ( std::sqrt( 2 * M_PI ) * std_dev );
+      Vector< double > weights( 2 * discrete_radius + 1, 0.0 );
+      for( int dlt = -discrete_radius; dlt <= discrete_radius; ++dlt )
+        weights[ dlt + discrete_radius ] = amplitude * std::exp( -dlt * dlt / ( 2.0 * std_dev * std_dev ) );
+      COMMENT( "Running one pass per dimension.", 1 );
+      Vector< size_t > dim_size( img.Dim( ) );
+      Vector< double > data( img.size( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        data[ pxl ] = static_cast< double >( img[ pxl ] );
+      for( size_t dim = 0; dim < img.Dims( ); ++dim )
+        GaussianPass( data, dim_size, dim, weights );
+      Image< D > res( img.Dim( ), img.PixelSize( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        res[ pxl ] = static_cast< D >( data[ pxl ] );
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > Filtering::RecursiveGaussian( const Image< D > &img, float std_dev ) {
+    try {
+      if( std_dev < 0.5 ) {
+        std::string msg( BIAL_ERROR( "Standard deviation must be at least 0.5. Given: " +
+                                     std::to_string( std_dev ) ) );
+        throw( std::logic_error( msg ) );
+      }
+      Vector< size_t > dim_size( img.Dim( ) );
+      Vector< double > data( img.size( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        data[ pxl ] = static_cast< double >( img[ pxl ] );
+      for( size_t dim = 0; dim < img.Dims( ); ++dim )
+        RecursiveGaussianPass( data, dim_size, dim, std_dev );
+      Image< D > res( img.Dim( ), img.PixelSize( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        res[ pxl ] = static_cast< D >( data[ pxl ] );
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void Filtering::GaussianPass( Vector< double > &data, const Vector< size_t > &dim_size, size_t dim,
+                                const Vector< double > &weights ) {
+    try {
+      size_t size = dim_size[ dim ];
+      size_t stride = 1;
+      for( size_t dms = 0; dms < dim; ++dms )
+        stride *= dim_size[ dms ];
+      size_t lines = data.size( ) / size;
+      int radius = static_cast< int >( weights.size( ) / 2 );
+      COMMENT( "Filtering " << lines << " lines of dimension " << dim << ".", 1 );
+      ThreadPool &pool = ThreadPool::Global( );
+      pool.Run( pool.Tasks( lines ), [ & ]( size_t tsk, size_t tasks ) {
+        Vector< double > line( size );
+        size_t min_line = tsk * lines / tasks;
+        size_t max_line = ( tsk + 1 ) * lines / tasks;
+        for( size_t lin = min_line; lin < max_line; ++lin ) {
+          size_t first = ( lin / stride ) * stride * size + lin % stride;
+          for( size_t elm = 0; elm < size; ++elm )
+            line[ elm ] = data[ first + elm * stride ];
+          for( size_t elm = 0; elm < size; ++elm ) {
+            int min_dlt = std::max( -radius, -static_cast< int >( elm ) );
+            int max_dlt = std::min( radius, static_cast< int >( size - 1 - elm ) );
+            double sum = 0.0;
+            for( int dlt = min_dlt; dlt <= max_dlt; ++dlt )
+              sum += line[ elm + dlt ] * weights[ dlt + radius ];
+            data[ first + elm * stride ] = sum;
+          }
+        }
+      } );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void Filtering::RecursiveGaussianPass( Vector< double > &data, const Vector< size_t > &dim_size, size_t dim,
+                                         float std_dev ) {
+    try {
+      COMMENT( "Young and van Vliet coefficients.", 1 );
+      double q;
+      if( std_dev >= 2.5 )
+        q = 0.98711 * std_dev - 0.96330;
+      else
+        q = 3.97156 - 4.14554 * std::sqrt( 1.0 - 0.26891 * std_dev );
+      double q2 = q * q;
+      double q3 = q2 * q;
+      double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+      double b1 = ( 2.44413 * q + 2.85619 * q2 + 1.26661 * q3 ) / b0;
+      double b2 = -( 1.4281 * q2 + 1.26661 * q3 ) / b0;
+      double b3 = 0.422205 * q3 / b0;
+      double b = 1.0 - ( b1 + b2 + b3 );
+      size_t size = dim_size[ dim ];
+      size_t stride = 1;
+      for( size_t dms = 0; dms < dim; ++dms )
+        stride *= dim_size[ dms ];
+      size_t lines = data.size( ) / size;
+      COMMENT( "Filtering " << lines << " lines of dimension " << dim << ".", 1 );
+      ThreadPool &pool = ThreadPool::Global( );
+      pool.Run( pool.Tasks( lines ), [ & ]( size_t tsk, size_t tasks ) {
+        Vector< double > line( size + 6 );
+        size_t min_line = tsk * lines / tasks;
+        size_t max_line = ( tsk + 1 ) * lines / tasks;
+        for( size_t lin = min_line; lin < max_line; ++lin ) {
+          size_t first = ( lin / stride ) * stride * size + lin % stride;
+          COMMENT( "Three border elements at each side hold the steady state of constant extension.", 4 );
+          double border = data[ first ];
+          line[ 0 ] = line[ 1 ] = line[ 2 ] = border;
+          for( size_t elm = 0; elm < size; ++elm )
+            line[ elm + 3 ] = b * data[ first + elm * stride ] + b1 * line[ elm + 2 ] + b2 * line[ elm + 1 ] +
+              b3 * line[ elm ];
+          border = line[ size + 2 ];
+          line[ size + 3 ] = line[ size + 4 ] = line[ size + 5 ] = border;
+          for( size_t elm = size + 2; elm > 2; --elm )
+            line[ elm ] = b * line[ elm ] + b1 * line[ elm + 1 ] + b2 * line[ elm + 2 ] + b3 * line[ elm + 3 ];
+          for( size_t elm = 0; elm < size; ++elm )
+            data[ first + elm * stride ] = line[ elm + 3 ];
+        }
+      } );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -68,6 +227,11 @@ namespace Bial {
   template Image< float > Filtering::Gaussian( const Image< float > &img, float radius, float std_dev );
   template Image< double > Filtering::Gaussian( const Image< double > &img, float radius, float std_dev );
 
+  template Image< int > Filtering::RecursiveGaussian( const Image< int > &img, float std_dev );
+  template Image< llint > Filtering::RecursiveGaussian( const Image< llint > &img, float std_dev );
+  template Image< float > Filtering::RecursiveGaussian( const Image< float > &img, float std_dev );
+  template Image< double > Filtering::RecursiveGaussian( const Image< double > &img, float std_dev );
+
 #endif
 
 }
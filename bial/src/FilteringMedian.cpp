@@ -19,11 +19,11 @@
 #if defined ( BIAL_EXPLICIT_FilteringMedian ) || ( BIAL_IMPLICIT_BIN )
 
 #include "AdjacencyRound.hpp"
-#include "AdjacencyIterator.hpp"
 #ifdef BIAL_DEBUG
 #include "FileImage.hpp"
 #endif
 #include "Image.hpp"
+#include "RankWindow.hpp"
 
 namespace Bial {
 
@@ -32,19 +32,17 @@ namespace Bial {
     try {
       Image< D > res( img );
       Adjacency adj( AdjacencyType::HyperSpheric( radius, img.Dims( ) ) );
-
+      D minimum = img.Minimum( );
+      D maximum = img.Maximum( );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads.push_back( std::thread( &Filtering::MedianThreads< D >, std::ref( img ), std::ref( adj ),
-                                          std::ref( res ), thd, total_threads ) );
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads[ thd ].join( );
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( img.size( 1 ) * img.size( 2 ) ), [ & ]( size_t tsk, size_t tasks ) {
+          Filtering::MedianThreads( img, adj, res, minimum, maximum, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
-        Filtering::MedianThreads( img, adj, res, 0, 1 );
+        Filtering::MedianThreads( img, adj, res, minimum, maximum, 0, 1 );
       }
       return( res );
     }
@@ -67,27 +65,26 @@ namespace Bial {
   }
 
   template< class D >
-  void Filtering::MedianThreads( const Image< D > &img, const Adjacency &adj, Image< D > &res, size_t thread,
-                                 size_t total_threads ) {
+  void Filtering::MedianThreads( const Image< D > &img, const Adjacency &adj, Image< D > &res, D minimum,
+                                 D maximum, size_t thread, size_t total_threads ) {
     try {
-      COMMENT( "Dealing with thread limits.", 2 );
-      size_t min_index = thread * img.Size( ) / total_threads;
-      size_t max_index = ( thread + 1 ) * img.Size( ) / total_threads;
-      AdjacencyIterator adj_itr( img, adj );
-      size_t adj_size = adj.size( );
-      size_t adj_pxl;
-      COMMENT( "Computing median filter.", 2 );
-      for( size_t pxl = min_index; pxl < max_index; ++pxl ) {
-        Vector< float > queue( adj_size );
-        size_t idx = 0;
-        for( size_t adj_idx = 0; adj_idx < adj_size; ++adj_idx ) {
-          if( adj_itr.AdjIdx( pxl, adj_idx, adj_pxl ) ) {
-            queue[ idx ] = img[ adj_pxl ];
-            ++idx;
-          }
+      COMMENT( "Dealing with thread limits. Threads get whole rows.", 2 );
+      size_t x_size = img.size( 0 );
+      size_t y_size = img.size( 1 );
+      size_t rows = y_size * img.size( 2 );
+      size_t min_row = thread * rows / total_threads;
+      size_t max_row = ( thread + 1 ) * rows / total_threads;
+      COMMENT( "Computing median filter with a window sliding along rows.", 2 );
+      RankWindow< D > window( img, adj, minimum, maximum );
+      RankSet< D > &values = window.Values( );
+      for( size_t row = min_row; row < max_row; ++row ) {
+        window.Row( row % y_size, row / y_size );
+        size_t pxl = row * x_size;
+        for( size_t x = 0; x < x_size; ++x, ++pxl ) {
+          if( x != 0 )
+            window.Next( );
+          res[ pxl ] = values.Rank( ( values.size( ) - 1 ) / 2 );
         }
-        sort( queue.begin( ), queue.begin( ) + idx );
-        res[ pxl ] = queue[ ( idx - 1 ) / 2 ];
       }
     }
     catch( std::bad_alloc &e ) {
@@ -112,16 +109,16 @@ namespace Bial {
 
   template Image< int > Filtering::Median( const Image< int > &img, float radius );
   template void Filtering::MedianThreads( const Image< int > &img, const Adjacency &adj, Image< int > &res,
-                                          size_t thread, size_t total_threads );
+                                          int minimum, int maximum, size_t thread, size_t total_threads );
   template Image< llint > Filtering::Median( const Image< llint > &img, float radius );
   template void Filtering::MedianThreads( const Image< llint > &img, const Adjacency &adj, Image< llint > &res,
-                                          size_t thread, size_t total_threads );
+                                          llint minimum, llint maximum, size_t thread, size_t total_threads );
   template Image< float > Filtering::Median( const Image< float > &img, float radius );
   template void Filtering::MedianThreads( const Image< float > &img, const Adjacency &adj, Image< float > &res,
-                                          size_t thread, size_t total_threads );
+                                          float minimum, float maximum, size_t thread, size_t total_threads );
   template Image< double > Filtering::Median( const Image< double > &img, float radius );
   template void Filtering::MedianThreads( const Image< double > &img, const Adjacency &adj, Image< double > &res,
-                                          size_t thread, size_t total_threads );
+                                          double minimum, double maximum, size_t thread, size_t total_threads );
 
 #endif
 
@@ -4,7 +4,7 @@
 
 /**
  * @date 2017/Mar/28
- * @brief Image class declaration. Handles 2D and 3D images.
+ * @brief Fourier Transform functions. Handles 2D and 3D images.
  */
 
 #ifndef BIALFOURIER_C
@@ -18,71 +18,216 @@
 
 #if defined ( BIAL_EXPLICIT_Fourier ) || ( BIAL_IMPLICIT_BIN )
 
+#include "FourierPlan.hpp"
 #include "Image.hpp"
 
 namespace Bial {
 
+  /** @brief Value of a real pixel. Integer pixels are rounded, since transforms are not exact. */
+  template< class D >
+  inline D FourierValue( double val ) {
+    return( std::is_integral< D >::value ? static_cast< D >( std::round( val ) ) : static_cast< D >( val ) );
+  }
+
   Image< bial_complex > FFT( const Image< bial_complex > &img, bool forward_transform ) {
     try {
-      size_t img_dims = img.Dims( );
       size_t x_size = img.size( 0 );
       size_t y_size = img.size( 1 );
       size_t z_size = img.size( 2 );
-      IF_DEBUG( ( x_size < 1 ) || ( y_size < 1 ) || ( ( img_dims == 3 ) && ( z_size < 1 ) ) ) {
+      IF_DEBUG( ( x_size < 1 ) || ( y_size < 1 ) || ( ( img.Dims( ) == 3 ) && ( z_size < 1 ) ) ) {
         std::string msg( BIAL_ERROR( "Image must have more than one pixel per dimension. " ) );
         throw( std::runtime_error( msg ) );
       }
-      Image< bial_complex > padded_img;
-      if( ( forward_transform ) && ( ( std::pow( static_cast< int >( std::sqrt( x_size ) ), 2 ) != x_size ) || 
-                                     ( std::pow( static_cast< int >( std::sqrt( y_size ) ), 2 ) != y_size ) ||
-                                     ( ( std::pow( static_cast< int >( std::sqrt( z_size ) ), 2 ) != z_size )
-                                       && ( img_dims == 3 ) ) ) ) {
-        COMMENT( "Zero padding image, since its dimensions are not powers of 2.", 0 );
-        padded_img = Image< bial_complex >( ZeroPad( img ) );
+      Image< bial_complex > res( img );
+      Vector< size_t > dim_size( 3 );
+      dim_size[ 0 ] = x_size;
+      dim_size[ 1 ] = y_size;
+      dim_size[ 2 ] = z_size;
+      double scale = forward_transform ? 1.0 : 1.0 / static_cast< double >( res.size( ) );
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        COMMENT( "Applaying FFT to the image dimension " << dms << ". Dimensions: " << dim_size, 0 );
+        FFTDimension( res.Data( ), dim_size, dms, forward_transform, scale );
+        if( dim_size[ dms ] > 1 )
+          scale = 1.0;
       }
-      else {
-        COMMENT( "Keeping original image. No need to paddle zeros.", 0 );
-        padded_img = img;
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void FFT( Vector< bial_complex > &aux, bool forward_transform ) {
+    try {
+      COMMENT( "Getting the plan of the number of points.", 0 );
+      size_t vct_size = aux.size( );
+      std::shared_ptr< const FourierPlan > plan( FourierPlan::Plan( vct_size ) );
+      Vector< bial_complex > work( plan->WorkSize( ) );
+      COMMENT( "Computing the FFT.", 0 );
+      plan->Transform( aux.data( ), work.data( ), forward_transform );
+      COMMENT( "Applying scaling factor for the inverse transform.", 0 );
+      if( !forward_transform ) {
+        for( size_t elm = 0; elm < vct_size; ++elm )
+          aux[ elm ] /= static_cast< double >( vct_size );
       }
-      x_size = padded_img.size( 0 );
-      y_size = padded_img.size( 1 );
-      z_size = padded_img.size( 2 );
-      COMMENT( "Applaying FFT to the image rows. Dimensions: " << x_size << ", " << y_size << ", " << z_size, 0 );
-      Vector< bial_complex > aux( x_size );
-      for( size_t z = 0; z < z_size; ++z ) {
-        for( size_t y = 0; y < y_size; ++y ) {
-          for( size_t x = 0; x < x_size; ++x )
-            aux[ x ] = padded_img( x, y, z );
-          FFT( aux, forward_transform );
-          for( size_t x = 0; x < x_size; ++x )
-            padded_img( x, y, z ) = aux[ x ];
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void FFTDimension( bial_complex *data, const Vector< size_t > &dim_size, size_t dms, bool forward_transform,
+                     double scale ) {
+    try {
+      const size_t block = 16;
+      size_t length = dim_size[ dms ];
+      if( ( length == 1 ) && ( scale == 1.0 ) )
+        return;
+      size_t stride = 1;
+      for( size_t prv = 0; prv < dms; ++prv )
+        stride *= dim_size[ prv ];
+      size_t outer = dim_size[ 0 ] * dim_size[ 1 ] * dim_size[ 2 ] / ( stride * length );
+      COMMENT( "Lines along dimension 0 are single blocks. Others are split in blocks of adjacent lines.", 0 );
+      size_t width = std::min( block, stride );
+      size_t outer_blocks = ( stride + width - 1 ) / width;
+      size_t blocks = outer * outer_blocks;
+      std::shared_ptr< const FourierPlan > plan( FourierPlan::Plan( length ) );
+      auto transform = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< bial_complex > work( plan->WorkSize( ) );
+        Vector< bial_complex > line( stride == 1 ? 0 : width * length );
+        for( size_t blk = tsk * blocks / tasks; blk < ( tsk + 1 ) * blocks / tasks; ++blk ) {
+          size_t first = ( blk % outer_blocks ) * width;
+          size_t lines = std::min( width, stride - first );
+          bial_complex *base = data + ( blk / outer_blocks ) * stride * length + first;
+          if( stride == 1 ) {
+            plan->Transform( base, work.data( ), forward_transform );
+            if( scale != 1.0 ) {
+              for( size_t elm = 0; elm < length; ++elm )
+                base[ elm ] *= scale;
+            }
+            continue;
+          }
+          for( size_t elm = 0; elm < length; ++elm ) {
+            const bial_complex *src = base + elm * stride;
+            for( size_t lin = 0; lin < lines; ++lin )
+              line[ lin * length + elm ] = src[ lin ];
+          }
+          for( size_t lin = 0; lin < lines; ++lin )
+            plan->Transform( line.data( ) + lin * length, work.data( ), forward_transform );
+          for( size_t elm = 0; elm < length; ++elm ) {
+            bial_complex *tgt = base + elm * stride;
+            for( size_t lin = 0; lin < lines; ++lin )
+              tgt[ lin ] = line[ lin * length + elm ] * scale;
+          }
         }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( blocks ), transform );
       }
-      COMMENT( "Applaying FFT to the image columns.", 0 );
-      aux = Vector< bial_complex >( y_size );
-      for( size_t z = 0; z < z_size; ++z ) {
-        for( size_t x = 0; x < x_size; ++x ) {
-          for( size_t y = 0; y < y_size; ++y )
-            aux[ y ] = padded_img( x, y, z );
-          FFT( aux, forward_transform );
-          for( size_t y = 0; y < y_size; ++y )
-            padded_img( x, y, z ) = aux[ y ];
-        }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        transform( 0, 1 );
       }
-      if( img_dims == 3 ) {
-        COMMENT( "Applaying FFT to the image depth.", 0 );
-        aux = Vector< bial_complex >( z_size );
-        for( size_t x = 0; x < x_size; ++x ) {
-          for( size_t y = 0; y < y_size; ++y ) {
-            for( size_t z = 0; z < z_size; ++z )
-              aux[ z ] = padded_img( x, y, z );
-            FFT( aux, forward_transform );
-            for( size_t z = 0; z < z_size; ++z )
-              padded_img( x, y, z ) = aux[ z ];
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< bial_complex > RealFFT( const Image< D > &img ) {
+    try {
+      size_t x_size = img.size( 0 );
+      size_t half = x_size / 2 + 1;
+      size_t rows = img.size( ) / x_size;
+      Vector< size_t > dim_size( 3 );
+      dim_size[ 0 ] = half;
+      dim_size[ 1 ] = img.size( 1 );
+      dim_size[ 2 ] = img.size( 2 );
+      Vector< size_t > res_dim( img.Dim( ) );
+      res_dim[ 0 ] = half;
+      Image< bial_complex > res( res_dim, img.PixelSize( ) );
+      COMMENT( "Transforming pairs of rows as the real and imaginary parts of a single row.", 0 );
+      std::shared_ptr< const FourierPlan > plan( FourierPlan::Plan( x_size ) );
+      size_t pairs = ( rows + 1 ) / 2;
+      const D *src = img.Data( );
+      bial_complex *tgt = res.Data( );
+      auto transform = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< bial_complex > work( plan->WorkSize( ) );
+        Vector< bial_complex > line( x_size );
+        for( size_t par = tsk * pairs / tasks; par < ( tsk + 1 ) * pairs / tasks; ++par ) {
+          size_t row = 2 * par;
+          bool pair = row + 1 < rows;
+          const D *src_0 = src + row * x_size;
+          for( size_t elm = 0; elm < x_size; ++elm ) {
+            line[ elm ] = bial_complex( static_cast< double >( src_0[ elm ] ),
+                                        pair ? static_cast< double >( src_0[ x_size + elm ] ) : 0.0 );
+          }
+          plan->Transform( line.data( ), work.data( ) );
+          bial_complex *tgt_0 = tgt + row * half;
+          for( size_t elm = 0; elm < half; ++elm ) {
+            bial_complex val( line[ elm ] );
+            bial_complex sym( std::conj( line[ ( x_size - elm ) % x_size ] ) );
+            tgt_0[ elm ] = 0.5 * ( val + sym );
+            if( pair ) {
+              bial_complex dif( 0.5 * ( val - sym ) );
+              tgt_0[ half + elm ] = bial_complex( dif.imag( ), -dif.real( ) );
+            }
           }
         }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( pairs ), transform );
       }
-      return( padded_img );
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        transform( 0, 1 );
+      }
+      COMMENT( "Transforming the other dimensions of the half spectrum.", 0 );
+      FFTDimension( tgt, dim_size, 1, true );
+      FFTDimension( tgt, dim_size, 2, true );
+      return( res );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -101,62 +246,70 @@ namespace Bial {
       throw( std::logic_error( msg ) );
     }
   }
-  
-  void FFT( Vector< bial_complex > &aux, bool forward_transform ) {
+
+  template< class D >
+  void InverseRealFFT( const Image< bial_complex > &spectrum, Image< D > &res ) {
     try {
-      COMMENT( "Getting the number of points.", 0 );
-      size_t vct_size = aux.size( );
-      size_t vct_size_power = std::log2( vct_size );
-      COMMENT( "Sort input vector elements such that they increase by counting their indexes considering " << 
-               "the least significant bit as the most significant one, and vice-versa.", 0 );
-      size_t vct_size_2 = vct_size >> 1;
-      size_t chg_elm = 0;
-      for( size_t elm = 0; elm < vct_size - 1; ++elm ) {
-        //std::cout << "elm: " << elm << "\\" << vct_size - 1 << std::endl;
-        if( elm < chg_elm )
-          std::swap( aux[ elm ], aux[ chg_elm ] );
-        size_t vct_factor = vct_size_2;
-        while( vct_factor <= chg_elm ) {
-          chg_elm -= vct_factor;
-          vct_factor >>= 1;
-          //std::cout << "chg_elm: " << chg_elm << ", vct_factor: " << vct_factor << std::endl;
-        }
-        chg_elm += vct_factor;
+      size_t x_size = res.size( 0 );
+      size_t half = x_size / 2 + 1;
+      if( ( spectrum.size( 0 ) != half ) || ( spectrum.size( 1 ) != res.size( 1 ) ) ||
+          ( spectrum.size( 2 ) != res.size( 2 ) ) ) {
+        std::string msg( BIAL_ERROR( "Spectrum does not match the dimensions of the resulting image." ) );
+        throw( std::logic_error( msg ) );
       }
-      COMMENT( "Computing the FFT.", 0 );
-      bial_complex fft_factor_chg( -1.0, 0.0 ); // Changes in FFT factor for every jump in a series.
-      size_t adj_series_jump = 1; // Jump size to the next element to be considered in the series.
-      size_t adj_series_size; // Number of parts that the series have.
-      bial_complex diff_val; // Difference between compared src and tgt elements of a step in a series.
-      for( size_t series = 0; series < vct_size_power; ++series ) {
-        adj_series_size = adj_series_jump;
-        adj_series_jump <<= 1;
-        bial_complex fft_factor( 1.0, 0.0 ); // FFT factor used in a jump of a series.
-        for( size_t step_elm = 0; step_elm < adj_series_size; ++step_elm ) {
-          for( size_t src_elm = step_elm; src_elm < vct_size; src_elm += adj_series_jump ) {
-            size_t tgt_elm = src_elm + adj_series_size;
-            diff_val.real( fft_factor.real( ) * aux[ tgt_elm ].real( ) - fft_factor.imag( ) * aux[ tgt_elm ].imag( ) );
-            diff_val.imag( fft_factor.imag( ) * aux[ tgt_elm ].real( ) + fft_factor.real( ) * aux[ tgt_elm ].imag( ) );
-            aux[ tgt_elm ] = aux[ src_elm ] - diff_val;
-            aux[ src_elm ] += diff_val;
+      size_t rows = res.size( ) / x_size;
+      Vector< size_t > dim_size( 3 );
+      dim_size[ 0 ] = half;
+      dim_size[ 1 ] = res.size( 1 );
+      dim_size[ 2 ] = res.size( 2 );
+      COMMENT( "Inverse transform of the other dimensions of the half spectrum, scaled once.", 0 );
+      Vector< bial_complex > aux( spectrum.Data( ), spectrum.Data( ) + spectrum.size( ) );
+      double scale = 1.0 / static_cast< double >( res.size( ) );
+      FFTDimension( aux.data( ), dim_size, 2, false, scale );
+      FFTDimension( aux.data( ), dim_size, 1, false );
+      COMMENT( "Transforming pairs of rows, rebuilding the full rows from the complex conjugate symmetry.", 0 );
+      std::shared_ptr< const FourierPlan > plan( FourierPlan::Plan( x_size ) );
+      size_t pairs = ( rows + 1 ) / 2;
+      D *tgt = res.Data( );
+      auto transform = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< bial_complex > work( plan->WorkSize( ) );
+        Vector< bial_complex > line( x_size );
+        for( size_t par = tsk * pairs / tasks; par < ( tsk + 1 ) * pairs / tasks; ++par ) {
+          size_t row = 2 * par;
+          bool pair = row + 1 < rows;
+          const bial_complex *src_0 = aux.data( ) + row * half;
+          const bial_complex *src_1 = pair ? src_0 + half : src_0;
+          for( size_t elm = 0; elm < half; ++elm ) {
+            bial_complex val_1( pair ? src_1[ elm ] : bial_complex( 0.0, 0.0 ) );
+            line[ elm ] = src_0[ elm ] + bial_complex( -val_1.imag( ), val_1.real( ) );
+          }
+          for( size_t elm = half; elm < x_size; ++elm ) {
+            bial_complex val_0( std::conj( src_0[ x_size - elm ] ) );
+            bial_complex val_1( pair ? std::conj( src_1[ x_size - elm ] ) : bial_complex( 0.0, 0.0 ) );
+            line[ elm ] = val_0 + bial_complex( -val_1.imag( ), val_1.real( ) );
+          }
+          plan->Transform( line.data( ), work.data( ), false );
+          D *tgt_0 = tgt + row * x_size;
+          for( size_t elm = 0; elm < x_size; ++elm ) {
+            tgt_0[ elm ] = FourierValue< D >( line[ elm ].real( ) );
+            if( pair )
+              tgt_0[ x_size + elm ] = FourierValue< D >( line[ elm ].imag( ) );
           }
-          double aux =  fft_factor.real( ) * fft_factor_chg.real( ) -
-            fft_factor.imag( ) * fft_factor_chg.imag( );
-          fft_factor.imag( fft_factor.real( ) * fft_factor_chg.imag( ) +
-                           fft_factor.imag( ) * fft_factor_chg.real( ) );
-          fft_factor.real( aux );
         }
-        fft_factor_chg.imag( sqrt( ( 1.0 - fft_factor_chg.real( ) ) / 2.0 ) );
-        if( !forward_transform )
-          fft_factor_chg.imag( -fft_factor_chg.imag( ) );
-        fft_factor_chg.real( sqrt( ( 1.0 + fft_factor_chg.real( ) ) / 2.0 ) );
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( pairs ), transform );
       }
-      COMMENT( "Applying scaling factor for the inverse transform.", 0 );
-      if( !forward_transform ) {
-        for( size_t elm = 0; elm < vct_size; ++elm )
-          aux[ elm ] /= static_cast< double >( vct_size );
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        transform( 0, 1 );
       }
     }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
     catch( std::runtime_error &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
       throw( std::runtime_error( msg ) );
@@ -261,8 +414,54 @@ namespace Bial {
     }
   }
 
+  template< class D >
+  Image< D > FFTShift( const Image< D > &img, bool forward ) {
+    try {
+      Vector< size_t > shift( 3 );
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        size_t size = img.size( dms );
+        shift[ dms ] = forward ? size / 2 : size - size / 2;
+      }
+      Image< D > res( img );
+      for( size_t z = 0; z < img.size( 2 ); ++z ) {
+        size_t tgt_z = ( z + shift[ 2 ] ) % img.size( 2 );
+        for( size_t y = 0; y < img.size( 1 ); ++y ) {
+          size_t tgt_y = ( y + shift[ 1 ] ) % img.size( 1 );
+          for( size_t x = 0; x < img.size( 0 ); ++x )
+            res( ( x + shift[ 0 ] ) % img.size( 0 ), tgt_y, tgt_z ) = img( x, y, z );
+        }
+      }
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
 #ifdef BIAL_EXPLICIT_Fourier
 
+  template Image< bial_complex > RealFFT( const Image< int > &img );
+  template void InverseRealFFT( const Image< bial_complex > &spectrum, Image< int > &res );
+  template Image< bial_complex > RealFFT( const Image< llint > &img );
+  template void InverseRealFFT( const Image< bial_complex > &spectrum, Image< llint > &res );
+  template Image< bial_complex > RealFFT( const Image< float > &img );
+  template void InverseRealFFT( const Image< bial_complex > &spectrum, Image< float > &res );
+  template Image< bial_complex > RealFFT( const Image< double > &img );
+  template void InverseRealFFT( const Image< bial_complex > &spectrum, Image< double > &res );
+
   template Image< int > ZeroPad( const Image< int > &img );
   template void ZeroUnPad( const Image< int > &src_img, Image< int > &tgt_img );
   template Image< llint > ZeroPad( const Image< llint > &img );
@@ -273,6 +472,12 @@ namespace Bial {
   template void ZeroUnPad( const Image< double > &src_img, Image< double > &tgt_img );
   template Image< bial_complex > ZeroPad( const Image< bial_complex > &img );
   template void ZeroUnPad( const Image< bial_complex > &src_img, Image< bial_complex > &tgt_img );
+
+  template Image< int > FFTShift( const Image< int > &img, bool forward );
+  template Image< llint > FFTShift( const Image< llint > &img, bool forward );
+  template Image< float > FFTShift( const Image< float > &img, bool forward );
+  template Image< double > FFTShift( const Image< double > &img, bool forward );
+  template Image< bial_complex > FFTShift( const Image< bial_complex > &img, bool forward );
   
 #endif
 
@@ -0,0 +1,349 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Precomputed one dimensional discrete Fourier transform of any length.
+ */
+
+#ifndef BIALFOURIERPLAN_C
+#define BIALFOURIERPLAN_C
+
+#include "FourierPlan.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_FourierPlan )
+#define BIAL_EXPLICIT_FourierPlan
+#endif
+
+#if defined ( BIAL_EXPLICIT_FourierPlan ) || ( BIAL_IMPLICIT_BIN )
+
+namespace Bial {
+
+  std::map< size_t, std::shared_ptr< const FourierPlan > > FourierPlan::cache;
+  std::mutex FourierPlan::cache_mutex;
+
+  /** @brief Complex product without the checks for infinities of std::complex. */
+  inline bial_complex FourierProduct( const bial_complex &a, const bial_complex &b ) {
+    return( bial_complex( a.real( ) * b.real( ) - a.imag( ) * b.imag( ),
+                          a.real( ) * b.imag( ) + a.imag( ) * b.real( ) ) );
+  }
+
+  /** @brief Product by -i. */
+  inline bial_complex FourierMinusI( const bial_complex &a ) {
+    return( bial_complex( a.imag( ), -a.real( ) ) );
+  }
+
+  FourierPlan::FourierPlan( size_t length ) try : length( length ) {
+    if( length == 0 ) {
+      std::string msg( BIAL_ERROR( "Transform length must be positive." ) );
+      throw( std::logic_error( msg ) );
+    }
+    COMMENT( "Factoring the length. Radix 4 first, then increasing primes.", 2 );
+    std::vector< size_t > factor;
+    size_t remaining = length;
+    while( remaining % 4 == 0 ) {
+      factor.push_back( 4 );
+      remaining /= 4;
+    }
+    for( size_t prm = 2; ( prm <= MaxRadix ) && ( remaining > 1 ); ++prm ) {
+      while( remaining % prm == 0 ) {
+        factor.push_back( prm );
+        remaining /= prm;
+      }
+    }
+    if( remaining == 1 ) {
+      COMMENT( "Mixed-radix plan.", 2 );
+      radix = Vector< size_t >( factor.size( ) );
+      for( size_t stp = 0; stp < factor.size( ); ++stp )
+        radix[ stp ] = factor[ stp ];
+      twiddle = Vector< bial_complex >( length );
+      for( size_t elm = 0; elm < length; ++elm )
+        twiddle[ elm ] = std::polar( 1.0, -2.0 * M_PI * elm / length );
+      return;
+    }
+    COMMENT( "Bluestein plan. The chirp is convolved by a power of two transform.", 2 );
+    size_t padded = 1;
+    while( padded < 2 * length - 1 )
+      padded <<= 1;
+    convolution = Plan( padded );
+    chirp = Vector< bial_complex >( length );
+    chirp_spectrum = Vector< bial_complex >( padded, bial_complex( 0.0, 0.0 ) );
+    for( size_t elm = 0; elm < length; ++elm ) {
+      size_t square = ( elm * elm ) % ( 2 * length );
+      chirp[ elm ] = std::polar( 1.0, -M_PI * square / length );
+      chirp_spectrum[ elm ] = std::conj( chirp[ elm ] ) / static_cast< double >( padded );
+      if( elm != 0 )
+        chirp_spectrum[ padded - elm ] = chirp_spectrum[ elm ];
+    }
+    Vector< bial_complex > work( convolution->WorkSize( ) );
+    convolution->Transform( chirp_spectrum.data( ), work.data( ) );
+  }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( const std::out_of_range &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+    throw( std::out_of_range( msg ) );
+  }
+  catch( const std::logic_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+    throw( std::logic_error( msg ) );
+  }
+
+  std::shared_ptr< const FourierPlan > FourierPlan::Plan( size_t length ) {
+    try {
+      {
+        std::lock_guard< std::mutex > lock( cache_mutex );
+        auto found = cache.find( length );
+        if( found != cache.end( ) )
+          return( found->second );
+      }
+      COMMENT( "Creating the plan outside the lock, since Bluestein plans request other plans.", 2 );
+      std::shared_ptr< const FourierPlan > plan( std::make_shared< FourierPlan >( length ) );
+      std::lock_guard< std::mutex > lock( cache_mutex );
+      if( cache.size( ) >= MaxPlans ) {
+        COMMENT( "Releasing plans used only by the cache. Releasing a Bluestein plan may release its convolution.", 2 );
+        bool released = true;
+        while( released ) {
+          released = false;
+          for( auto itr = cache.begin( ); itr != cache.end( ); ) {
+            if( itr->second.use_count( ) == 1 ) {
+              itr = cache.erase( itr );
+              released = true;
+            }
+            else
+              ++itr;
+          }
+        }
+      }
+      return( cache.insert( std::make_pair( length, plan ) ).first->second );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void FourierPlan::ClearPlans( ) {
+    std::lock_guard< std::mutex > lock( cache_mutex );
+    cache.clear( );
+  }
+
+  size_t FourierPlan::FastLength( size_t length ) {
+    for( size_t fast = std::max( length, static_cast< size_t >( 1 ) ); ; ++fast ) {
+      size_t remaining = fast;
+      while( remaining % 2 == 0 )
+        remaining /= 2;
+      while( remaining % 3 == 0 )
+        remaining /= 3;
+      while( remaining % 5 == 0 )
+        remaining /= 5;
+      if( remaining == 1 )
+        return( fast );
+    }
+  }
+
+  size_t FourierPlan::size( ) const {
+    return( length );
+  }
+
+  size_t FourierPlan::WorkSize( ) const {
+    if( convolution )
+      return( 2 * convolution->size( ) );
+    return( length );
+  }
+
+  bial_complex *FourierPlan::Stockham( bial_complex *src, bial_complex *dst ) const {
+    size_t n = length;
+    size_t stride = 1;
+    for( size_t stp = 0; stp < radix.size( ); ++stp ) {
+      size_t rdx = radix[ stp ];
+      size_t m = n / rdx;
+      size_t twiddle_step = length / n;
+      if( rdx == 2 ) {
+        for( size_t p = 0; p < m; ++p ) {
+          const bial_complex w1( twiddle[ p * twiddle_step ] );
+          const bial_complex *x = src + stride * p;
+          bial_complex *y = dst + stride * 2 * p;
+          for( size_t q = 0; q < stride; ++q ) {
+            const bial_complex a0( x[ q ] );
+            const bial_complex a1( x[ q + stride * m ] );
+            y[ q ] = a0 + a1;
+            y[ q + stride ] = FourierProduct( a0 - a1, w1 );
+          }
+        }
+      }
+      else if( rdx == 3 ) {
+        const double sin3 = std::sqrt( 3.0 ) / 2.0;
+        for( size_t p = 0; p < m; ++p ) {
+          const bial_complex w1( twiddle[ p * twiddle_step ] );
+          const bial_complex w2( twiddle[ 2 * p * twiddle_step ] );
+          const bial_complex *x = src + stride * p;
+          bial_complex *y = dst + stride * 3 * p;
+          for( size_t q = 0; q < stride; ++q ) {
+            const bial_complex a0( x[ q ] );
+            const bial_complex a1( x[ q + stride * m ] );
+            const bial_complex a2( x[ q + 2 * stride * m ] );
+            const bial_complex t( a1 + a2 );
+            const bial_complex u( a0 - 0.5 * t );
+            const bial_complex v( FourierMinusI( sin3 * ( a1 - a2 ) ) );
+            y[ q ] = a0 + t;
+            y[ q + stride ] = FourierProduct( u + v, w1 );
+            y[ q + 2 * stride ] = FourierProduct( u - v, w2 );
+          }
+        }
+      }
+      else if( rdx == 4 ) {
+        for( size_t p = 0; p < m; ++p ) {
+          const bial_complex w1( twiddle[ p * twiddle_step ] );
+          const bial_complex w2( twiddle[ 2 * p * twiddle_step ] );
+          const bial_complex w3( twiddle[ 3 * p * twiddle_step ] );
+          const bial_complex *x = src + stride * p;
+          bial_complex *y = dst + stride * 4 * p;
+          for( size_t q = 0; q < stride; ++q ) {
+            const bial_complex a0( x[ q ] );
+            const bial_complex a1( x[ q + stride * m ] );
+            const bial_complex a2( x[ q + 2 * stride * m ] );
+            const bial_complex a3( x[ q + 3 * stride * m ] );
+            const bial_complex t0( a0 + a2 );
+            const bial_complex t1( a0 - a2 );
+            const bial_complex t2( a1 + a3 );
+            const bial_complex t3( FourierMinusI( a1 - a3 ) );
+            y[ q ] = t0 + t2;
+            y[ q + stride ] = FourierProduct( t1 + t3, w1 );
+            y[ q + 2 * stride ] = FourierProduct( t0 - t2, w2 );
+            y[ q + 3 * stride ] = FourierProduct( t1 - t3, w3 );
+          }
+        }
+      }
+      else if( rdx == 5 ) {
+        const double cos1 = std::cos( 2.0 * M_PI / 5.0 );
+        const double cos2 = std::cos( 4.0 * M_PI / 5.0 );
+        const double sin1 = std::sin( 2.0 * M_PI / 5.0 );
+        const double sin2 = std::sin( 4.0 * M_PI / 5.0 );
+        for( size_t p = 0; p < m; ++p ) {
+          const bial_complex w1( twiddle[ p * twiddle_step ] );
+          const bial_complex w2( twiddle[ 2 * p * twiddle_step ] );
+          const bial_complex w3( twiddle[ 3 * p * twiddle_step ] );
+          const bial_complex w4( twiddle[ 4 * p * twiddle_step ] );
+          const bial_complex *x = src + stride * p;
+          bial_complex *y = dst + stride * 5 * p;
+          for( size_t q = 0; q < stride; ++q ) {
+            const bial_complex a0( x[ q ] );
+            const bial_complex a1( x[ q + stride * m ] );
+            const bial_complex a2( x[ q + 2 * stride * m ] );
+            const bial_complex a3( x[ q + 3 * stride * m ] );
+            const bial_complex a4( x[ q + 4 * stride * m ] );
+            const bial_complex t1( a1 + a4 );
+            const bial_complex t2( a2 + a3 );
+            const bial_complex d1( a1 - a4 );
+            const bial_complex d2( a2 - a3 );
+            const bial_complex u1( a0 + cos1 * t1 + cos2 * t2 );
+            const bial_complex u2( a0 + cos2 * t1 + cos1 * t2 );
+            const bial_complex v1( FourierMinusI( sin1 * d1 + sin2 * d2 ) );
+            const bial_complex v2( FourierMinusI( sin2 * d1 - sin1 * d2 ) );
+            y[ q ] = a0 + t1 + t2;
+            y[ q + stride ] = FourierProduct( u1 + v1, w1 );
+            y[ q + 2 * stride ] = FourierProduct( u2 + v2, w2 );
+            y[ q + 3 * stride ] = FourierProduct( u2 - v2, w3 );
+            y[ q + 4 * stride ] = FourierProduct( u1 - v1, w4 );
+          }
+        }
+      }
+      else {
+        size_t root_step = length / rdx;
+        bial_complex a[ MaxRadix ];
+        for( size_t p = 0; p < m; ++p ) {
+          const bial_complex *x = src + stride * p;
+          bial_complex *y = dst + stride * rdx * p;
+          for( size_t q = 0; q < stride; ++q ) {
+            for( size_t j = 0; j < rdx; ++j )
+              a[ j ] = x[ q + j * stride * m ];
+            for( size_t k = 0; k < rdx; ++k ) {
+              bial_complex sum( a[ 0 ] );
+              size_t root = 0;
+              for( size_t j = 1; j < rdx; ++j ) {
+                root += k;
+                if( root >= rdx )
+                  root -= rdx;
+                sum += FourierProduct( a[ j ], twiddle[ root * root_step ] );
+              }
+              y[ q + k * stride ] = FourierProduct( sum, twiddle[ p * k * twiddle_step ] );
+            }
+          }
+        }
+      }
+      std::swap( src, dst );
+      n = m;
+      stride *= rdx;
+    }
+    return( src );
+  }
+
+  void FourierPlan::Transform( bial_complex *data, bial_complex *work, bool forward_transform ) const {
+    try {
+      COMMENT( "The inverse transform is the conjugate of the forward transform of the conjugate.", 3 );
+      if( !forward_transform ) {
+        for( size_t elm = 0; elm < length; ++elm )
+          data[ elm ] = std::conj( data[ elm ] );
+      }
+      if( !convolution ) {
+        bial_complex *result = Stockham( data, work );
+        if( result != data )
+          std::copy( result, result + length, data );
+      }
+      else {
+        COMMENT( "Bluestein: convolution of the chirped sequence by the conjugate chirp.", 3 );
+        size_t padded = convolution->size( );
+        for( size_t elm = 0; elm < length; ++elm )
+          work[ elm ] = FourierProduct( data[ elm ], chirp[ elm ] );
+        std::fill( work + length, work + padded, bial_complex( 0.0, 0.0 ) );
+        convolution->Transform( work, work + padded );
+        for( size_t elm = 0; elm < padded; ++elm )
+          work[ elm ] = FourierProduct( work[ elm ], chirp_spectrum[ elm ] );
+        convolution->Transform( work, work + padded, false );
+        for( size_t elm = 0; elm < length; ++elm )
+          data[ elm ] = FourierProduct( work[ elm ], chirp[ elm ] );
+      }
+      if( !forward_transform ) {
+        for( size_t elm = 0; elm < length; ++elm )
+          data[ elm ] = std::conj( data[ elm ] );
+      }
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+}
+
+#endif
+
+#endif
@@ -31,7 +31,7 @@ namespace Bial {
   template< class D >
   GeodesicRestrictionPathFunction< D >::GeodesicRestrictionPathFunction( Image< D > &init_value, 
                                                                          Image< int > *init_label,
-                                                                         Image< int > *init_predecessor, 
+                                                                         Image< bial_index > *init_predecessor, 
                                                                          bool sequential_label, 
                                                                          const Image< D > &handicap,
                                                                          const Image< D > &new_intensity,
@@ -128,226 +128,6 @@ namespace Bial {
     }
   }
 
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::RemoveSimple( size_t, BucketState ) {
-    return( true );
-  }
-
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::RemovePredecessor( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        this->predecessor->operator()( index ) = -1;
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::RemoveLabel( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        this->label->operator()( index ) = this->next_label;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::RemoveComplete( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        this->label->operator()( index ) = this->next_label;
-        this->predecessor->operator()( index ) = -1;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  inline bool GeodesicRestrictionPathFunction< D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
-    try {
-      return( ( adj_state != BucketState::REMOVED ) &&
-              ( this->value->operator()( index ) < this->value->operator()( adj_index ) ) );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      D src_value = this->value->operator()( adj_index );
-      COMMENT( "Computing arc weight.", 3 );
-      double arc_weight = handicap( index ) + handicap( adj_index );
-      COMMENT( "Orienting edges.", 3 );
-      double fraction = 0;
-      // if( intensity[ index ] > intensity[ adj_index ] )
-      //   fraction = std::abs( alpha );
-      // else if( intensity[ index ] < intensity[ adj_index ] )
-      //   fraction = -std::abs( alpha );
-      // if( alpha < 0.0 )
-      //   fraction = -fraction;
-      if( ( intensity[ index ] - intensity[ adj_index ] ) * alpha >= 0.0 )
-        fraction = std::abs( alpha );
-      else
-        fraction = -std::abs( alpha );
-      arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
-      COMMENT( "Suppressing non-zero.", 3 );
-      ++arc_weight;
-      COMMENT( "Computing spacial distance.", 3 );
-      double distance = dists( adj_pos );
-      COMMENT( "Propagated value.", 3 );
-      D prp_value = static_cast< D >( this->value->operator()( index ) + std::pow( arc_weight, beta )
-                                      - 1.0 + distance );
-      COMMENT( "Updating value.", 3 );
-      if( ( src_value > prp_value ) ||
-          ( ( this->predecessor->operator()( adj_index ) == static_cast< int >( index ) ) &&
-            ( this->label->operator()( adj_index ) != this->label->operator()( index ) ) ) ) {
-        this->value->operator()( adj_index ) = prp_value;
-        ( this->*this->UpdateData )( index, adj_index );
-        return( true );
-      }
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< class D >
-  bool GeodesicRestrictionPathFunction< D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      D src_value = this->value->operator()( adj_index );
-      COMMENT( "Computing arc weight.", 3 );
-      double arc_weight = handicap( index ) + handicap( adj_index );
-      COMMENT( "Orienting edges.", 3 );
-      double fraction = 0;
-      // if( intensity[ index ] > intensity[ adj_index ] ) {
-      //   fraction = std::abs( alpha );
-      // }
-      // else if( intensity[ index ] < intensity[ adj_index ] ) {
-      //   fraction = -std::abs( alpha );
-      // }
-      // if( alpha < 0.0 ) {
-      //   fraction = -fraction;
-      // }
-      double tmp = ( intensity[ index ] - intensity[ adj_index ] ) * alpha;
-      if( tmp > 0.0 )
-        fraction = std::abs( alpha );
-      else if( tmp < 0.0 )
-        fraction = -std::abs( alpha );
-      arc_weight = std::round( arc_weight * ( 1.0 + fraction ) );
-      COMMENT( "Suppressing non-zero.", 3 );
-      ++arc_weight;
-      COMMENT( "Computing spacial distance.", 3 );
-      double distance = dists( adj_pos );
-      COMMENT( "Propagated value.", 3 );
-      D prp_value = static_cast< D >( this->value->operator()( index ) + std::pow( arc_weight, beta )
-                                      - 1.0 + distance );
-      COMMENT( "Updating value.", 3 );
-      if( src_value > prp_value ) {
-        this->value->operator()( adj_index ) = prp_value;
-        ( this->*this->UpdateData )( index, adj_index );
-        return( true );
-      }
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
   template< class D >
   bool GeodesicRestrictionPathFunction< D >::Increasing( ) {
     return( true );
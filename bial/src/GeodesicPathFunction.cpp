@@ -30,7 +30,7 @@ namespace Bial {
 
   template< class D >
   GeodesicDistancePathFunction< D >::GeodesicDistancePathFunction( Image< D > &init_value, Image< int > *init_label,
-                                                                   Image< int > *init_predecessor,
+                                                                   Image< bial_index > *init_predecessor,
                                                                    bool sequential_label, const Adjacency &adj,
                                                                    const Image< D > &handicap ) try :
     PathFunction< Image, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ) {
@@ -18,6 +18,8 @@
 
 #if defined ( BIAL_EXPLICIT_GeometricsAffine ) || ( BIAL_IMPLICIT_BIN )
 
+#include "Resampling.hpp"
+
 namespace Bial {
 
   template< class D >
@@ -49,6 +51,10 @@ namespace Bial {
                                           const PixelInterpolation &interpolation ) {
     try {
       COMMENT( "BialAffine: " << std::endl << transform, 1 );
+      COMMENT( "Library interpolations are inlined by the resampling engine.", 1 );
+      Image< D > engine;
+      if( Resampling::Affine( img, transform, interpolation, engine ) )
+        return( engine );
       if( img.Dims( ) == 2 ) {
         COMMENT( "2D image with 3x3 matrix.", 0 );
         Image< D > res( img );
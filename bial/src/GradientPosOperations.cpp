@@ -41,9 +41,9 @@ namespace Bial {
         size_t img_ysize = canny.size( 1 );
         size_t img_size = canny.size( );
         for( size_t elm = 0; elm < img_size; ++elm ) {
-          div_t elm_by_imgx = std::div( static_cast< int >( elm ), static_cast< int >( img_xsize ) );
-          if( ( elm_by_imgx.rem > 0 ) && ( elm_by_imgx.rem < static_cast< int >( img_xsize ) - 1 ) &&
-              ( elm_by_imgx.quot > 0 ) && ( elm_by_imgx.quot < static_cast< int >( img_ysize ) - 1 ) &&
+          size_t elm_x = elm % img_xsize;
+          size_t elm_y = elm / img_xsize;
+          if( ( elm_x > 0 ) && ( elm_x + 1 < img_xsize ) && ( elm_y > 0 ) && ( elm_y + 1 < img_ysize ) &&
               ( canny[ elm ] == 0 ) ) {
             for( int adj_dir = 7; adj_dir != 4; adj_dir = ( adj_dir + 1 ) % 8 ) {
               size_t adj_elm = adj_itr( elm, adj_dir );
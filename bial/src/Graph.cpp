@@ -22,12 +22,15 @@
 #include "DFIDE.hpp"
 #include "Feature.hpp"
 #include "GrowingBucketQueue.hpp"
+#include "KdTreeGraphAdjacency.hpp"
 #include "KnnGraphAdjacency.hpp"
 #include "LSHGraphAdjacency.hpp"
 #include "MinPathFunction.hpp"
+#include "OPFClassifier.hpp"
 #include "SampleRandom.hpp"
 #include "SampleUniform.hpp"
 #include "SortingSort.hpp"
+#include <chrono>
 
 namespace Bial {
 
@@ -140,26 +143,39 @@ namespace Bial {
       if( sigma == 0.0 ) {
         sigma = 1.0;
       }
+      COMMENT( "Sigma: " << sigma << ". Computing nodes density in parallel.", 2 );
+      auto pdf = [ & ]( size_t tsk, size_t tasks ) {
+        size_t min_src = tsk * density.size( ) / tasks;
+        size_t max_src = ( tsk + 1 ) * density.size( ) / tasks;
+        for( size_t src = min_src; src < max_src; ++src ) {
+          COMMENT( "src: " << src, 4 );
+          density( src ) = 1.0;
+          COMMENT( "Computing the density from the adjacents.", 4 );
+          size_t neighbors = adjacency.Arcs( src, scl );
+          for( size_t adj = 0; adj < neighbors; ++adj ) {
+            double weight = adjacency.ArcWeight( src, adj );
+            density( src ) += exp( -weight * weight / sigma );
+            COMMENT( "adj: " << adj << " weight: " << weight << ", exp: " << -weight * weight / sigma << ", dens: " <<
+                     exp( -weight * weight / sigma ), 4 );
+            COMMENT( "partial sum: " << density( src ), 4 );
+          }
+          COMMENT( "Here, see the difference when additional arcs from symmetry are inserted.", 4 );
+          /* density( src ) /= ( neighbors + 1 ); */
+          COMMENT( "final density: " << density( src ), 4 );
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( density.size( ) ), pdf );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        pdf( 0, 1 );
+      }
+      COMMENT( "Getting maximum and minimum density for delta computing.", 2 );
       double mindens = std::numeric_limits< double >::max( );
       double maxdens = std::numeric_limits< double >::min( );
-
-      COMMENT( "Sigma: " << sigma << ". Computing nodes density and the minimal and maximal densities.", 2 );
       for( size_t src = 0; src < density.size( ); ++src ) {
-        COMMENT( "src: " << src, 4 );
-        density( src ) = 1.0;
-        COMMENT( "Computing the density from the adjacents.", 4 );
-        size_t neighbors = adjacency.Arcs( src, scl );
-        for( size_t adj = 0; adj < neighbors; ++adj ) {
-          double weight = adjacency.ArcWeight( src, adj );
-          density( src ) += exp( -weight * weight / sigma );
-          COMMENT( "adj: " << adj << " weight: " << weight << ", exp: " << -weight * weight / sigma << ", dens: " <<
-                   exp( -weight * weight / sigma ), 4 );
-          COMMENT( "partial sum: " << density( src ), 4 );
-        }
-        COMMENT( "Here, see the difference when additional arcs from symmetry are inserted.", 4 );
-        /* density( src ) /= ( neighbors + 1 ); */
-        COMMENT( "final density: " << density( src ), 4 );
-        COMMENT( "Getting maximum and minimum density for delta computing.", 4 );
         if( mindens > density( src ) ) {
           mindens = density( src );
         }
@@ -197,6 +213,29 @@ namespace Bial {
 
   template< class GRAPH_ADJACENCY >
   size_t Graph< GRAPH_ADJACENCY >::Clustering( size_t scl ) {
+    try {
+      return( Clustering( scl, true ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class GRAPH_ADJACENCY >
+  size_t Graph< GRAPH_ADJACENCY >::Clustering( size_t scl, bool order_samples ) {
     try {
       COMMENT( "Computing the PDF and delta value for clustering.", 2 );
       double delta = PDF( scl );
@@ -231,8 +270,10 @@ namespace Bial {
                adjacency.HeterogeneousAdjacency( density, scl, delta ), &queue );
         ift.Run( );
       }
-      COMMENT( "Sorting value vector.", 2 );
-      ordered = Sorting::Sort( value, false );
+      if( order_samples ) {
+        COMMENT( "Sorting value vector.", 2 );
+        ordered = Sorting::Sort( value, false );
+      }
       COMMENT( "label: " << label, 2 );
       size_t nlabels = label.Maximum( ) + 1;
       COMMENT( "nlabels: " << nlabels << ".", 2 );
@@ -375,6 +416,108 @@ namespace Bial {
     }
   }
 
+  template< class GRAPH_ADJACENCY >
+  size_t Graph< GRAPH_ADJACENCY >::ScaleSweep( ) {
+    try {
+      COMMENT( "Initializing structures.", 1 );
+      size_t scales = Scales( );
+      size_t elements = label.size( );
+      scale_cut = Vector< double >( scales );
+      scale_time = Matrix< double >( scales, 2 );
+      size_t best_scl = 0;
+      double min_cut = std::numeric_limits< double >::max( );
+      for( size_t scl = 0; scl < scales; ++scl ) {
+        COMMENT( "Clustering scale " << scl << ". Samples are sorted only for the chosen scale.", 1 );
+        std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now( );
+        size_t nlabels = Clustering( scl, false );
+        std::chrono::high_resolution_clock::time_point clustered = std::chrono::high_resolution_clock::now( );
+        COMMENT( "Computing cut weights. Each task accumulates its own class weights, summed in task order.", 2 );
+        Vector< Vector< double > > internal_weight; /* acumulate weights inside each class */
+        Vector< Vector< double > > external_weight; /* acumulate weights between the class and a distinct one */
+        auto weights = [ & ]( size_t tsk, size_t tasks ) {
+          const int *lbl = label.data( );
+          double *task_internal = internal_weight( tsk ).data( );
+          double *task_external = external_weight( tsk ).data( );
+          for( size_t src = tsk * elements / tasks; src < ( tsk + 1 ) * elements / tasks; ++src ) {
+            int src_lbl = lbl[ src ];
+            size_t neighbors = adjacency.Arcs( src, scl );
+            double internal = 0.0;
+            double external = 0.0;
+            for( size_t ngb = 0; ngb < neighbors; ++ngb ) {
+              double weight = 1.0 / ( 1.0 + adjacency.ArcWeight( src, ngb ) );
+              if( lbl[ adjacency.Arc( src, ngb ) ] == src_lbl ) {
+                internal += weight;
+              }
+              else {
+                external += weight;
+              }
+            }
+            task_internal[ src_lbl ] += internal;
+            task_external[ src_lbl ] += external;
+          }
+        };
+        try {
+          ThreadPool &pool = ThreadPool::Global( );
+          size_t tasks = pool.Tasks( elements );
+          internal_weight = Vector< Vector< double > >( tasks, Vector< double >( nlabels ) );
+          external_weight = Vector< Vector< double > >( tasks, Vector< double >( nlabels ) );
+          pool.Run( tasks, weights );
+        }
+        catch( std::exception &e ) {
+          BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+          internal_weight = Vector< Vector< double > >( 1, Vector< double >( nlabels ) );
+          external_weight = Vector< Vector< double > >( 1, Vector< double >( nlabels ) );
+          weights( 0, 1 );
+        }
+        for( size_t tsk = 1; tsk < internal_weight.size( ); ++tsk ) {
+          internal_weight( 0 ) += internal_weight( tsk );
+          external_weight( 0 ) += external_weight( tsk );
+        }
+        double cut = 0.0;
+        for( size_t lbl = 0; lbl < nlabels; ++lbl ) {
+          cut += external_weight( 0 )( lbl ) / ( internal_weight( 0 )( lbl ) + external_weight( 0 )( lbl ) );
+        }
+        std::chrono::high_resolution_clock::time_point finished = std::chrono::high_resolution_clock::now( );
+        scale_cut( scl ) = cut;
+        scale_time( scl, 0 ) = std::chrono::duration< double >( clustered - start ).count( );
+        scale_time( scl, 1 ) = std::chrono::duration< double >( finished - clustered ).count( );
+        COMMENT( "Scale " << scl << ", labels: " << nlabels << ", cut: " << cut << ", clustering: " <<
+                 scale_time( scl, 0 ) << " s, cut: " << scale_time( scl, 1 ) << " s.", 1 );
+        if( min_cut > cut ) {
+          min_cut = cut;
+          best_scl = scl;
+        }
+      }
+      return( best_scl );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class GRAPH_ADJACENCY >
+  const Vector< double > &Graph< GRAPH_ADJACENCY >::ScaleCut( ) const {
+    return( scale_cut );
+  }
+
+  template< class GRAPH_ADJACENCY >
+  const Matrix< double > &Graph< GRAPH_ADJACENCY >::ScaleTime( ) const {
+    return( scale_time );
+  }
+
   template< class GRAPH_ADJACENCY >
   template< class D >
   void Graph< GRAPH_ADJACENCY >::PropagateLabel( Feature< D > &feature, size_t scl ) const {
@@ -388,22 +531,19 @@ namespace Bial {
           feature.Label( sample( elm, rpt ) ) = label( elm );
         }
       }
-      COMMENT( "Propagating other labels.", 1 );
-      try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &Graph::PropagateLabelThread< D >, this, std::ref( feature ), scl, thd,
-                                          total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
-      }
-      catch( std::exception &e ) {
-        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
-        PropagateLabelThread( feature, scl, 0, 1 );
+      COMMENT( "Building the classifier from the subsamples, in the order they conquer other samples.", 1 );
+      Vector< size_t > element( ordered.size( ) );
+      Vector< int > node_label( ordered.size( ) );
+      Vector< double > node_radius( ordered.size( ) );
+      for( size_t idx = 0; idx < ordered.size( ); ++idx ) {
+        size_t spl = ordered( idx );
+        element( idx ) = sample( spl );
+        node_label( idx ) = label( spl );
+        node_radius( idx ) = adjacency.Radius( spl, scl );
       }
+      OPFClassifier< D > classifier( feature, element, node_label, node_radius );
+      COMMENT( "Propagating other labels.", 1 );
+      classifier.Classify( feature );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -550,6 +690,7 @@ namespace Bial {
 
   template class Graph< KnnGraphAdjacency >;
   template class Graph< LSHGraphAdjacency >;
+  template class Graph< KdTreeGraphAdjacency >;
 
   template void Graph< KnnGraphAdjacency >::Initialize( const Feature< int > &feature, float scl_min, float scl_max );
   template void Graph< KnnGraphAdjacency >::PropagateLabel( Feature< int > &feature, size_t scl ) const;
@@ -615,6 +756,42 @@ namespace Bial {
                                                               const Feature< double > &feat, size_t, size_t x, 
                                                               size_t y );
 
+  template void Graph< KdTreeGraphAdjacency >::Initialize( const Feature< int > &feature, float scl_min,
+                                                           float scl_max );
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabel( Feature< int > &feature, size_t scl ) const;
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabelThread( Feature< int > &feature, size_t scl,
+                                                                     size_t thread, size_t total_threads ) const;
+  template void Graph< KdTreeGraphAdjacency >::GnuPlot2DScatter( const std::string & basename,
+                                                                 const Feature< int > &feat, size_t, size_t x,
+                                                                 size_t y );
+
+  template void Graph< KdTreeGraphAdjacency >::Initialize( const Feature< llint > &feature, float scl_min,
+                                                           float scl_max );
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabel( Feature< llint > &feature, size_t scl ) const;
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabelThread( Feature< llint > &feature, size_t scl,
+                                                                     size_t thread, size_t total_threads ) const;
+  template void Graph< KdTreeGraphAdjacency >::GnuPlot2DScatter( const std::string & basename,
+                                                                 const Feature< llint > &feat, size_t, size_t x,
+                                                                 size_t y );
+
+  template void Graph< KdTreeGraphAdjacency >::Initialize( const Feature< float > &feature, float scl_min,
+                                                           float scl_max );
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabel( Feature< float > &feature, size_t scl ) const;
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabelThread( Feature< float > &feature, size_t scl,
+                                                                     size_t thread, size_t total_threads ) const;
+  template void Graph< KdTreeGraphAdjacency >::GnuPlot2DScatter( const std::string & basename,
+                                                                 const Feature< float > &feat, size_t, size_t x,
+                                                                 size_t y );
+
+  template void Graph< KdTreeGraphAdjacency >::Initialize( const Feature< double > &feature, float scl_min,
+                                                           float scl_max );
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabel( Feature< double > &feature, size_t scl ) const;
+  template void Graph< KdTreeGraphAdjacency >::PropagateLabelThread( Feature< double > &feature, size_t scl,
+                                                                     size_t thread, size_t total_threads ) const;
+  template void Graph< KdTreeGraphAdjacency >::GnuPlot2DScatter( const std::string & basename,
+                                                                 const Feature< double > &feat, size_t, size_t x,
+                                                                 size_t y );
+
 #endif
 
 }
@@ -31,7 +31,7 @@ namespace Bial {
 
   template< template< class D > class C, class D >
   HierarchicalPathFunction< C, D >::HierarchicalPathFunction( C< D > &init_value, C< int > &init_label,
-                                                              C< int > *init_predecessor, bool sequential_label, 
+                                                              C< bial_index > *init_predecessor, bool sequential_label, 
                                                               const C< D > &handicap, C< int > *merge_label, 
                                                               C< int > *split_label ) try :
     PathFunction< C, D >( init_value, &init_label, init_predecessor, sequential_label ), handicap( handicap ), 
@@ -112,8 +112,10 @@ namespace Bial {
     throw( std::logic_error( msg ) );
   }
 
-  template< class D > Image< D >::Image( D *new_data, const Vector< size_t > &new_dim ) try
-    : _data( new_data, new_dim ), qk_data( new_data ), pixel_size( 3, 1.0 ), y_table( nullptr ), z_table( nullptr ) {
+  template< class D > Image< D >::Image( D *new_data, const Vector< size_t > &new_dim,
+                                         const std::shared_ptr< void > &new_owner ) try
+    : _data( new_data, new_dim ), qk_data( new_data ), pixel_size( 3, 1.0 ), y_table( nullptr ), z_table( nullptr ),
+      owner( new_owner ) {
       size_t dimensions = new_dim.size( );
       if( ( dimensions < 2 ) || ( dimensions > 3 ) ) {
         std::string msg( BIAL_ERROR( "Must have 2 or 3 dimensions. Given" + std::to_string( dimensions ) + "." ) );
@@ -574,7 +576,7 @@ namespace Bial {
   template< class D >
   Image< D >::Image( Image< D > &&img )  try :
     _data( std::move( img._data ) ), qk_data( img.qk_data ), pixel_size( std::move( img.pixel_size ) ),
-      y_table( std::move( img.y_table ) ), z_table( std::move( img.z_table ) ) {
+      y_table( std::move( img.y_table ) ), z_table( std::move( img.z_table ) ), owner( std::move( img.owner ) ) {
       img.y_table = nullptr;
       img.z_table = nullptr;
     }
@@ -602,6 +604,7 @@ namespace Bial {
     qk_data = &_data[ 0 ];
     CreateTables( );
     pixel_size = other.pixel_size;
+    owner.reset( );
     return( *this );
   }
 
@@ -613,6 +616,7 @@ namespace Bial {
     pixel_size = std::move( other.pixel_size );
     y_table = std::move( other.y_table );
     z_table = std::move( other.z_table );
+    owner = std::move( other.owner );
     other.y_table = nullptr;
     other.z_table = nullptr;
     return( *this );
@@ -633,6 +637,7 @@ namespace Bial {
     qk_data = &_data[ 0 ];
     CreateTables( );
     pixel_size = other.pixel_size;
+    owner.reset( );
     return( *this );
   }
 
@@ -1324,67 +1329,67 @@ namespace Bial {
   }
 
   template< class D >
-  typename std::vector< D >::iterator Image< D >::begin( ) noexcept {
+  D* Image< D >::begin( ) noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.begin( ) );
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Image< D >::begin( ) const noexcept {
+  const D* Image< D >::begin( ) const noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.begin( ) );
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::iterator Image< D >::end( ) noexcept {
+  D* Image< D >::end( ) noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.end( ) );
+    return( qk_data + _data._size );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Image< D >::end( ) const noexcept {
+  const D* Image< D >::end( ) const noexcept {
     COMMENT( "size_of D: " << sizeof( D ), 4 );
-    return( _data.end( ) );
+    return( qk_data + _data._size );
   }
 
   template< class D >
-  typename std::vector< D >::reverse_iterator Image< D >::rbegin( ) noexcept {
-    return( _data.rbegin( ) );
+  std::reverse_iterator< D* > Image< D >::rbegin( ) noexcept {
+    return( std::reverse_iterator< D* >( qk_data + _data._size ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Image< D >::rbegin( ) const noexcept {
-    return( _data.rbegin( ) );
+  std::reverse_iterator< const D* > Image< D >::rbegin( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data + _data._size ) );
   }
 
   template< class D >
-  typename std::vector< D >::reverse_iterator Image< D >::rend( ) noexcept {
-    return( _data.rend( ) );
+  std::reverse_iterator< D* > Image< D >::rend( ) noexcept {
+    return( std::reverse_iterator< D* >( qk_data ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Image< D >::rend( ) const noexcept {
-    return( _data.rend( ) );
+  std::reverse_iterator< const D* > Image< D >::rend( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Image< D >::cbegin( ) const noexcept {
-    return( _data.cbegin( ) );
+  const D* Image< D >::cbegin( ) const noexcept {
+    return( qk_data );
   }
 
   template< class D >
-  typename std::vector< D >::const_iterator Image< D >::cend( ) const noexcept {
-    return( _data.cend( ) );
+  const D* Image< D >::cend( ) const noexcept {
+    return( qk_data + _data._size );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Image< D >::crbegin( ) const noexcept {
-    return( _data.crbegin( ) );
+  std::reverse_iterator< const D* > Image< D >::crbegin( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data + _data._size ) );
   }
 
   template< class D >
-  typename std::vector< D >::const_reverse_iterator Image< D >::crend( ) const noexcept {
-    return( _data.crend( ) );
+  std::reverse_iterator< const D* > Image< D >::crend( ) const noexcept {
+    return( std::reverse_iterator< const D* >( qk_data ) );
   }
 
   template< class D >
@@ -1443,20 +1448,19 @@ namespace Bial {
     // Vector< size_t > index( _data.dim_size.size( ), position / _data.acc_dim_size( 1 ) );
     // index[ 0 ] = position % _data.dim_size( 0 );
     // index[ 1 ] = ( position / _data.dim_size( 0 ) ) % _data.dim_size( 1 );
-    std::div_t pos_div_xy_size = std::div( static_cast< int >( position ), _data.acc_dim_size( 1 ) );
-    std::div_t xy_size_div_xsize = std::div( pos_div_xy_size.rem, _data.dim_size( 0 ) );
-    Vector< size_t > index( 3, pos_div_xy_size.quot );
-    index[ 0 ] = xy_size_div_xsize.rem;
-    index[ 1 ] = xy_size_div_xsize.quot;
+    size_t z = position / _data.acc_dim_size( 1 );
+    size_t xy = position - z * _data.acc_dim_size( 1 );
+    Vector< size_t > index( 3, z );
+    index[ 1 ] = xy / _data.dim_size( 0 );
+    index[ 0 ] = xy - index[ 1 ] * _data.dim_size( 0 );
     return( index );
   }
 
   template< class D >
   Vector< size_t > Image< D >::Coordinates2( size_t position ) const {
-    std::div_t pos_div_xsize = std::div( static_cast< int >( position ), _data.acc_dim_size( 0 ) );
     Vector< size_t > index( 3, 0 );
-    index[ 0 ] = pos_div_xsize.rem;
-    index[ 1 ] = pos_div_xsize.quot;
+    index[ 1 ] = position / _data.acc_dim_size( 0 );
+    index[ 0 ] = position - index[ 1 ] * _data.acc_dim_size( 0 );
     return( index );
   }
 
@@ -1694,7 +1698,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator+( const Image< D > &img1, const Image< D > &img2 ) {
+  typename ExpressionEager< D, Image< D > >::type operator+( const Image< D > &img1, const Image< D > &img2 ) {
     try {
       COMMENT( "Verifying if images have compatible dimensions", 2 );
       if( img1.size( ) != img2.size( ) ) {
@@ -1735,7 +1739,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator-( const Image< D > &img1, const Image< D > &img2 ) {
+  typename ExpressionEager< D, Image< D > >::type operator-( const Image< D > &img1, const Image< D > &img2 ) {
     try {
       COMMENT( "Verifying if images have compatible dimensions.", 4 );
       if( img1.size( ) != img2.size( ) ) {
@@ -1777,7 +1781,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator*( const Image< D > &img1, const Image< D > &img2 ) {
+  typename ExpressionEager< D, Image< D > >::type operator*( const Image< D > &img1, const Image< D > &img2 ) {
     try {
       COMMENT( "Verifying if images have compatible dimensions.", 4 );
       if( img1.size( ) != img2.size( ) ) {
@@ -1819,7 +1823,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator/( const Image< D > &img1, const Image< D > &img2 ) {
+  typename ExpressionEager< D, Image< D > >::type operator/( const Image< D > &img1, const Image< D > &img2 ) {
     try {
       COMMENT( "Verifying if images have compatible dimensions.", 4 );
       if( img1.size( ) != img2.size( ) ) {
@@ -1929,7 +1933,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator+( const Image< D > &img, double scalar ) {
+  typename ExpressionEager< D, Image< D > >::type operator+( const Image< D > &img, double scalar ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -1950,7 +1954,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator+( double scalar, const Image< D > &img ) {
+  typename ExpressionEager< D, Image< D > >::type operator+( double scalar, const Image< D > &img ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -1995,7 +1999,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator-( const Image< D > &img, double scalar ) {
+  typename ExpressionEager< D, Image< D > >::type operator-( const Image< D > &img, double scalar ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -2016,7 +2020,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator-( double scalar, const Image< D > &img ) {
+  typename ExpressionEager< D, Image< D > >::type operator-( double scalar, const Image< D > &img ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -2066,7 +2070,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator*( const Image< D > &img, double scalar ) {
+  typename ExpressionEager< D, Image< D > >::type operator*( const Image< D > &img, double scalar ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -2088,7 +2092,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator*( double scalar, const Image< D > &img ) {
+  typename ExpressionEager< D, Image< D > >::type operator*( double scalar, const Image< D > &img ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -2133,7 +2137,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator/( const Image< D > &img, double scalar ) {
+  typename ExpressionEager< D, Image< D > >::type operator/( const Image< D > &img, double scalar ) {
     try {
       COMMENT( "Verifying if scalar is not zero.", 2 );
       if( scalar == 0.0 ) {
@@ -2160,7 +2164,7 @@ namespace Bial {
   }
 
   template< class D >
-  Image< D > operator/( double scalar, const Image< D > &img ) {
+  typename ExpressionEager< D, Image< D > >::type operator/( double scalar, const Image< D > &img ) {
     try {
       COMMENT( "Initializing resultant image.", 2 );
       Image< D > res( img );
@@ -2357,88 +2361,40 @@ namespace Bial {
   template Image< double > &Image< double >::operator=( const Image< llint > &img );
   template Image< double > &Image< double >::operator=( const Image< float > &img );
 
-  template Image< int > operator+( const Image< int > &img1, const Image< int > &img2 );
   template Image< int > &operator+=( Image< int > &img1, const Image< int > &img2 );
-  template Image< int > operator-( const Image< int > &img1, const Image< int > &img2 );
   template Image< int > &operator-=( Image< int > &img1, const Image< int > &img2 );
-  template Image< int > operator*( const Image< int > &img1, const Image< int > &img2 );
   template Image< int > &operator*=( Image< int > &img1, const Image< int > &img2 );
-  template Image< int > operator/( const Image< int > &img1, const Image< int > &img2 );
   template Image< int > &operator/=( Image< int > &img1, const Image< int > &img2 );
-  template Image< int > operator+( const Image< int > &img, double scalar );
-  template Image< int > operator+( double scalar, const Image< int > &img );
   template Image< int > &operator+=( Image< int > &img, double scalar );
-  template Image< int > operator-( const Image< int > &img, double scalar );
-  template Image< int > operator-( double scalar, const Image< int > &img );
   template Image< int > &operator-=( Image< int > &img, double scalar );
-  template Image< int > operator*( const Image< int > &img, double scalar );
-  template Image< int > operator*( double scalar, const Image< int > &img );
   template Image< int > &operator*=( Image< int > &img, double scalar );
-  template Image< int > operator/( const Image< int > &img, double scalar );
-  template Image< int > operator/( double scalar, const Image< int > &img );
   template Image< int > &operator/=( Image< int > &img, double scalar );
 
-  template Image< llint > operator+( const Image< llint > &img1, const Image< llint > &img2 );
   template Image< llint > &operator+=( Image< llint > &img1, const Image< llint > &img2 );
-  template Image< llint > operator-( const Image< llint > &img1, const Image< llint > &img2 );
   template Image< llint > &operator-=( Image< llint > &img1, const Image< llint > &img2 );
-  template Image< llint > operator*( const Image< llint > &img1, const Image< llint > &img2 );
   template Image< llint > &operator*=( Image< llint > &img1, const Image< llint > &img2 );
-  template Image< llint > operator/( const Image< llint > &img1, const Image< llint > &img2 );
   template Image< llint > &operator/=( Image< llint > &img1, const Image< llint > &img2 );
-  template Image< llint > operator+( const Image< llint > &img, double scalar );
-  template Image< llint > operator+( double scalar, const Image< llint > &img );
   template Image< llint > &operator+=( Image< llint > &img, double scalar );
-  template Image< llint > operator-( const Image< llint > &img, double scalar );
-  template Image< llint > operator-( double scalar, const Image< llint > &img );
   template Image< llint > &operator-=( Image< llint > &img, double scalar );
-  template Image< llint > operator*( const Image< llint > &img, double scalar );
-  template Image< llint > operator*( double scalar, const Image< llint > &img );
   template Image< llint > &operator*=( Image< llint > &img, double scalar );
-  template Image< llint > operator/( const Image< llint > &img, double scalar );
-  template Image< llint > operator/( double scalar, const Image< llint > &img );
   template Image< llint > &operator/=( Image< llint > &img, double scalar );
 
-  template Image< float > operator+( const Image< float > &img1, const Image< float > &img2 );
   template Image< float > &operator+=( Image< float > &img1, const Image< float > &img2 );
-  template Image< float > operator-( const Image< float > &img1, const Image< float > &img2 );
   template Image< float > &operator-=( Image< float > &img1, const Image< float > &img2 );
-  template Image< float > operator*( const Image< float > &img1, const Image< float > &img2 );
   template Image< float > &operator*=( Image< float > &img1, const Image< float > &img2 );
-  template Image< float > operator/( const Image< float > &img1, const Image< float > &img2 );
   template Image< float > &operator/=( Image< float > &img1, const Image< float > &img2 );
-  template Image< float > operator+( const Image< float > &img, double scalar );
-  template Image< float > operator+( double scalar, const Image< float > &img );
   template Image< float > &operator+=( Image< float > &img, double scalar );
-  template Image< float > operator-( const Image< float > &img, double scalar );
-  template Image< float > operator-( double scalar, const Image< float > &img );
   template Image< float > &operator-=( Image< float > &img, double scalar );
-  template Image< float > operator*( const Image< float > &img, double scalar );
-  template Image< float > operator*( double scalar, const Image< float > &img );
   template Image< float > &operator*=( Image< float > &img, double scalar );
-  template Image< float > operator/( const Image< float > &img, double scalar );
-  template Image< float > operator/( double scalar, const Image< float > &img );
   template Image< float > &operator/=( Image< float > &img, double scalar );
 
-  template Image< double > operator+( const Image< double > &img1, const Image< double > &img2 );
   template Image< double > &operator+=( Image< double > &img1, const Image< double > &img2 );
-  template Image< double > operator-( const Image< double > &img1, const Image< double > &img2 );
   template Image< double > &operator-=( Image< double > &img1, const Image< double > &img2 );
-  template Image< double > operator*( const Image< double > &img1, const Image< double > &img2 );
   template Image< double > &operator*=( Image< double > &img1, const Image< double > &img2 );
-  template Image< double > operator/( const Image< double > &img1, const Image< double > &img2 );
   template Image< double > &operator/=( Image< double > &img1, const Image< double > &img2 );
-  template Image< double > operator+( const Image< double > &img, double scalar );
-  template Image< double > operator+( double scalar, const Image< double > &img );
   template Image< double > &operator+=( Image< double > &img, double scalar );
-  template Image< double > operator-( const Image< double > &img, double scalar );
-  template Image< double > operator-( double scalar, const Image< double > &img );
   template Image< double > &operator-=( Image< double > &img, double scalar );
-  template Image< double > operator*( const Image< double > &img, double scalar );
-  template Image< double > operator*( double scalar, const Image< double > &img );
   template Image< double > &operator*=( Image< double > &img, double scalar );
-  template Image< double > operator/( const Image< double > &img, double scalar );
-  template Image< double > operator/( double scalar, const Image< double > &img );
   template Image< double > &operator/=( Image< double > &img, double scalar );
 
   template Image< Color > operator+( const Image< Color > &img1, const Image< Color > &img2 );
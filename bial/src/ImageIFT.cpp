@@ -20,13 +20,16 @@
 
 #include "AdjacencyIterator.hpp"
 #include "BucketQueue.hpp"
+#include "GrowingBucketQueue.hpp"
+#include "ImageIFTEngine.hpp"
 
 namespace Bial {
 
   template< class D >
   ImageIFT< D >::ImageIFT( Image< D > &value, const Adjacency &adjacency, PathFunction< Image, D > *function,
                            BucketQueue *queue ) try :
-    DegeneratedIFT< Image, D >( value, function, queue ), adjacency( adjacency ), stop_elm( value.size( ) ) {
+    DegeneratedIFT< Image, D >( value, function, queue ), adjacency( adjacency ), stop_elm( value.size( ) ),
+    editing( false ), block_bucket_size( 0.0 ) {
       if( value.Dims( ) != adjacency.Dims( ) ) {
         std::string msg( BIAL_ERROR( "Image and adjacency relation dimensions do not match. Image dimensions: " +
                                      std::to_string( value.Dims( ) ) + ", adjacency dimensions: " +
@@ -56,31 +59,16 @@ namespace Bial {
   void ImageIFT< D >::Run( ) {
     try {
       COMMENT( "Running Image IFT. Queue: " << ( this->queue->Empty( ) ? "empty" : "not empty" ), 0 );
-      AdjacencyIterator adj_itr( this->value, adjacency );
-      size_t adj_size = adjacency.size( );
-      size_t adj_index;
-      size_t index = std::numeric_limits< size_t >::max( );
-      while( ( !this->queue->Empty( ) ) && ( index != stop_elm ) ) {
-        COMMENT( "Initializing removed data.", 4 );
-        index = this->queue->Remove( );
-        bool capable = ( this->function->*( this->function->RemoveData ) )( index, this->queue->State( index ) );
-        COMMENT( "Index: " << index << ", value: " << this->value[ index ] << ", is capable: " <<
-                 ( capable ? "true" : "false" ), 4 );
-        this->queue->Finished( index );
-        if( capable ) {
-          for( size_t adj = 0; adj < adj_size; ++adj ) {
-            if( ( adj_itr.AdjIdx( index, adj, adj_index ) ) &&
-                ( this->queue->State( adj_index ) != BucketState::REMOVED ) &&
-                ( this->function->Capable( index, adj_index, this->queue->State( adj_index ) ) ) ) {
-              COMMENT( "Conquering: " << adj_index, 4 );
-              D previous_value = this->value[ adj_index ];
-              COMMENT( "previous_value: " << previous_value, 4 );
-              if( ( this->function->*( this->function->PropagateData ) )( index, adj_index, adj ) )
-                this->queue->Update( adj_index, previous_value, this->value[ adj_index ] );
-            }
-          }
-        }
+      if( block_bucket_size > 0.0 ) {
+        ParallelRun( );
+        editing = false;
+        return;
       }
+      ImageIFTEngine< D, PathFunction< Image, D >, BucketQueue > engine( this->value, adjacency, this->function,
+                                                                         this->queue );
+      engine.EnableStopElement( stop_elm );
+      engine.Run( );
+      editing = false;
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -111,6 +99,302 @@ namespace Bial {
     stop_elm = this->value.size( );
   }
 
+  template< class D >
+  void ImageIFT< D >::PrepareEdit( ) {
+    if( editing )
+      return;
+    if( ( this->function->Label( ) == nullptr ) || ( this->function->Predecessor( ) == nullptr ) ) {
+      std::string msg( BIAL_ERROR( "Differential IFT requires label and predecessor maps." ) );
+      throw( std::logic_error( msg ) );
+    }
+    this->function->DifferentialPropagation( true );
+    COMMENT( "Queue states are reset only after complete runs. Otherwise, queued elements would be lost.", 2 );
+    if( this->queue->Empty( ) )
+      this->queue->ResetState( );
+    editing = true;
+  }
+
+  template< class D >
+  void ImageIFT< D >::AddSeeds( const Vector< size_t > &seeds, D seed_value ) {
+    try {
+      PrepareEdit( );
+      Image< bial_index > &predecessor( *this->function->Predecessor( ) );
+      for( size_t idx = 0; idx < seeds.size( ); ++idx ) {
+        size_t elm = seeds[ idx ];
+        D previous_value = this->value[ elm ];
+        this->value[ elm ] = seed_value;
+        predecessor[ elm ] = -1;
+        if( this->queue->State( elm ) == BucketState::NOT_VISITED )
+          this->queue->Insert( elm, seed_value );
+        else {
+          COMMENT( "Seed was queued as frontier element. It is moved and becomes a root.", 3 );
+          this->queue->Update( elm, previous_value, seed_value );
+          this->queue->State( elm, BucketState::INSERTED );
+        }
+      }
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  void ImageIFT< D >::RemoveSeeds( const Vector< size_t > &seeds ) {
+    try {
+      PrepareEdit( );
+      Image< bial_index > &predecessor( *this->function->Predecessor( ) );
+      D worst = this->function->Increasing( ) ? std::numeric_limits< D >::max( ) :
+        std::numeric_limits< D >::lowest( );
+      AdjacencyIterator adj_itr( this->value, adjacency );
+      size_t adj_size = adjacency.size( );
+      size_t adj_index;
+      COMMENT( "Removing trees rooted at the given seeds.", 1 );
+      Vector< size_t > tree;
+      Vector< size_t > frontier;
+      for( size_t idx = 0; idx < seeds.size( ); ++idx ) {
+        size_t elm = seeds[ idx ];
+        if( ( predecessor[ elm ] == -1 ) && ( this->value[ elm ] != worst ) &&
+            ( this->queue->State( elm ) == BucketState::NOT_VISITED ) ) {
+          this->value[ elm ] = worst;
+          tree.push_back( elm );
+        }
+      }
+      while( !tree.empty( ) ) {
+        size_t index = tree.back( );
+        tree.pop_back( );
+        bool interior = adj_itr.Interior( index );
+        for( size_t adj = 1; adj < adj_size; ++adj ) {
+          if( adj_itr.AdjIdx( index, adj, adj_index, interior ) ) {
+            if( predecessor[ adj_index ] == static_cast< bial_index >( index ) ) {
+              this->value[ adj_index ] = worst;
+              predecessor[ adj_index ] = -1;
+              tree.push_back( adj_index );
+            }
+            else if( this->value[ adj_index ] != worst )
+              frontier.push_back( adj_index );
+          }
+        }
+      }
+      COMMENT( "Queueing frontier elements with their current values. They are not roots.", 1 );
+      for( size_t idx = 0; idx < frontier.size( ); ++idx ) {
+        size_t elm = frontier[ idx ];
+        if( ( this->value[ elm ] != worst ) && ( this->queue->State( elm ) == BucketState::NOT_VISITED ) )
+          this->queue->Update( elm, this->value[ elm ], this->value[ elm ] );
+      }
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  void ImageIFT< D >::EnableParallel( ldbl bucket_size ) {
+    if( bucket_size <= 0.0 ) {
+      std::string msg( BIAL_ERROR( "Bucket size must be positive. Given: " + std::to_string( bucket_size ) ) );
+      throw( std::logic_error( msg ) );
+    }
+    block_bucket_size = bucket_size;
+  }
+
+  template< class D >
+  void ImageIFT< D >::DisableParallel( ) {
+    block_bucket_size = 0.0;
+  }
+
+  template< class D >
+  void ImageIFT< D >::ParallelRun( ) {
+    try {
+      size_t size = this->value.size( );
+      if( stop_elm != size ) {
+        std::string msg( BIAL_ERROR( "Stop element is not supported by parallel IFT." ) );
+        throw( std::logic_error( msg ) );
+      }
+      ThreadPool &pool = ThreadPool::Global( );
+      size_t x_size = this->value.size( 0 );
+      size_t rows = size / x_size;
+      size_t blocks = std::min( pool.Threads( ), rows );
+      if( blocks < 2 ) {
+        ImageIFTEngine< D, PathFunction< Image, D >, BucketQueue > engine( this->value, adjacency, this->function,
+                                                                           this->queue );
+        engine.Run( );
+        return;
+      }
+      size_t block_size = ( ( rows + blocks - 1 ) / blocks ) * x_size;
+      blocks = ( size + block_size - 1 ) / block_size;
+      COMMENT( "Initializing seeds as roots in queue order. Blocks: " << blocks << ".", 0 );
+      bool increasing = this->function->Increasing( );
+      int next_label = this->function->NextLabel( );
+      Vector< size_t > queued;
+      Vector< D > queued_value;
+      Vector< bool > inserted;
+      bool rooted = true;
+      Vector< Vector< size_t > > block_seeds( blocks, Vector< size_t >( ) );
+      while( !this->queue->Empty( ) ) {
+        size_t index = this->queue->Remove( );
+        queued.push_back( index );
+        queued_value.push_back( this->value[ index ] );
+        inserted.push_back( this->queue->State( index ) == BucketState::INSERTED );
+        if( ( this->function->*( this->function->RemoveData ) )( index, this->queue->State( index ) ) )
+          block_seeds[ index / block_size ].push_back( index );
+        else
+          rooted = false;
+        this->queue->Finished( index );
+      }
+      COMMENT( "Paths are not better than their roots, so no path value beats the best root value. Sequential IFT "
+               << "keeps the queued value of a seed only if no path beats it before the seed is removed.", 0 );
+      if( ( rooted ) && ( !queued.empty( ) ) ) {
+        D best = this->value[ queued[ 0 ] ];
+        for( size_t idx = 1; idx < queued.size( ); ++idx )
+          best = increasing ? std::min( best, this->value[ queued[ idx ] ] ) :
+            std::max( best, this->value[ queued[ idx ] ] );
+        for( size_t idx = 0; ( idx < queued.size( ) ) && ( rooted ); ++idx )
+          rooted = increasing ? !( best < queued_value[ idx ] ) : !( queued_value[ idx ] < best );
+      }
+      if( !rooted ) {
+        COMMENT( "Some seed may be conquered by other seeds. Undoing the roots and running sequential IFT.", 0 );
+        this->function->NextLabel( next_label );
+        for( size_t pos = 0; pos < queued.size( ); ++pos ) {
+          size_t idx = this->queue->Fifo( ) ? pos : queued.size( ) - 1 - pos;
+          size_t index = queued[ idx ];
+          this->value[ index ] = queued_value[ idx ];
+          if( inserted[ idx ] )
+            this->queue->Insert( index, queued_value[ idx ] );
+          else
+            this->queue->Update( index, queued_value[ idx ], queued_value[ idx ] );
+        }
+        ImageIFTEngine< D, PathFunction< Image, D >, BucketQueue > engine( this->value, adjacency, this->function,
+                                                                           this->queue );
+        engine.Run( );
+        return;
+      }
+      COMMENT( "Running IFT inside blocks.", 0 );
+      pool.Run( blocks, [ & ]( size_t blk, size_t ) {
+        BlockRun( blk * block_size, std::min( ( blk + 1 ) * block_size, size ), block_seeds[ blk ] );
+      } );
+      COMMENT( "Collecting reached elements that are adjacent to other blocks.", 0 );
+      AdjacencyIterator adj_itr( this->value, adjacency );
+      size_t adj_size = adjacency.size( );
+      size_t reach = 0;
+      for( size_t adj = 0; adj < adj_size; ++adj )
+        reach = std::max( reach, static_cast< size_t >( std::abs( adj_itr.Displacement( adj ) ) ) );
+      D worst = this->function->Increasing( ) ? std::numeric_limits< D >::max( ) :
+        std::numeric_limits< D >::lowest( );
+      Vector< Vector< size_t > > borders( blocks, Vector< size_t >( ) );
+      pool.Run( blocks, [ & ]( size_t blk, size_t ) {
+        size_t begin = blk * block_size;
+        size_t end = std::min( begin + block_size, size );
+        size_t adj_index;
+        for( size_t index = begin; index < end; ++index ) {
+          if( ( index == begin + reach ) && ( end > begin + 2 * reach ) )
+            index = end - reach;
+          if( this->value[ index ] == worst )
+            continue;
+          for( size_t adj = 0; adj < adj_size; ++adj ) {
+            if( ( adj_itr.AdjIdx( index, adj, adj_index ) ) && ( ( adj_index < begin ) || ( adj_index >= end ) ) ) {
+              borders[ blk ].push_back( index );
+              break;
+            }
+          }
+        }
+      } );
+      COMMENT( "Repairing paths that cross block borders.", 0 );
+      this->queue->ResetState( );
+      for( size_t blk = 0; blk < blocks; ++blk ) {
+        for( size_t idx = 0; idx < borders[ blk ].size( ); ++idx ) {
+          size_t index = borders[ blk ][ idx ];
+          this->queue->Update( index, this->value[ index ], this->value[ index ] );
+        }
+      }
+      auto propagate = this->function->PropagateData;
+      this->function->DifferentialPropagation( true );
+      ImageIFTEngine< D, PathFunction< Image, D >, BucketQueue > engine( this->value, adjacency, this->function,
+                                                                         this->queue );
+      engine.Run( );
+      this->function->PropagateData = propagate;
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  void ImageIFT< D >::BlockRun( size_t begin, size_t end, const Vector< size_t > &seeds ) {
+    /*
+     * The path function is shared by all blocks. It is safe, as seeds were rooted before, and queued as updated
+     * elements, so that removal functions never create roots nor change the next label here. Propagation only
+     * reads the maps at both ends of an arc, and writes them at the adjacent element, and both are inside the
+     * block. Members of the path functions, as handicap and distances, are only read.
+     */
+    PathFunction< Image, D > *function = this->function;
+    GrowingBucketQueue queue( end - begin, block_bucket_size, this->queue->Increasing( ), this->queue->Fifo( ) );
+    COMMENT( "Seeds were initialized as roots. They are queued as updated elements.", 2 );
+    for( size_t idx = 0; idx < seeds.size( ); ++idx )
+      queue.Update( seeds[ idx ] - begin, this->value[ seeds[ idx ] ], this->value[ seeds[ idx ] ] );
+    AdjacencyIterator adj_itr( this->value, adjacency );
+    size_t adj_size = adjacency.size( );
+    size_t adj_index;
+    while( !queue.Empty( ) ) {
+      size_t local = queue.Remove( );
+      size_t index = begin + local;
+      bool capable = ( function->*( function->RemoveData ) )( index, queue.State( local ) );
+      queue.Finished( local );
+      if( capable ) {
+        bool interior = adj_itr.Interior( index );
+        for( size_t adj = 0; adj < adj_size; ++adj ) {
+          if( ( adj_itr.AdjIdx( index, adj, adj_index, interior ) ) && ( adj_index >= begin ) &&
+              ( adj_index < end ) ) {
+            size_t adj_local = adj_index - begin;
+            BucketState adj_state = queue.State( adj_local );
+            if( ( adj_state != BucketState::REMOVED ) && ( function->Capable( index, adj_index, adj_state ) ) ) {
+              D previous_value = this->value[ adj_index ];
+              if( ( function->*( function->PropagateData ) )( index, adj_index, adj ) )
+                queue.Update( adj_local, previous_value, this->value[ adj_index ] );
+            }
+          }
+        }
+      }
+    }
+  }
+
 #ifdef BIAL_EXPLICIT_ImageIFT
 
   template class ImageIFT< int >;
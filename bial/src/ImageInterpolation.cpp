@@ -20,6 +20,7 @@
 
 #include "Image.hpp"
 #include "PixelInterpolation.hpp"
+#include "Resampling.hpp"
 
 namespace Bial {
 
@@ -59,7 +60,12 @@ namespace Bial {
       Vector< float > img_size( 2 );
       img_size[ 0 ] = std::round( img.size( 0 ) * factor_x );
       img_size[ 1 ] = std::round( img.size( 1 ) * factor_y );
-      Image< D > res( img_size, pxl_size );
+      Image< D > res;
+      COMMENT( "Library interpolations are inlined by the separable resampling engine.", 0 );
+      Vector< size_t > dim = { static_cast< size_t >( img_size[ 0 ] ), static_cast< size_t >( img_size[ 1 ] ) };
+      if( Resampling::Separable( img, dim, pxl_size, { delta_x, delta_y }, { 0.0, 0.0 }, interpolation_type, res ) )
+        return( res );
+      res = Image< D >( img_size, pxl_size );
       COMMENT( "Running interpolation for all new pixels.", 0 );
       float src_y = 0;
       for( size_t tgt_y = 0; tgt_y < img_size[ 1 ]; ++tgt_y, src_y += delta_y ) {
@@ -137,7 +143,14 @@ namespace Bial {
       img_size[ 1 ] = std::round( img.size( 1 ) * factor_y );
       img_size[ 2 ] = std::round( img.size( 2 ) * factor_z );
       COMMENT( "image size: " << img_size, 0 );
-      Image< D > res( img_size, pxl_size );
+      Image< D > res;
+      COMMENT( "Library interpolations are inlined by the separable resampling engine.", 0 );
+      Vector< size_t > dim = { static_cast< size_t >( img_size[ 0 ] ), static_cast< size_t >( img_size[ 1 ] ),
+                               static_cast< size_t >( img_size[ 2 ] ) };
+      if( Resampling::Separable( img, dim, pxl_size, { delta_x, delta_y, delta_z }, { 0.0, 0.0, 0.0 },
+                                 interpolation_type, res ) )
+        return( res );
+      res = Image< D >( img_size, pxl_size );
       COMMENT( "Running interpolation for all new pixels.", 0 );
       float src_z = 0;
       for( size_t tgt_z = 0; tgt_z < img_size[ 2 ]; ++tgt_z, src_z += delta_z ) {
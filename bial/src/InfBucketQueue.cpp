@@ -27,7 +27,7 @@
 namespace Bial {
 
   InfBucketQueue::InfBucketQueue( size_t size, llint bucket_size, llint inf_val, bool increasing_order, bool fifo_tie )
-  try : identity( Vector< IdentityNode >( size, IdentityNode( ) ) ), 
+  try : identity( Vector< IdentityNode >( IdentityNode::CheckedSize( size ), IdentityNode( ) ) ), 
           weight( Vector< WeightNode >( std::min( static_cast< size_t >( 256 ), sizeof( ldbl ) * 255 + 1 ),
                                         WeightNode( ) ) ), minimum( 0 ), maximum( 0 ), delta( bucket_size ), 
           elements( 0 ), increasing( increasing_order ), fifo( fifo_tie ), inf_elements( 0 ), infinite_val( inf_val ) {
@@ -241,9 +241,9 @@ namespace Bial {
       }
       COMMENT( "Found index: " << current_weight, 3 );
       --elements;
-      int idt = weight( current_weight ).first;
+      bial_index idt = weight( current_weight ).first;
       COMMENT( "idt: " << idt, 3 );
-      int next = identity( idt ).next;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing idt: " << idt << ", weight_idx: " << current_weight << ", prev: " << 
                identity( idt ).prev << ", next:" << next, 3 );
       weight( current_weight ).first = next;
@@ -283,8 +283,8 @@ namespace Bial {
       }
       COMMENT( "Removing element " << idt << " with weight " << wgt << ".", 3 );
       size_t weight_idx = Index( wgt );
-      int prev = identity( idt ).prev;
-      int next = identity( idt ).next;
+      bial_index prev = identity( idt ).prev;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing for update! elements: " << elements << ", infinite elements: " << inf_elements <<
                ", minimum: " << minimum << ", maximum: " << maximum << ", idt: " << idt << ", wgt: " << 
                wgt << ", weight_idx: " << weight_idx << ", previous: " << prev << ", next:" << next << ", first: " << 
@@ -294,7 +294,7 @@ namespace Bial {
         COMMENT( "Removed infinite element. Elements: " << elements << ", infs: " << inf_elements, 3 );
         --inf_elements;
       }
-      if( weight( weight_idx ).first == static_cast< int >( idt ) ) {
+      if( weight( weight_idx ).first == static_cast< bial_index >( idt ) ) {
         COMMENT( "idt is the first element.", 4 );
         weight( weight_idx ).first = next;
         if( next == -1 ) {
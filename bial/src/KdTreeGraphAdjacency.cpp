@@ -0,0 +1,225 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Exact knn graph adjacency computed by searching a kd-tree over the feature vector.
+ */
+
+#ifndef BIALKDTREEGRAPHADJACENCY_C
+#define BIALKDTREEGRAPHADJACENCY_C
+
+#include "KdTreeGraphAdjacency.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_KdTreeGraphAdjacency )
+#define BIAL_EXPLICIT_KdTreeGraphAdjacency
+#endif
+
+#if defined ( BIAL_EXPLICIT_KdTreeGraphAdjacency ) || ( BIAL_IMPLICIT_BIN )
+
+#include "DFIDE.hpp"
+#include "Feature.hpp"
+#include "Sample.hpp"
+#include <numeric>
+
+namespace Bial {
+
+  template< class D >
+  void KdTreeGraphAdjacency::Initialize( const Feature< D > &feature, const Sample &sample, float scl_min,
+                                         float scl_max ) {
+    try {
+      COMMENT( "Computing the number of neighbors based on the given scale.", 1 );
+      EstimateK( feature, scl_min, scl_max, MAX_SAMPLES );
+      size_t scales = scale.size( );
+      COMMENT( "Scales: " << scale, 2 );
+      COMMENT( "Initializing other structures.", 1 );
+      size_t elements = sample.size( );
+      size_t kmax = scale( scales - 1 );
+      COMMENT( "Samples: " << elements << ", kmax: " << kmax, 1 );
+      arc = Matrix< size_t >( elements, kmax );
+      arc_weight = Matrix< double >( elements, kmax );
+      null_heterogeneous_size = Vector< size_t >( 0 );
+      COMMENT( "Picking the correct feature vector.", 1 );
+      Feature< D > subfeature = elements < feature.Elements( ) ? Feature< D >( feature, sample ) :
+        Feature< D >( 1, 1 );
+      const Feature< D > &used_feature = elements < feature.Elements( ) ? subfeature : feature;
+      size_t features = used_feature.Features( );
+      const D *data = used_feature.data( );
+
+      COMMENT( "Building the tree. Nodes split their samples at the median of the dimension of largest spread.", 1 );
+      Vector< size_t > order( elements );
+      std::iota( order.begin( ), order.end( ), 0 );
+      std::vector< KdTreeNode > node( 1, KdTreeNode{ 0, elements, 0, 0, 0 } );
+      std::vector< D > split( 1, 0 );
+      std::vector< size_t > pending( 1, 0 );
+      size_t max_leaf = 1;
+      while( !pending.empty( ) ) {
+        size_t nod = pending.back( );
+        pending.pop_back( );
+        size_t begin = node[ nod ].begin;
+        size_t end = node[ nod ].end;
+        if( end - begin > LEAF_SIZE ) {
+          size_t dim = 0;
+          double max_spread = 0.0;
+          for( size_t ftr = 0; ftr < features; ++ftr ) {
+            D min_val = data[ order[ begin ] * features + ftr ];
+            D max_val = min_val;
+            for( size_t pos = begin + 1; pos < end; ++pos ) {
+              D val = data[ order[ pos ] * features + ftr ];
+              min_val = std::min( min_val, val );
+              max_val = std::max( max_val, val );
+            }
+            double spread = static_cast< double >( max_val ) - static_cast< double >( min_val );
+            if( spread > max_spread ) {
+              max_spread = spread;
+              dim = ftr;
+            }
+          }
+          if( max_spread > 0.0 ) {
+            COMMENT( "Left child values in dim are not greater than the median, right child ones not smaller.", 4 );
+            size_t mid = ( begin + end ) / 2;
+            std::nth_element( order.begin( ) + begin, order.begin( ) + mid, order.begin( ) + end,
+                              [ data, features, dim ]( size_t lhs, size_t rhs ) {
+                                return( data[ lhs * features + dim ] < data[ rhs * features + dim ] );
+                              } );
+            split[ nod ] = data[ order[ mid ] * features + dim ];
+            node[ nod ].dim = dim;
+            node[ nod ].left = node.size( );
+            node[ nod ].right = node.size( ) + 1;
+            node.push_back( KdTreeNode{ begin, mid, 0, 0, 0 } );
+            node.push_back( KdTreeNode{ mid, end, 0, 0, 0 } );
+            split.resize( node.size( ), 0 );
+            pending.push_back( node.size( ) - 1 );
+            pending.push_back( node.size( ) - 2 );
+            continue;
+          }
+        }
+        COMMENT( "Leaf node. Nodes with equal samples may be larger than LEAF_SIZE.", 4 );
+        max_leaf = std::max( max_leaf, end - begin );
+      }
+      COMMENT( "Tree nodes: " << node.size( ) << ", largest leaf: " << max_leaf, 1 );
+      COMMENT( "Copying the samples in tree order, so that leaves are contiguous blocks.", 1 );
+      Vector< D > point( elements * features );
+      for( size_t pos = 0; pos < elements; ++pos ) {
+        std::copy( data + order[ pos ] * features, data + ( order[ pos ] + 1 ) * features,
+                   point.data( ) + pos * features );
+      }
+
+      COMMENT( "Searching the adjacent samples.", 1 );
+      auto search = [ & ]( size_t tsk, size_t tasks ) {
+        size_t min_src = tsk * elements / tasks;
+        size_t max_src = ( tsk + 1 ) * elements / tasks;
+        Vector< double > distance( max_leaf );
+        std::vector< std::pair< double, size_t > > best;
+        best.reserve( kmax );
+        std::vector< std::pair< size_t, double > > stack;
+        for( size_t src = min_src; src < max_src; ++src ) {
+          COMMENT( "Setting repeated samples to zero.", 3 );
+          size_t equal_samples = std::min( sample.size( src ) - 1, kmax );
+          for( size_t knn = 0; knn < equal_samples; ++knn ) {
+            arc_weight( src, knn ) = 0.0;
+            arc( src, knn ) = src;
+          }
+          size_t needed = kmax - equal_samples;
+          if( needed == 0 )
+            continue;
+          COMMENT( "Max-heap of the nearest samples, ordered by distance and then by index.", 4 );
+          best.clear( );
+          stack.clear( );
+          stack.push_back( std::make_pair( static_cast< size_t >( 0 ), 0.0 ) );
+          const D *query = data + src * features;
+          while( !stack.empty( ) ) {
+            size_t nod = stack.back( ).first;
+            double bound = stack.back( ).second;
+            stack.pop_back( );
+            if( ( best.size( ) == needed ) && ( bound > best.front( ).first ) )
+              continue;
+            const KdTreeNode &cur = node[ nod ];
+            if( cur.left == 0 ) {
+              size_t size = cur.end - cur.begin;
+              DFIDE::Distances( query, point.data( ) + cur.begin * features, size, features, distance.data( ) );
+              for( size_t pos = 0; pos < size; ++pos ) {
+                std::pair< double, size_t > candidate( distance[ pos ], order[ cur.begin + pos ] );
+                if( candidate.second == src )
+                  continue;
+                if( best.size( ) < needed ) {
+                  best.push_back( candidate );
+                  std::push_heap( best.begin( ), best.end( ) );
+                }
+                else if( candidate < best.front( ) ) {
+                  std::pop_heap( best.begin( ), best.end( ) );
+                  best.back( ) = candidate;
+                  std::push_heap( best.begin( ), best.end( ) );
+                }
+              }
+            }
+            else {
+              double plane;
+              DFIDE::Distances( query + cur.dim, &split[ nod ], 1, 1, &plane );
+              size_t near = ( query[ cur.dim ] < split[ nod ] ) ? cur.left : cur.right;
+              size_t far = ( near == cur.left ) ? cur.right : cur.left;
+              stack.push_back( std::make_pair( far, std::max( bound, plane ) ) );
+              stack.push_back( std::make_pair( near, bound ) );
+            }
+          }
+          std::sort_heap( best.begin( ), best.end( ) );
+          for( size_t knn = 0; knn < best.size( ); ++knn ) {
+            arc_weight( src, equal_samples + knn ) = best[ knn ].first;
+            arc( src, equal_samples + knn ) = best[ knn ].second;
+          }
+          for( size_t knn = equal_samples + best.size( ); knn < kmax; ++knn )
+            arc_weight( src, knn ) = std::numeric_limits< double >::max( );
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( elements ), search );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        search( 0, 1 );
+      }
+      COMMENT( "Graph arcs: " << arc, 3 );
+      COMMENT( "Arc weights: " << arc_weight, 3 );
+      RankReverseArcs( );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  /* Initializing Graphs Maximum samples. */
+  const size_t KdTreeGraphAdjacency::MAX_SAMPLES = 100000;
+
+#ifdef BIAL_EXPLICIT_KdTreeGraphAdjacency
+
+  template void KdTreeGraphAdjacency::Initialize( const Feature< int > &feature, const Sample &sample,
+                                                  float scl_min, float scl_max );
+  template void KdTreeGraphAdjacency::Initialize( const Feature< llint > &feature, const Sample &sample,
+                                                  float scl_min, float scl_max );
+  template void KdTreeGraphAdjacency::Initialize( const Feature< float > &feature, const Sample &sample,
+                                                  float scl_min, float scl_max );
+  template void KdTreeGraphAdjacency::Initialize( const Feature< double > &feature, const Sample &sample,
+                                                  float scl_min, float scl_max );
+
+#endif
+
+}
+
+#endif
+
+#endif
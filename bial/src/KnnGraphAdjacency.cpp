@@ -21,6 +21,7 @@
 #include "DFIDE.hpp"
 #include "Feature.hpp"
 #include "Sample.hpp"
+#include <numeric>
 
 namespace Bial {
 
@@ -46,6 +47,8 @@ namespace Bial {
       COMMENT( "Used feature elements: " << used_feature.Elements( ) << ", features: " << used_feature.Features( ), 1 );
       COMMENT( "Features: " << used_feature, 3 );
       COMMENT( "Computing the adjacent samples.", 1 );
+      size_t features = used_feature.Features( );
+      Vector< double > distance( elements );
       for( size_t src = 0; src < elements; ++src ) {
         COMMENT( "Setting repeated samples to zero.", 3 );
         size_t equal_samples = std::min( sample.size( src ) - 1, kmax );
@@ -59,16 +62,13 @@ namespace Bial {
         }
         COMMENT( "Checking if more arcs are necessary as there are not enough equal features.", 4 );
         if( equal_samples < kmax ) {
-          COMMENT( "Compute and sort the nearst kmax of each node.", 4 );
+          COMMENT( "Compute the distances to all nodes in a block and sort the nearst kmax of each node.", 4 );
+          DFIDE::Distances( used_feature.data( ) + src * features, used_feature.data( ), elements, features,
+                            distance.data( ) );
           for( size_t tgt = 0; tgt < elements; ++tgt ) {
             if( tgt != src ) {
-              COMMENT( "src: " << src << ", tgt: " << tgt << ", dms: " << used_feature.Features( ), 4 );
-              double dist = DFIDE::Distance( used_feature, src * used_feature.Features( ),
-                                             tgt * used_feature.Features( ), used_feature.Features( ) );
-              /*
-               * double dist = ( *BialDistanceFunction )( &used_feature( src, 0 ), &used_feature( tgt, 0 ),
-               * used_feature.Features( ) );
-               */
+              COMMENT( "src: " << src << ", tgt: " << tgt << ", dms: " << features, 4 );
+              double dist = distance[ tgt ];
               size_t index = tgt;
               for( size_t knn = equal_samples; knn < kmax; ++knn ) {
                 if( dist < arc_weight( src, knn ) ) {
@@ -85,6 +85,7 @@ namespace Bial {
       }
       COMMENT( "Graph arcs: " << arc, 3 );
       COMMENT( "Arc weights: " << arc_weight, 3 );
+      RankReverseArcs( );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -191,10 +192,11 @@ namespace Bial {
   }
 
   template< class D >
-  void KnnGraphAdjacency::EstimateK( const Feature< D > &feature, float scl_min, float scl_max ) {
+  void KnnGraphAdjacency::EstimateK( const Feature< D > &feature, float scl_min, float scl_max,
+                                     size_t max_samples ) {
     try {
       COMMENT( "Getting the maximum number of neighbors given params: " << scl_min << " to " << scl_max << ".", 1 );
-      size_t size = std::min( feature.Elements( ), MAX_SAMPLES ) - 1;
+      size_t size = std::min( feature.Elements( ), max_samples ) - 1;
       COMMENT( "Computing the power that satisfies: ( 0.1*size^( 1/p ) )^p = 2, so r = 0.1 implies k = 2.", 1 );
       float power = std::log( 2.0f / size ) / std::log( 0.1f );
       COMMENT( "size: " << size << ", power: " << power << ". Getting the required element indexes.", 1 );
@@ -256,14 +258,7 @@ namespace Bial {
           if( ( density( src ) + delta >= density( tgt ) ) &&
               ( density( src ) - delta <= density( tgt ) ) ) {
             COMMENT( "Insert src in heterogeneous adjacency of tgt, if src is not in knn adjacency of tgt.", 3 );
-            bool insert_src = true;
-            for( size_t bck = 0; bck < neighbors; ++bck ) {
-              if( arc( tgt, bck ) == src ) {
-                insert_src = false;
-                break;
-              }
-            }
-            if( insert_src ) {
+            if( reverse_rank( src, knn ) >= neighbors ) {
               plateau( tgt ).push_back( src );
             }
           }
@@ -289,6 +284,68 @@ namespace Bial {
     }
   }
 
+  void KnnGraphAdjacency::RankReverseArcs( ) {
+    try {
+      size_t elements = arc.size( 0 );
+      size_t kmax = arc.size( 1 );
+      COMMENT( "Sorting the arc positions of each sample by target, and then by position.", 2 );
+      Matrix< size_t > sorted( kmax, elements );
+      auto sort_arcs = [ & ]( size_t tsk, size_t tasks ) {
+        for( size_t src = tsk * elements / tasks; src < ( tsk + 1 ) * elements / tasks; ++src ) {
+          size_t *pos = &sorted( 0, src );
+          std::iota( pos, pos + kmax, 0 );
+          std::sort( pos, pos + kmax, [ this, src ]( size_t lhs, size_t rhs ) {
+            return( ( arc( src, lhs ) < arc( src, rhs ) ) ||
+                    ( ( arc( src, lhs ) == arc( src, rhs ) ) && ( lhs < rhs ) ) );
+          } );
+        }
+      };
+      COMMENT( "Finding the first position of src among the arcs of tgt by binary search.", 2 );
+      reverse_rank = Matrix< size_t >( elements, kmax );
+      auto rank_arcs = [ & ]( size_t tsk, size_t tasks ) {
+        for( size_t src = tsk * elements / tasks; src < ( tsk + 1 ) * elements / tasks; ++src ) {
+          for( size_t knn = 0; knn < kmax; ++knn ) {
+            size_t tgt = arc( src, knn );
+            const size_t *first = &sorted( 0, tgt );
+            const size_t *found = std::lower_bound( first, first + kmax, src, [ this, tgt ]( size_t pos, size_t val ) {
+              return( arc( tgt, pos ) < val );
+            } );
+            if( ( found != first + kmax ) && ( arc( tgt, *found ) == src ) )
+              reverse_rank( src, knn ) = *found;
+            else
+              reverse_rank( src, knn ) = kmax;
+          }
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( elements ), sort_arcs );
+        pool.Run( pool.Tasks( elements ), rank_arcs );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        sort_arcs( 0, 1 );
+        rank_arcs( 0, 1 );
+      }
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
   const Matrix< size_t > &KnnGraphAdjacency::HomogeneousAdjacency( ) const {
     return( arc );
   }
@@ -325,6 +382,20 @@ namespace Bial {
     }
   }
 
+  double KnnGraphAdjacency::Radius( size_t src, size_t scl ) const {
+    try {
+      return( arc_weight( src, scale( scl ) - 1 ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
   /* Initializing Graphs Maximum samples. */
   const size_t KnnGraphAdjacency::MAX_SAMPLES = 10000;
 
@@ -335,16 +406,20 @@ namespace Bial {
 
   template void KnnGraphAdjacency::Initialize( const Feature< int > &feature, const Sample &sample, float scl_min, 
                                                float scl_max );
-  template void KnnGraphAdjacency::EstimateK( const Feature< int > &feature, float scl_min, float scl_max );
+  template void KnnGraphAdjacency::EstimateK( const Feature< int > &feature, float scl_min, float scl_max,
+                                              size_t max_samples );
   template void KnnGraphAdjacency::Initialize( const Feature< llint > &feature, const Sample &sample, float scl_min,
                                                float scl_max );
-  template void KnnGraphAdjacency::EstimateK( const Feature< llint > &feature, float scl_min, float scl_max );
+  template void KnnGraphAdjacency::EstimateK( const Feature< llint > &feature, float scl_min, float scl_max,
+                                              size_t max_samples );
   template void KnnGraphAdjacency::Initialize( const Feature< float > &feature, const Sample &sample, float scl_min,
                                                float scl_max );
-  template void KnnGraphAdjacency::EstimateK( const Feature< float > &feature, float scl_min, float scl_max );
+  template void KnnGraphAdjacency::EstimateK( const Feature< float > &feature, float scl_min, float scl_max,
+                                              size_t max_samples );
   template void KnnGraphAdjacency::Initialize( const Feature< double > &feature, const Sample &sample, float scl_min,
                                                float scl_max );
-  template void KnnGraphAdjacency::EstimateK( const Feature< double > &feature, float scl_min, float scl_max );
+  template void KnnGraphAdjacency::EstimateK( const Feature< double > &feature, float scl_min, float scl_max,
+                                              size_t max_samples );
 
 #endif
 
@@ -21,17 +21,10 @@
 #include "DFIDE.hpp"
 #include "Feature.hpp"
 #include "Sample.hpp"
+#include <memory>
 
 namespace Bial {
 
-  LSHGraphAdjacency::~LSHGraphAdjacency( ) {
-    COMMENT( "Freeing LSH internal structure.", 0 );
-    if( initialized ) {
-      LSH_Free( );
-      initialized = false;
-    }
-  }
-
   template< class D >
   void LSHGraphAdjacency::Initialize( const Feature< D > &feature, const Sample &sample, float scl_min, 
                                       float scl_max ) {
@@ -52,41 +45,55 @@ namespace Bial {
       COMMENT( "Features: " << subfeature, 3 );
       COMMENT( "Initializing LSH.", 1 );
       float rmax = scale( scales - 1 );
-      if( !initialized ) {
-        LSH_Init( &subfeature( 0, 0 ), elements, subfeature.Features( ), &rmax, 1 );
-        initialized = true;
-      }
-      COMMENT( "Creating LSH structures.", 1 );
-      Vector< int > index( elements - 1 );
-      Vector< float > distance( elements - 1 );
-      COMMENT( "Computing the adjacent samples.", 1 )
-      for( size_t src = 0; src < elements; ++src ) {
-        /*
-         * COMMENT( "Setting repeated samples to zero.", 4 );
-         * size_t equal_samples = sample.size( src ) - 1;
-         * for( size_t adj = 0; adj < equal_samples; ++adj ) {
-         *   arc_weight( src ).push_back( 0.0 );
-         *   arc( src ).push_back( src );
-         * }
-         */
-        COMMENT( "Getting adjacents in radius by LSH.", 4 );
-        size_t adjs = LSH_Query( src, rmax, &( index( 0 ) ), &( distance( 0 ) ) );
-        COMMENT( "Copying adjacents to LSHGraphAdjacency.", 4 );
-        size_t scl = 0;
-        for( size_t adj = 0; adj < adjs; ++adj ) {
-          arc( src ).push_back( index( adj ) );
-          arc_weight( src ).push_back( distance( adj ) );
-          COMMENT( "Computing the number of adjacents for a given scale for src sample.", 4 );
-          while( ( scl < scales ) && ( scale( scl ) < distance( adj ) ) ) {
-            adjacents( scl ) ( src ) = adj;
+      std::unique_ptr< _LSHIndexT, void( * )( PLSHIndexT ) >
+      lsh( LSH_Init( &subfeature( 0, 0 ), elements, subfeature.Features( ), &rmax, 1 ), LSH_Free );
+      COMMENT( "Computing the adjacent samples.", 1 );
+      auto query = [ & ]( size_t tsk, size_t tasks ) {
+        size_t min_src = tsk * elements / tasks;
+        size_t max_src = ( tsk + 1 ) * elements / tasks;
+        COMMENT( "Creating LSH structures.", 1 );
+        std::unique_ptr< _LSHQueryT, void( * )( PLSHQueryT ) > lsh_query( LSH_NewQuery( lsh.get( ) ),
+                                                                          LSH_FreeQuery );
+        Vector< int > index( std::max< size_t >( elements, 2 ) - 1 );
+        Vector< float > distance( std::max< size_t >( elements, 2 ) - 1 );
+        for( size_t src = min_src; src < max_src; ++src ) {
+          /*
+           * COMMENT( "Setting repeated samples to zero.", 4 );
+           * size_t equal_samples = sample.size( src ) - 1;
+           * for( size_t adj = 0; adj < equal_samples; ++adj ) {
+           *   arc_weight( src ).push_back( 0.0 );
+           *   arc( src ).push_back( src );
+           * }
+           */
+          COMMENT( "Getting adjacents in radius by LSH.", 4 );
+          size_t adjs = LSH_Query( lsh_query.get( ), src, rmax, &( index( 0 ) ), &( distance( 0 ) ) );
+          COMMENT( "Copying adjacents to LSHGraphAdjacency.", 4 );
+          size_t scl = 0;
+          for( size_t adj = 0; adj < adjs; ++adj ) {
+            arc( src ).push_back( index( adj ) );
+            arc_weight( src ).push_back( distance( adj ) );
+            COMMENT( "Computing the number of adjacents for a given scale for src sample.", 4 );
+            while( ( scl < scales ) && ( scale( scl ) < distance( adj ) ) ) {
+              adjacents( scl ) ( src ) = adj;
+              ++scl;
+            }
+          }
+          COMMENT( "Setting the number of adjacents for the scales that contain them all.", 4 );
+          while( scl < scales ) {
+            adjacents( scl ) ( src ) = adjs;
             ++scl;
           }
         }
-        COMMENT( "Setting the number of adjacents for the scales that contain them all.", 4 );
-        while( scl < scales ) {
-          adjacents( scl ) ( src ) = adjs;
-          ++scl;
-        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( elements ), query );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        arc = Vector< Vector< size_t > >( elements );
+        arc_weight = Vector< Vector< double > >( elements );
+        query( 0, 1 );
       }
       COMMENT( "Graph arcs: " << arc, 3 );
       COMMENT( "Arc weights: " << arc_weight, 3 );
@@ -294,12 +301,23 @@ namespace Bial {
     }
   }
 
+  double LSHGraphAdjacency::Radius( size_t, size_t scl ) const {
+    try {
+      return( scale( scl ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
   /* Initializing Graphs Maximum samples. */
   const size_t LSHGraphAdjacency::MAX_SAMPLES = 10000;
 
-  /* Initializing LSH global variable */
-  bool LSHGraphAdjacency::initialized = false;
-
 #ifdef BIAL_EXPLICIT_LSHGraphAdjacency
 
   template class GraphAdjacency< LSHGraphAdjacency >;
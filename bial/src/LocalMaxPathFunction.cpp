@@ -30,7 +30,7 @@ namespace Bial {
 
   template< template< class D > class C, class D >
   LocalMaxPathFunction< C, D >::LocalMaxPathFunction( C< D > &init_value, C< int > *init_label, 
-                                                      C< int > *init_predecessor, bool sequential_label ) try :
+                                                      C< bial_index > *init_predecessor, bool sequential_label ) try :
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ) {
     }
   catch( std::bad_alloc &e ) {
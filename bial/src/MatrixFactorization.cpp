@@ -0,0 +1,393 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief LU and Cholesky factorizations and solution of linear systems.
+ */
+
+#ifndef BIALMATRIXFACTORIZATION_C
+#define BIALMATRIXFACTORIZATION_C
+
+#include "MatrixFactorization.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_MatrixFactorization )
+#define BIAL_EXPLICIT_MatrixFactorization
+#endif
+
+#if defined ( BIAL_EXPLICIT_MatrixFactorization ) || ( BIAL_IMPLICIT_BIN )
+
+#include "Matrix.hpp"
+#include "MatrixProduct.hpp"
+
+namespace Bial {
+
+  namespace MatrixOp {
+
+    /** @brief Number of columns of a panel of the blocked LU factorization. */
+    const size_t LUBlock = 64;
+
+    /**
+     * @date 2026/Oct/18
+     * @param cols: Number of columns of the right-hand sides.
+     * @param size: Number of rows of the system.
+     * @param function: Solves the range of columns [ first, last ).
+     * @return none.
+     * @brief Splits the columns of the right-hand sides among the threads of the global pool.
+     * @warning none.
+     */
+    template< class F >
+    void SolveColumns( size_t cols, size_t size, const F &function ) {
+      auto columns = [ & ]( size_t tsk, size_t total_tasks ) {
+        function( cols * tsk / total_tasks, cols * ( tsk + 1 ) / total_tasks );
+      };
+      if( ( cols < 2 ) || ( cols * size * size < ProductParallelSize ) ) {
+        columns( 0, 1 );
+        return;
+      }
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( cols ), columns );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        columns( 0, 1 );
+      }
+    }
+
+  }
+
+  template< class D >
+  int MatrixOp::LU( const Matrix< D > &mat, Matrix< double > &lu, Vector< size_t > &pivot ) {
+    try {
+      if( mat.Dims( ) != 2 ) {
+        std::string msg( BIAL_ERROR( "Invalid number of dimensions. Expected 2." ) );
+        throw( std::logic_error( msg ) );
+      }
+      size_t size = mat.size( 0 );
+      if( size != mat.size( 1 ) ) {
+        std::string msg( BIAL_ERROR( "Matrix must be square." ) );
+        throw( std::logic_error( msg ) );
+      }
+      lu = Matrix< double >( mat );
+      pivot = Vector< size_t >( size );
+      for( size_t row = 0; row < size; ++row )
+        pivot[ row ] = row;
+      double *data = lu.Data( );
+      int sign = 1;
+      for( size_t first = 0; first < size; first += LUBlock ) {
+        size_t last = std::min( size, first + LUBlock );
+        COMMENT( "Factorizing the panel of columns from " << first << " to " << last << ".", 3 );
+        for( size_t col = first; col < last; ++col ) {
+          size_t max_row = col;
+          double max_value = std::abs( data[ col * size + col ] );
+          for( size_t row = col + 1; row < size; ++row ) {
+            if( max_value < std::abs( data[ row * size + col ] ) ) {
+              max_value = std::abs( data[ row * size + col ] );
+              max_row = row;
+            }
+          }
+          if( max_value == 0.0 )
+            return( 0 );
+          if( max_row != col ) {
+            std::swap_ranges( data + col * size, data + ( col + 1 ) * size, data + max_row * size );
+            std::swap( pivot[ col ], pivot[ max_row ] );
+            sign = -sign;
+          }
+          const double *pivot_row = data + col * size;
+          for( size_t row = col + 1; row < size; ++row ) {
+            double *row_data = data + row * size;
+            double factor = ( row_data[ col ] /= pivot_row[ col ] );
+            if( factor != 0.0 ) {
+              for( size_t elm = col + 1; elm < last; ++elm )
+                row_data[ elm ] -= factor * pivot_row[ elm ];
+            }
+          }
+        }
+        if( last == size )
+          break;
+        COMMENT( "Computing the block row of U.", 3 );
+        for( size_t row = first + 1; row < last; ++row ) {
+          double *row_data = data + row * size;
+          for( size_t col = first; col < row; ++col ) {
+            double factor = row_data[ col ];
+            const double *pivot_row = data + col * size;
+#pragma omp simd
+            for( size_t elm = last; elm < size; ++elm )
+              row_data[ elm ] -= factor * pivot_row[ elm ];
+          }
+        }
+        COMMENT( "Updating the trailing matrix.", 3 );
+        MatrixOp::Product( data + last * size + first, size, data + first * size + last, size,
+                           data + last * size + last, size, size - last, last - first, size - last, true );
+      }
+      return( sign );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  bool MatrixOp::Cholesky( const Matrix< D > &mat, Matrix< double > &lower ) {
+    try {
+      if( mat.Dims( ) != 2 ) {
+        std::string msg( BIAL_ERROR( "Invalid number of dimensions. Expected 2." ) );
+        throw( std::logic_error( msg ) );
+      }
+      size_t size = mat.size( 0 );
+      if( size != mat.size( 1 ) ) {
+        std::string msg( BIAL_ERROR( "Matrix must be square." ) );
+        throw( std::logic_error( msg ) );
+      }
+      lower = Matrix< double >( size, size );
+      const D *src = mat.Data( );
+      double *data = lower.Data( );
+      for( size_t row = 0; row < size; ++row ) {
+        double *row_data = data + row * size;
+        for( size_t col = 0; col <= row; ++col ) {
+          const double *col_data = data + col * size;
+          double sum = static_cast< double >( src[ row * size + col ] );
+          for( size_t elm = 0; elm < col; ++elm )
+            sum -= row_data[ elm ] * col_data[ elm ];
+          if( row != col )
+            row_data[ col ] = sum / col_data[ col ];
+          else if( sum > 0.0 )
+            row_data[ col ] = std::sqrt( sum );
+          else
+            return( false );
+        }
+      }
+      return( true );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void MatrixOp::LUSolve( const Matrix< double > &lu, const Vector< size_t > &pivot, Matrix< double > &rhs ) {
+    try {
+      size_t size = lu.size( 0 );
+      size_t cols = rhs.size( 0 );
+      if( ( rhs.Dims( ) != 2 ) || ( rhs.size( 1 ) != size ) ) {
+        std::string msg( BIAL_ERROR( "Right-hand sides must have as many rows as the system." ) );
+        throw( std::logic_error( msg ) );
+      }
+      COMMENT( "Permuting the rows of the right-hand sides.", 3 );
+      Matrix< double > res( cols, size );
+      for( size_t row = 0; row < size; ++row )
+        std::copy( rhs.Data( ) + pivot[ row ] * cols, rhs.Data( ) + ( pivot[ row ] + 1 ) * cols,
+                   res.Data( ) + row * cols );
+      const double *data = lu.Data( );
+      double *sol = res.Data( );
+      MatrixOp::SolveColumns( cols, size, [ & ]( size_t first, size_t last ) {
+          for( size_t row = 1; row < size; ++row ) {
+            double *sol_row = sol + row * cols;
+            for( size_t col = 0; col < row; ++col ) {
+              double factor = data[ row * size + col ];
+              const double *sol_col = sol + col * cols;
+#pragma omp simd
+              for( size_t elm = first; elm < last; ++elm )
+                sol_row[ elm ] -= factor * sol_col[ elm ];
+            }
+          }
+          for( size_t row = size; row-- > 0; ) {
+            double *sol_row = sol + row * cols;
+            for( size_t col = row + 1; col < size; ++col ) {
+              double factor = data[ row * size + col ];
+              const double *sol_col = sol + col * cols;
+#pragma omp simd
+              for( size_t elm = first; elm < last; ++elm )
+                sol_row[ elm ] -= factor * sol_col[ elm ];
+            }
+            double diagonal = data[ row * size + row ];
+            for( size_t elm = first; elm < last; ++elm )
+              sol_row[ elm ] /= diagonal;
+          }
+        } );
+      rhs = std::move( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void MatrixOp::CholeskySolve( const Matrix< double > &lower, Matrix< double > &rhs ) {
+    try {
+      size_t size = lower.size( 0 );
+      size_t cols = rhs.size( 0 );
+      if( ( rhs.Dims( ) != 2 ) || ( rhs.size( 1 ) != size ) ) {
+        std::string msg( BIAL_ERROR( "Right-hand sides must have as many rows as the system." ) );
+        throw( std::logic_error( msg ) );
+      }
+      const double *data = lower.Data( );
+      double *sol = rhs.Data( );
+      MatrixOp::SolveColumns( cols, size, [ & ]( size_t first, size_t last ) {
+          for( size_t row = 0; row < size; ++row ) {
+            double *sol_row = sol + row * cols;
+            for( size_t col = 0; col < row; ++col ) {
+              double factor = data[ row * size + col ];
+              const double *sol_col = sol + col * cols;
+#pragma omp simd
+              for( size_t elm = first; elm < last; ++elm )
+                sol_row[ elm ] -= factor * sol_col[ elm ];
+            }
+            double diagonal = data[ row * size + row ];
+            for( size_t elm = first; elm < last; ++elm )
+              sol_row[ elm ] /= diagonal;
+          }
+          COMMENT( "The transpose of L is read along its columns, which are the rows of L.", 4 );
+          for( size_t row = size; row-- > 0; ) {
+            double *sol_row = sol + row * cols;
+            double diagonal = data[ row * size + row ];
+            for( size_t elm = first; elm < last; ++elm )
+              sol_row[ elm ] /= diagonal;
+            for( size_t col = 0; col < row; ++col ) {
+              double factor = data[ row * size + col ];
+              double *sol_col = sol + col * cols;
+#pragma omp simd
+              for( size_t elm = first; elm < last; ++elm )
+                sol_col[ elm ] -= factor * sol_row[ elm ];
+            }
+          }
+        } );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Matrix< D > MatrixOp::Solve( const Matrix< D > &mat, const Matrix< D > &rhs ) {
+    try {
+      if( ( mat.Dims( ) != 2 ) || ( rhs.Dims( ) != 2 ) ) {
+        std::string msg( BIAL_ERROR( "Invalid number of dimensions. Expected 2." ) );
+        throw( std::logic_error( msg ) );
+      }
+      size_t size = mat.size( 0 );
+      if( ( size != mat.size( 1 ) ) || ( size != rhs.size( 1 ) ) ) {
+        std::string msg( BIAL_ERROR( "Matrix must be square, with as many rows as the right-hand sides." ) );
+        throw( std::logic_error( msg ) );
+      }
+      Matrix< double > sol( rhs );
+      bool symmetric = true;
+      for( size_t row = 1; ( row < size ) && ( symmetric ); ++row ) {
+        for( size_t col = 0; col < row; ++col ) {
+          if( mat( col, row ) != mat( row, col ) ) {
+            symmetric = false;
+            break;
+          }
+        }
+      }
+      Matrix< double > factor;
+      if( ( symmetric ) && ( MatrixOp::Cholesky( mat, factor ) ) ) {
+        COMMENT( "Solving by Cholesky factorization.", 2 );
+        MatrixOp::CholeskySolve( factor, sol );
+      }
+      else {
+        COMMENT( "Solving by LU factorization.", 2 );
+        Vector< size_t > pivot;
+        if( MatrixOp::LU( mat, factor, pivot ) == 0 ) {
+          std::string msg( BIAL_ERROR( "Singular matrix." ) );
+          throw( std::logic_error( msg ) );
+        }
+        MatrixOp::LUSolve( factor, pivot, sol );
+      }
+      return( Matrix< D >( sol ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+#ifdef BIAL_EXPLICIT_MatrixFactorization
+
+  template int MatrixOp::LU( const Matrix< int > &mat, Matrix< double > &lu, Vector< size_t > &pivot );
+  template bool MatrixOp::Cholesky( const Matrix< int > &mat, Matrix< double > &lower );
+  template Matrix< int > MatrixOp::Solve( const Matrix< int > &mat, const Matrix< int > &rhs );
+
+  template int MatrixOp::LU( const Matrix< llint > &mat, Matrix< double > &lu, Vector< size_t > &pivot );
+  template bool MatrixOp::Cholesky( const Matrix< llint > &mat, Matrix< double > &lower );
+  template Matrix< llint > MatrixOp::Solve( const Matrix< llint > &mat, const Matrix< llint > &rhs );
+
+  template int MatrixOp::LU( const Matrix< float > &mat, Matrix< double > &lu, Vector< size_t > &pivot );
+  template bool MatrixOp::Cholesky( const Matrix< float > &mat, Matrix< double > &lower );
+  template Matrix< float > MatrixOp::Solve( const Matrix< float > &mat, const Matrix< float > &rhs );
+
+  template int MatrixOp::LU( const Matrix< double > &mat, Matrix< double > &lu, Vector< size_t > &pivot );
+  template bool MatrixOp::Cholesky( const Matrix< double > &mat, Matrix< double > &lower );
+  template Matrix< double > MatrixOp::Solve( const Matrix< double > &mat, const Matrix< double > &rhs );
+
+#endif
+
+}
+
+#endif
+
+#endif
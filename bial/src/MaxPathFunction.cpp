@@ -29,7 +29,7 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  MaxPathFunction< C, D >::MaxPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor,
+  MaxPathFunction< C, D >::MaxPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor,
                                             bool sequential_label, const C< D > &handicap ) try :
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ) {
     }
@@ -99,218 +99,6 @@ namespace Bial {
     }
   }
 
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::RemoveSimple( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        COMMENT( "Root.", 3 );
-        this->value->operator()( index ) = handicap( index );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::RemovePredecessor( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        COMMENT( "Root.", 3 );
-        this->value->operator()( index ) = handicap( index );
-        this->predecessor->operator()( index ) = -1;
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::RemoveLabel( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = handicap( index );
-        this->label->operator()( index ) = this->next_label;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::RemoveComplete( size_t index, BucketState state ) {
-    try {
-      if( state == BucketState::INSERTED ) {
-        this->value->operator()( index ) = handicap( index );
-        this->label->operator()( index ) = this->next_label;
-        this->predecessor->operator()( index ) = -1;
-        ++( this->next_label );
-      }
-      return( true );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  inline bool MaxPathFunction< C, D >::Capable( size_t index, size_t adj_index, BucketState adj_state ) {
-    try {
-      return( adj_state != BucketState::REMOVED );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::PropagateDifferential( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      IF_DEBUG( ( this->predecessor == nullptr ) || ( this->label == nullptr ) ) {
-        std::string msg( BIAL_ERROR( "Differential propragation requires predecessor and label maps." ) );
-        throw( std::runtime_error( msg ) );
-      }
-      COMMENT( "Propagating!", 4 );
-      D src_value = this->value->operator()( adj_index );
-      D arc_weight = handicap( adj_index );
-      D prp_value = std::max( this->value->operator()( index ), arc_weight );
-      if( ( src_value > prp_value ) ||
-          ( ( this->predecessor->operator()( adj_index ) == static_cast< int >( index ) ) &&
-            ( this->label->operator()( adj_index ) != this->label->operator()( index ) ) ) ) {
-        COMMENT( "propagated!", 4 );
-        this->value->operator()( adj_index ) = prp_value;
-        this->predecessor->operator()( adj_index ) = index;
-        this->label->operator()( adj_index ) = this->label->operator()( index );
-        return( true );
-      }
-      COMMENT( "Not propagated!", 4 );
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
-  template< template< class D > class C, class D >
-  bool MaxPathFunction< C, D >::Propagate( size_t index, size_t adj_index, size_t adj_pos ) {
-    try {
-      COMMENT( "Propagating!", 4 );
-      D src_value = this->value->operator()( adj_index );
-      D arc_weight = handicap( adj_index );
-      D prp_value = std::max( this->value->operator()( index ), arc_weight );
-      if( ( ( this->predecessor != nullptr ) &&
-            ( this->predecessor->operator()( adj_index ) == static_cast< int >( index ) ) )
-            || ( src_value > prp_value ) ) {
-        COMMENT( "propagated!", 4 );
-        this->value->operator()( adj_index ) = prp_value;
-        ( this->*this->UpdateData )( index, adj_index );
-        return( true );
-      }
-      COMMENT( "Not propagated!", 4 );
-      return( false );
-    }
-    catch( std::bad_alloc &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( std::runtime_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
-      throw( std::runtime_error( msg ) );
-    }
-    catch( const std::out_of_range &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
-      throw( std::out_of_range( msg ) );
-    }
-    catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
-      throw( std::logic_error( msg ) );
-    }
-  }
-
   template< template< class D > class C, class D >
   bool MaxPathFunction< C, D >::Increasing( ) {
     return( true );
@@ -29,7 +29,8 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  MaxSumPathFunction< C, D >::MaxSumPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+  MaxSumPathFunction< C, D >::MaxSumPathFunction( C< D > &init_value, C< int > *init_label,
+                                                  C< bial_index > *init_predecessor, 
                                                   bool sequential_label, const C< D > &intensity, 
                                                   const C< D > &handicap, double new_alpha, double new_beta ) try :
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), intensity( intensity ), 
@@ -21,10 +21,10 @@
 #if defined ( BIAL_EXPLICIT_MedianFeature ) || ( BIAL_IMPLICIT_BIN )
 
 #include "Adjacency.hpp"
-#include "AdjacencyIterator.hpp"
 #include "Feature.hpp"
 #include "Image.hpp"
 #include "Matrix.hpp"
+#include "RankWindow.hpp"
 
 namespace Bial {
 
@@ -42,20 +42,17 @@ namespace Bial {
       size_t elements = src.size( );
       Feature< D > res( elements, features );
       COMMENT( "Computing median features.", 0 );
+      D minimum = src.Minimum( );
+      D maximum = src.Maximum( );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &MedianFeatureThread< D >, std::ref( src ), std::ref( adj_rel ),
-                                          std::ref( res ), thd, total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( src.size( 1 ) * src.size( 2 ) ), [ & ]( size_t tsk, size_t tasks ) {
+          MedianFeatureThread( src, adj_rel, res, minimum, maximum, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
-        MedianFeatureThread( src, adj_rel, res, 0, 1 );
+        MedianFeatureThread( src, adj_rel, res, minimum, maximum, 0, 1 );
       }
       return( res );
     }
@@ -81,10 +78,8 @@ namespace Bial {
   Feature< D > MedianFeature( const Image< D > &src, const Image< D > &msk, const Adjacency &adj_rel, 
                               float proportion ) {
     try {
-      AdjacencyIterator adj_itr( src, adj_rel );
       size_t adj_size = adj_rel.size( );
       size_t img_size = src.size( );
-      size_t adj_pxl;
       IF_DEBUG( ( proportion >= 1.0 ) || ( proportion <= 0.0 ) ) {
         std::string msg( BIAL_ERROR( "Invalid proportion. Expected: 0 < proportion < 1." ) );
         throw( std::logic_error( msg ) );
@@ -103,24 +98,29 @@ namespace Bial {
           ++elements;
       }
       Feature< D > res( elements, features );
-      COMMENT( "Computing median features.", 0 );
-      Vector< D > median( adj_size );
+      COMMENT( "Computing median features. Adjacents out of image or mask count as copies of the source pixel.", 0 );
+      RankWindow< D > window( src, adj_rel, src.Minimum( ), src.Maximum( ), &msk, features );
+      RankSet< D > &values = window.Values( );
       size_t adj_base = ( adj_size / 2 ) - ( features / 2 );
+      size_t x_size = src.size( 0 );
+      size_t y_size = src.size( 1 );
+      size_t rows = y_size * src.size( 2 );
       size_t tgt_pxl = 0;
-      for( size_t src_pxl = 0; src_pxl < img_size; ++src_pxl ) {
-        if( msk[ src_pxl ] != 0 ) {
-          for( size_t adj = 0; adj < adj_size; ++adj ) {
-            if( ( adj_itr.AdjIdx( src_pxl, adj, adj_pxl ) ) && ( msk[ adj_pxl ] != 0 ) )
-              median( adj ) = src[ adj_pxl ];
-            else
-              median( adj ) = src[ src_pxl ];
-          }
-          sort( median.begin( ), median.end( ) );
-          for( size_t ftr = 0; ftr < features; ++ftr ) {
-            res( tgt_pxl, ftr ) = median( adj_base + ftr );
+      for( size_t row = 0; row < rows; ++row ) {
+        window.Row( row % y_size, row / y_size );
+        size_t src_pxl = row * x_size;
+        for( size_t x = 0; x < x_size; ++x, ++src_pxl ) {
+          if( x != 0 )
+            window.Next( );
+          if( msk[ src_pxl ] != 0 ) {
+            size_t missing = adj_size - values.size( );
+            values.Insert( src[ src_pxl ], missing );
+            for( size_t ftr = 0; ftr < features; ++ftr )
+              res( tgt_pxl, ftr ) = values.Rank( adj_base + ftr );
             res.Index( tgt_pxl ) = src_pxl;
+            values.Remove( src[ src_pxl ], missing );
+            ++tgt_pxl;
           }
-          ++tgt_pxl;
         }
       }
       return( res );
@@ -144,30 +144,33 @@ namespace Bial {
   }
 
   template< class D >
-  void MedianFeatureThread( const Image< D > &src, const Adjacency &adj_rel, Feature< D > &res, size_t thread,
-                            size_t total_threads ) {
+  void MedianFeatureThread( const Image< D > &src, const Adjacency &adj_rel, Feature< D > &res, D minimum,
+                            D maximum, size_t thread, size_t total_threads ) {
     try {
-      COMMENT( "Dealing with thread limits.", 2 );
+      COMMENT( "Dealing with thread limits. Threads get whole rows.", 2 );
       size_t features = res.Features( );
-      size_t elements = res.Elements( );
-      size_t min_index = thread * elements / total_threads;
-      size_t max_index = ( thread + 1 ) * elements / total_threads;
-      COMMENT( "Computing median features.", 2 );
-      AdjacencyIterator adj_itr( src, adj_rel );
+      size_t x_size = src.size( 0 );
+      size_t y_size = src.size( 1 );
+      size_t rows = y_size * src.size( 2 );
+      size_t min_row = thread * rows / total_threads;
+      size_t max_row = ( thread + 1 ) * rows / total_threads;
+      COMMENT( "Computing median features. Adjacents out of image count as copies of the source pixel.", 2 );
+      RankWindow< D > window( src, adj_rel, minimum, maximum, nullptr, features );
+      RankSet< D > &values = window.Values( );
       size_t adj_size = adj_rel.size( );
-      size_t adj_pxl;
-      Vector< D > median( adj_size );
       size_t adj_base = ( adj_size / 2 ) - ( features / 2 );
-      for( size_t src_pxl = min_index; src_pxl < max_index; ++src_pxl ) {
-        for( size_t adj = 0; adj < adj_size; ++adj ) {
-          if( adj_itr.AdjIdx( src_pxl, adj, adj_pxl ) )
-            median( adj ) = src[ adj_pxl ];
-          else
-            median( adj ) = src[ src_pxl ];
+      for( size_t row = min_row; row < max_row; ++row ) {
+        window.Row( row % y_size, row / y_size );
+        size_t src_pxl = row * x_size;
+        for( size_t x = 0; x < x_size; ++x, ++src_pxl ) {
+          if( x != 0 )
+            window.Next( );
+          size_t missing = adj_size - values.size( );
+          values.Insert( src[ src_pxl ], missing );
+          for( size_t ftr = 0; ftr < features; ++ftr )
+            res( src_pxl, ftr ) = values.Rank( adj_base + ftr );
+          values.Remove( src[ src_pxl ], missing );
         }
-        std::sort( median.begin( ), median.end( ) );
-        for( size_t ftr = 0; ftr < features; ++ftr )
-          res( src_pxl, ftr ) = median( adj_base + ftr );
       }
     }
     catch( std::bad_alloc &e ) {
@@ -205,13 +208,13 @@ namespace Bial {
                                             const Adjacency &adj, float proportion );
 
   template void MedianFeatureThread( const Image< int > &src, const Adjacency &adj_rel, Feature< int > &res,
-                                     size_t thread, size_t total_threads );
+                                     int minimum, int maximum, size_t thread, size_t total_threads );
   template void MedianFeatureThread( const Image< llint > &src, const Adjacency &adj_rel, Feature< llint > &res,
-                                     size_t thread, size_t total_threads );
+                                     llint minimum, llint maximum, size_t thread, size_t total_threads );
   template void MedianFeatureThread( const Image< float > &src, const Adjacency &adj_rel, Feature< float > &res,
-                                     size_t thread, size_t total_threads );
+                                     float minimum, float maximum, size_t thread, size_t total_threads );
   template void MedianFeatureThread( const Image< double > &src, const Adjacency &adj_rel, Feature< double > &res,
-                                     size_t thread, size_t total_threads );
+                                     double minimum, double maximum, size_t thread, size_t total_threads );
   
 #endif
 
@@ -29,7 +29,7 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  MinPathFunction< C, D >::MinPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+  MinPathFunction< C, D >::MinPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, 
                                             bool sequential_label, const C< D > &handicap ) try :
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ) {
     }
@@ -32,7 +32,7 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  void MinimumSpanningTree::MST( const Feature< D > &feature, C< D > &distance_map, C< int > &predecessor_map ) {
+  void MinimumSpanningTree::MST( const Feature< D > &feature, C< D > &distance_map, C< bial_index > &predecessor_map ) {
     try {
       if( ( feature.Elements( ) != distance_map.size( ) ) || ( distance_map.size( ) != predecessor_map.size( ) ) ) {
         std::string msg( std::string( __FILE__ ) + ": " + std::to_string( __LINE__ ) + ": " + std::string(
@@ -71,21 +71,33 @@ namespace Bial {
 
 #ifdef BIAL_EXPLICIT_MinimumSpanningTree
 
-  template void MinimumSpanningTree::MST( const Feature< int > &feature, Image< int > &distance_map, Image< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< int > &feature, Matrix< int > &distance_map, Matrix< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< int > &feature, Vector< int > &distance_map, Vector< int > &predecessor_map );
-
-  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Image< llint > &distance_map, Image< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Matrix< llint > &distance_map, Matrix< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Vector< llint > &distance_map, Vector< int > &predecessor_map );
-
-  template void MinimumSpanningTree::MST( const Feature< float > &feature, Image< float > &distance_map, Image< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< float > &feature, Matrix< float > &distance_map, Matrix< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< float > &feature, Vector< float > &distance_map, Vector< int > &predecessor_map );
-
-  template void MinimumSpanningTree::MST( const Feature< double > &feature, Image< double > &distance_map, Image< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< double > &feature, Matrix< double > &distance_map, Matrix< int > &predecessor_map );
-  template void MinimumSpanningTree::MST( const Feature< double > &feature, Vector< double > &distance_map, Vector< int > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< int > &feature, Image< int > &distance_map,
+                                          Image< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< int > &feature, Matrix< int > &distance_map,
+                                          Matrix< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< int > &feature, Vector< int > &distance_map,
+                                          Vector< bial_index > &predecessor_map );
+
+  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Image< llint > &distance_map,
+                                          Image< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Matrix< llint > &distance_map,
+                                          Matrix< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< llint > &feature, Vector< llint > &distance_map,
+                                          Vector< bial_index > &predecessor_map );
+
+  template void MinimumSpanningTree::MST( const Feature< float > &feature, Image< float > &distance_map,
+                                          Image< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< float > &feature, Matrix< float > &distance_map,
+                                          Matrix< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< float > &feature, Vector< float > &distance_map,
+                                          Vector< bial_index > &predecessor_map );
+
+  template void MinimumSpanningTree::MST( const Feature< double > &feature, Image< double > &distance_map,
+                                          Image< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< double > &feature, Matrix< double > &distance_map,
+                                          Matrix< bial_index > &predecessor_map );
+  template void MinimumSpanningTree::MST( const Feature< double > &feature, Vector< double > &distance_map,
+                                          Vector< bial_index > &predecessor_map );
 
 #endif
 
@@ -20,6 +20,7 @@
 #include "AdjacencyRound.hpp"
 #include "AdjacencyIterator.hpp"
 #include "Image.hpp"
+#include "MorphologyLine.hpp"
 
 namespace Bial {
 
@@ -57,17 +58,20 @@ namespace Bial {
         throw( std::logic_error( msg ) );
       }
       COMMENT( "Computing dilation.", 2 );
+      COMMENT( "Boxes, including lines along any dimension, and structuring elements made of runs longer than "
+               "one pixel are filtered by line passes.", 2 );
+      Vector< int > run;
+      Vector< int > low;
+      Vector< int > high;
+      if( ( LineRuns( adjacency, run ) ) &&
+          ( ( run.size( ) / 4 < adjacency.size( ) ) || ( LineBox( run, low, high ) ) ) )
+        return( LineFilter( image, run, true ) );
       Image< D > result( image );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &Morphology::DilateThreads< D >, std::ref( image ), std::ref( adjacency ),
-                                          std::ref( result ), thd, total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( image.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          Morphology::DilateThreads( image, adjacency, result, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
@@ -104,8 +108,9 @@ namespace Bial {
       size_t min_index = thread * image.Size( ) / total_threads;
       size_t max_index = ( thread + 1 ) * image.Size( ) / total_threads;
       for( size_t src_index = min_index; src_index < max_index; ++src_index ) {
+        bool interior = adj_itr.Interior( src_index );
         for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( adj_itr.AdjIdx( src_index, idx, adj_index ) ) {
+          if( adj_itr.AdjIdx( src_index, idx, adj_index, interior ) ) {
             if( result[ src_index ] < image[ adj_index ] )
               result[ src_index ] = image[ adj_index ];
           }
@@ -133,6 +138,20 @@ namespace Bial {
   template< class D >
   Image< D > Morphology::DilateBin( const Image< D > &image, const Adjacency &adjacency ) {
     try {
+      COMMENT( "Images with a single nonzero value are dilated with packed bits.", 2 );
+      Vector< int > run;
+      if( LineRuns( adjacency, run ) ) {
+        D value = 0;
+        bool single_value = true;
+        for( size_t pxl = 0; ( pxl < image.size( ) ) && ( single_value ); ++pxl ) {
+          if( image[ pxl ] != 0 ) {
+            single_value = ( value == 0 ) || ( value == image[ pxl ] );
+            value = image[ pxl ];
+          }
+        }
+        if( single_value )
+          return( BinaryLineFilter( image, run, true ) );
+      }
       COMMENT( "Inserting pixels into the priority queue.", 2 );
       Vector< size_t > seeds;
       for( size_t pxl = 0; pxl < image.size( ); ++pxl ) {
@@ -142,15 +161,10 @@ namespace Bial {
       COMMENT( "Computing dilation result.", 2 );
       Image< D > res( image );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads.push_back( std::thread( &Morphology::DilateBinThreads< D >, std::ref( image ), std::ref( adjacency ),
-                                          std::ref( seeds ), std::ref( res ), thd, total_threads ) );
-        }
-        for( size_t thd = 0; thd < total_threads; ++thd ) {
-          threads( thd ).join( );
-        }
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( seeds.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          Morphology::DilateBinThreads( image, adjacency, seeds, res, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
@@ -188,8 +202,9 @@ namespace Bial {
       size_t adj_pxl;
       for( size_t sed = min_index; sed < max_index; ++sed ) {
         size_t pxl = seeds[ sed ];
+        bool interior = adj_itr.Interior( pxl );
         for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) ) {
+          if( adj_itr.AdjIdx( pxl, idx, adj_pxl, interior ) ) {
             if( image[ adj_pxl ] != 0 ) {
               result[ pxl ] = image[ adj_pxl ];
               break;
@@ -20,6 +20,7 @@
 #include "AdjacencyRound.hpp"
 #include "AdjacencyIterator.hpp"
 #include "Image.hpp"
+#include "MorphologyLine.hpp"
 
 namespace Bial {
 
@@ -55,15 +56,20 @@ namespace Bial {
                          ": error: Image and adjacency relation dimensions do not match." );
         throw( std::logic_error( msg ) );
       }
+      COMMENT( "Boxes, including lines along any dimension, and structuring elements made of runs longer than "
+               "one pixel are filtered by line passes.", 2 );
+      Vector< int > run;
+      Vector< int > low;
+      Vector< int > high;
+      if( ( LineRuns( adjacency, run ) ) &&
+          ( ( run.size( ) / 4 < adjacency.size( ) ) || ( LineBox( run, low, high ) ) ) )
+        return( LineFilter( image, run, false ) );
       Image< D > result( image );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads.push_back( std::thread( &Morphology::ErodeThreads< D >, std::ref( image ), std::ref( adjacency ),
-                                          std::ref( result ), thd, total_threads ) );
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads( thd ).join( );
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( image.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          Morphology::ErodeThreads( image, adjacency, result, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
@@ -100,8 +106,9 @@ namespace Bial {
       size_t adj_size = adjacency.size( );
       size_t adj_index;
       for( size_t img_index = min_index; img_index < max_index; ++img_index ) {
+        bool interior = adj_itr.Interior( img_index );
         for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( ( adj_itr.AdjIdx( img_index, idx, adj_index ) ) &&
+          if( ( adj_itr.AdjIdx( img_index, idx, adj_index, interior ) ) &&
               ( result[ img_index ] > image[ adj_index ] ) )
             result[ img_index ] = image[ adj_index ];
         }
@@ -128,6 +135,10 @@ namespace Bial {
   template< class D >
   Image< D > Morphology::ErodeBin( const Image< D > &image, const Adjacency &adjacency ) {
     try {
+      COMMENT( "Eroding with packed bits.", 2 );
+      Vector< int > run;
+      if( LineRuns( adjacency, run ) )
+        return( BinaryLineFilter( image, run, false ) );
       COMMENT( "Inserting pixels into the priority queue.", 2 );
       Vector< size_t > seeds;
       for( size_t pxl = 0; pxl < image.size( ); ++pxl ) {
@@ -137,13 +148,10 @@ namespace Bial {
       COMMENT( "Computing erosion result.", 2 );
       Image< D > res( image );
       try {
-        size_t total_threads = 12;
-        Vector< std::thread > threads;
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads.push_back( std::thread( &Morphology::ErodeBinThreads< D >, std::ref( image ), std::ref( adjacency ),
-                                          std::ref( seeds ), std::ref( res ), thd, total_threads ) );
-        for( size_t thd = 0; thd < total_threads; ++thd )
-          threads( thd ).join( );
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( seeds.size( ) ), [ & ]( size_t tsk, size_t tasks ) {
+          Morphology::ErodeBinThreads( image, adjacency, seeds, res, tsk, tasks );
+        } );
       }
       catch( std::exception &e ) {
         std::cout << "Warning: Failed to run in multi-thread. Exception: " << e.what( ) << std::endl;
@@ -181,8 +189,9 @@ namespace Bial {
       size_t adj_pxl;
       for( size_t sed = min_index; sed < max_index; ++sed ) {
         size_t pxl = seeds[ sed ];
+        bool interior = adj_itr.Interior( pxl );
         for( size_t idx = 1; idx < adj_size; ++idx ) {
-          if( ( adj_itr.AdjIdx( pxl, idx, adj_pxl ) ) && ( image[ adj_pxl ] == 0 ) ) {
+          if( ( adj_itr.AdjIdx( pxl, idx, adj_pxl, interior ) ) && ( image[ adj_pxl ] == 0 ) ) {
             result[ pxl ] = 0;
             break;
           }
@@ -0,0 +1,572 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Morphological dilation and erosion decomposed into line passes.
+ */
+
+#ifndef BIALMORPHOLOGYLINE_C
+#define BIALMORPHOLOGYLINE_C
+
+#include "MorphologyLine.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_MorphologyLine )
+#define BIAL_EXPLICIT_MorphologyLine
+#endif
+#if defined ( BIAL_EXPLICIT_MorphologyLine ) || ( BIAL_IMPLICIT_BIN )
+
+#include "Adjacency.hpp"
+#include "Image.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+
+namespace Bial {
+
+  bool Morphology::LineRuns( const Adjacency &adjacency, Vector< int > &run ) {
+    try {
+      size_t dims = adjacency.Dims( );
+      if( dims > 3 )
+        return( false );
+      COMMENT( "Sorting the displacements and the origin by dimensions 2, 1 and 0.", 2 );
+      std::vector< std::array< int, 3 > > dsp( 1, std::array< int, 3 >{ { 0, 0, 0 } } );
+      for( size_t elm = 0; elm < adjacency.size( ); ++elm ) {
+        std::array< int, 3 > cur{ { 0, 0, 0 } };
+        for( size_t dms = 0; dms < dims; ++dms )
+          cur[ 2 - dms ] = adjacency( elm, dms );
+        dsp.push_back( cur );
+      }
+      std::sort( dsp.begin( ), dsp.end( ) );
+      dsp.erase( std::unique( dsp.begin( ), dsp.end( ) ), dsp.end( ) );
+      COMMENT( "Joining consecutive displacements of dimension 0.", 2 );
+      std::vector< int > result;
+      for( size_t elm = 0; elm < dsp.size( ); ++elm ) {
+        bool same_line = ( elm > 0 ) && ( dsp[ elm ][ 0 ] == dsp[ elm - 1 ][ 0 ] ) &&
+          ( dsp[ elm ][ 1 ] == dsp[ elm - 1 ][ 1 ] );
+        if( !same_line ) {
+          result.insert( result.end( ), { dsp[ elm ][ 2 ], dsp[ elm ][ 2 ], dsp[ elm ][ 1 ], dsp[ elm ][ 0 ] } );
+          continue;
+        }
+        if( dsp[ elm ][ 2 ] != dsp[ elm - 1 ][ 2 ] + 1 )
+          return( false );
+        result[ result.size( ) - 3 ] = dsp[ elm ][ 2 ];
+      }
+      run = Vector< int >( result.size( ) );
+      std::copy( result.begin( ), result.end( ), run.begin( ) );
+      return( true );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  bool Morphology::LineBox( const Vector< int > &run, Vector< int > &low, Vector< int > &high ) {
+    try {
+      size_t runs = run.size( ) / 4;
+      low = Vector< int >( 3 );
+      high = Vector< int >( 3 );
+      low[ 0 ] = run[ 0 ];
+      high[ 0 ] = run[ 1 ];
+      low[ 1 ] = high[ 1 ] = run[ 2 ];
+      low[ 2 ] = high[ 2 ] = run[ 3 ];
+      for( size_t rn = 1; rn < runs; ++rn ) {
+        if( ( run[ 4 * rn ] != low[ 0 ] ) || ( run[ 4 * rn + 1 ] != high[ 0 ] ) )
+          return( false );
+        for( size_t dms = 1; dms < 3; ++dms ) {
+          low[ dms ] = std::min( low[ dms ], run[ 4 * rn + 1 + dms ] );
+          high[ dms ] = std::max( high[ dms ], run[ 4 * rn + 1 + dms ] );
+        }
+      }
+      COMMENT( "Runs are distinct, so they fill the box if they are as many as its lines.", 2 );
+      return( runs == static_cast< size_t >( ( high[ 1 ] - low[ 1 ] + 1 ) * ( high[ 2 ] - low[ 2 ] + 1 ) ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D, class C >
+  void Morphology::LineWindow( const D *src, size_t size, int low, int high, C better, D *forward, D *backward,
+                               D *acc ) {
+    int last = static_cast< int >( size ) - 1;
+    if( ( low > last ) || ( high < -last ) )
+      return;
+    low = std::max( low, -last );
+    high = std::min( high, last );
+    COMMENT( "Elements whose window has in-line elements.", 4 );
+    size_t min_elm = std::max( 0, -high );
+    size_t max_elm = std::min( last, last - low ) + 1;
+    if( low == high ) {
+      for( size_t elm = min_elm; elm < max_elm; ++elm ) {
+        if( better( src[ elm + low ], acc[ elm ] ) )
+          acc[ elm ] = src[ elm + low ];
+      }
+      return;
+    }
+    COMMENT( "Window position pos starts at element pos + low. Out of line elements repeat the line ends, which "
+             "are in the window of every element with in-line elements.", 4 );
+    size_t length = high - low + 1;
+    size_t total = size + length - 1;
+    size_t head = std::max( 0, -low );
+    size_t tail = last - low + 1;
+    std::fill( backward, backward + head, src[ 0 ] );
+    std::copy( src + head + low, src + size, backward + head );
+    std::fill( backward + tail, backward + total, src[ last ] );
+    COMMENT( "Best from the start of each block of length elements, and then from each position to its block end.",
+             4 );
+    for( size_t blk = 0; blk < total; blk += length ) {
+      size_t blk_end = std::min( blk + length, total );
+      forward[ blk ] = backward[ blk ];
+      for( size_t pos = blk + 1; pos < blk_end; ++pos )
+        forward[ pos ] = better( backward[ pos ], forward[ pos - 1 ] ) ? backward[ pos ] : forward[ pos - 1 ];
+      for( size_t pos = blk_end - 1; pos > blk; --pos ) {
+        if( better( backward[ pos ], backward[ pos - 1 ] ) )
+          backward[ pos - 1 ] = backward[ pos ];
+      }
+    }
+    for( size_t elm = min_elm; elm < max_elm; ++elm ) {
+      const D &val = better( forward[ elm + length - 1 ], backward[ elm ] ) ? forward[ elm + length - 1 ] :
+        backward[ elm ];
+      if( better( val, acc[ elm ] ) )
+        acc[ elm ] = val;
+    }
+  }
+
+  template< class D, class C >
+  void Morphology::LineWindowRows( const D *src, size_t size, size_t cols, int low, int high, C better,
+                                   D *forward, D *backward, D *acc ) {
+    int last = static_cast< int >( size ) - 1;
+    if( ( low > last ) || ( high < -last ) )
+      return;
+    low = std::max( low, -last );
+    high = std::min( high, last );
+    size_t min_elm = std::max( 0, -high );
+    size_t max_elm = std::min( last, last - low ) + 1;
+    size_t length = high - low + 1;
+    size_t total = size + length - 1;
+    size_t head = std::max( 0, -low );
+    size_t tail = last - low + 1;
+    for( size_t pos = 0; pos < head; ++pos )
+      std::copy( src, src + cols, backward + pos * cols );
+    std::copy( src + ( head + low ) * cols, src + size * cols, backward + head * cols );
+    for( size_t pos = tail; pos < total; ++pos )
+      std::copy( src + last * cols, src + size * cols, backward + pos * cols );
+    for( size_t blk = 0; blk < total; blk += length ) {
+      size_t blk_end = std::min( blk + length, total );
+      std::copy( backward + blk * cols, backward + ( blk + 1 ) * cols, forward + blk * cols );
+      for( size_t pos = blk + 1; pos < blk_end; ++pos ) {
+        const D *bwd = backward + pos * cols;
+        const D *prv = forward + ( pos - 1 ) * cols;
+        D *fwd = forward + pos * cols;
+        for( size_t cl = 0; cl < cols; ++cl )
+          fwd[ cl ] = better( bwd[ cl ], prv[ cl ] ) ? bwd[ cl ] : prv[ cl ];
+      }
+      for( size_t pos = blk_end - 1; pos > blk; --pos ) {
+        const D *nxt = backward + pos * cols;
+        D *bwd = backward + ( pos - 1 ) * cols;
+        for( size_t cl = 0; cl < cols; ++cl )
+          bwd[ cl ] = better( nxt[ cl ], bwd[ cl ] ) ? nxt[ cl ] : bwd[ cl ];
+      }
+    }
+    for( size_t elm = min_elm; elm < max_elm; ++elm ) {
+      const D *fwd = forward + ( elm + length - 1 ) * cols;
+      const D *bwd = backward + elm * cols;
+      D *res = acc + elm * cols;
+      for( size_t cl = 0; cl < cols; ++cl ) {
+        D val = better( fwd[ cl ], bwd[ cl ] ) ? fwd[ cl ] : bwd[ cl ];
+        res[ cl ] = better( val, res[ cl ] ) ? val : res[ cl ];
+      }
+    }
+  }
+
+  template< class D, class C >
+  void Morphology::LineFilter( const Image< D > &image, const Vector< int > &run, C better, D worst,
+                               Image< D > &result ) {
+    try {
+      size_t dim_size[ 3 ] = { image.size( 0 ), image.size( 1 ), image.size( 2 ) };
+      size_t runs = run.size( ) / 4;
+      Vector< int > low;
+      Vector< int > high;
+      if( LineBox( run, low, high ) ) {
+        COMMENT( "Boxes are filtered one dimension at a time, in place.", 2 );
+        for( size_t dim = 0; dim < 3; ++dim ) {
+          if( ( low[ dim ] == 0 ) && ( high[ dim ] == 0 ) )
+            continue;
+          size_t size = dim_size[ dim ];
+          size_t stride = 1;
+          for( size_t dms = 0; dms < dim; ++dms )
+            stride *= dim_size[ dms ];
+          size_t lines = image.size( ) / size;
+          COMMENT( "Strided lines are filtered in blocks of adjacent lines, one contiguous row at a time.", 2 );
+          size_t width = std::min< size_t >( stride, 256 );
+          size_t plane_blocks = ( stride + width - 1 ) / width;
+          size_t blocks = ( lines / stride ) * plane_blocks;
+          auto filter = [ & ]( size_t tsk, size_t tasks ) {
+            Vector< D > line( width * size );
+            Vector< D > acc( width * size );
+            Vector< D > forward( 3 * width * size );
+            Vector< D > backward( 3 * width * size );
+            size_t min_block = tsk * blocks / tasks;
+            size_t max_block = ( tsk + 1 ) * blocks / tasks;
+            for( size_t blk = min_block; blk < max_block; ++blk ) {
+              size_t col = ( blk % plane_blocks ) * width;
+              size_t cols = std::min( width, stride - col );
+              D *first = &result[ ( blk / plane_blocks ) * stride * size + col ];
+              if( stride == 1 ) {
+                std::copy( first, first + size, line.data( ) );
+                LineWindow( line.data( ), size, low[ dim ], high[ dim ], better, forward.data( ), backward.data( ),
+                            first );
+                continue;
+              }
+              for( size_t elm = 0; elm < size; ++elm )
+                std::copy( first + elm * stride, first + elm * stride + cols, line.data( ) + elm * cols );
+              std::copy( line.data( ), line.data( ) + size * cols, acc.data( ) );
+              LineWindowRows( line.data( ), size, cols, low[ dim ], high[ dim ], better, forward.data( ),
+                              backward.data( ), acc.data( ) );
+              for( size_t elm = 0; elm < size; ++elm )
+                std::copy( acc.data( ) + elm * cols, acc.data( ) + ( elm + 1 ) * cols, first + elm * stride );
+            }
+          };
+          try {
+            ThreadPool &pool = ThreadPool::Global( );
+            pool.Run( pool.Tasks( blocks ), filter );
+          }
+          catch( std::exception &e ) {
+            BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+            filter( 0, 1 );
+          }
+        }
+        return;
+      }
+      COMMENT( "Other runs are joined from the lines of the input image filtered by their dimension 0 intervals. "
+               "Filtered lines are kept in a ring, as each one is used by the output lines of nearby runs.", 2 );
+      std::vector< std::pair< int, int > > interval;
+      std::vector< size_t > run_interval( runs );
+      long min_offset = std::numeric_limits< long >::max( );
+      long max_offset = std::numeric_limits< long >::min( );
+      for( size_t rn = 0; rn < runs; ++rn ) {
+        std::pair< int, int > cur( run[ 4 * rn ], run[ 4 * rn + 1 ] );
+        run_interval[ rn ] = std::find( interval.begin( ), interval.end( ), cur ) - interval.begin( );
+        if( run_interval[ rn ] == interval.size( ) )
+          interval.push_back( cur );
+        long offset = run[ 4 * rn + 3 ] * static_cast< long >( dim_size[ 1 ] ) + run[ 4 * rn + 2 ];
+        min_offset = std::min( min_offset, offset );
+        max_offset = std::max( max_offset, offset );
+      }
+      size_t intervals = interval.size( );
+      size_t size = dim_size[ 0 ];
+      size_t lines = dim_size[ 1 ] * dim_size[ 2 ];
+      size_t ring = std::min( static_cast< size_t >( max_offset - min_offset + 1 ), lines );
+      COMMENT( "Runs: " << runs << ", intervals: " << intervals << ", ring lines: " << ring, 2 );
+      auto filter = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< D > filtered( ring * intervals * size );
+        std::vector< size_t > ring_line( ring, lines );
+        Vector< D > forward( 3 * size );
+        Vector< D > backward( 3 * size );
+        size_t min_line = tsk * lines / tasks;
+        size_t max_line = ( tsk + 1 ) * lines / tasks;
+        for( size_t lin = min_line; lin < max_line; ++lin ) {
+          int y = static_cast< int >( lin % dim_size[ 1 ] );
+          int z = static_cast< int >( lin / dim_size[ 1 ] );
+          D *acc = &result[ lin * size ];
+          for( size_t rn = 0; rn < runs; ++rn ) {
+            int src_y = y + run[ 4 * rn + 2 ];
+            int src_z = z + run[ 4 * rn + 3 ];
+            if( ( src_y < 0 ) || ( src_y >= static_cast< int >( dim_size[ 1 ] ) ) || ( src_z < 0 ) ||
+                ( src_z >= static_cast< int >( dim_size[ 2 ] ) ) )
+              continue;
+            size_t src_line = src_z * dim_size[ 1 ] + src_y;
+            size_t slot = src_line % ring;
+            D *slot_data = filtered.data( ) + slot * intervals * size;
+            if( ring_line[ slot ] != src_line ) {
+              ring_line[ slot ] = src_line;
+              const D *src = image.Data( ) + src_line * size;
+              for( size_t itv = 0; itv < intervals; ++itv ) {
+                std::fill( slot_data + itv * size, slot_data + ( itv + 1 ) * size, worst );
+                LineWindow( src, size, interval[ itv ].first, interval[ itv ].second, better, forward.data( ),
+                            backward.data( ), slot_data + itv * size );
+              }
+            }
+            const D *src = slot_data + run_interval[ rn ] * size;
+            for( size_t elm = 0; elm < size; ++elm ) {
+              if( better( src[ elm ], acc[ elm ] ) )
+                acc[ elm ] = src[ elm ];
+            }
+          }
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( lines, 1 ), filter );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        filter( 0, 1 );
+      }
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > Morphology::LineFilter( const Image< D > &image, const Vector< int > &run, bool dilation ) {
+    try {
+      Image< D > result( image );
+      if( dilation )
+        LineFilter( image, run, std::greater< D >( ), std::numeric_limits< D >::lowest( ), result );
+      else
+        LineFilter( image, run, std::less< D >( ), std::numeric_limits< D >::max( ), result );
+      return( result );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > Morphology::BinaryLineFilter( const Image< D > &image, const Vector< int > &run, bool dilation ) {
+    try {
+      size_t x_size = image.size( 0 );
+      size_t y_size = image.size( 1 );
+      size_t z_size = image.size( 2 );
+      size_t rows = y_size * z_size;
+      size_t words = ( x_size + 63 ) / 64;
+      size_t runs = run.size( ) / 4;
+      COMMENT( "Packing the foreground for dilation and the background for erosion, which is the dilation of the "
+               "background.", 2 );
+      std::vector< std::uint64_t > bits( rows * words, 0 );
+      D value = 0;
+      for( size_t row = 0; row < rows; ++row ) {
+        const D *src = image.Data( ) + row * x_size;
+        std::uint64_t *tgt = bits.data( ) + row * words;
+        for( size_t x = 0; x < x_size; ++x ) {
+          value = std::max( value, src[ x ] );
+          if( ( src[ x ] != 0 ) == dilation )
+            tgt[ x / 64 ] |= static_cast< std::uint64_t >( 1 ) << ( x % 64 );
+        }
+      }
+      COMMENT( "Distinct dimension 0 intervals of the runs.", 2 );
+      std::vector< std::pair< int, int > > interval;
+      std::vector< size_t > run_interval( runs );
+      for( size_t rn = 0; rn < runs; ++rn ) {
+        std::pair< int, int > cur( run[ 4 * rn ], run[ 4 * rn + 1 ] );
+        run_interval[ rn ] = std::find( interval.begin( ), interval.end( ), cur ) - interval.begin( );
+        if( run_interval[ rn ] == interval.size( ) )
+          interval.push_back( cur );
+      }
+      size_t intervals = interval.size( );
+      COMMENT( "Intervals: " << intervals, 2 );
+      std::uint64_t last_mask = ( x_size % 64 == 0 ) ? ~static_cast< std::uint64_t >( 0 ) :
+        ( static_cast< std::uint64_t >( 1 ) << ( x_size % 64 ) ) - 1;
+      COMMENT( "Bit pxl of the result gets bit pxl + shift of the source. Bits out of the row are 0.", 2 );
+      auto shift = [ words ]( const std::uint64_t *src, int offset, std::uint64_t *tgt ) {
+        size_t wrd_shift = std::abs( offset ) / 64;
+        size_t bit_shift = std::abs( offset ) % 64;
+        for( size_t wrd = 0; wrd < words; ++wrd ) {
+          std::uint64_t val = 0;
+          if( offset >= 0 ) {
+            if( wrd + wrd_shift < words )
+              val = src[ wrd + wrd_shift ] >> bit_shift;
+            if( ( bit_shift != 0 ) && ( wrd + wrd_shift + 1 < words ) )
+              val |= src[ wrd + wrd_shift + 1 ] << ( 64 - bit_shift );
+          }
+          else {
+            if( wrd >= wrd_shift )
+              val = src[ wrd - wrd_shift ] << bit_shift;
+            if( ( bit_shift != 0 ) && ( wrd >= wrd_shift + 1 ) )
+              val |= src[ wrd - wrd_shift - 1 ] >> ( 64 - bit_shift );
+          }
+          tgt[ wrd ] = val;
+        }
+      };
+      COMMENT( "Dilating each row by each interval. A window of length 2p is the or of two windows of length p.", 2 );
+      std::vector< std::uint64_t > spread( intervals * rows * words );
+      int last = static_cast< int >( x_size ) - 1;
+      auto spread_rows = [ & ]( size_t tsk, size_t tasks ) {
+        std::vector< std::uint64_t > cover( words );
+        std::vector< std::uint64_t > moved( words );
+        size_t min_row = tsk * rows / tasks;
+        size_t max_row = ( tsk + 1 ) * rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          const std::uint64_t *src = bits.data( ) + row * words;
+          for( size_t itv = 0; itv < intervals; ++itv ) {
+            std::uint64_t *tgt = spread.data( ) + ( itv * rows + row ) * words;
+            int low = interval[ itv ].first;
+            int high = interval[ itv ].second;
+            if( ( low > last ) || ( high < -last ) ) {
+              std::fill( tgt, tgt + words, 0 );
+              continue;
+            }
+            low = std::max( low, -last );
+            high = std::min( high, last );
+            int length = high - low + 1;
+            std::copy( src, src + words, cover.begin( ) );
+            int covered = 1;
+            while( covered < length ) {
+              int step = std::min( covered, length - covered );
+              shift( cover.data( ), step, moved.data( ) );
+              for( size_t wrd = 0; wrd < words; ++wrd )
+                cover[ wrd ] |= moved[ wrd ];
+              covered += step;
+            }
+            shift( cover.data( ), low, tgt );
+            COMMENT( "The windows of the first -low bits start before the row. They hold the first set bit of the "
+                     "row if it is not after their end.", 4 );
+            if( low < 0 ) {
+              size_t wrd = 0;
+              while( ( wrd < words ) && ( src[ wrd ] == 0 ) )
+                ++wrd;
+              if( wrd < words ) {
+                int first = static_cast< int >( wrd * 64 );
+                while( ( ( src[ wrd ] >> ( first % 64 ) ) & 1 ) == 0 )
+                  ++first;
+                for( int bit = std::max( 0, first - high ); bit < std::min( -low, last + 1 ); ++bit )
+                  tgt[ bit / 64 ] |= static_cast< std::uint64_t >( 1 ) << ( bit % 64 );
+              }
+            }
+            tgt[ words - 1 ] &= last_mask;
+          }
+        }
+      };
+      COMMENT( "Joining the dilated rows of the runs, and unpacking.", 2 );
+      Image< D > result( image );
+      auto join_rows = [ & ]( size_t tsk, size_t tasks ) {
+        std::vector< std::uint64_t > acc( words );
+        size_t min_row = tsk * rows / tasks;
+        size_t max_row = ( tsk + 1 ) * rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          std::fill( acc.begin( ), acc.end( ), 0 );
+          int y = static_cast< int >( row % y_size );
+          int z = static_cast< int >( row / y_size );
+          for( size_t rn = 0; rn < runs; ++rn ) {
+            int src_y = y + run[ 4 * rn + 2 ];
+            int src_z = z + run[ 4 * rn + 3 ];
+            if( ( src_y < 0 ) || ( src_y >= static_cast< int >( y_size ) ) || ( src_z < 0 ) ||
+                ( src_z >= static_cast< int >( z_size ) ) )
+              continue;
+            const std::uint64_t *src = spread.data( ) + ( run_interval[ rn ] * rows + src_z * y_size + src_y ) *
+              words;
+            for( size_t wrd = 0; wrd < words; ++wrd )
+              acc[ wrd ] |= src[ wrd ];
+          }
+          D *tgt = &result[ row * x_size ];
+          for( size_t x = 0; x < x_size; ++x ) {
+            bool on = ( ( acc[ x / 64 ] >> ( x % 64 ) ) & 1 ) != 0;
+            if( dilation && on && ( tgt[ x ] == 0 ) )
+              tgt[ x ] = value;
+            else if( !dilation && on )
+              tgt[ x ] = 0;
+          }
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( rows ), spread_rows );
+        pool.Run( pool.Tasks( rows ), join_rows );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        spread_rows( 0, 1 );
+        join_rows( 0, 1 );
+      }
+      return( result );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+#ifdef BIAL_EXPLICIT_MorphologyLine
+
+  template Image< int > Morphology::LineFilter( const Image< int > &image, const Vector< int > &run, bool dilation );
+  template Image< llint > Morphology::LineFilter( const Image< llint > &image, const Vector< int > &run,
+                                                  bool dilation );
+  template Image< float > Morphology::LineFilter( const Image< float > &image, const Vector< int > &run,
+                                                  bool dilation );
+  template Image< double > Morphology::LineFilter( const Image< double > &image, const Vector< int > &run,
+                                                   bool dilation );
+
+  template Image< int > Morphology::BinaryLineFilter( const Image< int > &image, const Vector< int > &run,
+                                                      bool dilation );
+  template Image< llint > Morphology::BinaryLineFilter( const Image< llint > &image, const Vector< int > &run,
+                                                        bool dilation );
+  template Image< float > Morphology::BinaryLineFilter( const Image< float > &image, const Vector< int > &run,
+                                                        bool dilation );
+  template Image< double > Morphology::BinaryLineFilter( const Image< double > &image, const Vector< int > &run,
+                                                         bool dilation );
+
+#endif
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,308 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Classification of samples by the nodes of an optimum-path forest, searching a kd-tree of the nodes.
+ */
+
+#ifndef BIALOPFCLASSIFIER_C
+#define BIALOPFCLASSIFIER_C
+
+#include "OPFClassifier.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_OPFClassifier )
+#define BIAL_EXPLICIT_OPFClassifier
+#endif
+
+#if defined ( BIAL_EXPLICIT_OPFClassifier ) || ( BIAL_IMPLICIT_BIN )
+
+#include "DFIDE.hpp"
+#include "Feature.hpp"
+#include <numeric>
+
+namespace Bial {
+
+  template< class D >
+  OPFClassifier< D >::OPFClassifier( const Feature< D > &feature, const Vector< size_t > &element,
+                                     const Vector< int > &node_label, const Vector< double > &node_radius ) try :
+    features( feature.Features( ) ), node( 1, OPFClassifierNode{ 0, element.size( ), 0, 0, 0, 0.0 } ),
+    low( ), high( ), point( element.size( ) * feature.Features( ) ), order( element.size( ) ),
+    label( element.size( ) ), radius( element.size( ) ), max_leaf( 1 ) {
+    size_t nodes = element.size( );
+    if( nodes == 0 ) {
+      std::string msg( BIAL_ERROR( "The forest must have at least one node." ) );
+      throw( std::logic_error( msg ) );
+    }
+    if( ( node_label.size( ) != nodes ) || ( node_radius.size( ) != nodes ) ) {
+      std::string msg( BIAL_ERROR( "Forest nodes, labels and radii must have the same size. Given: " +
+                                   std::to_string( nodes ) + ", " + std::to_string( node_label.size( ) ) + ", " +
+                                   std::to_string( node_radius.size( ) ) + "." ) );
+      throw( std::logic_error( msg ) );
+    }
+    const D *data = feature.data( );
+    COMMENT( "Building the tree. Nodes split at the median of the dimension of largest spread.", 1 );
+    std::iota( order.begin( ), order.end( ), 0 );
+    std::vector< size_t > pending( 1, 0 );
+    while( !pending.empty( ) ) {
+      size_t nod = pending.back( );
+      pending.pop_back( );
+      size_t begin = node[ nod ].begin;
+      size_t end = node[ nod ].end;
+      if( end - begin > LEAF_SIZE ) {
+        size_t dim = 0;
+        double max_spread = 0.0;
+        for( size_t ftr = 0; ftr < features; ++ftr ) {
+          D min_val = data[ element[ order[ begin ] ] * features + ftr ];
+          D max_val = min_val;
+          for( size_t pos = begin + 1; pos < end; ++pos ) {
+            D val = data[ element[ order[ pos ] ] * features + ftr ];
+            min_val = std::min( min_val, val );
+            max_val = std::max( max_val, val );
+          }
+          double spread = static_cast< double >( max_val ) - static_cast< double >( min_val );
+          if( spread > max_spread ) {
+            max_spread = spread;
+            dim = ftr;
+          }
+        }
+        if( max_spread > 0.0 ) {
+          size_t mid = ( begin + end ) / 2;
+          std::nth_element( order.begin( ) + begin, order.begin( ) + mid, order.begin( ) + end,
+                            [ data, &element, this, dim ]( size_t lhs, size_t rhs ) {
+                              return( data[ element[ lhs ] * features + dim ] <
+                                      data[ element[ rhs ] * features + dim ] );
+                            } );
+          node[ nod ].left = node.size( );
+          node[ nod ].right = node.size( ) + 1;
+          node.push_back( OPFClassifierNode{ begin, mid, 0, 0, 0, 0.0 } );
+          node.push_back( OPFClassifierNode{ mid, end, 0, 0, 0, 0.0 } );
+          pending.push_back( node.size( ) - 1 );
+          pending.push_back( node.size( ) - 2 );
+          continue;
+        }
+      }
+      max_leaf = std::max( max_leaf, end - begin );
+    }
+    COMMENT( "Tree nodes: " << node.size( ) << ", largest leaf: " << max_leaf, 1 );
+    COMMENT( "Copying the forest nodes in tree order.", 1 );
+    for( size_t pos = 0; pos < nodes; ++pos ) {
+      size_t frt = order[ pos ];
+      std::copy( data + element[ frt ] * features, data + ( element[ frt ] + 1 ) * features,
+                 point.data( ) + pos * features );
+      label[ pos ] = node_label[ frt ];
+      radius[ pos ] = node_radius[ frt ];
+    }
+    COMMENT( "Computing boxes, first orders and largest radii from the leaves up. Children follow their parents.", 1 );
+    low = Vector< D >( node.size( ) * features );
+    high = Vector< D >( node.size( ) * features );
+    for( size_t nod = node.size( ); nod > 0; --nod ) {
+      OPFClassifierNode &cur = node[ nod - 1 ];
+      D *cur_low = low.data( ) + ( nod - 1 ) * features;
+      D *cur_high = high.data( ) + ( nod - 1 ) * features;
+      if( cur.left == 0 ) {
+        std::copy( point.data( ) + cur.begin * features, point.data( ) + ( cur.begin + 1 ) * features, cur_low );
+        std::copy( point.data( ) + cur.begin * features, point.data( ) + ( cur.begin + 1 ) * features, cur_high );
+        cur.first = order[ cur.begin ];
+        cur.max_radius = radius[ cur.begin ];
+        for( size_t pos = cur.begin + 1; pos < cur.end; ++pos ) {
+          for( size_t ftr = 0; ftr < features; ++ftr ) {
+            cur_low[ ftr ] = std::min( cur_low[ ftr ], point[ pos * features + ftr ] );
+            cur_high[ ftr ] = std::max( cur_high[ ftr ], point[ pos * features + ftr ] );
+          }
+          cur.first = std::min( cur.first, order[ pos ] );
+          cur.max_radius = std::max( cur.max_radius, radius[ pos ] );
+        }
+      }
+      else {
+        const OPFClassifierNode &lft = node[ cur.left ];
+        const OPFClassifierNode &rgt = node[ cur.right ];
+        for( size_t ftr = 0; ftr < features; ++ftr ) {
+          cur_low[ ftr ] = std::min( low[ cur.left * features + ftr ], low[ cur.right * features + ftr ] );
+          cur_high[ ftr ] = std::max( high[ cur.left * features + ftr ], high[ cur.right * features + ftr ] );
+        }
+        cur.first = std::min( lft.first, rgt.first );
+        cur.max_radius = std::max( lft.max_radius, rgt.max_radius );
+      }
+    }
+  }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( const std::out_of_range &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+    throw( std::out_of_range( msg ) );
+  }
+  catch( const std::logic_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+    throw( std::logic_error( msg ) );
+  }
+
+  template< class D >
+  double OPFClassifier< D >::BoxDistance( const D *sample, size_t nod, D *clamp ) const {
+    const D *nod_low = low.data( ) + nod * features;
+    const D *nod_high = high.data( ) + nod * features;
+    for( size_t ftr = 0; ftr < features; ++ftr ) {
+      clamp[ ftr ] = std::min( std::max( sample[ ftr ], nod_low[ ftr ] ), nod_high[ ftr ] );
+    }
+    double dist;
+    DFIDE::Distances( sample, clamp, 1, features, &dist );
+    return( dist );
+  }
+
+  template< class D >
+  int OPFClassifier< D >::Classify( const D *sample, D *clamp, double *distance,
+                                    std::vector< std::pair< size_t, double > > &stack ) const {
+    COMMENT( "Searching the first conquering node. Children of smaller first order are visited first.", 4 );
+    size_t best_order = std::numeric_limits< size_t >::max( );
+    int best_label = -1;
+    stack.clear( );
+    stack.push_back( std::make_pair( static_cast< size_t >( 0 ), BoxDistance( sample, 0, clamp ) ) );
+    while( !stack.empty( ) ) {
+      size_t nod = stack.back( ).first;
+      double bound = stack.back( ).second;
+      stack.pop_back( );
+      const OPFClassifierNode &cur = node[ nod ];
+      if( ( cur.first >= best_order ) || ( bound > cur.max_radius ) )
+        continue;
+      if( cur.left == 0 ) {
+        size_t size = cur.end - cur.begin;
+        DFIDE::Distances( sample, point.data( ) + cur.begin * features, size, features, distance );
+        for( size_t pos = 0; pos < size; ++pos ) {
+          size_t frt = cur.begin + pos;
+          if( ( order[ frt ] < best_order ) && ( distance[ pos ] <= radius[ frt ] ) ) {
+            best_order = order[ frt ];
+            best_label = label[ frt ];
+          }
+        }
+      }
+      else {
+        bool left_first = node[ cur.left ].first < node[ cur.right ].first;
+        size_t next = left_first ? cur.left : cur.right;
+        size_t later = left_first ? cur.right : cur.left;
+        stack.push_back( std::make_pair( later, BoxDistance( sample, later, clamp ) ) );
+        stack.push_back( std::make_pair( next, BoxDistance( sample, next, clamp ) ) );
+      }
+    }
+    if( best_label != -1 )
+      return( best_label );
+    COMMENT( "No node conquers the sample. Searching the nearest node, breaking ties by order.", 4 );
+    double best_distance = std::numeric_limits< double >::max( );
+    stack.push_back( std::make_pair( static_cast< size_t >( 0 ), 0.0 ) );
+    while( !stack.empty( ) ) {
+      size_t nod = stack.back( ).first;
+      double bound = stack.back( ).second;
+      stack.pop_back( );
+      if( bound > best_distance )
+        continue;
+      const OPFClassifierNode &cur = node[ nod ];
+      if( cur.left == 0 ) {
+        size_t size = cur.end - cur.begin;
+        DFIDE::Distances( sample, point.data( ) + cur.begin * features, size, features, distance );
+        for( size_t pos = 0; pos < size; ++pos ) {
+          size_t frt = cur.begin + pos;
+          if( ( distance[ pos ] < best_distance ) ||
+              ( ( distance[ pos ] == best_distance ) && ( order[ frt ] < best_order ) ) ) {
+            best_distance = distance[ pos ];
+            best_order = order[ frt ];
+            best_label = label[ frt ];
+          }
+        }
+      }
+      else {
+        double left_bound = BoxDistance( sample, cur.left, clamp );
+        double right_bound = BoxDistance( sample, cur.right, clamp );
+        if( left_bound < right_bound ) {
+          stack.push_back( std::make_pair( cur.right, right_bound ) );
+          stack.push_back( std::make_pair( cur.left, left_bound ) );
+        }
+        else {
+          stack.push_back( std::make_pair( cur.left, left_bound ) );
+          stack.push_back( std::make_pair( cur.right, right_bound ) );
+        }
+      }
+    }
+    return( best_label );
+  }
+
+  template< class D >
+  int OPFClassifier< D >::Classify( const D *sample ) const {
+    try {
+      Vector< D > clamp( features );
+      Vector< double > distance( max_leaf );
+      std::vector< std::pair< size_t, double > > stack;
+      return( Classify( sample, clamp.data( ), distance.data( ), stack ) );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+  }
+
+  template< class D >
+  void OPFClassifier< D >::Classify( Feature< D > &feature ) const {
+    try {
+      if( feature.Features( ) != features ) {
+        std::string msg( BIAL_ERROR( "Feature vector must have " + std::to_string( features ) +
+                                     " features. Given: " + std::to_string( feature.Features( ) ) + "." ) );
+        throw( std::logic_error( msg ) );
+      }
+      size_t elements = feature.Elements( );
+      auto classify = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< D > clamp( features );
+        Vector< double > distance( max_leaf );
+        std::vector< std::pair< size_t, double > > stack;
+        for( size_t elm = tsk * elements / tasks; elm < ( tsk + 1 ) * elements / tasks; ++elm ) {
+          if( feature.Label( elm ) == -1 ) {
+            feature.Label( elm ) = Classify( feature.data( ) + elm * features, clamp.data( ), distance.data( ),
+                                             stack );
+          }
+        }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( elements ), classify );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        classify( 0, 1 );
+      }
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+#ifdef BIAL_EXPLICIT_OPFClassifier
+
+  template class OPFClassifier< int >;
+  template class OPFClassifier< llint >;
+  template class OPFClassifier< float >;
+  template class OPFClassifier< double >;
+
+#endif
+
+}
+
+#endif
+
+#endif
@@ -97,19 +97,14 @@ namespace Bial {
                         float intensity_fraction ) {
     try {
       COMMENT( "Computing the maximum arc weight.", 1 );
-      size_t total_threads = 12;
-      Vector< float > max_distance( total_threads, 0.0 );
-      Vector< std::thread > threads;
-      for( size_t thd = 0; thd < total_threads; ++thd ) {
-        threads.push_back( std::thread( &OPF::MaxWeightThread< D >, std::ref( feature ), std::ref( label ),
-                                        std::ref( adjacency ), std::ref( max_distance( thd ) ),
-                                        thd, total_threads ) );
-      }
-      for( size_t thd = 0; thd < total_threads; ++thd ) {
-        threads( thd ).join( );
-      }
-      for( size_t thd = 1; thd < total_threads; ++thd ) {
-        max_distance( 0 ) = std::max( max_distance( 0 ), max_distance( thd ) );
+      ThreadPool &pool = ThreadPool::Global( );
+      size_t total_tasks = pool.Tasks( label.size( ) );
+      Vector< float > max_distance( total_tasks, 0.0 );
+      pool.Run( total_tasks, [ & ]( size_t tsk, size_t tasks ) {
+        MaxWeightThread( feature, label, adjacency, max_distance( tsk ), tsk, tasks );
+      } );
+      for( size_t tsk = 1; tsk < total_tasks; ++tsk ) {
+        max_distance( 0 ) = std::max( max_distance( 0 ), max_distance( tsk ) );
       }
       return( static_cast< float >( intensity_fraction ) * max_distance( 0 ) );
     }
@@ -129,20 +124,22 @@ namespace Bial {
       size_t adj_size = adjacency.size( );
       size_t min_pxl = thread * size / total_threads;
       size_t max_pxl = ( thread + 1 ) * size / total_threads;
+      size_t features = feature.Features( );
       AdjacencyIterator adj_itr( label, adjacency );
-      size_t adj_pxl;
+      Vector< size_t > adjacents( adj_size );
+      Vector< double > distance( adj_size );
       COMMENT( "Computing distance from all samples.", 2 );
       for( size_t pxl = min_pxl; pxl < max_pxl; ++pxl ) {
+        size_t adjs = 0;
         for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) ) {
-            double distance = DFIDE::Distance( feature, pxl * feature.Features( ), adj_pxl * feature.Features( ),
-                                               feature.Features( ) );
-            /* float distance = ( *BialDistanceFunction )( &feature( pxl, 0 ), &feature( adj_pxl, 0 ), 
-               feature.Features( ) ); 
-            */
-            if( max_distance < distance )
-              max_distance = distance;
-          }
+          if( adj_itr.AdjIdx( pxl, idx, adjacents[ adjs ] ) )
+            ++adjs;
+        }
+        DFIDE::Distances( feature.data( ) + pxl * features, feature.data( ), adjacents.data( ), adjs, features,
+                          distance.data( ) );
+        for( size_t adj = 0; adj < adjs; ++adj ) {
+          if( max_distance < distance[ adj ] )
+            max_distance = distance[ adj ];
         }
       }
     }
@@ -174,19 +171,14 @@ namespace Bial {
     }
     COMMENT( "sigma: " << sigma, 2 );
     try {
-      size_t total_threads = 12;
-      Vector< float > max_dens_diff( total_threads, 0.0 );
-      Vector< std::thread > threads;
-      for( size_t thd = 0; thd < total_threads; ++thd ) {
-        threads.push_back( std::thread( &OPF::PDFThread< D >, std::ref( feature ), std::ref( adjacency ),
-                                        std::ref( density ), sigma, std::ref( max_dens_diff( thd ) ), thd,
-                                        total_threads ) );
-      }
-      for( size_t thd = 0; thd < total_threads; ++thd ) {
-        threads( thd ).join( );
-      }
-      for( size_t thd = 1; thd < total_threads; ++thd ) {
-        max_dens_diff( 0 ) = std::max( max_dens_diff( 0 ), max_dens_diff( thd ) );
+      ThreadPool &pool = ThreadPool::Global( );
+      size_t total_tasks = pool.Tasks( density.size( ) );
+      Vector< float > max_dens_diff( total_tasks, 0.0 );
+      pool.Run( total_tasks, [ & ]( size_t tsk, size_t tasks ) {
+        PDFThread( feature, adjacency, density, sigma, max_dens_diff( tsk ), tsk, tasks );
+      } );
+      for( size_t tsk = 1; tsk < total_tasks; ++tsk ) {
+        max_dens_diff( 0 ) = std::max( max_dens_diff( 0 ), max_dens_diff( tsk ) );
       }
       return( max_dens_diff( 0 ) / 10000.0 );
     }
@@ -208,23 +200,23 @@ namespace Bial {
       size_t max_pxl = ( thread + 1 ) * size / total_threads;
       float mindens = std::numeric_limits< float >::max( );
       float maxdens = std::numeric_limits< float >::min( );
+      size_t features = feature.Features( );
       AdjacencyIterator adj_itr( density, adjacency );
-      size_t adj_pxl;
+      Vector< size_t > adjacents( adj_size );
+      Vector< double > arc_weight( adj_size );
       COMMENT( "Computing nodes density and the minimal and maximal densities.", 2 );
       for( size_t pxl = min_pxl; pxl < max_pxl; ++pxl ) {
         density[ pxl ] = 1.0;
-        size_t pixels = 1;
+        size_t adjs = 0;
         for( size_t idx = 0; idx < adj_size; ++idx ) {
-          if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) ) {
-            double arc_weight = DFIDE::Distance( feature, pxl * feature.Features( ), adj_pxl * feature.Features( ),
-                                                 feature.Features( ) );
-            /* float arc_weight = ( *BialDistanceFunction )( &feature( pxl, 0 ), &feature( adj_pxl, 0 ), feature.Features(
-             * ) ); 
-             */
-            ++pixels;
-            density[ pxl ] += exp( -arc_weight / sigma );
-          }
+          if( adj_itr.AdjIdx( pxl, idx, adjacents[ adjs ] ) )
+            ++adjs;
         }
+        DFIDE::Distances( feature.data( ) + pxl * features, feature.data( ), adjacents.data( ), adjs, features,
+                          arc_weight.data( ) );
+        for( size_t adj = 0; adj < adjs; ++adj )
+          density[ pxl ] += exp( -arc_weight[ adj ] / sigma );
+        size_t pixels = adjs + 1;
         density[ pxl ] /= pixels;
         if( mindens > density[ pxl ] ) {
           mindens = density[ pxl ];
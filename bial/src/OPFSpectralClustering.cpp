@@ -19,6 +19,7 @@
 
 #include "Feature.hpp"
 #include "Graph.hpp"
+#include "KdTreeGraphAdjacency.hpp"
 #include "KnnGraphAdjacency.hpp"
 #include "LSHGraphAdjacency.hpp"
 
@@ -68,21 +69,9 @@ namespace Bial {
     try {
       COMMENT( "Initializing graph with scales " << scale_min << " to " << scale_max << ".", 0 );
       graph.Initialize( feature, scale_min, scale_max );
-      size_t scales = graph.Scales( );
-      size_t best_scl = 0;
-      double min_cut = std::numeric_limits< double >::max( );
       COMMENT( "Computing the best scale by means of the minimum cut.", 0 );
-      for( size_t scl = 0; scl < scales; ++scl ) {
-        COMMENT( "Clustering and getting the number of labels.", 1 );
-        graph.Clustering( scl );
-        COMMENT( "Computing the normalized cut value from clusters.", 1 );
-        double cut = graph.NormalizedCut( scl );
-        COMMENT( "Updating the best number of neighbors by the minimum cut value.", 1 );
-        if( min_cut > cut ) {
-          min_cut = cut;
-          best_scl = scl;
-        }
-      }
+      size_t best_scl = graph.ScaleSweep( );
+      COMMENT( "Cut of each scale: " << graph.ScaleCut( ) << ". Time of each scale: " << graph.ScaleTime( ), 1 );
       COMMENT( "Clustering and computing the number of labels for " << best_scl << " neighbors.", 0 );
       size_t nlabels = graph.Clustering( best_scl );
       graph.GnuPlot2DScatter( "final_cluster", feature, best_scl );
@@ -216,6 +205,10 @@ namespace Bial {
                                            Graph< LSHGraphAdjacency > &graph );
   template size_t OPF::SpectralClustering( Feature< int > &feature, size_t clusters, 
                                            Graph< LSHGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< int > &feature, float scale_min, float scale_max,
+                                           Graph< KdTreeGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< int > &feature, size_t clusters,
+                                           Graph< KdTreeGraphAdjacency > &graph );
 
   template size_t OPF::SpectralClustering( Feature< llint > &feature, float scale_min, float scale_max );
   template size_t OPF::SpectralClustering( Feature< llint > &feature, size_t clusters );
@@ -227,6 +220,10 @@ namespace Bial {
                                            Graph< LSHGraphAdjacency > &graph );
   template size_t OPF::SpectralClustering( Feature< llint > &feature, size_t clusters, 
                                            Graph< LSHGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< llint > &feature, float scale_min, float scale_max,
+                                           Graph< KdTreeGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< llint > &feature, size_t clusters,
+                                           Graph< KdTreeGraphAdjacency > &graph );
 
   template size_t OPF::SpectralClustering( Feature< float > &feature, float scale_min, float scale_max );
   template size_t OPF::SpectralClustering( Feature< float > &feature, size_t clusters );
@@ -238,6 +235,10 @@ namespace Bial {
                                            Graph< LSHGraphAdjacency > &graph );
   template size_t OPF::SpectralClustering( Feature< float > &feature, size_t clusters, 
                                            Graph< LSHGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< float > &feature, float scale_min, float scale_max,
+                                           Graph< KdTreeGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< float > &feature, size_t clusters,
+                                           Graph< KdTreeGraphAdjacency > &graph );
 
   template size_t OPF::SpectralClustering( Feature< double > &feature, float scale_min, float scale_max );
   template size_t OPF::SpectralClustering( Feature< double > &feature, size_t clusters );
@@ -249,6 +250,10 @@ namespace Bial {
                                            Graph< LSHGraphAdjacency > &graph );
   template size_t OPF::SpectralClustering( Feature< double > &feature, size_t clusters, 
                                            Graph< LSHGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< double > &feature, float scale_min, float scale_max,
+                                           Graph< KdTreeGraphAdjacency > &graph );
+  template size_t OPF::SpectralClustering( Feature< double > &feature, size_t clusters,
+                                           Graph< KdTreeGraphAdjacency > &graph );
 
 #endif
 
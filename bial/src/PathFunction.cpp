@@ -28,7 +28,7 @@
 namespace Bial {
 
   template< template< class D > class C, class D > 
-  PathFunction< C, D >::PathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+  PathFunction< C, D >::PathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, 
                                       bool sequential_label ) try :
     value( &init_value ), label( init_label ), predecessor( init_predecessor ), next_label( -1 ) {
       if( ( ( init_label != nullptr ) && ( init_value.size( ) != init_label->size( ) ) ) ||
@@ -36,6 +36,11 @@ namespace Bial {
         std::string msg( BIAL_ERROR( "Image dimensions do not match." ) );
         throw( std::logic_error( msg ) );
       }
+      if( ( init_predecessor != nullptr ) &&
+          ( init_predecessor->size( ) > static_cast< size_t >( std::numeric_limits< bial_index >::max( ) ) ) ) {
+        std::string msg( BIAL_ERROR( "Predecessor map is too large for bial_index. Undefine BIAL_SMALL_VOLUME." ) );
+        throw( std::logic_error( msg ) );
+      }
       if( sequential_label ) {
         COMMENT( "Sequential label.", 0 );
         next_label = 0;
@@ -258,6 +263,26 @@ namespace Bial {
       PropagateData = &PathFunction< C, D >::Propagate;
   }
 
+  template< template< class D > class C, class D >
+  C< int > *PathFunction< C, D >::Label( ) {
+    return( label );
+  }
+
+  template< template< class D > class C, class D >
+  C< bial_index > *PathFunction< C, D >::Predecessor( ) {
+    return( predecessor );
+  }
+
+  template< template< class D > class C, class D >
+  int PathFunction< C, D >::NextLabel( ) const {
+    return( next_label );
+  }
+
+  template< template< class D > class C, class D >
+  void PathFunction< C, D >::NextLabel( int new_label ) {
+    if( next_label != -1 )
+      next_label = new_label;
+  }
 
 #ifdef BIAL_EXPLICIT_PathFunction
 
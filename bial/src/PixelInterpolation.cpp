@@ -88,6 +88,40 @@ namespace Bial {
     return( LinearInterpolation::operator()< double >( img, x, y, z ) );
   }
 
+  /* CubicBSplineInterpolation ------------------------------------------------------------------------------------- **/
+
+  int CubicBSplineInterpolation::operator()( const Image< int > &img, float x, float y ) const {
+    return( CubicBSplineInterpolation::operator()< int >( img, x, y ) );
+  }
+
+  llint CubicBSplineInterpolation::operator()( const Image< llint > &img, float x, float y ) const {
+    return( CubicBSplineInterpolation::operator()< llint >( img, x, y ) );
+  }
+
+  float CubicBSplineInterpolation::operator()( const Image< float > &img, float x, float y ) const {
+    return( CubicBSplineInterpolation::operator()< float >( img, x, y ) );
+  }
+
+  double CubicBSplineInterpolation::operator()( const Image< double > &img, float x, float y ) const {
+    return( CubicBSplineInterpolation::operator()< double >( img, x, y ) );
+  }
+
+  int CubicBSplineInterpolation::operator()( const Image< int > &img, float x, float y, float z ) const {
+    return( CubicBSplineInterpolation::operator()< int >( img, x, y, z ) );
+  }
+
+  llint CubicBSplineInterpolation::operator()( const Image< llint > &img, float x, float y, float z ) const {
+    return( CubicBSplineInterpolation::operator()< llint >( img, x, y, z ) );
+  }
+
+  float CubicBSplineInterpolation::operator()( const Image< float > &img, float x, float y, float z ) const {
+    return( CubicBSplineInterpolation::operator()< float >( img, x, y, z ) );
+  }
+
+  double CubicBSplineInterpolation::operator()( const Image< double > &img, float x, float y, float z ) const {
+    return( CubicBSplineInterpolation::operator()< double >( img, x, y, z ) );
+  }
+
 }
 
 #endif
@@ -0,0 +1,295 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Order statistics of a window sliding along image rows. Used by median filter and median features.
+ */
+
+#ifndef BIALRANKWINDOW_C
+#define BIALRANKWINDOW_C
+
+#include "RankWindow.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_RankWindow )
+#define BIAL_EXPLICIT_RankWindow
+#endif
+
+#if defined ( BIAL_EXPLICIT_RankWindow ) || ( BIAL_IMPLICIT_BIN )
+
+#include "Adjacency.hpp"
+#include "Image.hpp"
+#include <type_traits>
+
+namespace Bial {
+
+  template< class D >
+  RankSet< D >::RankSet( D minimum, D maximum, size_t capacity, size_t ranks ) : histogram( false ),
+    minimum( minimum ), bin( 0 ), below( 0 ), elements( 0 ) {
+    try {
+      if( maximum < minimum ) {
+        std::string msg( BIAL_ERROR( "Maximum value is smaller than minimum value." ) );
+        throw( std::logic_error( msg ) );
+      }
+      double range = static_cast< double >( maximum ) - static_cast< double >( minimum );
+      histogram = ( std::is_integral< D >::value ) && ( range < histogram_limit ) &&
+        ( ( ranks <= 1 ) || ( range < 2.0 * capacity ) );
+      if( histogram )
+        count = Vector< size_t >( static_cast< size_t >( maximum - minimum ) + 1, 0 );
+      else
+        sorted = Vector< D >( capacity );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  void RankSet< D >::Insert( D value, size_t copies ) {
+    if( histogram ) {
+      size_t idx = static_cast< size_t >( value - minimum );
+      count[ idx ] += copies;
+      if( idx < bin )
+        below += copies;
+    }
+    else {
+      D *data = sorted.data( );
+      D *pos = std::upper_bound( data, data + elements, value );
+      std::copy_backward( pos, data + elements, data + elements + copies );
+      std::fill( pos, pos + copies, value );
+    }
+    elements += copies;
+  }
+
+  template< class D >
+  void RankSet< D >::Remove( D value, size_t copies ) {
+    if( histogram ) {
+      size_t idx = static_cast< size_t >( value - minimum );
+      count[ idx ] -= copies;
+      if( idx < bin )
+        below -= copies;
+    }
+    else {
+      D *data = sorted.data( );
+      D *pos = std::lower_bound( data, data + elements, value );
+      std::copy( pos + copies, data + elements, pos );
+    }
+    elements -= copies;
+  }
+
+  template< class D >
+  void RankSet< D >::Replace( D old_value, D new_value ) {
+    if( histogram ) {
+      Remove( old_value );
+      Insert( new_value );
+      return;
+    }
+    D *data = sorted.data( );
+    D *end = data + elements;
+    if( new_value > old_value ) {
+      D *src = std::upper_bound( data, end, old_value ) - 1;
+      D *tgt = std::lower_bound( src, end, new_value ) - 1;
+      std::copy( src + 1, tgt + 1, src );
+      *tgt = new_value;
+    }
+    else if( new_value < old_value ) {
+      D *src = std::lower_bound( data, end, old_value );
+      D *tgt = std::upper_bound( data, src, new_value );
+      std::copy_backward( tgt, src, src + 1 );
+      *tgt = new_value;
+    }
+  }
+
+  template< class D >
+  D RankSet< D >::Rank( size_t rank ) {
+    if( !histogram )
+      return( sorted[ rank ] );
+    COMMENT( "Moving rank pointer from last query.", 4 );
+    while( below > rank ) {
+      --bin;
+      below -= count[ bin ];
+    }
+    while( below + count[ bin ] <= rank ) {
+      below += count[ bin ];
+      ++bin;
+    }
+    return( static_cast< D >( minimum + bin ) );
+  }
+
+  template< class D >
+  size_t RankSet< D >::size( ) const {
+    return( elements );
+  }
+
+  template< class D >
+  void RankSet< D >::Clear( ) {
+    if( histogram )
+      count.Set( 0 );
+    bin = 0;
+    below = 0;
+    elements = 0;
+  }
+
+  template< class D >
+  RankWindow< D >::RankWindow( const Image< D > &img, const Adjacency &adj, D minimum, D maximum,
+                               const Image< D > *msk, size_t ranks ) try :
+    img( img ), msk( msk ), dx( adj.size( ) ), dy( adj.size( ), 0 ), dz( adj.size( ), 0 ),
+    displacement( adj.size( ) ), row_valid( adj.size( ) ), values( minimum, maximum, adj.size( ), ranks ), x( 0 ),
+    y( 0 ), z( 0 ), filled( false ) {
+    if( img.Dims( ) != adj.Dims( ) ) {
+      std::string msg( BIAL_ERROR( "Image and adjacency relation dimensions do not match. Image dimensions: " +
+                                   std::to_string( img.Dims( ) ) + ", adjacency dimensions: " +
+                                   std::to_string( adj.Dims( ) ) ) );
+      throw( std::logic_error( msg ) );
+    }
+    if( ( msk != nullptr ) && ( msk->size( ) != img.size( ) ) ) {
+      std::string msg( BIAL_ERROR( "Image and mask sizes do not match." ) );
+      throw( std::logic_error( msg ) );
+    }
+    size_t adj_size = adj.size( );
+    llint x_size = img.size( 0 );
+    llint xy_size = x_size * static_cast< llint >( img.size( 1 ) );
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      dx[ idx ] = adj( idx, 0 );
+      if( adj.Dims( ) > 1 )
+        dy[ idx ] = adj( idx, 1 );
+      if( adj.Dims( ) > 2 )
+        dz[ idx ] = adj( idx, 2 );
+      displacement[ idx ] = dx[ idx ] + static_cast< llint >( dy[ idx ] ) * x_size +
+        static_cast< llint >( dz[ idx ] ) * xy_size;
+    }
+    COMMENT( "Computing leaving and entering faces of the adjacency relation.", 2 );
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      bool has_previous = false;
+      bool has_next = false;
+      for( size_t oth = 0; oth < adj_size; ++oth ) {
+        if( ( dy[ oth ] == dy[ idx ] ) && ( dz[ oth ] == dz[ idx ] ) ) {
+          if( dx[ oth ] == dx[ idx ] - 1 )
+            has_previous = true;
+          if( dx[ oth ] == dx[ idx ] + 1 )
+            has_next = true;
+        }
+      }
+      if( !has_previous )
+        leaving.push_back( idx );
+      if( !has_next )
+        entering.push_back( idx );
+    }
+    old_index = Vector< size_t >( leaving.size( ) );
+  }
+  catch( std::bad_alloc &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( std::runtime_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+    throw( std::runtime_error( msg ) );
+  }
+  catch( const std::out_of_range &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+    throw( std::out_of_range( msg ) );
+  }
+  catch( const std::logic_error &e ) {
+    std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+    throw( std::logic_error( msg ) );
+  }
+
+  template< class D >
+  size_t RankWindow< D >::Adjacent( size_t adj ) const {
+    llint adj_x = static_cast< llint >( x ) + dx[ adj ];
+    if( ( !row_valid[ adj ] ) || ( adj_x < 0 ) || ( adj_x >= static_cast< llint >( img.size( 0 ) ) ) )
+      return( img.size( ) );
+    size_t index = static_cast< size_t >( static_cast< llint >( x + img.size( 0 ) * ( y + img.size( 1 ) * z ) ) +
+                                          displacement[ adj ] );
+    if( ( msk != nullptr ) && ( ( *msk )[ index ] == 0 ) )
+      return( img.size( ) );
+    return( index );
+  }
+
+  template< class D >
+  void RankWindow< D >::Row( size_t y, size_t z ) {
+    size_t adj_size = dx.size( );
+    size_t img_size = img.size( );
+    if( filled ) {
+      COMMENT( "Removing the adjacents of the last pixel. Cheaper than clearing a histogram.", 4 );
+      for( size_t adj = 0; adj < adj_size; ++adj ) {
+        size_t index = Adjacent( adj );
+        if( index != img_size )
+          values.Remove( img[ index ] );
+      }
+    }
+    this->x = 0;
+    this->y = y;
+    this->z = z;
+    llint y_size = img.size( 1 );
+    llint z_size = img.size( 2 );
+    for( size_t adj = 0; adj < adj_size; ++adj ) {
+      llint adj_y = static_cast< llint >( y ) + dy[ adj ];
+      llint adj_z = static_cast< llint >( z ) + dz[ adj ];
+      row_valid[ adj ] = ( adj_y >= 0 ) && ( adj_y < y_size ) && ( adj_z >= 0 ) && ( adj_z < z_size );
+    }
+    for( size_t adj = 0; adj < adj_size; ++adj ) {
+      size_t index = Adjacent( adj );
+      if( index != img_size )
+        values.Insert( img[ index ] );
+    }
+    filled = true;
+  }
+
+  template< class D >
+  void RankWindow< D >::Next( ) {
+    size_t img_size = img.size( );
+    size_t faces = leaving.size( );
+    COMMENT( "Each line of the adjacency relation in x has one leaving and one entering adjacent.", 4 );
+    for( size_t idx = 0; idx < faces; ++idx )
+      old_index[ idx ] = Adjacent( leaving[ idx ] );
+    ++x;
+    for( size_t idx = 0; idx < faces; ++idx ) {
+      size_t new_index = Adjacent( entering[ idx ] );
+      if( ( old_index[ idx ] != img_size ) && ( new_index != img_size ) )
+        values.Replace( img[ old_index[ idx ] ], img[ new_index ] );
+      else if( old_index[ idx ] != img_size )
+        values.Remove( img[ old_index[ idx ] ] );
+      else if( new_index != img_size )
+        values.Insert( img[ new_index ] );
+    }
+  }
+
+  template< class D >
+  RankSet< D > &RankWindow< D >::Values( ) {
+    return( values );
+  }
+
+#ifdef BIAL_EXPLICIT_RankWindow
+
+  template class RankSet< int >;
+  template class RankSet< llint >;
+  template class RankSet< float >;
+  template class RankSet< double >;
+
+  template class RankWindow< int >;
+  template class RankWindow< llint >;
+  template class RankWindow< float >;
+  template class RankWindow< double >;
+
+#endif
+
+}
+
+#endif
+
+#endif
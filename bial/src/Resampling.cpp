@@ -0,0 +1,537 @@
+/* Biomedical Image Analysis Library
+ * See README file in the root instalation directory for more information.
+ */
+
+/**
+ * @date 2026/Oct/18
+ * @brief Image resampling templated on the pixel interpolation.
+ */
+
+#ifndef BIALRESAMPLING_C
+#define BIALRESAMPLING_C
+
+#include "Resampling.hpp"
+
+#if defined ( BIAL_EXPLICIT_LIB ) && ( BIAL_Resampling )
+#define BIAL_EXPLICIT_Resampling
+#endif
+#if defined ( BIAL_EXPLICIT_Resampling ) || ( BIAL_IMPLICIT_BIN )
+
+#include "Image.hpp"
+#include "Matrix.hpp"
+#include "PixelInterpolation.hpp"
+#include <typeinfo>
+
+namespace Bial {
+
+  /**
+   * @brief Image whose interpolation by I gives the resampled image: the image itself, or its B-spline
+   * coefficients for cubic interpolation.
+   */
+  template< class D >
+  static inline const Image< D > &ResamplingSource( const Image< D > &img, const PixelInterpolation* ) {
+    return( img );
+  }
+
+  template< class D >
+  static inline Image< Resampling::Real< D > > ResamplingSource( const Image< D > &img,
+                                                                 const CubicBSplineInterpolation* ) {
+    return( Resampling::BSplineCoefficients( img ) );
+  }
+
+  /** @brief Converts an interpolated value to the image type. Cubic interpolation of integers is rounded. */
+  template< class I, class D, class R >
+  static inline D ResamplingStore( R value ) {
+    if( ( std::is_same< I, CubicBSplineInterpolation >::value ) && ( std::is_integral< D >::value ) )
+      return( static_cast< D >( std::round( value ) ) );
+    return( static_cast< D >( value ) );
+  }
+
+  /** @brief Runs task( tsk, tasks ) over the thread pool, or in the calling thread if the pool fails. */
+  template< class F >
+  static void ResamplingRun( size_t size, F task ) {
+    try {
+      ThreadPool &pool = ThreadPool::Global( );
+      pool.Run( pool.Tasks( size ), task );
+    }
+    catch( std::exception &e ) {
+      BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+      task( 0, 1 );
+    }
+  }
+
+  template< class D >
+  Image< Resampling::Real< D > > Resampling::BSplineCoefficients( const Image< D > &img ) {
+    try {
+      typedef Real< D > R;
+      Image< R > res( img.Dim( ), img.PixelSize( ) );
+      for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+        res[ pxl ] = static_cast< R >( img[ pxl ] );
+      const R pole = std::sqrt( static_cast< R >( 3.0 ) ) - 2;
+      const R gain = 6;
+      COMMENT( "Number of terms of the causal initialization for double precision.", 2 );
+      const size_t horizon = std::ceil( std::log( 1.0e-15 ) / std::log( std::abs( pole ) ) );
+      size_t dim_size[ 3 ] = { img.size( 0 ), img.size( 1 ), img.size( 2 ) };
+      for( size_t dim = 0; dim < 3; ++dim ) {
+        size_t size = dim_size[ dim ];
+        if( size < 2 )
+          continue;
+        size_t stride = 1;
+        for( size_t dms = 0; dms < dim; ++dms )
+          stride *= dim_size[ dms ];
+        size_t lines = img.size( ) / size;
+        auto filter = [ & ]( size_t tsk, size_t tasks ) {
+          std::vector< R > line( size );
+          size_t min_line = tsk * lines / tasks;
+          size_t max_line = ( tsk + 1 ) * lines / tasks;
+          for( size_t lin = min_line; lin < max_line; ++lin ) {
+            size_t first = ( lin / stride ) * stride * size + lin % stride;
+            for( size_t elm = 0; elm < size; ++elm )
+              line[ elm ] = res[ first + elm * stride ] * gain;
+            COMMENT( "Causal initialization with mirrored borders.", 4 );
+            if( horizon < size ) {
+              R zn = pole;
+              R sum = line[ 0 ];
+              for( size_t elm = 1; elm < horizon; ++elm ) {
+                sum += zn * line[ elm ];
+                zn *= pole;
+              }
+              line[ 0 ] = sum;
+            }
+            else {
+              R zn = pole;
+              R iz = 1 / pole;
+              R z2n = std::pow( pole, static_cast< R >( size - 1 ) );
+              R sum = line[ 0 ] + z2n * line[ size - 1 ];
+              z2n *= z2n * iz;
+              for( size_t elm = 1; elm < size - 1; ++elm ) {
+                sum += ( zn + z2n ) * line[ elm ];
+                zn *= pole;
+                z2n *= iz;
+              }
+              line[ 0 ] = sum / ( 1 - zn * zn );
+            }
+            for( size_t elm = 1; elm < size; ++elm )
+              line[ elm ] += pole * line[ elm - 1 ];
+            COMMENT( "Anticausal initialization and filter.", 4 );
+            line[ size - 1 ] = ( pole / ( pole * pole - 1 ) ) * ( pole * line[ size - 2 ] + line[ size - 1 ] );
+            for( size_t elm = size - 1; elm > 0; --elm )
+              line[ elm - 1 ] = pole * ( line[ elm ] - line[ elm - 1 ] );
+            for( size_t elm = 0; elm < size; ++elm )
+              res[ first + elm * stride ] = line[ elm ];
+          }
+        };
+        ResamplingRun( lines, filter );
+      }
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class I, class D >
+  Image< D > Resampling::Affine( const Image< D > &img, const Matrix< float > &transform ) {
+    try {
+      size_t dims = img.Dims( );
+      COMMENT( "Coordinate u of dimension i contributes u * transform( i, j ) to coordinate j of the input image. "
+               "Row 3 holds the translation.", 2 );
+      double mat[ 4 ][ 3 ] = { { 0.0 } };
+      for( size_t row = 0; row < 4; ++row ) {
+        if( ( dims == 2 ) && ( row == 2 ) )
+          continue;
+        for( size_t col = 0; col < dims; ++col )
+          mat[ row ][ col ] = transform( row, col );
+      }
+      if( ( mat[ 1 ][ 0 ] == 0.0 ) && ( mat[ 2 ][ 0 ] == 0.0 ) && ( mat[ 0 ][ 1 ] == 0.0 ) &&
+          ( mat[ 2 ][ 1 ] == 0.0 ) && ( mat[ 0 ][ 2 ] == 0.0 ) && ( mat[ 1 ][ 2 ] == 0.0 ) ) {
+        COMMENT( "No rotation or shear.", 0 );
+        Vector< double > scale( dims );
+        Vector< double > translation( dims );
+        for( size_t dms = 0; dms < dims; ++dms ) {
+          scale[ dms ] = mat[ dms ][ dms ];
+          translation[ dms ] = mat[ 3 ][ dms ];
+        }
+        return( Separable< I >( img, img.Dim( ), img.PixelSize( ), scale, translation ) );
+      }
+      Image< D > res( img.Dim( ), img.PixelSize( ) );
+      const auto &src = ResamplingSource( img, static_cast< const I* >( nullptr ) );
+      const auto *data = src.data( );
+      size_t x_size = img.size( 0 );
+      size_t y_size = img.size( 1 );
+      size_t z_size = img.size( 2 );
+      size_t rows = y_size * z_size;
+      COMMENT( "Each task transforms a slab of consecutive rows. Row coordinates are stepped along the row.", 0 );
+      auto resample = [ & ]( size_t tsk, size_t tasks ) {
+        std::vector< float > x( x_size );
+        std::vector< float > y( x_size );
+        std::vector< float > z( x_size );
+        size_t min_row = tsk * rows / tasks;
+        size_t max_row = ( tsk + 1 ) * rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          double v = static_cast< double >( row % y_size );
+          double w = static_cast< double >( row / y_size );
+          double x0 = v * mat[ 1 ][ 0 ] + w * mat[ 2 ][ 0 ] + mat[ 3 ][ 0 ];
+          double y0 = v * mat[ 1 ][ 1 ] + w * mat[ 2 ][ 1 ] + mat[ 3 ][ 1 ];
+          double z0 = v * mat[ 1 ][ 2 ] + w * mat[ 2 ][ 2 ] + mat[ 3 ][ 2 ];
+#pragma omp simd
+          for( size_t u = 0; u < x_size; ++u ) {
+            x[ u ] = static_cast< float >( x0 + u * mat[ 0 ][ 0 ] );
+            y[ u ] = static_cast< float >( y0 + u * mat[ 0 ][ 1 ] );
+            z[ u ] = static_cast< float >( z0 + u * mat[ 0 ][ 2 ] );
+          }
+          D *dst = res.data( ) + row * x_size;
+          if( dims == 2 ) {
+            for( size_t u = 0; u < x_size; ++u )
+              dst[ u ] = ResamplingStore< I, D >( I::Sample( data, x_size, y_size, x[ u ], y[ u ] ) );
+          }
+          else {
+            for( size_t u = 0; u < x_size; ++u )
+              dst[ u ] = ResamplingStore< I, D >( I::Sample( data, x_size, y_size, z_size, x[ u ], y[ u ], z[ u ] ) );
+          }
+        }
+      };
+      ResamplingRun( rows, resample );
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class I, class D >
+  Image< D > Resampling::Separable( const Image< D > &img, const Vector< size_t > &dim,
+                                    const Vector< float > &pixel_size, const Vector< double > &scale,
+                                    const Vector< double > &translation ) {
+    try {
+      typedef Real< D > R;
+      const size_t taps = I::Taps;
+      size_t dims = img.Dims( );
+      Image< D > res( dim, pixel_size );
+      size_t in_size[ 3 ] = { img.size( 0 ), img.size( 1 ), img.size( 2 ) };
+      size_t out_size[ 3 ] = { res.size( 0 ), res.size( 1 ), res.size( 2 ) };
+      COMMENT( "Indexes and weights of each output coordinate. Coordinates out of the image have null weights. "
+               "The third dimension of 2D images is copied.", 0 );
+      std::vector< size_t > index[ 3 ];
+      std::vector< R > weight[ 3 ];
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        index[ dms ].assign( out_size[ dms ] * taps, 0 );
+        weight[ dms ].assign( out_size[ dms ] * taps, 0 );
+        for( size_t crd = 0; crd < out_size[ dms ]; ++crd ) {
+          if( dms >= dims ) {
+            weight[ dms ][ crd * taps ] = 1;
+            continue;
+          }
+          float coord = static_cast< float >( crd * scale[ dms ] + translation[ dms ] );
+          I::Weights( coord, in_size[ dms ], &index[ dms ][ crd * taps ], &weight[ dms ][ crd * taps ] );
+        }
+      }
+      size_t x_size = out_size[ 0 ];
+      size_t rows = out_size[ 1 ] * out_size[ 2 ];
+      if( taps == 1 ) {
+        COMMENT( "Nearest interpolation copies the pixels.", 0 );
+        auto copy = [ & ]( size_t tsk, size_t tasks ) {
+          size_t min_row = tsk * rows / tasks;
+          size_t max_row = ( tsk + 1 ) * rows / tasks;
+          for( size_t row = min_row; row < max_row; ++row ) {
+            size_t v = row % out_size[ 1 ];
+            size_t w = row / out_size[ 1 ];
+            D *dst = res.data( ) + row * x_size;
+            if( ( weight[ 1 ][ v ] == 0 ) || ( weight[ 2 ][ w ] == 0 ) ) {
+              std::fill( dst, dst + x_size, 0 );
+              continue;
+            }
+            const D *src = img.data( ) + in_size[ 0 ] * ( index[ 1 ][ v ] + in_size[ 1 ] * index[ 2 ][ w ] );
+            for( size_t u = 0; u < x_size; ++u )
+              dst[ u ] = ( weight[ 0 ][ u ] != 0 ) ? src[ index[ 0 ][ u ] ] : 0;
+          }
+        };
+        ResamplingRun( rows, copy );
+        return( res );
+      }
+      const auto &src = ResamplingSource( img, static_cast< const I* >( nullptr ) );
+      const auto *data = src.data( );
+      COMMENT( "Input slices used by some output slice.", 0 );
+      std::vector< char > used( in_size[ 2 ], 0 );
+      for( size_t tap = 0; tap < weight[ 2 ].size( ); ++tap ) {
+        if( weight[ 2 ][ tap ] != 0 )
+          used[ index[ 2 ][ tap ] ] = 1;
+      }
+      COMMENT( "First pass: interpolates input rows along the first dimension.", 0 );
+      size_t x_rows = in_size[ 1 ] * in_size[ 2 ];
+      std::vector< R > x_pass( x_rows * x_size );
+      auto first_pass = [ & ]( size_t tsk, size_t tasks ) {
+        const size_t *idx = index[ 0 ].data( );
+        const R *wgt = weight[ 0 ].data( );
+        size_t min_row = tsk * x_rows / tasks;
+        size_t max_row = ( tsk + 1 ) * x_rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          if( !used[ row / in_size[ 1 ] ] )
+            continue;
+          const auto *line = data + row * in_size[ 0 ];
+          R *dst = x_pass.data( ) + row * x_size;
+#pragma omp simd
+          for( size_t u = 0; u < x_size; ++u ) {
+            R acc = 0;
+            for( size_t tap = 0; tap < taps; ++tap )
+              acc += wgt[ u * taps + tap ] * line[ idx[ u * taps + tap ] ];
+            dst[ u ] = acc;
+          }
+        }
+      };
+      ResamplingRun( x_rows, first_pass );
+      COMMENT( "Second pass: combines rows along the second dimension.", 0 );
+      size_t y_rows = out_size[ 1 ] * in_size[ 2 ];
+      std::vector< R > y_pass( y_rows * x_size );
+      auto second_pass = [ & ]( size_t tsk, size_t tasks ) {
+        size_t min_row = tsk * y_rows / tasks;
+        size_t max_row = ( tsk + 1 ) * y_rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          size_t v = row % out_size[ 1 ];
+          size_t z = row / out_size[ 1 ];
+          if( !used[ z ] )
+            continue;
+          R *dst = y_pass.data( ) + row * x_size;
+          std::fill( dst, dst + x_size, 0 );
+          for( size_t tap = 0; tap < taps; ++tap ) {
+            R wgt = weight[ 1 ][ v * taps + tap ];
+            if( wgt == 0 )
+              continue;
+            const R *line = x_pass.data( ) + ( z * in_size[ 1 ] + index[ 1 ][ v * taps + tap ] ) * x_size;
+#pragma omp simd
+            for( size_t u = 0; u < x_size; ++u )
+              dst[ u ] += wgt * line[ u ];
+          }
+        }
+      };
+      ResamplingRun( y_rows, second_pass );
+      COMMENT( "Third pass: combines rows along the third dimension into the output image.", 0 );
+      auto third_pass = [ & ]( size_t tsk, size_t tasks ) {
+        std::vector< R > acc( x_size );
+        size_t min_row = tsk * rows / tasks;
+        size_t max_row = ( tsk + 1 ) * rows / tasks;
+        for( size_t row = min_row; row < max_row; ++row ) {
+          size_t v = row % out_size[ 1 ];
+          size_t w = row / out_size[ 1 ];
+          std::fill( acc.begin( ), acc.end( ), 0 );
+          for( size_t tap = 0; tap < taps; ++tap ) {
+            R wgt = weight[ 2 ][ w * taps + tap ];
+            if( wgt == 0 )
+              continue;
+            const R *line = y_pass.data( ) + ( index[ 2 ][ w * taps + tap ] * out_size[ 1 ] + v ) * x_size;
+#pragma omp simd
+            for( size_t u = 0; u < x_size; ++u )
+              acc[ u ] += wgt * line[ u ];
+          }
+          D *dst = res.data( ) + row * x_size;
+          for( size_t u = 0; u < x_size; ++u )
+            dst[ u ] = ResamplingStore< I, D >( acc[ u ] );
+        }
+      };
+      ResamplingRun( rows, third_pass );
+      return( res );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  bool Resampling::Affine( const Image< D > &img, const Matrix< float > &transform,
+                           const PixelInterpolation &interpolation, Image< D > &res ) {
+    COMMENT( "Exact types only: derived classes may override the interpolation.", 2 );
+    if( typeid( interpolation ) == typeid( NearestInterpolation ) )
+      res = Affine< NearestInterpolation >( img, transform );
+    else if( typeid( interpolation ) == typeid( LinearInterpolation ) )
+      res = Affine< LinearInterpolation >( img, transform );
+    else if( typeid( interpolation ) == typeid( CubicBSplineInterpolation ) )
+      res = Affine< CubicBSplineInterpolation >( img, transform );
+    else
+      return( false );
+    return( true );
+  }
+
+  template< class D >
+  bool Resampling::Separable( const Image< D > &img, const Vector< size_t > &dim, const Vector< float > &pixel_size,
+                              const Vector< double > &scale, const Vector< double > &translation,
+                              const PixelInterpolation &interpolation, Image< D > &res ) {
+    if( typeid( interpolation ) == typeid( NearestInterpolation ) )
+      res = Separable< NearestInterpolation >( img, dim, pixel_size, scale, translation );
+    else if( typeid( interpolation ) == typeid( LinearInterpolation ) )
+      res = Separable< LinearInterpolation >( img, dim, pixel_size, scale, translation );
+    else if( typeid( interpolation ) == typeid( CubicBSplineInterpolation ) )
+      res = Separable< CubicBSplineInterpolation >( img, dim, pixel_size, scale, translation );
+    else
+      return( false );
+    return( true );
+  }
+
+#ifdef BIAL_EXPLICIT_Resampling
+
+  template Image< int > Resampling::Affine< NearestInterpolation >( const Image< int > &img,
+                                                                    const Matrix< float > &transform );
+  template Image< llint > Resampling::Affine< NearestInterpolation >( const Image< llint > &img,
+                                                                      const Matrix< float > &transform );
+  template Image< float > Resampling::Affine< NearestInterpolation >( const Image< float > &img,
+                                                                      const Matrix< float > &transform );
+  template Image< double > Resampling::Affine< NearestInterpolation >( const Image< double > &img,
+                                                                       const Matrix< float > &transform );
+
+  template Image< int > Resampling::Affine< LinearInterpolation >( const Image< int > &img,
+                                                                   const Matrix< float > &transform );
+  template Image< llint > Resampling::Affine< LinearInterpolation >( const Image< llint > &img,
+                                                                     const Matrix< float > &transform );
+  template Image< float > Resampling::Affine< LinearInterpolation >( const Image< float > &img,
+                                                                     const Matrix< float > &transform );
+  template Image< double > Resampling::Affine< LinearInterpolation >( const Image< double > &img,
+                                                                      const Matrix< float > &transform );
+
+  template Image< int > Resampling::Affine< CubicBSplineInterpolation >( const Image< int > &img,
+                                                                         const Matrix< float > &transform );
+  template Image< llint > Resampling::Affine< CubicBSplineInterpolation >( const Image< llint > &img,
+                                                                           const Matrix< float > &transform );
+  template Image< float > Resampling::Affine< CubicBSplineInterpolation >( const Image< float > &img,
+                                                                           const Matrix< float > &transform );
+  template Image< double > Resampling::Affine< CubicBSplineInterpolation >( const Image< double > &img,
+                                                                            const Matrix< float > &transform );
+
+  template Image< int > Resampling::Separable< NearestInterpolation >( const Image< int > &img,
+                                                                       const Vector< size_t > &dim,
+                                                                       const Vector< float > &pixel_size,
+                                                                       const Vector< double > &scale,
+                                                                       const Vector< double > &translation );
+  template Image< llint > Resampling::Separable< NearestInterpolation >( const Image< llint > &img,
+                                                                         const Vector< size_t > &dim,
+                                                                         const Vector< float > &pixel_size,
+                                                                         const Vector< double > &scale,
+                                                                         const Vector< double > &translation );
+  template Image< float > Resampling::Separable< NearestInterpolation >( const Image< float > &img,
+                                                                         const Vector< size_t > &dim,
+                                                                         const Vector< float > &pixel_size,
+                                                                         const Vector< double > &scale,
+                                                                         const Vector< double > &translation );
+  template Image< double > Resampling::Separable< NearestInterpolation >( const Image< double > &img,
+                                                                          const Vector< size_t > &dim,
+                                                                          const Vector< float > &pixel_size,
+                                                                          const Vector< double > &scale,
+                                                                          const Vector< double > &translation );
+
+  template Image< int > Resampling::Separable< LinearInterpolation >( const Image< int > &img,
+                                                                      const Vector< size_t > &dim,
+                                                                      const Vector< float > &pixel_size,
+                                                                      const Vector< double > &scale,
+                                                                      const Vector< double > &translation );
+  template Image< llint > Resampling::Separable< LinearInterpolation >( const Image< llint > &img,
+                                                                        const Vector< size_t > &dim,
+                                                                        const Vector< float > &pixel_size,
+                                                                        const Vector< double > &scale,
+                                                                        const Vector< double > &translation );
+  template Image< float > Resampling::Separable< LinearInterpolation >( const Image< float > &img,
+                                                                        const Vector< size_t > &dim,
+                                                                        const Vector< float > &pixel_size,
+                                                                        const Vector< double > &scale,
+                                                                        const Vector< double > &translation );
+  template Image< double > Resampling::Separable< LinearInterpolation >( const Image< double > &img,
+                                                                         const Vector< size_t > &dim,
+                                                                         const Vector< float > &pixel_size,
+                                                                         const Vector< double > &scale,
+                                                                         const Vector< double > &translation );
+
+  template Image< int > Resampling::Separable< CubicBSplineInterpolation >( const Image< int > &img,
+                                                                            const Vector< size_t > &dim,
+                                                                            const Vector< float > &pixel_size,
+                                                                            const Vector< double > &scale,
+                                                                            const Vector< double > &translation );
+  template Image< llint > Resampling::Separable< CubicBSplineInterpolation >( const Image< llint > &img,
+                                                                              const Vector< size_t > &dim,
+                                                                              const Vector< float > &pixel_size,
+                                                                              const Vector< double > &scale,
+                                                                              const Vector< double > &translation );
+  template Image< float > Resampling::Separable< CubicBSplineInterpolation >( const Image< float > &img,
+                                                                              const Vector< size_t > &dim,
+                                                                              const Vector< float > &pixel_size,
+                                                                              const Vector< double > &scale,
+                                                                              const Vector< double > &translation );
+  template Image< double > Resampling::Separable< CubicBSplineInterpolation >( const Image< double > &img,
+                                                                               const Vector< size_t > &dim,
+                                                                               const Vector< float > &pixel_size,
+                                                                               const Vector< double > &scale,
+                                                                               const Vector< double > &translation );
+
+  template Image< float > Resampling::BSplineCoefficients( const Image< int > &img );
+  template Image< double > Resampling::BSplineCoefficients( const Image< llint > &img );
+  template Image< float > Resampling::BSplineCoefficients( const Image< float > &img );
+  template Image< double > Resampling::BSplineCoefficients( const Image< double > &img );
+
+  template bool Resampling::Affine( const Image< int > &img, const Matrix< float > &transform,
+                                    const PixelInterpolation &interpolation, Image< int > &res );
+  template bool Resampling::Affine( const Image< llint > &img, const Matrix< float > &transform,
+                                    const PixelInterpolation &interpolation, Image< llint > &res );
+  template bool Resampling::Affine( const Image< float > &img, const Matrix< float > &transform,
+                                    const PixelInterpolation &interpolation, Image< float > &res );
+  template bool Resampling::Affine( const Image< double > &img, const Matrix< float > &transform,
+                                    const PixelInterpolation &interpolation, Image< double > &res );
+
+  template bool Resampling::Separable( const Image< int > &img, const Vector< size_t > &dim,
+                                       const Vector< float > &pixel_size, const Vector< double > &scale,
+                                       const Vector< double > &translation, const PixelInterpolation &interpolation,
+                                       Image< int > &res );
+  template bool Resampling::Separable( const Image< llint > &img, const Vector< size_t > &dim,
+                                       const Vector< float > &pixel_size, const Vector< double > &scale,
+                                       const Vector< double > &translation, const PixelInterpolation &interpolation,
+                                       Image< llint > &res );
+  template bool Resampling::Separable( const Image< float > &img, const Vector< size_t > &dim,
+                                       const Vector< float > &pixel_size, const Vector< double > &scale,
+                                       const Vector< double > &translation, const PixelInterpolation &interpolation,
+                                       Image< float > &res );
+  template bool Resampling::Separable( const Image< double > &img, const Vector< size_t > &dim,
+                                       const Vector< float > &pixel_size, const Vector< double > &scale,
+                                       const Vector< double > &translation, const PixelInterpolation &interpolation,
+                                       Image< double > &res );
+
+#endif
+
+}
+
+#endif
+
+#endif
@@ -29,8 +29,8 @@
 namespace Bial {
 
   RotatingBucketQueue::RotatingBucketQueue( size_t size, size_t max_dist ) try :
-    identity( size, IdentityNode( ) ), weight( max_dist + 1, WeightNode( ) ), elements( 0 ), minimum( 0 ), 
-      buckets( max_dist ), size( size ) {
+    identity( IdentityNode::CheckedSize( size ), IdentityNode( ) ), weight( max_dist + 1, WeightNode( ) ),
+      elements( 0 ), minimum( 0 ), buckets( max_dist ), size( size ) {
       COMMENT( "Creating queue with " << size << " elements and " << buckets << " buckets." , 3 );
     }
   catch( std::bad_alloc &e ) {
@@ -176,8 +176,8 @@ namespace Bial {
         minimum = ( minimum + 1 ) % buckets;
       COMMENT( "Found index: " << minimum, 1 );
       --elements;
-      int idt = weight( minimum ).first;
-      int next = identity( idt ).next;
+      bial_index idt = weight( minimum ).first;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing idt: " << idt << ", weight_idx: " << minimum << ", prev: " << 
                identity( idt ).prev << ", next:" << next, 1 );
       weight( minimum ).first = next;
@@ -216,8 +216,8 @@ namespace Bial {
       }
       int idx = weight_idx % size;
       COMMENT( "Removing element " << idt << " with weight " << weight_idx << ".", 3 );
-      int prev = identity( idt ).prev;
-      int next = identity( idt ).next;
+      bial_index prev = identity( idt ).prev;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing for update! elements: " << elements << ", minimum: " << minimum << ", idt: " << idt
                << ", weight_idx: " << weight_idx << ", previous: " << prev << ", next: " << next << ", idx: " << idx
                << ", first: " << weight( idx ).first << ", last: " << weight( idx ).last, 3 );
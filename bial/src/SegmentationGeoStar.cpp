@@ -24,7 +24,7 @@
 #include "GradientDirectional.hpp"
 #include "GrowingBucketQueue.hpp"
 #include "Image.hpp"
-#include "ImageIFT.hpp"
+#include "ImageIFTEngine.hpp"
 #include "OrientedExternPathFunction.hpp"
 #include "OrientedInternPathFunction.hpp"
 #include "RotatingBucketQueue.hpp"
@@ -47,7 +47,7 @@ namespace Bial {
         throw( std::logic_error( msg ) );
       }
       COMMENT( "Initializing maps.", 0 );
-      Image< int > pred( grad );
+      Image< bial_index > pred( grad );
       Image< D > value( grad );
       size_t size = grad.size( );
       D max_val = 2 * grad.Maximum( );
@@ -93,11 +93,10 @@ namespace Bial {
         COMMENT( "Src_Index: " << src_index << ", value: " << value[ src_index ], 3 );
         queue.Finished( src_index );
         COMMENT( "Computing src_index coordinates.", 3 );
-        div_t div_index_by_xy = std::div( static_cast< int >( src_index ), static_cast< int >( xy_size ) );
-        div_t div_rem_by_x =  std::div( div_index_by_xy.rem, static_cast< int >( x_size ) );
-        src_coords[ 0 ] = static_cast< size_t >( div_rem_by_x.rem );
-        src_coords[ 1 ] = static_cast< size_t >( div_rem_by_x.quot );
-        src_coords[ 2 ] = static_cast< size_t >( div_index_by_xy.quot );
+        src_coords[ 2 ] = src_index / xy_size;
+        size_t src_index_xy = src_index - src_coords[ 2 ] * xy_size;
+        src_coords[ 1 ] = src_index_xy / x_size;
+        src_coords[ 0 ] = src_index_xy - src_coords[ 1 ] * x_size;
         COMMENT( "Checking if pixel is in the border of the image.", 3 );
         if( ( src_coords[ 0 ] > 0 ) && ( src_coords[ 0 ] < x_size_1 ) && ( src_coords[ 1 ] > 0 ) && 
             ( src_coords[ 1 ] < y_size_1 ) && ( src_coords[ 2 ] > 0 ) && ( src_coords[ 2 ] < z_size_1 ) ) {
@@ -189,8 +188,8 @@ namespace Bial {
             COMMENT( "curr_adj_value: " << curr_adj_value << ". Computing arc weight.", 3 );
             double arc_weight = grad( index ) + grad( adj_index ) + 1;
             COMMENT( "Zero weight edges.", 3 );
-            if( ( ( label[ index ] != 0 ) && ( pred[ index ] == static_cast< int >( adj_index ) ) ) ||
-                ( ( label[ index ] == 0 ) && ( pred[ adj_index ] == static_cast< int >( index ) ) ) ) {
+            if( ( ( label[ index ] != 0 ) && ( pred[ index ] == static_cast< bial_index >( adj_index ) ) ) ||
+                ( ( label[ index ] == 0 ) && ( pred[ adj_index ] == static_cast< bial_index >( index ) ) ) ) {
               arc_weight = 0;
             }
             ++arc_weight;
@@ -249,7 +248,7 @@ namespace Bial {
       COMMENT( "Initializing maps.", 0 );
       Adjacency adj( AdjacencyType::HyperSpheric( 1.5, image.Dims( ) ) );
       Image< D > grad( Gradient::Directional( image, adj ) );
-      Image< int > pred( image );
+      Image< bial_index > pred( image );
       Image< D > value( grad );
       Image< int > label( image.Dim( ), image.PixelSize( ) );
       label.Set( -1 );
@@ -266,7 +265,8 @@ namespace Bial {
         queue.Insert( elm, grad[ elm ] );
       }
       COMMENT( "Running geodesic star restriction IFT.", 0 );
-      ImageIFT< D > ift( grad, adj, &geo_path, &queue );
+      ImageIFTEngine< D, GeodesicRestrictionPathFunction< D >, GrowingBucketQueue > ift( grad, adj, &geo_path,
+                                                                                        &queue );
       ift.Run( );
       COMMENT( "SECOND STEP. Running with background and foreground seeds.", 0 );
       COMMENT( "Setting seeds with background.", 0 );
@@ -292,13 +292,15 @@ namespace Bial {
       if( alpha >= 0.0 ) {
         COMMENT( "OrientedExternPathFunction.", 0 );
         OrientedExternPathFunction< D > oriented_path( grad, label, nullptr, false, value, image, &pred, alpha );
-        ImageIFT< D > ift( grad, adj, &oriented_path, &queue );
+        ImageIFTEngine< D, OrientedExternPathFunction< D >, GrowingBucketQueue > ift( grad, adj, &oriented_path,
+                                                                                      &queue );
         ift.Run( );
       }
       else {
         COMMENT( "OrientedInternPathFunction.", 0 );
         OrientedInternPathFunction< D > oriented_path( grad, label, nullptr, false, value, image, &pred, -alpha );
-        ImageIFT< D > ift( grad, adj, &oriented_path, &queue );
+        ImageIFTEngine< D, OrientedInternPathFunction< D >, GrowingBucketQueue > ift( grad, adj, &oriented_path,
+                                                                                      &queue );
         ift.Run( );
       }
       return( label );
@@ -42,7 +42,7 @@ namespace Bial {
       COMMENT( "Computing MST.", 0 );
       Image< D > distance( img );
       distance.Set( std::numeric_limits< D >::max( ) );
-      Image< int > predecessor( img );
+      Image< bial_index > predecessor( img );
       MinimumSpanningTree::MST( feature, distance, predecessor );
       COMMENT( "Cutting MST into the desired number of regions.", 0 );
       Vector< size_t > order = Sorting::Sort( distance );
@@ -103,11 +103,10 @@ namespace Bial {
         }
         COMMENT( "Index: " << index << ", value: " << value[ index ], 4 );
         queue.Finished( index );
-        div_t div_index_by_xy = std::div( static_cast< int >( index ), static_cast< int >( xy_size ) );
-        div_t div_rem_by_x =  std::div( div_index_by_xy.rem, static_cast< int >( x_size ) );
-        src_vector[ 0 ] = static_cast< size_t >( div_rem_by_x.rem );
-        src_vector[ 1 ] = static_cast< size_t >( div_rem_by_x.quot );
-        src_vector[ 2 ] = static_cast< size_t >( div_index_by_xy.quot );
+        src_vector[ 2 ] = index / xy_size;
+        size_t index_xy = index - src_vector[ 2 ] * xy_size;
+        src_vector[ 1 ] = index_xy / x_size;
+        src_vector[ 0 ] = index_xy - src_vector[ 1 ] * x_size;
         if( ( src_vector[ 0 ] > 0 ) && ( src_vector[ 0 ] < x_size_1 ) && ( src_vector[ 1 ] > 0 ) && 
             ( src_vector[ 1 ] < y_size_1 ) && ( src_vector[ 2 ] > 0 ) && ( src_vector[ 2 ] < z_size_1 ) ) {
           COMMENT( "For pixels that are not in the image border, there is no need for adjacency validation.", 4 );
@@ -227,11 +226,10 @@ namespace Bial {
         }
         COMMENT( "Index: " << index << ", value: " << value[ index ], 4 );
         queue.Finished( index );
-        div_t div_index_by_xy = std::div( static_cast< int >( index ), static_cast< int >( xy_size ) );
-        div_t div_rem_by_x =  std::div( div_index_by_xy.rem, static_cast< int >( x_size ) );
-        src_vector[ 0 ] = static_cast< size_t >( div_rem_by_x.rem );
-        src_vector[ 1 ] = static_cast< size_t >( div_rem_by_x.quot );
-        src_vector[ 2 ] = static_cast< size_t >( div_index_by_xy.quot );
+        src_vector[ 2 ] = index / xy_size;
+        size_t index_xy = index - src_vector[ 2 ] * xy_size;
+        src_vector[ 1 ] = index_xy / x_size;
+        src_vector[ 0 ] = index_xy - src_vector[ 1 ] * x_size;
         if( ( src_vector[ 0 ] > 0 ) && ( src_vector[ 0 ] < x_size_1 ) && ( src_vector[ 1 ] > 0 ) && 
             ( src_vector[ 1 ] < y_size_1 ) && ( src_vector[ 2 ] > 0 ) && ( src_vector[ 2 ] < z_size_1 ) ) {
           COMMENT( "For pixels that are not in the image border, there is no need for adjacency validation.", 4 );
@@ -29,7 +29,8 @@
 namespace Bial {
 
   SimpleBucketQueue::SimpleBucketQueue( size_t size, size_t max_dist ) try :
-    identity( size, IdentityNode( ) ), weight( max_dist + 1, WeightNode( ) ), elements( 0 ), minimum( 0 ) {
+    identity( IdentityNode::CheckedSize( size ), IdentityNode( ) ), weight( max_dist + 1, WeightNode( ) ),
+      elements( 0 ), minimum( 0 ) {
       COMMENT( "Creating queue with " << weight.size( ) << " elements.", 3 );
     }
   catch( std::bad_alloc &e ) {
@@ -175,8 +176,8 @@ namespace Bial {
         ++minimum;
       COMMENT( "Found index: " << minimum, 3 );
       --elements;
-      int idt = weight( minimum ).first;
-      int next = identity( idt ).next;
+      bial_index idt = weight( minimum ).first;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing idt: " << idt << ", weight_idx: " << minimum << ", prev: " << 
                identity( idt ).prev << ", next:" << next, 3 );
       weight( minimum ).first = next;
@@ -214,8 +215,8 @@ namespace Bial {
         throw( std::underflow_error( msg ) );
       }
       COMMENT( "Removing element " << idt << " with weight " << weight_idx << ".", 3 );
-      int prev = identity( idt ).prev;
-      int next = identity( idt ).next;
+      bial_index prev = identity( idt ).prev;
+      bial_index next = identity( idt ).next;
       COMMENT( "Removing for update! elements: " << elements << ", minimum: " << minimum << ", idt: " << idt
                << ", weight_idx: " << weight_idx << ", previous: " << prev << ", next:" << next 
                << ", first: " << weight( weight_idx ).first, 3 );
@@ -29,7 +29,7 @@
 namespace Bial {
 
   template< template< class D > class C, class D >
-  SumPathFunction< C, D >::SumPathFunction( C< D > &init_value, C< int > *init_label, C< int > *init_predecessor, 
+  SumPathFunction< C, D >::SumPathFunction( C< D > &init_value, C< int > *init_label, C< bial_index > *init_predecessor, 
                                             bool sequential_label, const C< D > &handicap ) try : 
     PathFunction< C, D >( init_value, init_label, init_predecessor, sequential_label ), handicap( handicap ) {
     }
@@ -245,7 +245,7 @@ namespace Bial {
       COMMENT( "Trying to propagate from " << index << " to " << adj_index << ".", 4 );
       COMMENT( "orig value " << src_value << ", tgt value: " << prp_value << ".", 4 );
       if( ( src_value > prp_value ) ||
-          ( ( this->predecessor->operator()( adj_index ) == static_cast< int >( index ) ) &&
+          ( ( this->predecessor->operator()( adj_index ) == static_cast< bial_index >( index ) ) &&
             ( this->label->operator()( adj_index ) != this->label->operator()( index ) ) ) ) {
         COMMENT( "Conquested.", 4 );
         this->value->operator()( adj_index ) = prp_value;
@@ -18,102 +18,28 @@
 
 #if defined ( BIAL_EXPLICIT_TransformEuclDist ) || ( BIAL_IMPLICIT_BIN )
 
-#include "AdjacencyRound.hpp"
-#include "AdjacencyIterator.hpp"
-#include "GeodesicPathFunction.hpp"
-#include "GrowingBucketQueue.hpp"
 #include "Image.hpp"
-#include "ImageIFT.hpp"
-#include "SimpleBucketQueue.hpp"
+#include "Vector.hpp"
 
 namespace Bial {
 
   template< class D >
   Image< D > Transform::EDT( const Image< D > &border ) {
     try {
-      COMMENT( "Creating images for processing.", 0 );
+      COMMENT( "Setting seed pixels. Other pixels are not reached yet.", 0 );
       size_t size = border.size( );
+      Vector< double > sqr_dist( size );
+      for( size_t pxl = 0; pxl < size; ++pxl )
+        sqr_dist[ pxl ] = ( border[ pxl ] != 0 ) ? 0.0 : std::numeric_limits< double >::infinity( );
+      COMMENT( "Running the separable passes.", 0 );
+      Vector< size_t > dim_size( border.Dim( ) );
+      Vector< bial_index > root;
+      for( size_t dim = 0; dim < border.Dims( ); ++dim )
+        EDTPass( sqr_dist, root, dim_size, dim, border.PixelSize( dim ) );
       Image< D > value( border.Dim( ), border.PixelSize( ) );
-      COMMENT( "Square value kept for faster comparison between values.", 0 );
-      Image< int > sqr_value( border.Dim( ), border.PixelSize( ) );
-      Image< int > root( border.Dim( ), border.PixelSize( ) );
-      COMMENT( "Creating adjacency.", 0 );
-      Adjacency adj( AdjacencyType::HyperSpheric( 1.8f, border.Dims( ) ) );
-      AdjacencyIterator adj_itr( value, adj );
-      size_t adj_size = adj.size( );
-      COMMENT( "Setting seed pixels.", 0 );
-      COMMENT( "Creating bucket queue with the longest distance in the image.", 0 );
-      SimpleBucketQueue queue( size, border.size( 0 ) * border.size( 0 ) + border.size( 1 ) * border.size( 1 ) + 
-                                 border.size( 2 ) * border.size( 2 ) + 1 );
-      for( size_t pxl = 0; pxl < size; ++pxl ) {
-        if( border[ pxl ] != 0 ) {
-          root[ pxl ] = pxl;
-          queue.Insert( pxl, sqr_value[ pxl ] );
-        }
-        else
-          sqr_value[ pxl ] = std::numeric_limits< int >::max( ); // Mudado de D para float. Voltei aqora...
-      }
-      COMMENT( "Running Image IFT. Queue: " << ( queue.Empty( ) ? "empty" : "not empty" ), 0 );
-      Vector< size_t > adj_coords( 3 );
-      size_t adj_index;
-      if( border.Dims( ) == 3 ) {
-        while( !queue.Empty( ) ) {
-          COMMENT( "Initializing removed data.", 4 );
-          size_t src_index = queue.Remove( );
-          Vector< size_t > src_coords( border.Coordinates( src_index ) );
-          Vector< size_t > root_coords( border.Coordinates( root[ src_index ] ) );
-          size_t src_value = sqr_value[ src_index ];
-          COMMENT( "Index: " << src_index << ", sqr_value: " << src_value, 4 );
-          queue.Finished( src_index );
-          size_t previous_value;
-          for( size_t adj_pos = 0; adj_pos < adj_size; ++adj_pos ) {
-            if( ( adj_itr.AdjVct( src_coords, adj_pos, adj_coords ) ) && 
-                ( adj_index = src_index + adj_itr.Displacement( adj_pos ) ) && 
-                ( previous_value = sqr_value[ adj_index ] ) && ( src_value < previous_value ) ) {
-              COMMENT( "Conquering: " << adj_index << " with previous_sqr_value: " << previous_value, 4 );
-              D prp_value = ( root_coords[ 0 ] - adj_coords[ 0 ] ) * ( root_coords[ 0 ] - adj_coords[ 0 ] ) +
-                ( root_coords[ 1 ] - adj_coords[ 1 ] ) * ( root_coords[ 1 ] - adj_coords[ 1 ] ) + 
-                ( root_coords[ 2 ] - adj_coords[ 2 ] ) * ( root_coords[ 2 ] - adj_coords[ 2 ] );
-              COMMENT( "Updating value.", 3 );
-              if( static_cast< int >( previous_value ) > prp_value ) {
-                sqr_value[ adj_index ] = prp_value;
-                root[ adj_index ] = root[ src_index ];
-                queue.Update( adj_index, previous_value, sqr_value[ adj_index ] );
-              }
-            }
-          }
-        }
-      }
-      // Optimized 2D version. It is around 6% faster.
-      else {
-        while( !queue.Empty( ) ) {
-          COMMENT( "Initializing removed data.", 4 );
-          size_t src_index = queue.Remove( );
-          Vector< size_t > src_coords( border.Coordinates2( src_index ) );
-          Vector< size_t > root_coords( border.Coordinates2( root[ src_index ] ) );
-          size_t src_value = sqr_value[ src_index ];
-          COMMENT( "Index: " << src_index << ", sqr_value: " << src_value, 4 );
-          queue.Finished( src_index );
-          size_t previous_value;
-          for( size_t adj_pos = 0; adj_pos < adj_size; ++adj_pos ) {
-            if( ( adj_itr.AdjVct2( src_coords, adj_pos, adj_coords ) ) && 
-                ( adj_index = src_index + adj_itr.Displacement( adj_pos ) ) && 
-                ( previous_value = sqr_value[ adj_index ] ) && ( src_value < previous_value ) ) {
-              COMMENT( "Conquering: " << adj_index << " with previous_sqr_value: " << previous_value, 4 );
-              D prp_value = ( root_coords[ 0 ] - adj_coords[ 0 ] ) * ( root_coords[ 0 ] - adj_coords[ 0 ] ) +
-                ( root_coords[ 1 ] - adj_coords[ 1 ] ) * ( root_coords[ 1 ] - adj_coords[ 1 ] );
-              COMMENT( "Updating value.", 3 );
-              if( static_cast< int >( previous_value ) > prp_value ) {
-                sqr_value[ adj_index ] = prp_value;
-                root[ adj_index ] = root[ src_index ];
-                queue.Update( adj_index, previous_value, sqr_value[ adj_index ] );
-              }
-            }
-          }
-        }
-      }
+      double unreached = std::sqrt( static_cast< double >( std::numeric_limits< int >::max( ) ) );
       for( size_t pxl = 0; pxl < size; ++pxl )
-        value[ pxl ] = std::sqrt( sqr_value[ pxl ] );
+        value[ pxl ] = std::isinf( sqr_dist[ pxl ] ) ? unreached : std::sqrt( sqr_dist[ pxl ] );
       return( value );
     }
     catch( std::bad_alloc &e ) {
@@ -129,8 +55,7 @@ namespace Bial {
       throw( std::out_of_range( msg ) );
     }
     catch( const std::logic_error &e ) {
-      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR(
-                         "Image, window end, and/or window size dimensions do not match." ) );
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
       throw( std::logic_error( msg ) );
     }
   }
@@ -139,92 +64,165 @@ namespace Bial {
   template< class D >
   Image< D > Transform::EDT( const Image< D > &border, const Image< D > &mask ) {
     try {
-      COMMENT( "Creating images for processing.", 0 );
+      COMMENT( "Setting seed pixels. Other pixels are not reached yet.", 0 );
       size_t size = border.size( );
+      Vector< double > sqr_dist( size );
+      for( size_t pxl = 0; pxl < size; ++pxl ) {
+        sqr_dist[ pxl ] = ( ( mask[ pxl ] != 0 ) && ( border[ pxl ] != 0 ) ) ? 0.0 :
+          std::numeric_limits< double >::infinity( );
+      }
+      COMMENT( "Running the separable passes.", 0 );
+      Vector< size_t > dim_size( border.Dim( ) );
+      Vector< bial_index > root;
+      for( size_t dim = 0; dim < border.Dims( ); ++dim )
+        EDTPass( sqr_dist, root, dim_size, dim, border.PixelSize( dim ) );
       Image< D > value( border.Dim( ), border.PixelSize( ) );
-      COMMENT( "Square value kept for faster comparison between values.", 0 );
-      Image< int > sqr_value( border.Dim( ), border.PixelSize( ) );
-      Image< int > root( border.Dim( ), border.PixelSize( ) );
-      COMMENT( "Creating adjacency.", 0 );
-      Adjacency adj( AdjacencyType::HyperSpheric( 1.8f, border.Dims( ) ) );
-      AdjacencyIterator adj_itr( value, adj );
-      size_t adj_size = adj.size( );
-      COMMENT( "Setting seed pixels.", 0 );
-      COMMENT( "Creating bucket queue with the longest distance in the image.", 0 );
-      SimpleBucketQueue queue( size, border.size( 0 ) * border.size( 0 ) + border.size( 1 ) * border.size( 1 ) +
-                               border.size( 2 ) * border.size( 2 ) + 1 );
+      double unreached = std::sqrt( static_cast< double >( std::numeric_limits< int >::max( ) ) );
       for( size_t pxl = 0; pxl < size; ++pxl ) {
-        if( mask[ pxl ] != 0 ) {
-          if( border[ pxl ] != 0 ) {
-            root[ pxl ] = pxl;
-            queue.Insert( pxl, sqr_value[ pxl ] );
-          }
-          else
-            sqr_value[ pxl ] = std::numeric_limits< int >::max( ); // Mudado de D para float. Voltei aqora...
+        if( mask[ pxl ] != 0 )
+          value[ pxl ] = std::isinf( sqr_dist[ pxl ] ) ? unreached : std::sqrt( sqr_dist[ pxl ] );
+      }
+      return( value );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  template< class D >
+  Image< D > Transform::EDT( const Image< D > &border, const Image< D > &mask, Image< bial_index > &root ) {
+    try {
+      COMMENT( "Setting seed pixels, which are their own roots. Other pixels are not reached yet.", 0 );
+      size_t size = border.size( );
+      Vector< double > sqr_dist( size );
+      Vector< bial_index > root_map( size, -1 );
+      for( size_t pxl = 0; pxl < size; ++pxl ) {
+        if( ( mask[ pxl ] != 0 ) && ( border[ pxl ] != 0 ) ) {
+          sqr_dist[ pxl ] = 0.0;
+          root_map[ pxl ] = static_cast< bial_index >( pxl );
         }
+        else
+          sqr_dist[ pxl ] = std::numeric_limits< double >::infinity( );
       }
-      COMMENT( "Running Image IFT. Queue: " << ( queue.Empty( ) ? "empty" : "not empty" ), 0 );
-      Vector< size_t > adj_coords( 3 );
-      size_t adj_index;
-      if( border.Dims( ) == 3 ) {
-        while( !queue.Empty( ) ) {
-          COMMENT( "Initializing removed data.", 4 );
-          size_t src_index = queue.Remove( );
-          Vector< size_t > src_coords( border.Coordinates( src_index ) );
-          Vector< size_t > root_coords( border.Coordinates( root[ src_index ] ) );
-          size_t src_value = sqr_value[ src_index ];
-          COMMENT( "Index: " << src_index << ", sqr_value: " << src_value, 4 );
-          queue.Finished( src_index );
-          size_t previous_value;
-          for( size_t adj_pos = 0; adj_pos < adj_size; ++adj_pos ) {
-            if( ( adj_itr.AdjVct( src_coords, adj_pos, adj_coords ) ) && 
-                ( adj_index = src_index + adj_itr.Displacement( adj_pos ) ) && 
-                ( previous_value = sqr_value[ adj_index ] ) && ( src_value < previous_value ) ) {
-              COMMENT( "Conquering: " << adj_index << " with previous_sqr_value: " << previous_value, 4 );
-              D prp_value = ( root_coords[ 0 ] - adj_coords[ 0 ] ) * ( root_coords[ 0 ] - adj_coords[ 0 ] ) +
-                ( root_coords[ 1 ] - adj_coords[ 1 ] ) * ( root_coords[ 1 ] - adj_coords[ 1 ] ) + 
-                ( root_coords[ 2 ] - adj_coords[ 2 ] ) * ( root_coords[ 2 ] - adj_coords[ 2 ] );
-              COMMENT( "Updating value.", 3 );
-              if( static_cast< int >( previous_value ) > prp_value ) {
-                sqr_value[ adj_index ] = prp_value;
-                root[ adj_index ] = root[ src_index ];
-                queue.Update( adj_index, previous_value, sqr_value[ adj_index ] );
-              }
-            }
-          }
+      COMMENT( "Running the separable passes.", 0 );
+      Vector< size_t > dim_size( border.Dim( ) );
+      for( size_t dim = 0; dim < border.Dims( ); ++dim )
+        EDTPass( sqr_dist, root_map, dim_size, dim, border.PixelSize( dim ) );
+      Image< D > value( border.Dim( ), border.PixelSize( ) );
+      root = Image< bial_index >( border.Dim( ), border.PixelSize( ) );
+      double unreached = std::sqrt( static_cast< double >( std::numeric_limits< int >::max( ) ) );
+      for( size_t pxl = 0; pxl < size; ++pxl ) {
+        if( mask[ pxl ] != 0 ) {
+          value[ pxl ] = std::isinf( sqr_dist[ pxl ] ) ? unreached : std::sqrt( sqr_dist[ pxl ] );
+          root[ pxl ] = root_map[ pxl ];
         }
+        else
+          root[ pxl ] = -1;
       }
-      // Optimized 2D version. It is around 6% faster.
-      else {
-        while( !queue.Empty( ) ) {
-          COMMENT( "Initializing removed data.", 4 );
-          size_t src_index = queue.Remove( );
-          Vector< size_t > src_coords( border.Coordinates2( src_index ) );
-          Vector< size_t > root_coords( border.Coordinates2( root[ src_index ] ) );
-          size_t src_value = sqr_value[ src_index ];
-          COMMENT( "Index: " << src_index << ", sqr_value: " << src_value, 4 );
-          queue.Finished( src_index );
-          size_t previous_value;
-          for( size_t adj_pos = 0; adj_pos < adj_size; ++adj_pos ) {
-            if( ( adj_itr.AdjVct2( src_coords, adj_pos, adj_coords ) ) && 
-                ( adj_index = src_index + adj_itr.Displacement( adj_pos ) ) && 
-                ( previous_value = sqr_value[ adj_index ] ) && ( src_value < previous_value ) ) {
-              COMMENT( "Conquering: " << adj_index << " with previous_sqr_value: " << previous_value, 4 );
-              D prp_value = ( root_coords[ 0 ] - adj_coords[ 0 ] ) * ( root_coords[ 0 ] - adj_coords[ 0 ] ) +
-                ( root_coords[ 1 ] - adj_coords[ 1 ] ) * ( root_coords[ 1 ] - adj_coords[ 1 ] );
-              COMMENT( "Updating value.", 3 );
-              if( static_cast< int >( previous_value ) > prp_value ) {
-                sqr_value[ adj_index ] = prp_value;
-                root[ adj_index ] = root[ src_index ];
-                queue.Update( adj_index, previous_value, sqr_value[ adj_index ] );
-              }
+      return( value );
+    }
+    catch( std::bad_alloc &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( std::runtime_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Runtime error." ) );
+      throw( std::runtime_error( msg ) );
+    }
+    catch( const std::out_of_range &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Out of range exception." ) );
+      throw( std::out_of_range( msg ) );
+    }
+    catch( const std::logic_error &e ) {
+      std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Logic Error." ) );
+      throw( std::logic_error( msg ) );
+    }
+  }
+
+  void Transform::EDTPass( Vector< double > &sqr_dist, Vector< bial_index > &root,
+                           const Vector< size_t > &dim_size, size_t dim, float pixel_size ) {
+    try {
+      size_t size = dim_size[ dim ];
+      if( size == 1 )
+        return;
+      size_t stride = 1;
+      for( size_t dms = 0; dms < dim; ++dms )
+        stride *= dim_size[ dms ];
+      size_t lines = sqr_dist.size( ) / size;
+      bool track_root = !root.empty( );
+      double step = pixel_size;
+      COMMENT( "Transforming " << lines << " lines of dimension " << dim << ".", 1 );
+      auto pass = [ & ]( size_t tsk, size_t tasks ) {
+        Vector< double > line( size );
+        Vector< bial_index > line_root( track_root ? size : 0 );
+        COMMENT( "Sites of the lower envelope and the position where each one starts to be the lowest.", 4 );
+        Vector< size_t > site( size );
+        Vector< double > start( size );
+        size_t min_line = tsk * lines / tasks;
+        size_t max_line = ( tsk + 1 ) * lines / tasks;
+        for( size_t lin = min_line; lin < max_line; ++lin ) {
+          size_t first = ( lin / stride ) * stride * size + lin % stride;
+          size_t sites = 0;
+          for( size_t elm = 0; elm < size; ++elm ) {
+            double val = sqr_dist[ first + elm * stride ];
+            line[ elm ] = val;
+            if( track_root )
+              line_root[ elm ] = root[ first + elm * stride ];
+            if( std::isinf( val ) )
+              continue;
+            COMMENT( "Removing the sites hidden by the parabola of elm.", 4 );
+            double pos = elm * step;
+            double cross = 0.0;
+            while( sites > 0 ) {
+              size_t prv = site[ sites - 1 ];
+              double prv_pos = prv * step;
+              cross = ( ( val + pos * pos ) - ( line[ prv ] + prv_pos * prv_pos ) ) / ( 2.0 * ( pos - prv_pos ) );
+              if( ( sites > 1 ) && ( cross <= start[ sites - 1 ] ) )
+                --sites;
+              else
+                break;
             }
+            site[ sites ] = elm;
+            start[ sites ] = ( sites == 0 ) ? -std::numeric_limits< double >::infinity( ) : cross;
+            ++sites;
+          }
+          if( sites == 0 )
+            continue;
+          COMMENT( "Reading the envelope. Ties go to the first site.", 4 );
+          size_t lowest = 0;
+          for( size_t elm = 0; elm < size; ++elm ) {
+            double pos = elm * step;
+            while( ( lowest + 1 < sites ) && ( start[ lowest + 1 ] < pos ) )
+              ++lowest;
+            size_t src = site[ lowest ];
+            double dlt = pos - src * step;
+            sqr_dist[ first + elm * stride ] = line[ src ] + dlt * dlt;
+            if( track_root )
+              root[ first + elm * stride ] = line_root[ src ];
           }
         }
+      };
+      try {
+        ThreadPool &pool = ThreadPool::Global( );
+        pool.Run( pool.Tasks( lines ), pass );
+      }
+      catch( std::exception &e ) {
+        BIAL_WARNING( "Failed to run in multi-thread. Exception: " << e.what( ) );
+        pass( 0, 1 );
       }
-      for( size_t pxl = 0; pxl < size; ++pxl )
-        value[ pxl ] = std::sqrt( sqr_value[ pxl ] );
-      return( value );
     }
     catch( std::bad_alloc &e ) {
       std::string msg( e.what( ) + std::string( "\n" ) + BIAL_ERROR( "Memory allocation error." ) );
@@ -244,7 +242,6 @@ namespace Bial {
     }
   }
 
-
 #ifdef BIAL_EXPLICIT_TransformEuclDist
 
   template Image< int > Transform::EDT( const Image< int > &border );
@@ -257,6 +254,15 @@ namespace Bial {
   template Image< float > Transform::EDT( const Image< float > &border, const Image< float > &mask );
   template Image< double > Transform::EDT( const Image< double > &border, const Image< double > &mask );
 
+  template Image< int > Transform::EDT( const Image< int > &border, const Image< int > &mask,
+                                        Image< bial_index > &root );
+  template Image< llint > Transform::EDT( const Image< llint > &border, const Image< llint > &mask,
+                                          Image< bial_index > &root );
+  template Image< float > Transform::EDT( const Image< float > &border, const Image< float > &mask,
+                                          Image< bial_index > &root );
+  template Image< double > Transform::EDT( const Image< double > &border, const Image< double > &mask,
+                                           Image< bial_index > &root );
+
 #endif
 
 }
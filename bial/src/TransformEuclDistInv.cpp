@@ -18,15 +18,9 @@
 
 #if defined ( BIAL_EXPLICIT_TransformEuclDistInv ) || ( BIAL_IMPLICIT_BIN )
 
-#include "AdjacencyRound.hpp"
-#include "AdjacencyIterator.hpp"
-#include "GrowingBucketQueue.hpp"
 #include "Image.hpp"
-#include "IntensityLocals.hpp"
 #include "TransformEuclDist.hpp"
 
-#include "FileImage.hpp"
-
 namespace Bial {
 
   template< class D >
@@ -34,40 +28,23 @@ namespace Bial {
     try {
       COMMENT( "root_dist: " << root_dist, 1 );
       Image< float > value = Transform::EDT( border, mask );
-      Write( value, "value.nii.gz" );
-      Image< int > root( mask );
-      Adjacency adj = AdjacencyType::HyperSpheric( 1.8, mask.Dims( ) );
-      COMMENT( "Seeds are local maxima from value map. May be a pixel in a plateau.", 2 );
-      Vector< bool > seeds( Intensity::LocalMaxima( value, mask, adj ) );
-      GrowingBucketQueue queue( value.size( ), 256, false );
-      for( size_t pxl = 0; pxl < mask.size( ); ++pxl ) {
-        if( seeds[ pxl ] == true ) {
-          queue.Insert( pxl, value[ pxl ] );
-        }
-      }
-      Image< float > dist( value );
-      size_t adj_pxl;
-      size_t adj_size = adj.size( );
-      AdjacencyIterator adj_itr( border, adj );
-      while( !queue.Empty( ) ) {
-        size_t pxl = queue.Remove( );
-        if( value[ pxl ] >= root_dist ) {
-          root[ pxl ] = pxl;
-        }
-        queue.Finished( pxl );
-        for( size_t adj_idx = 0; adj_idx < adj_size; ++adj_idx ) {
-          if( adj_itr.AdjIdx( pxl, adj_idx, adj_pxl ) ) {
-            if( ( mask[ adj_pxl ] != 0 ) && ( queue.State( adj_pxl ) != BucketState::REMOVED ) &&
-                ( dist[ pxl ] > dist[ adj_pxl ] ) ) {
-              if( queue.State( adj_pxl ) == BucketState::NOT_VISITED ) {
-                queue.Insert( adj_pxl, dist[ adj_pxl ] );
-              }
-              dist[ adj_pxl ] = dist[ pxl ];
-              root[ adj_pxl ] = root[ pxl ];
-            }
-          }
-        }
+      COMMENT( "Roots are the mask pixels at root_dist or more from the border, or the deepest ones if none is.", 2 );
+      size_t size = mask.size( );
+      float depth = 0.0f;
+      for( size_t pxl = 0; pxl < size; ++pxl ) {
+        if( ( mask[ pxl ] != 0 ) && ( value[ pxl ] > depth ) )
+          depth = value[ pxl ];
       }
+      depth = std::min( depth, static_cast< float >( root_dist ) );
+      Image< D > seeds( mask.Dim( ), mask.PixelSize( ) );
+      for( size_t pxl = 0; pxl < size; ++pxl )
+        seeds[ pxl ] = ( ( mask[ pxl ] != 0 ) && ( value[ pxl ] >= depth ) ) ? 1 : 0;
+      COMMENT( "Each mask pixel takes the nearest root, given by the EDT from the roots.", 2 );
+      Image< bial_index > nearest;
+      Transform::EDT( seeds, mask, nearest );
+      Image< D > root( mask.Dim( ), mask.PixelSize( ) );
+      for( size_t pxl = 0; pxl < size; ++pxl )
+        root[ pxl ] = ( mask[ pxl ] != 0 ) ? static_cast< D >( nearest[ pxl ] ) : 0;
       return( root );
     }
     catch( std::bad_alloc &e ) {
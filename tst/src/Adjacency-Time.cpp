@@ -0,0 +1,132 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of neighbor index computation. The previous coordinate decomposition by int std::div is compared
+ * to the 64-bit safe size_t decomposition now used by AdjacencyIterator, and to the library AdjIdx. Used to check
+ * that 64-bit safe indexing does not slow down normal sized images. */
+
+#include "AdjacencyIterator.hpp"
+#include "AdjacencyRound.hpp"
+#include "Image.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Neighbor index as computed before 64-bit safe indexing, by int std::div. Wraps for more than 2^31 pixels. */
+bool DivAdjIdx( size_t src_index, const int *relation, int displacement, int x_size, int y_size, int z_size,
+                size_t &adj_index ) {
+  div_t div_pos_by_xy = std::div( static_cast< int >( src_index ), x_size * y_size );
+  div_t div_rem_by_x = std::div( div_pos_by_xy.rem, x_size );
+  size_t x = static_cast< size_t >( div_rem_by_x.rem + relation[ 0 ] );
+  size_t y = static_cast< size_t >( div_rem_by_x.quot + relation[ 1 ] );
+  size_t z = static_cast< size_t >( div_pos_by_xy.quot + relation[ 2 ] );
+  if( ( x >= static_cast< size_t >( x_size ) ) || ( y >= static_cast< size_t >( y_size ) ) ||
+      ( z >= static_cast< size_t >( z_size ) ) )
+    return( false );
+  adj_index = src_index + displacement;
+  return( true );
+}
+
+/* Neighbor index as computed by AdjacencyIterator::AdjIdx, by size_t division. */
+bool SizeAdjIdx( size_t src_index, const int *relation, bial_index displacement, size_t x_size, size_t y_size,
+                 size_t z_size, size_t &adj_index ) {
+  size_t xy_size = x_size * y_size;
+  size_t src_z = src_index / xy_size;
+  size_t src_xy = src_index - src_z * xy_size;
+  size_t src_y = src_xy / x_size;
+  size_t x = src_xy - src_y * x_size + relation[ 0 ];
+  size_t y = src_y + relation[ 1 ];
+  size_t z = src_z + relation[ 2 ];
+  if( ( x >= x_size ) || ( y >= y_size ) || ( z >= z_size ) )
+    return( false );
+  adj_index = src_index + displacement;
+  return( true );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <adjacency radius>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 256 1.8" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  float radius = atof( argv[ 4 ] );
+  Image< int > img( x_size, y_size, z_size );
+  Adjacency adj( AdjacencyType::HyperSpheric( radius, img.Dims( ) ) );
+  AdjacencyIterator adj_itr( img, adj );
+  size_t adj_size = adj.size( );
+  size_t adj_pxl;
+  cout << "Image: " << img.size( ) << " pixels. Adjacency: " << adj_size << " elements." << endl;
+
+  Vector< int > relation( 3 * adj_size, 0 );
+  for( size_t idx = 0; idx < adj_size; ++idx ) {
+    for( size_t dms = 0; dms < adj.Dims( ); ++dms )
+      relation[ 3 * idx + dms ] = static_cast< int >( adj( idx, dms ) );
+  }
+
+  size_t checksum = 0;
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      if( DivAdjIdx( pxl, &relation[ 3 * idx ], static_cast< int >( adj_itr.Displacement( idx ) ), x_size, y_size,
+                     z_size, adj_pxl ) )
+        checksum += adj_pxl;
+    }
+  }
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Previous std::div AdjIdx: " << elapsed.count( ) << " s, " << 1.0e9 * elapsed.count( ) /
+    ( img.size( ) * adj_size ) << " ns per arc. Checksum: " << checksum << endl;
+
+  checksum = 0;
+  start = chrono::high_resolution_clock::now( );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      if( SizeAdjIdx( pxl, &relation[ 3 * idx ], adj_itr.Displacement( idx ), x_size, y_size, z_size, adj_pxl ) )
+        checksum += adj_pxl;
+    }
+  }
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Current size_t AdjIdx: " << elapsed.count( ) << " s, " << 1.0e9 * elapsed.count( ) /
+    ( img.size( ) * adj_size ) << " ns per arc. Checksum: " << checksum << endl;
+
+  checksum = 0;
+  start = chrono::high_resolution_clock::now( );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    Vector< size_t > coords( img.Coordinates( pxl ) );
+    checksum += coords[ 0 ] + coords[ 1 ] + coords[ 2 ];
+  }
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Coordinates: " << elapsed.count( ) << " s. Checksum: " << checksum << endl;
+
+  checksum = 0;
+  start = chrono::high_resolution_clock::now( );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      if( adj_itr.AdjIdx( pxl, idx, adj_pxl ) )
+        checksum += adj_pxl;
+    }
+  }
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Library checked AdjIdx: " << elapsed.count( ) << " s, " << 1.0e9 * elapsed.count( ) /
+    ( img.size( ) * adj_size ) << " ns per arc. Checksum: " << checksum << endl;
+
+  checksum = 0;
+  start = chrono::high_resolution_clock::now( );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    bool interior = adj_itr.Interior( pxl );
+    for( size_t idx = 0; idx < adj_size; ++idx ) {
+      if( adj_itr.AdjIdx( pxl, idx, adj_pxl, interior ) )
+        checksum += adj_pxl;
+    }
+  }
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Library interior/border AdjIdx: " << elapsed.count( ) << " s, " << 1.0e9 * elapsed.count( ) /
+    ( img.size( ) * adj_size ) << " ns per arc. Checksum: " << checksum << endl;
+
+  return( 0 );
+}
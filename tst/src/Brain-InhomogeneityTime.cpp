@@ -0,0 +1,104 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of bias surface estimation, computed once per root with sparse histogram clearing, against a
+ * reference that builds and clears a complete histogram for every masked voxel. Checks that both estimations are
+ * equal. Set BIAL_THREADS to choose the number of threads. */
+
+#include "AdjacencyIterator.hpp"
+#include "AdjacencyRound.hpp"
+#include "BrainInhomogeneity.hpp"
+#include "FilteringMean.hpp"
+#include "Image.hpp"
+#include "SegmentationBorder.hpp"
+#include "Signal.hpp"
+#include "SignalHysteresis.hpp"
+#include "TransformEuclDistInv.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Per voxel estimation, as computed before root caching. */
+Image< int > Reference( const Image< int > &img, const Image< int > &msk, const Image< int > &cln_msk, float radius,
+                        MRIModality modality ) {
+  Adjacency small_adj = AdjacencyType::HyperSpheric( 1.0, img.Dims( ) );
+  Image< int > border = Segmentation::BorderPixels( msk, small_adj );
+  Image< int > edt = Transform::InverseEDT( border, msk, radius );
+  Vector< float > input_radius( img.Dims( ), radius );
+  for( size_t dms = 0; dms < img.Dims( ); ++dms )
+    input_radius( dms ) /= img.PixelSize( dms );
+  Adjacency input_adj = AdjacencyType::HyperEllipsoid( input_radius );
+  Image< int > res( msk );
+  size_t histo_size = ( img * cln_msk ).Maximum( ) + 1;
+  Signal histo( histo_size );
+  AdjacencyIterator adj_itr( img, input_adj );
+  size_t adj_pxl;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( msk[ pxl ] != 0 ) {
+      size_t total_voxels = 0;
+      size_t root = edt[ pxl ];
+      for( size_t idx = 0; idx < input_adj.size( ); ++idx ) {
+        if( ( adj_itr.AdjIdx( root, idx, adj_pxl ) ) && ( cln_msk[ adj_pxl ] != 0 ) ) {
+          ++total_voxels;
+          ++histo[ img[ adj_pxl ] ];
+        }
+      }
+      if( total_voxels == 0 )
+        res[ pxl ] = img[ pxl ];
+      else {
+        size_t kernel_size = 5 + std::round( histo.size( ) / 1000.0 );
+        if( modality == MRIModality::T1 )
+          res[ pxl ] = SignalOp::HighHysteresis( histo, kernel_size, 0.2, 0.3 );
+        else
+          res[ pxl ] = SignalOp::LowHysteresis( histo, kernel_size, 0.2, 0.3 );
+      }
+      for( size_t bin = 0; bin < histo_size; ++bin )
+        histo[ bin ] = 0;
+    }
+  }
+  return( Filtering::Mean( res, msk, 1.1 ) );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 3 ) {
+    cout << "Usage: " << argv[ 0 ] << " <size> <radius>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 96 10.0" << endl;
+    return( 0 );
+  }
+  size_t size = atoi( argv[ 1 ] );
+  float radius = atof( argv[ 2 ] );
+  Image< int > img( size, size, size );
+  Image< int > msk( size, size, size );
+  Image< int > cln_msk( size, size, size );
+  float center = size / 2.0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    Vector< size_t > crd( img.Coordinates( pxl ) );
+    float dist = std::sqrt( ( crd[ 0 ] - center ) * ( crd[ 0 ] - center ) + ( crd[ 1 ] - center ) *
+                            ( crd[ 1 ] - center ) + ( crd[ 2 ] - center ) * ( crd[ 2 ] - center ) );
+    img[ pxl ] = static_cast< int >( 400 + 200.0 * crd[ 0 ] / size + ( pxl * 2654435761u ) % 64 );
+    msk[ pxl ] = ( dist < 0.4 * size ) ? 1 : 0;
+    cln_msk[ pxl ] = ( ( dist < 0.35 * size ) && ( pxl % 7 != 0 ) ) ? 1 : 0;
+  }
+  cout << "Image: " << img.size( ) << " pixels. Radius: " << radius << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< int > reference( Reference( img, msk, cln_msk, radius, MRIModality::T1 ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Per voxel estimation: " << elapsed.count( ) << " s." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< int > bias( Brain::BiasSurfaceEstimation( img, msk, cln_msk, radius, MRIModality::T1 ) );
+  chrono::duration< double > cached = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( bias[ pxl ] != reference[ pxl ] )
+      ++different;
+  }
+  cout << "Per root estimation with " << ThreadPool::Global( ).Threads( ) << " threads: " << cached.count( ) <<
+    " s, speedup: " << elapsed.count( ) / cached.count( ) << ". Different pixels: " << different << "." << endl;
+
+  return( 0 );
+}
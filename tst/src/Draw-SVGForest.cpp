@@ -18,7 +18,7 @@ int main( ) {
   Image< > img( Read< int >( "res/river.pgm" ) );
   Vector< bool > seed( img.size( ) );
   Image< > label( img.Dim( ) );
-  Image< > pred( img.Dim( ) );
+  Image< bial_index > pred( img.Dim( ) );
   Image< > res( img.Dim( ) );
   seed( 0 ) = true;
   seed( 12 ) = true;
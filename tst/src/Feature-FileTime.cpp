@@ -0,0 +1,145 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of feature file reading. Writes a synthetic feature set in legacy OPF format and in binary
+ * feature format, with .bft extension, uncompressed and compressed, and compares reading them against reading the
+ * legacy file with one stream call per value. Also reads a range of elements. Files are written to the given
+ * directory. */
+
+#include "Feature.hpp"
+#include "File.hpp"
+#include "FileFeature.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Legacy OPF reading with one stream call per value. */
+Feature< float > ReadPerValue( const string &filename ) {
+  IFile file;
+  file.exceptions( std::fstream::failbit | std::fstream::badbit );
+  file.open( filename );
+  int nnodes;
+  int nlabels;
+  int nfeats;
+  file.read( reinterpret_cast< char* >( &nnodes ), sizeof( int ) );
+  file.read( reinterpret_cast< char* >( &nlabels ), sizeof( int ) );
+  file.read( reinterpret_cast< char* >( &nfeats ), sizeof( int ) );
+  Feature< float > feat( nnodes, nfeats );
+  feat.Labels( nlabels );
+  int index;
+  int label;
+  float ffeat;
+  for( size_t elm = 0; elm < static_cast< size_t >( nnodes ); ++elm ) {
+    file.read( reinterpret_cast< char* >( &index ), sizeof( int ) );
+    feat.Index( elm ) = elm;
+    file.read( reinterpret_cast< char* >( &label ), sizeof( int ) );
+    feat.Label( elm ) = label;
+    for( size_t ftr = 0; ftr < static_cast< size_t >( nfeats ); ++ftr ) {
+      file.read( reinterpret_cast< char* >( &ffeat ), sizeof( float ) );
+      feat( elm, ftr ) = ffeat;
+    }
+  }
+  file.close( );
+  return( feat );
+}
+
+/* Number of elements of feat that differ from elements [ first, first + feat.Elements( ) ) of ref. */
+size_t Different( const Feature< float > &feat, const Feature< float > &ref, size_t first = 0 ) {
+  size_t different = 0;
+  for( size_t elm = 0; elm < feat.Elements( ); ++elm ) {
+    bool same = ( feat.Index( elm ) == ref.Index( first + elm ) ) && ( feat.Label( elm ) == ref.Label( first + elm ) );
+    for( size_t ftr = 0; ftr < feat.Features( ); ++ftr )
+      same = same && ( feat( elm, ftr ) == ref( first + elm, ftr ) );
+    if( !same )
+      ++different;
+  }
+  return( different );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <elements> <features> <directory>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 200000 100 /tmp" << endl;
+    return( 0 );
+  }
+  size_t elements = atoi( argv[ 1 ] );
+  size_t features = atoi( argv[ 2 ] );
+  string directory( argv[ 3 ] );
+  Feature< float > feat( elements, features );
+  feat.Labels( 5 );
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    feat.Index( elm ) = elm;
+    feat.Label( elm ) = static_cast< int >( elm % 5 );
+    for( size_t ftr = 0; ftr < features; ++ftr )
+      feat( elm, ftr ) = static_cast< float >( ( ( elm * features + ftr ) * 2654435761u ) % 10000 ) / 100.0f;
+  }
+  cout << "Elements: " << elements << ", features: " << features << "." << endl;
+
+  string opf( directory + "/features.opf" );
+  string binary( directory + "/features.bft" );
+  string compressed( directory + "/features.bft.gz" );
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  FileFeature::Write( feat, opf );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Write legacy OPF: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  FileFeature::Write( feat, binary );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Write binary: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  FileFeature::Write( feat, compressed );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Write compressed binary: " << elapsed.count( ) << " s." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Feature< float > ref( ReadPerValue( opf ) );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  cout << "Read legacy OPF with one call per value: " << ref_time.count( ) << " s. Different elements: " <<
+    Different( ref, feat ) << "." << endl;
+  start = chrono::high_resolution_clock::now( );
+  Feature< float > res( FileFeature::Read< float >( opf ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Read legacy OPF: " << elapsed.count( ) << " s, speedup " << ref_time.count( ) / elapsed.count( ) <<
+    ". Different elements: " << Different( res, feat ) << "." << endl;
+  start = chrono::high_resolution_clock::now( );
+  res = FileFeature::Read< float >( binary );
+  double sum = 0.0;
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    for( size_t ftr = 0; ftr < features; ++ftr )
+      sum += res( elm, ftr );
+  }
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Read binary and visit all values: " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Different elements: " << Different( res, feat ) << ". Sum: " << sum <<
+    "." << endl;
+  start = chrono::high_resolution_clock::now( );
+  res = FileFeature::Read< float >( compressed );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Read compressed binary: " << elapsed.count( ) << " s, speedup " << ref_time.count( ) / elapsed.count( ) <<
+    ". Different elements: " << Different( res, feat ) << "." << endl;
+  start = chrono::high_resolution_clock::now( );
+  Feature< double > converted( FileFeature::Read< double >( binary ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Read binary into double Feature: " << elapsed.count( ) << " s." << endl;
+
+  size_t first = elements / 2;
+  size_t range = std::max( static_cast< size_t >( 1 ), elements / 10 );
+  FileFeature::Header hdr( FileFeature::ReadHeader( binary ) );
+  cout << "Binary header. Version: " << hdr.version << ", elements: " << hdr.elements << ", features: " <<
+    hdr.features << ", labels: " << hdr.labels << "." << endl;
+  string other( directory + "/features.dat" );
+  FileFeature::Write( feat, other );
+  cout << "Version of file without .bft extension: " << FileFeature::ReadHeader( other ).version << "." << endl;
+  for( const string &filename : { opf, binary, compressed } ) {
+    start = chrono::high_resolution_clock::now( );
+    res = FileFeature::Read< float >( filename, first, range );
+    elapsed = chrono::high_resolution_clock::now( ) - start;
+    cout << "Read " << range << " elements of " << filename << ": " << elapsed.count( ) << " s. Different elements: "
+         << Different( res, feat, first ) << "." << endl;
+  }
+
+  return( 0 );
+}
@@ -0,0 +1,234 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of reading a Dicom series as a volume. Writes a synthetic series with shuffled file names, a
+ * smaller series and a file that is not Dicom to the given directory. Compares reading the files one by one with
+ * DicomHeader and assembling the volume against the series reader, when the series is opened for the first time
+ * and when its headers are cached. Then reads a series in implicit VR little endian, whose rescale slope, intercept
+ * and number of frames are 2-byte strings. Last, writes a DICOMDIR and reads the first series through it. Set
+ * BIAL_THREADS to choose the number of threads. */
+
+#include "DicomHeader.hpp"
+#include "DicomSeries.hpp"
+#include "File.hpp"
+#include "Image.hpp"
+#include <chrono>
+#include <random>
+
+using namespace std;
+using namespace Bial;
+
+/* Appends little endian integer of given size to buffer. */
+void Append( string &buffer, uint32_t value, size_t bytes ) {
+  for( size_t byte = 0; byte < bytes; ++byte )
+    buffer.push_back( static_cast< char >( ( value >> ( 8 * byte ) ) & 0xFF ) );
+}
+
+/* Writes elements in implicit VR little endian, except meta information, which is always explicit. */
+bool implicit_vr = false;
+
+/* Appends an explicit or implicit VR little endian element to buffer. */
+void Element( string &buffer, uint32_t group, uint32_t element, const string &vr, string value ) {
+  if( value.size( ) % 2 == 1 )
+    value.push_back( vr == "UI" ? '\0' : ' ' );
+  Append( buffer, group, 2 );
+  Append( buffer, element, 2 );
+  if( ( implicit_vr ) && ( group != 0x0002 ) ) {
+    Append( buffer, value.size( ), 4 );
+    buffer += value;
+    return;
+  }
+  buffer += vr;
+  if( ( vr == "OB" ) || ( vr == "OW" ) || ( vr == "SQ" ) ) {
+    Append( buffer, 0, 2 );
+    Append( buffer, value.size( ), 4 );
+  }
+  else
+    Append( buffer, value.size( ), 2 );
+  buffer += value;
+}
+
+void Element( string &buffer, uint32_t group, uint32_t element, uint32_t value ) {
+  string bytes;
+  Append( bytes, value, 2 );
+  Element( buffer, group, element, "US", bytes );
+}
+
+/* Preamble and meta information. */
+string Meta( ) {
+  string buffer( 128, '\0' );
+  buffer += "DICM";
+  string meta;
+  Element( meta, 0x0002, 0x0001, "OB", string( "\0\1", 2 ) );
+  Element( meta, 0x0002, 0x0010, "UI", implicit_vr ? "1.2.840.10008.1.2" : "1.2.840.10008.1.2.1" );
+  string length;
+  Append( length, meta.size( ), 4 );
+  Element( buffer, 0x0002, 0x0000, "UL", length );
+  return( buffer + meta );
+}
+
+void WriteSlice( const string &filename, const string &series_uid, size_t columns, size_t rows, size_t slice,
+                 double spacing, const string &intercept = "-1024" ) {
+  string buffer( Meta( ) );
+  Element( buffer, 0x0008, 0x0060, "CS", "CT" );
+  Element( buffer, 0x0018, 0x0050, "DS", "2.5" );
+  Element( buffer, 0x0020, 0x000E, "UI", series_uid );
+  Element( buffer, 0x0020, 0x0013, "IS", to_string( slice + 1 ) );
+  Element( buffer, 0x0020, 0x0032, "DS", "-120.5\\-130.25\\" + to_string( -200.0 + slice * spacing ) );
+  Element( buffer, 0x0020, 0x0037, "DS", "1\\0\\0\\0\\1\\0" );
+  Element( buffer, 0x0028, 0x0002, 1 );
+  Element( buffer, 0x0028, 0x0004, "CS", "MONOCHROME2" );
+  Element( buffer, 0x0028, 0x0008, "IS", "1" );
+  Element( buffer, 0x0028, 0x0010, rows );
+  Element( buffer, 0x0028, 0x0011, columns );
+  Element( buffer, 0x0028, 0x0030, "DS", "0.75\\0.5" );
+  Element( buffer, 0x0028, 0x0100, 16 );
+  Element( buffer, 0x0028, 0x0101, 12 );
+  Element( buffer, 0x0028, 0x0103, 0 );
+  Element( buffer, 0x0028, 0x1052, "DS", intercept );
+  Element( buffer, 0x0028, 0x1053, "DS", "1" );
+  string pixels;
+  for( size_t pxl = 0; pxl < columns * rows; ++pxl )
+    Append( pixels, ( pxl * 7 + slice * 31 ) % 4096, 2 );
+  Element( buffer, 0x7FE0, 0x0010, "OW", pixels );
+  OFile file;
+  file.exceptions( std::fstream::failbit | std::fstream::badbit );
+  file.open( filename, std::ios::out | std::ios::binary );
+  file.write( buffer.data( ), buffer.size( ) );
+  file.close( );
+}
+
+/* Reads the files one by one with DicomHeader, and assembles the volume of the given series. */
+Image< int > ReadOneByOne( const string &directory, const string &series_uid ) {
+  Vector< string > names( Directory::ListFiles( directory ) );
+  vector< pair< double, Image< int > > > slices;
+  for( size_t fl = 0; fl < names.size( ); ++fl ) {
+    try {
+      DicomHeader dhdr;
+      Image< int > slice( dhdr.readFile< int >( directory + DIR_SEPARATOR + names[ fl ] ) );
+      string uid( dhdr.getElement( 0x0020, 0x000E ).getStringValue( ) );
+      if( uid.compare( 0, series_uid.size( ), series_uid ) != 0 )
+        continue;
+      string position( dhdr.getElement( 0x0020, 0x0032 ).getStringValue( ) );
+      slices.push_back( make_pair( atof( position.substr( position.rfind( '\\' ) + 1 ).c_str( ) ), slice ) );
+    }
+    catch( std::exception &e ) {
+    }
+  }
+  sort( slices.begin( ), slices.end( ), [ ]( const pair< double, Image< int > > &a,
+                                             const pair< double, Image< int > > &b ) {
+          return( a.first < b.first );
+        } );
+  Image< int > res( slices[ 0 ].second.size( 0 ), slices[ 0 ].second.size( 1 ), slices.size( ) );
+  for( size_t slc = 0; slc < slices.size( ); ++slc ) {
+    for( size_t pxl = 0; pxl < slices[ slc ].second.size( ); ++pxl )
+      res[ slc * slices[ slc ].second.size( ) + pxl ] = slices[ slc ].second[ pxl ] - 1024;
+  }
+  return( res );
+}
+
+size_t Different( const Image< int > &img1, const Image< int > &img2 ) {
+  if( img1.Dim( ) != img2.Dim( ) )
+    return( img1.size( ) );
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img1.size( ); ++pxl ) {
+    if( img1[ pxl ] != img2[ pxl ] )
+      ++different;
+  }
+  return( different );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <columns> <rows> <slices> <empty directory>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 512 512 600 dat/dicom_series" << endl;
+    return( 0 );
+  }
+  size_t columns = atoi( argv[ 1 ] );
+  size_t rows = atoi( argv[ 2 ] );
+  size_t slices = atoi( argv[ 3 ] );
+  string directory( argv[ 4 ] );
+  string series_uid( "1.2.826.0.1.3680043.2.1125.1" );
+  string other_uid( "1.2.826.0.1.3680043.2.1125.2" );
+  vector< size_t > order( slices );
+  for( size_t slc = 0; slc < slices; ++slc )
+    order[ slc ] = slc;
+  shuffle( order.begin( ), order.end( ), mt19937( 1 ) );
+  vector< string > names;
+  for( size_t slc = 0; slc < slices; ++slc ) {
+    char name[ 16 ];
+    sprintf( name, "IMG%05d", static_cast< int >( order[ slc ] ) );
+    names.push_back( name );
+    WriteSlice( directory + DIR_SEPARATOR + name, series_uid, columns, rows, slc, 2.5 );
+  }
+  for( size_t slc = 0; slc < 3; ++slc )
+    WriteSlice( directory + DIR_SEPARATOR + "OTHER" + to_string( slc ), other_uid, 64, 64, slc, 5.0 );
+  OFile text;
+  text.open( directory + DIR_SEPARATOR + "README", std::ios::out );
+  text << "Synthetic Dicom series." << endl;
+  text.close( );
+  cout << "Series: " << slices << " slices of " << columns << "x" << rows << ", threads: " <<
+    ThreadPool::Global( ).Threads( ) << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< int > ref( ReadOneByOne( directory, series_uid ) );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  cout << "Files read one by one: " << ref_time.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > res( ReadDicomSeries< int >( directory ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Series read: " << elapsed.count( ) << " s, speedup " << ref_time.count( ) / elapsed.count( ) <<
+    ". Different pixels: " << Different( ref, res ) << ". Pixel size: " << res.PixelSize( ) << "." << endl;
+  start = chrono::high_resolution_clock::now( );
+  res = ReadDicomSeries< int >( directory );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Series reopened with cached headers: " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Different pixels: " << Different( ref, res ) << "." << endl;
+  Image< float > other( ReadDicomSeries< float >( directory, other_uid ) );
+  cout << "Other series: " << other.size( 0 ) << "x" << other.size( 1 ) << "x" << other.size( 2 ) << ", pixel size " <<
+    other.PixelSize( ) << "." << endl;
+
+  string implicit_uid( "1.2.826.0.1.3680043.2.1125.3" );
+  size_t implicit_slices = std::min( slices, static_cast< size_t >( 8 ) );
+  implicit_vr = true;
+  for( size_t slc = 0; slc < implicit_slices; ++slc )
+    WriteSlice( directory + DIR_SEPARATOR + "IMPLICIT" + to_string( slc ), implicit_uid, columns, rows, slc, 2.5, "0" );
+  implicit_vr = false;
+  Image< int > expected( columns, rows, implicit_slices );
+  for( size_t pxl = 0; pxl < expected.size( ); ++pxl )
+    expected[ pxl ] = ref[ pxl ] + 1024;
+  res = ReadDicomSeries< int >( directory, implicit_uid );
+  cout << "Implicit VR series: " << res.size( 0 ) << "x" << res.size( 1 ) << "x" << res.size( 2 ) <<
+    ". Different pixels: " << Different( expected, res ) << "." << endl;
+
+  string records;
+  Element( records, 0x0004, 0x1430, "CS", "IMAGE" );
+  string items;
+  for( const string &name : names ) {
+    Append( items, 0xFFFE, 2 );
+    Append( items, 0xE000, 2 );
+    Append( items, 0xFFFFFFFF, 4 );
+    items += records;
+    Element( items, 0x0004, 0x1500, "CS", name );
+    Append( items, 0xFFFE, 2 );
+    Append( items, 0xE00D, 2 );
+    Append( items, 0, 4 );
+  }
+  string dicomdir( Meta( ) );
+  Element( dicomdir, 0x0004, 0x1200, "UL", string( 4, '\0' ) );
+  Element( dicomdir, 0x0004, 0x1220, "SQ", items );
+  OFile file;
+  file.exceptions( std::fstream::failbit | std::fstream::badbit );
+  file.open( directory + DIR_SEPARATOR + "DICOMDIR", std::ios::out | std::ios::binary );
+  file.write( dicomdir.data( ), dicomdir.size( ) );
+  file.close( );
+  start = chrono::high_resolution_clock::now( );
+  res = ReadDicomSeries< int >( directory + DIR_SEPARATOR + "DICOMDIR" );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Series read through DICOMDIR: " << elapsed.count( ) << " s. Different pixels: " << Different( ref, res ) <<
+    "." << endl;
+
+  return( 0 );
+}
@@ -0,0 +1,81 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of writing and reading compressed and uncompressed Nifti and Scene files. Checks that images
+ * are read back unchanged, and that compressed files are decoded by plain zlib as the uncompressed ones. Set
+ * BIAL_THREADS to choose the number of compression threads. */
+
+#include "FileImage.hpp"
+#include "Image.hpp"
+#include <chrono>
+#include <zlib.h>
+
+using namespace std;
+using namespace Bial;
+
+/* Contents of a file, decompressed by zlib if gziped. */
+string Contents( const string &filename ) {
+  gzFile file = gzopen( filename.c_str( ), "rb" );
+  string res;
+  char chunk[ 65536 ];
+  int num;
+  while( ( num = gzread( file, chunk, sizeof( chunk ) ) ) > 0 )
+    res.append( chunk, num );
+  gzclose( file );
+  return( res );
+}
+
+template< class D >
+void Compare( const Image< D > &img, const string &basename, const string &extension ) {
+  string plain = basename + extension;
+  string gziped = plain + ".gz";
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Write( img, plain );
+  chrono::duration< double > plain_write = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Write( img, gziped );
+  chrono::duration< double > gzip_write = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< D > plain_img( Read< D >( plain ) );
+  chrono::duration< double > plain_read = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< D > gzip_img( Read< D >( gziped ) );
+  chrono::duration< double > gzip_read = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( ( plain_img[ pxl ] != img[ pxl ] ) || ( gzip_img[ pxl ] != img[ pxl ] ) )
+      ++different;
+  }
+  cout << extension << ". Write: " << plain_write.count( ) << " s, compressed: " << gzip_write.count( ) <<
+    " s. Read: " << plain_read.count( ) << " s, compressed: " << gzip_read.count( ) << " s. Different pixels: " <<
+    different << ". zlib decodes compressed file as uncompressed one: " <<
+    ( Contents( gziped ) == Contents( plain ) ? "yes" : "no" ) << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <output basename>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 256 dat/gzip_time" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  string basename( argv[ 4 ] );
+  Image< int > img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    size_t x = pxl % x_size;
+    size_t y = ( pxl / x_size ) % y_size;
+    img[ pxl ] = static_cast< int >( ( x * y ) % 1024 + ( pxl * 2654435761u ) % 16 );
+  }
+  cout << "Image: " << img.size( ) << " pixels. Compression threads: " << ThreadPool::Global( ).Threads( ) << "." <<
+    endl;
+  Compare( img, basename, ".nii" );
+  Compare( img, basename, ".scn" );
+  Image< float > flt( img );
+  Compare( flt, basename + "_float", ".nii" );
+
+  return( 0 );
+}
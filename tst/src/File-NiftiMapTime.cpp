@@ -0,0 +1,89 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of reading uncompressed Nifti files through memory mapping, with the image adopting the mapped
+ * data when the file type matches the image type and converting it otherwise, against reading compressed files.
+ * Checks that all images are read unchanged, and that swapped data is converted correctly. */
+
+#include "FileImage.hpp"
+#include "FileNifti.hpp"
+#include "Image.hpp"
+#include "NiftiHeader.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+template< class D >
+size_t Different( const Image< D > &img1, const Image< D > &img2 ) {
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img1.size( ); ++pxl ) {
+    if( img1[ pxl ] != img2[ pxl ] )
+      ++different;
+  }
+  return( different );
+}
+
+template< class D >
+void Compare( const Image< D > &img, const string &plain, const string &description ) {
+  string gziped = plain + ".gz";
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< D > plain_img( ReadNifti< D >( plain ) );
+  chrono::duration< double > plain_read = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< D > gzip_img( ReadNifti< D >( gziped ) );
+  chrono::duration< double > gzip_read = chrono::high_resolution_clock::now( ) - start;
+  cout << description << ". Mapped read: " << plain_read.count( ) << " s, compressed read: " << gzip_read.count( ) <<
+    " s. Different pixels: " << Different( img, plain_img ) + Different( img, gzip_img ) << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <output basename>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 256 dat/nifti_map_time" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  string basename( argv[ 4 ] );
+  Image< float > flt( x_size, y_size, z_size );
+  Image< int > itg( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < flt.size( ); ++pxl ) {
+    itg[ pxl ] = static_cast< int >( ( pxl * 2654435761u ) % 4096 );
+    flt[ pxl ] = itg[ pxl ] * 0.25f;
+  }
+  cout << "Image: " << flt.size( ) << " pixels." << endl;
+
+  NiftiHeader flt_hdr( flt );
+  WriteNifti( flt, basename + "_float.nii", flt_hdr );
+  WriteNifti( flt, basename + "_float.nii.gz", flt_hdr );
+  NiftiHeader short_hdr( itg );
+  short_hdr.DataType( NiftiType::INT16 );
+  WriteNifti( itg, basename + "_short.nii", short_hdr );
+  WriteNifti( itg, basename + "_short.nii.gz", short_hdr );
+
+  Compare( flt, basename + "_float.nii", "Float file, float image (adopted)" );
+  Compare( itg, basename + "_short.nii", "Short file, int image (converted)" );
+
+  /* Swapped short data converted in a single pass. */
+  size_t size = 100000;
+  Vector< short > swapped( size );
+  for( size_t elm = 0; elm < size; ++elm ) {
+    unsigned short value = static_cast< unsigned short >( elm * 7919 );
+    swapped[ elm ] = static_cast< short >( ( value >> 8 ) | ( value << 8 ) );
+  }
+  Vector< int > converted( size );
+  NiftiConvertData( NiftiType::INT16, reinterpret_cast< const char* >( swapped.data( ) ), size, true,
+                    converted.data( ) );
+  size_t different = 0;
+  for( size_t elm = 0; elm < size; ++elm ) {
+    if( converted[ elm ] != static_cast< short >( elm * 7919 ) )
+      ++different;
+  }
+  cout << "Swapped short data. Different elements: " << different << "." << endl;
+
+  return( 0 );
+}
@@ -0,0 +1,84 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of correlation with separable, small and large kernels. Compares Correlation, which selects
+ * separable passes, dense correlation or FFT correlation, against single thread CorrelationThreads. Also counts the
+ * integer pixels changed by explicitly choosing the separable or FFT methods. Set BIAL_THREADS to choose the number
+ * of threads. */
+
+#include "Correlation.hpp"
+#include "Image.hpp"
+#include "KernelBox.hpp"
+#include "KernelGabor.hpp"
+#include "KernelGaussian.hpp"
+#include "KernelSobel.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+void Compare( const string &name, const Image< float > &img, const Kernel &krn ) {
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< float > ref( img );
+  CorrelationThreads( img, krn, ref, 0, 1 );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< float > res( Correlation( img, krn ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  double error = 0.0;
+  double max_value = 0.0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    error = std::max( error, static_cast< double >( std::abs( res[ pxl ] - ref[ pxl ] ) ) );
+    max_value = std::max( max_value, static_cast< double >( std::abs( ref[ pxl ] ) ) );
+  }
+  std::vector< Vector< double > > weights;
+  cout << name << " (" << krn.size( ) << " elements" << ( SeparableKernel( krn, weights ) ? ", separable" : "" ) <<
+    "): " << ref_time.count( ) << " s, " << elapsed.count( ) << " s, speedup " << ref_time.count( ) / elapsed.count( )
+       << ". Maximum relative error: " << error / std::max( max_value, 1.0 ) << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128 128 64" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  Image< float > img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+    img[ pxl ] = static_cast< float >( ( pxl * 2654435761u ) % 1000 );
+  cout << "Volume: " << x_size << "x" << y_size << "x" << z_size << ", threads: " <<
+    ThreadPool::Global( ).Threads( ) << "." << endl;
+
+  Compare( "Sobel", img, KernelType::NormalizedSobel( img.Dims( ), 0 ) );
+  Kernel box( KernelType::Box( img.Dims( ), 7 ) );
+  for( size_t idx = 0; idx < box.size( ); ++idx )
+    box.Value( idx ) = 1.0f / box.size( );
+  Compare( "Box of side 7", img, box );
+  Compare( "Gaussian radius 2", img, KernelType::NormalizedGaussian( img.Dims( ), 2.0f, 1.0f ) );
+  Compare( "Gabor", img, KernelType::NormalizedGabor( 1.5f, img.Dims( ), 0 ) );
+  Compare( "Gaussian radius 8", img, KernelType::NormalizedGaussian( img.Dims( ), 8.0f, 3.0f ) );
+
+  Image< int > int_img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < int_img.size( ); ++pxl )
+    int_img[ pxl ] = static_cast< int >( img[ pxl ] );
+  Image< int > dense( Correlation( int_img, box ) );
+  Image< int > separable( Correlation( int_img, box, CorrelationMethod::Separable ) );
+  Image< int > fft( Correlation( int_img, box, CorrelationMethod::FFT ) );
+  size_t separable_diff = 0;
+  size_t fft_diff = 0;
+  for( size_t pxl = 0; pxl < int_img.size( ); ++pxl ) {
+    if( separable[ pxl ] != dense[ pxl ] )
+      ++separable_diff;
+    if( fft[ pxl ] != dense[ pxl ] )
+      ++fft_diff;
+  }
+  cout << "Integer image, box of side 7: " << separable_diff << " pixels differ by the separable method, " << fft_diff
+       << " by the FFT method." << endl;
+
+  return( 0 );
+}
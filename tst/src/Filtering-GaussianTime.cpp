@@ -0,0 +1,95 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of Gaussian filtering with the dense spherical kernel, the separable filter, and the recursive
+ * filter. Checks the separable filter against a direct box correlation and the recursive filter against a wide
+ * separable filter. */
+
+#include "Correlation.hpp"
+#include "FilteringGaussian.hpp"
+#include "Image.hpp"
+#include "KernelGaussian.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <standard deviation>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128 128 128 2.0" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  float std_dev = atof( argv[ 4 ] );
+  float radius = 3.0 * std_dev;
+  int rds = static_cast< int >( radius );
+  Image< float > img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+    img[ pxl ] = static_cast< float >( ( pxl * 2654435761u ) % 256 );
+  cout << "Image: " << img.size( ) << " pixels. Radius: " << radius << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< float > dense( Correlation( img, KernelType::Gaussian( img.Dims( ), radius, std_dev ) ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Dense spherical kernel: " << elapsed.count( ) << " s." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< float > separable( Filtering::Gaussian( img, radius, std_dev ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Separable: " << elapsed.count( ) << " s." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< float > recursive( Filtering::RecursiveGaussian( img, std_dev ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Recursive: " << elapsed.count( ) << " s." << endl;
+
+  /* Direct box correlation on a few pixels. */
+  double amplitude = 1.0 / std::pow( std::sqrt( 2 * M_PI ) * std_dev, img.Dims( ) );
+  double max_error = 0.0;
+  for( size_t pxl = 0; pxl < img.size( ); pxl += 997 ) {
+    Vector< size_t > crd( img.Coordinates( pxl ) );
+    double sum = 0.0;
+    for( int z = -rds; z <= rds; ++z ) {
+      for( int y = -rds; y <= rds; ++y ) {
+        for( int x = -rds; x <= rds; ++x ) {
+          int adj_x = crd[ 0 ] + x;
+          int adj_y = crd[ 1 ] + y;
+          int adj_z = crd[ 2 ] + ( img.Dims( ) == 3 ? z : 0 );
+          if( ( adj_x < 0 ) || ( adj_y < 0 ) || ( adj_z < 0 ) || ( adj_x >= static_cast< int >( x_size ) ) ||
+              ( adj_y >= static_cast< int >( y_size ) ) || ( adj_z >= static_cast< int >( z_size ) ) )
+            continue;
+          double dist = x * x + y * y + ( img.Dims( ) == 3 ? z * z : 0 );
+          sum += img( adj_x, adj_y, adj_z ) * amplitude * std::exp( -dist / ( 2.0 * std_dev * std_dev ) );
+        }
+      }
+      if( img.Dims( ) != 3 )
+        break;
+    }
+    max_error = std::max( max_error, std::abs( sum - separable[ pxl ] ) );
+  }
+  cout << "Separable against direct box correlation. Maximum error: " << max_error << "." << endl;
+
+  /* Recursive filter against separable filter with 4 standard deviations, far from borders. */
+  Image< float > wide( Filtering::Gaussian( img, 4.0 * std_dev, std_dev ) );
+  size_t border = static_cast< size_t >( 8.0 * std_dev );
+  max_error = 0.0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    Vector< size_t > crd( img.Coordinates( pxl ) );
+    bool inside = true;
+    for( size_t dms = 0; dms < img.Dims( ); ++dms ) {
+      if( ( crd[ dms ] < border ) || ( crd[ dms ] + border >= img.size( dms ) ) )
+        inside = false;
+    }
+    if( inside )
+      max_error = std::max( max_error, static_cast< double >( std::abs( recursive[ pxl ] - wide[ pxl ] ) ) );
+  }
+  cout << "Recursive against separable filter far from borders. Maximum error: " << max_error <<
+    " (intensity range 0-255)." << endl;
+
+  return( 0 );
+}
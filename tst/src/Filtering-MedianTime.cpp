@@ -0,0 +1,115 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of median filter and median features with sliding windows against sorting the neighborhood of
+ * each pixel. Integer images use histogram windows and float images use sorted windows. */
+
+#include "AdjacencyIterator.hpp"
+#include "AdjacencyRound.hpp"
+#include "Feature.hpp"
+#include "FilteringMedian.hpp"
+#include "Image.hpp"
+#include "MedianFeature.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Median filter sorting the neighborhood of each pixel. */
+template< class D >
+Image< D > SortMedian( const Image< D > &img, const Adjacency &adj ) {
+  Image< D > res( img );
+  AdjacencyIterator adj_itr( img, adj );
+  Vector< D > queue( adj.size( ) );
+  size_t adj_pxl;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    size_t idx = 0;
+    for( size_t adj_idx = 0; adj_idx < adj.size( ); ++adj_idx ) {
+      if( adj_itr.AdjIdx( pxl, adj_idx, adj_pxl ) )
+        queue[ idx++ ] = img[ adj_pxl ];
+    }
+    sort( queue.begin( ), queue.begin( ) + idx );
+    res[ pxl ] = queue[ ( idx - 1 ) / 2 ];
+  }
+  return( res );
+}
+
+/* Median features sorting the neighborhood of each pixel. Adjacents out of image are copies of the pixel. */
+template< class D >
+Feature< D > SortMedianFeature( const Image< D > &img, const Adjacency &adj, size_t features ) {
+  Feature< D > res( img.size( ), features );
+  AdjacencyIterator adj_itr( img, adj );
+  Vector< D > queue( adj.size( ) );
+  size_t adj_base = ( adj.size( ) / 2 ) - ( features / 2 );
+  size_t adj_pxl;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    for( size_t adj_idx = 0; adj_idx < adj.size( ); ++adj_idx )
+      queue[ adj_idx ] = adj_itr.AdjIdx( pxl, adj_idx, adj_pxl ) ? img[ adj_pxl ] : img[ pxl ];
+    sort( queue.begin( ), queue.end( ) );
+    for( size_t ftr = 0; ftr < features; ++ftr )
+      res( pxl, ftr ) = queue[ adj_base + ftr ];
+  }
+  return( res );
+}
+
+template< class D >
+void Compare( const Image< D > &img, float radius, const string &name ) {
+  Adjacency adj( AdjacencyType::HyperSpheric( radius, img.Dims( ) ) );
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< D > sorted( SortMedian( img, adj ) );
+  chrono::duration< double > sort_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< D > sliding( Filtering::Median( img, radius ) );
+  chrono::duration< double > sliding_time = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( sorted[ pxl ] != sliding[ pxl ] )
+      ++different;
+  }
+  cout << name << " median. Sorting: " << sort_time.count( ) << " s, sliding window: " << sliding_time.count( ) <<
+    " s, speedup: " << sort_time.count( ) / sliding_time.count( ) << ". Different pixels: " << different << "." <<
+    endl;
+
+  size_t features = adj.size( ) * 0.6;
+  start = chrono::high_resolution_clock::now( );
+  Feature< D > sorted_ftr( SortMedianFeature( img, adj, features ) );
+  sort_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Feature< D > sliding_ftr( MedianFeature( img, adj, 0.6 ) );
+  sliding_time = chrono::high_resolution_clock::now( ) - start;
+  different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    for( size_t ftr = 0; ftr < features; ++ftr ) {
+      if( sorted_ftr( pxl, ftr ) != sliding_ftr( pxl, ftr ) )
+        ++different;
+    }
+  }
+  cout << name << " median features. Sorting: " << sort_time.count( ) << " s, sliding window: " <<
+    sliding_time.count( ) << " s, speedup: " << sort_time.count( ) / sliding_time.count( ) <<
+    ". Different features: " << different << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <radius>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128 128 128 3.0" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  float radius = atof( argv[ 4 ] );
+  Image< int > int_img( x_size, y_size, z_size );
+  Image< float > float_img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < int_img.size( ); ++pxl ) {
+    int_img[ pxl ] = ( pxl * 2654435761u ) % 4096;
+    float_img[ pxl ] = int_img[ pxl ] / 7.0f;
+  }
+  cout << "Image: " << int_img.size( ) << " pixels. Radius: " << radius << "." << endl;
+  Compare( int_img, radius, "Integer" );
+  Compare( float_img, radius, "Float" );
+
+  return( 0 );
+}
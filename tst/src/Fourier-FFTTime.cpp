@@ -0,0 +1,109 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of the FFT of a synthetic volume of any dimensions. Compares the FFT of vectors of several
+ * lengths against the direct discrete Fourier transform, the real FFT against the complex one, and the FFT
+ * correlation against the spatial one. Set BIAL_THREADS to choose the number of threads. */
+
+#include "AdjacencyRound.hpp"
+#include "Correlation.hpp"
+#include "Fourier.hpp"
+#include "Image.hpp"
+#include "Kernel.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 180" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+
+  double error = 0.0;
+  size_t length[ ] = { 1, 2, 6, 15, 16, 49, 59, 97, 180, 256, 1009 };
+  for( size_t len : length ) {
+    Vector< bial_complex > vct( len );
+    for( size_t elm = 0; elm < len; ++elm )
+      vct[ elm ] = bial_complex( std::sin( 1.3 * elm ), std::cos( 0.7 * elm ) );
+    Vector< bial_complex > res( vct );
+    FFT( res, true );
+    for( size_t frq = 0; frq < len; ++frq ) {
+      bial_complex sum( 0.0, 0.0 );
+      for( size_t elm = 0; elm < len; ++elm )
+        sum += vct[ elm ] * std::polar( 1.0, -2.0 * M_PI * ( ( elm * frq ) % len ) / len );
+      error = std::max( error, std::abs( sum - res[ frq ] ) / len );
+    }
+    FFT( res, false );
+    for( size_t elm = 0; elm < len; ++elm )
+      error = std::max( error, std::abs( res[ elm ] - vct[ elm ] ) );
+  }
+  cout << "Vector FFT against direct transform. Maximum error: " << error << "." << endl;
+
+  Image< float > img( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+    img[ pxl ] = static_cast< float >( ( pxl * 2654435761u ) % 1000 );
+  cout << "Volume: " << x_size << "x" << y_size << "x" << z_size << ", threads: " <<
+    ThreadPool::Global( ).Threads( ) << "." << endl;
+  Image< bial_complex > c_img( img );
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< bial_complex > spectrum( FFT( c_img ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "FFT: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  Image< bial_complex > inverse( FFT( spectrum, false ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  error = 0.0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+    error = std::max( error, std::abs( inverse[ pxl ] - c_img[ pxl ] ) );
+  cout << "Inverse FFT: " << elapsed.count( ) << " s. Maximum error: " << error << "." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< bial_complex > half( RealFFT( img ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  error = 0.0;
+  for( size_t z = 0; z < half.size( 2 ); ++z ) {
+    for( size_t y = 0; y < half.size( 1 ); ++y ) {
+      for( size_t x = 0; x < half.size( 0 ); ++x )
+        error = std::max( error, std::abs( half( x, y, z ) - spectrum( x, y, z ) ) / img.size( ) );
+    }
+  }
+  cout << "Real FFT: " << elapsed.count( ) << " s. Maximum error: " << error << "." << endl;
+  Image< float > real_inverse( img.Dim( ) );
+  start = chrono::high_resolution_clock::now( );
+  InverseRealFFT( half, real_inverse );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  error = 0.0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl )
+    error = std::max( error, static_cast< double >( std::abs( real_inverse[ pxl ] - img[ pxl ] ) ) );
+  cout << "Inverse real FFT: " << elapsed.count( ) << " s. Maximum error: " << error << "." << endl;
+
+  Image< int > small( 64, 64, 32 );
+  for( size_t pxl = 0; pxl < small.size( ); ++pxl )
+    small[ pxl ] = static_cast< int >( ( pxl * 2654435761u ) % 1000 );
+  Kernel krn( AdjacencyType::HyperSpheric( 5.0, 3 ) );
+  for( size_t idx = 0; idx < krn.size( ); ++idx )
+    krn.Value( idx ) = static_cast< float >( idx % 7 ) - 3.0f;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > spatial( Correlation( small, krn ) );
+  chrono::duration< double > spatial_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > fourier( CorrelationFFT( small, krn ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < small.size( ); ++pxl ) {
+    if( spatial[ pxl ] != fourier[ pxl ] )
+      ++different;
+  }
+  cout << "Correlation of a 64x64x32 volume by a " << krn.size( ) << " element kernel: " << spatial_time.count( ) <<
+    " s, FFT correlation: " << elapsed.count( ) << " s. Different pixels: " << different << "." << endl;
+
+  return( 0 );
+}
@@ -29,15 +29,7 @@ int main( int argc, char *argv[ ] ) {
   float max_rad = atof( argv[ 4 ] );
   COMMENT( "Running FFT.", 0 );
   Image< bial_complex > c_img( img );
-  for( size_t z = 0; z < c_img.size( 2 ); ++z ) {
-    for( size_t y = 0; y < c_img.size( 1 ); ++y ) {
-      for( size_t x = 0; x < c_img.size( 0 ); ++x ) {
-        int pot = static_cast< int >( ( x + y + z ) % 2 ) * -2 + 1;
-        c_img( x, y, z ).real( c_img( x, y, z ).real( ) * pot );
-      }
-    }
-  }
-  Image< bial_complex > f_img( FFT( c_img ) );
+  Image< bial_complex > f_img( FFTShift( FFT( c_img ) ) );
   COMMENT( "Filtering inhomogeneity.", 0 );
   Adjacency adj( AdjacencyType::HyperSpheric( max_rad, img.Dims( ) ) );
   Vector< size_t > src_pxl( 3, f_img.size( 2 ) / 2 );
@@ -52,20 +44,10 @@ int main( int argc, char *argv[ ] ) {
   Image< llint > abs_img( f_img.Dim( ) );
   for( size_t pxl = 0; pxl < abs_img.size( ); ++pxl )
     abs_img[ pxl ] = static_cast< llint >( std::abs( f_img[ pxl ] ) );
-  Write( abs_img * ( 255.0 / abs_img.Maximum( ) ), "abs_img.pgm" );
+  Write( Image< llint >( abs_img * ( 255.0 / abs_img.Maximum( ) ) ), "abs_img.pgm" );
   COMMENT( "Running IFFT.", 0 );
-  Image< bial_complex > r_img( FFT( f_img, false ) );
-  Image< int > res_pad( r_img );
-  Image< int > res( img.Dim( ) );
-  ZeroUnPad( res_pad, res );
-  for( size_t z = 0; z < c_img.size( 2 ); ++z ) {
-    for( size_t y = 0; y < c_img.size( 1 ); ++y ) {
-      for( size_t x = 0; x < c_img.size( 0 ); ++x ) {
-        int pot = static_cast< int >( ( x + y + z ) % 2 ) * -2 + 1;
-        res( x, y, z ) *= pot;
-      }
-    }
-  }
+  Image< bial_complex > r_img( FFT( FFTShift( f_img, false ), false ) );
+  Image< int > res( r_img );
   Write( res, argv[ 2 ], argv[ 1 ] );
   
   return( 0 );
@@ -0,0 +1,115 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of morphological dilation and erosion of a synthetic volume with spheres, boxes and lines.
+ * Compares Dilate, Erode, DilateBin and ErodeBin, which use line passes for these structuring elements, against
+ * DilateThreads, ErodeThreads, DilateBinThreads and ErodeBinThreads, which scan the whole adjacency relation of each
+ * pixel. Set BIAL_THREADS to choose the number of threads. */
+
+#include "Adjacency.hpp"
+#include "AdjacencyRound.hpp"
+#include "Image.hpp"
+#include "MorphologyDilation.hpp"
+#include "MorphologyErosion.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Box from low to high in each dimension. */
+Adjacency Box( int x_low, int x_high, int y_low, int y_high, int z_low, int z_high ) {
+  Adjacency adj( ( x_high - x_low + 1 ) * ( y_high - y_low + 1 ) * ( z_high - z_low + 1 ), 3 );
+  size_t elm = 0;
+  for( int z = z_low; z <= z_high; ++z ) {
+    for( int y = y_low; y <= y_high; ++y ) {
+      for( int x = x_low; x <= x_high; ++x ) {
+        adj( elm, 0 ) = x;
+        adj( elm, 1 ) = y;
+        adj( elm, 2 ) = z;
+        ++elm;
+      }
+    }
+  }
+  return( adj );
+}
+
+/* Number of different pixels. */
+size_t Different( const Image< int > &img, const Image< int > &ref ) {
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( img[ pxl ] != ref[ pxl ] )
+      ++different;
+  }
+  return( different );
+}
+
+void Compare( const string &name, const Image< int > &gray, const Image< int > &binary, const Adjacency &adj ) {
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< int > ref_dilation( gray );
+  Morphology::DilateThreads( gray, adj, ref_dilation, 0, 1 );
+  Image< int > ref_erosion( gray );
+  Morphology::ErodeThreads( gray, adj, ref_erosion, 0, 1 );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > dilation( Morphology::Dilate( gray, adj ) );
+  Image< int > erosion( Morphology::Erode( gray, adj ) );
+  chrono::duration< double > time = chrono::high_resolution_clock::now( ) - start;
+
+  Vector< size_t > seeds;
+  for( size_t pxl = 0; pxl < binary.size( ); ++pxl ) {
+    if( binary[ pxl ] == 0 )
+      seeds.push_back( pxl );
+  }
+  start = chrono::high_resolution_clock::now( );
+  Image< int > ref_bin_dilation( binary );
+  Morphology::DilateBinThreads( binary, adj, seeds, ref_bin_dilation, 0, 1 );
+  seeds.clear( );
+  for( size_t pxl = 0; pxl < binary.size( ); ++pxl ) {
+    if( binary[ pxl ] != 0 )
+      seeds.push_back( pxl );
+  }
+  Image< int > ref_bin_erosion( binary );
+  Morphology::ErodeBinThreads( binary, adj, seeds, ref_bin_erosion, 0, 1 );
+  chrono::duration< double > ref_bin_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > bin_dilation( Morphology::DilateBin( binary, adj ) );
+  Image< int > bin_erosion( Morphology::ErodeBin( binary, adj ) );
+  chrono::duration< double > bin_time = chrono::high_resolution_clock::now( ) - start;
+
+  cout << name << " (" << adj.size( ) << " elements). Gray: " << ref_time.count( ) << " s, " << time.count( ) <<
+    " s, speedup " << ref_time.count( ) / time.count( ) << ". Binary: " << ref_bin_time.count( ) << " s, " <<
+    bin_time.count( ) << " s, speedup " << ref_bin_time.count( ) / bin_time.count( ) << ". Different pixels: " <<
+    Different( dilation, ref_dilation ) << "," << Different( erosion, ref_erosion ) << "," <<
+    Different( bin_dilation, ref_bin_dilation ) << "," << Different( bin_erosion, ref_bin_erosion ) << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 2 ) {
+    cout << "Usage: " << argv[ 0 ] << " <size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128" << endl;
+    return( 0 );
+  }
+  size_t size = atoi( argv[ 1 ] );
+  Image< int > gray( size, size, size / 2 );
+  Image< int > binary( size, size, size / 2 );
+  for( size_t pxl = 0; pxl < gray.size( ); ++pxl ) {
+    gray[ pxl ] = static_cast< int >( ( pxl * 2654435761u ) % 1000 );
+    binary[ pxl ] = ( ( pxl * 2654435761u ) % 97 < 3 ) ? 1 : 0;
+  }
+  cout << "Volume: " << size << "x" << size << "x" << size / 2 << ", threads: " << ThreadPool::Global( ).Threads( ) <<
+    "." << endl;
+  Compare( "Sphere radius 1.0", gray, binary, AdjacencyType::HyperSpheric( 1.0, 3 ) );
+  Compare( "Sphere radius 2.0", gray, binary, AdjacencyType::HyperSpheric( 2.0, 3 ) );
+  Compare( "Sphere radius 5.0", gray, binary, AdjacencyType::HyperSpheric( 5.0, 3 ) );
+  Compare( "Box 7x5x3", gray, binary, Box( -3, 3, -2, 2, -1, 1 ) );
+  Compare( "Line 1x9x1", gray, binary, Box( 0, 0, -4, 4, 0, 0 ) );
+  Compare( "Shifted box", gray, binary, Box( 1, 4, -3, 0, 0, 2 ) );
+  Adjacency gaps( 3, 3 );
+  gaps( 1, 0 ) = 2;
+  gaps( 2, 0 ) = -2;
+  Compare( "Runs with gaps", gray, binary, gaps );
+
+  return( 0 );
+}
@@ -126,7 +126,7 @@ int main( int argc, char *argv[] ) {
       }
     }
     Image< int > value( cgrad );
-    Image< int > pred( value );
+    Image< bial_index > pred( value );
     Adjacency adj( AdjacencyType::Circular( 1.9 ) );
     SumPathFunction< Image, int > pf( value, nullptr, &pred, false, value );
     size_t size = value.size( );
@@ -155,7 +155,7 @@ int main( int argc, char *argv[] ) {
     size_t min_pxl = min_y * value.size( 0 ) + value.size( 0 ) - 1;
     COMMENT( "min_pxl: " << min_pxl, 0 );
     Image< int > curve( grad.Dim( ) );
-    int prd = min_pxl;
+    bial_index prd = min_pxl;
     long long sum_y = 0;
     do {
       sum_y += prd / value.size( 0 );
@@ -0,0 +1,115 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of seed edition with differential IFT against a complete watershed IFT. Checks that both
+ * compute the same path values and that labels are consistent with the predecessor forest. */
+
+#include "AdjacencyRound.hpp"
+#include "FastIncreasingFifoBucketQueue.hpp"
+#include "Image.hpp"
+#include "ImageIFT.hpp"
+#include "MaxPathFunction.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Complete watershed IFT from the given seeds. */
+void Watershed( const Image< int > &gradient, const Adjacency &adj, const Vector< size_t > &seeds,
+                Image< int > &value, Image< int > &label, Image< bial_index > &pred ) {
+  value.Set( numeric_limits< int >::max( ) );
+  FastIncreasingFifoBucketQueue queue( gradient.size( ), 0, gradient.Maximum( ) + 2 );
+  for( size_t idx = 0; idx < seeds.size( ); ++idx ) {
+    value[ seeds[ idx ] ] = 0;
+    queue.Insert( seeds[ idx ], value[ seeds[ idx ] ] );
+  }
+  MaxPathFunction< Image, int > pf( value, &label, &pred, true, gradient );
+  ImageIFT< int > ift( value, adj, &pf, &queue );
+  ift.Run( );
+}
+
+/* Number of elements whose label differs from the label of their root. */
+size_t Inconsistent( const Image< int > &label, const Image< bial_index > &pred ) {
+  size_t errors = 0;
+  for( size_t pxl = 0; pxl < label.size( ); ++pxl ) {
+    size_t root = pxl;
+    while( pred[ root ] != -1 )
+      root = pred[ root ];
+    if( label[ root ] != label[ pxl ] )
+      ++errors;
+  }
+  return( errors );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size> <edits>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128 128 128 10" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  size_t edits = atoi( argv[ 4 ] );
+  Image< int > gradient( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < gradient.size( ); ++pxl )
+    gradient[ pxl ] = ( pxl * 2654435761u ) % 256;
+  size_t size = gradient.size( );
+  Adjacency adj( AdjacencyType::HyperSpheric( 1.0, gradient.Dims( ) ) );
+  Vector< size_t > seeds;
+  for( size_t pxl = 0; pxl < size; pxl += 9973 )
+    seeds.push_back( pxl );
+  cout << "Image: " << size << " pixels. Seeds: " << seeds.size( ) << "." << endl;
+
+  Image< int > value( gradient.Dim( ) );
+  Image< int > label( gradient.Dim( ) );
+  Image< bial_index > pred( gradient.Dim( ) );
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  value.Set( numeric_limits< int >::max( ) );
+  /* Seeds are queued with value 0, so that all of them are roots and may be removed. */
+  FastIncreasingFifoBucketQueue queue( size, 0, gradient.Maximum( ) + 2 );
+  for( size_t idx = 0; idx < seeds.size( ); ++idx ) {
+    value[ seeds[ idx ] ] = 0;
+    queue.Insert( seeds[ idx ], value[ seeds[ idx ] ] );
+  }
+  MaxPathFunction< Image, int > pf( value, &label, &pred, true, gradient );
+  ImageIFT< int > ift( value, adj, &pf, &queue );
+  ift.Run( );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Complete IFT: " << elapsed.count( ) << " s." << endl;
+
+  double differential = 0.0;
+  for( size_t edt = 0; edt < edits; ++edt ) {
+    size_t removed = seeds[ ( edt * 7 ) % seeds.size( ) ];
+    size_t added = ( removed + size / 3 + edt * 101 ) % size;
+    for( size_t idx = 0; idx < seeds.size( ); ++idx ) {
+      if( seeds[ idx ] == removed )
+        seeds[ idx ] = added;
+    }
+    start = chrono::high_resolution_clock::now( );
+    ift.RemoveSeeds( Vector< size_t >( 1, removed ) );
+    ift.AddSeeds( Vector< size_t >( 1, added ), 0 );
+    ift.Run( );
+    elapsed = chrono::high_resolution_clock::now( ) - start;
+    differential += elapsed.count( );
+  }
+  cout << "Differential IFT: " << differential / edits << " s per edit (remove one seed and add another)." << endl;
+
+  Image< int > full_value( gradient.Dim( ) );
+  Image< int > full_label( gradient.Dim( ) );
+  Image< bial_index > full_pred( gradient.Dim( ) );
+  start = chrono::high_resolution_clock::now( );
+  Watershed( gradient, adj, seeds, full_value, full_label, full_pred );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < size; ++pxl ) {
+    if( value[ pxl ] != full_value[ pxl ] )
+      ++different;
+  }
+  cout << "Complete IFT with final seeds: " << elapsed.count( ) << " s. Different path values: " << different <<
+    ". Labels inconsistent with forest: " << Inconsistent( label, pred ) << "." << endl;
+
+  return( 0 );
+}
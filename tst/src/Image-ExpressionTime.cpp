@@ -0,0 +1,110 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of lazy image arithmetic over a synthetic volume. Compares expressions, evaluated in a single
+ * pass, against the same operations computed by compound operators, one temporary image per operation, as the eager
+ * operators did. Set BIAL_THREADS to choose the number of threads. */
+
+#include "Image.hpp"
+#include "Matrix.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Number of different pixels. */
+template< class D >
+size_t Different( const Image< D > &img, const Image< D > &ref ) {
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    if( img[ pxl ] != ref[ pxl ] )
+      ++different;
+  }
+  return( different );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 180" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  Image< int > img( x_size, y_size, z_size );
+  Image< int > msk( x_size, y_size, z_size );
+  Image< float > flt( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < img.size( ); ++pxl ) {
+    img[ pxl ] = static_cast< int >( ( pxl * 2654435761u ) % 4096 );
+    msk[ pxl ] = ( ( pxl * 2654435761u ) % 7 ) < 5 ? 1 : 0;
+    flt[ pxl ] = static_cast< float >( ( pxl * 2246822519u ) % 1000 ) / 10.0f;
+  }
+  cout << "Volume: " << x_size << "x" << y_size << "x" << z_size << ", threads: " <<
+    ThreadPool::Global( ).Threads( ) << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< int > tmp( img );
+  tmp *= msk;
+  int ref_max = tmp.Maximum( );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  int max = ( img * msk ).Maximum( );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "( img * msk ).Maximum( ): " << ref_time.count( ) << " s, " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Results: " << ref_max << ", " << max << "." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< int > ref_norm( img );
+  ref_norm -= 2048.0;
+  ref_norm *= msk;
+  ref_norm *= 0.25;
+  ref_norm += 1000.0;
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< int > norm( ( img - 2048.0 ) * msk * 0.25 + 1000.0 );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "( img - 2048 ) * msk * 0.25 + 1000: " << ref_time.count( ) << " s, " << elapsed.count( ) <<
+    " s, speedup " << ref_time.count( ) / elapsed.count( ) << ". Different pixels: " << Different( norm, ref_norm ) <<
+    "." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Image< float > ref_ratio( flt );
+  Image< float > ref_den( flt );
+  ref_den += 1.0;
+  ref_ratio /= ref_den;
+  ref_ratio *= 255.0;
+  Image< float > ref_sum( ref_ratio );
+  ref_sum += flt;
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< float > sum( flt / ( flt + 1.0 ) * 255.0 + flt );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "flt / ( flt + 1 ) * 255 + flt: " << ref_time.count( ) << " s, " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Different pixels: " << Different( sum, ref_sum ) << "." << endl;
+
+  Matrix< int > mtx1( 2, 3 );
+  Matrix< int > mtx2( 3, 2 );
+  Image< int > img1( 2, 3 );
+  Image< int > img2( 3, 2 );
+  bool mtx_throws = false;
+  bool img_throws = false;
+  try {
+    Matrix< int > mtx( mtx1 + mtx2 );
+  }
+  catch( std::logic_error & ) {
+    mtx_throws = true;
+  }
+  try {
+    Image< int > res( img1 - img2 * 2 );
+  }
+  catch( std::logic_error & ) {
+    img_throws = true;
+  }
+  cout << "2x3 + 3x2 matrices throws: " << mtx_throws << ". 2x3 - 3x2 * 2 images throws: " << img_throws << "." <<
+    endl;
+
+  return( 0 );
+}
@@ -0,0 +1,186 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of IFT with runtime path function and queue (ImageIFT) against the compile-time composed
+ * engine (ImageIFTEngine) and the parallel block IFT on watershed from markers and from all pixels, connected
+ * components and geodesic star path functions. Values, labels and predecessors are compared to ImageIFT. Parallel
+ * IFT is not equivalent to sequential IFT: labels and predecessors of tied elements may differ. Set
+ * BIAL_THREADS to choose the number of blocks of parallel IFT. */
+
+#include "AdjacencyRound.hpp"
+#include "ConnPathFunction.hpp"
+#include "FastIncreasingFifoBucketQueue.hpp"
+#include "GeoSumPathFunction.hpp"
+#include "GrowingBucketQueue.hpp"
+#include "Image.hpp"
+#include "ImageIFT.hpp"
+#include "ImageIFTEngine.hpp"
+#include "MaxPathFunction.hpp"
+#include "SegmentationConnectedComponents.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Number of pixels that differ. */
+template< class D >
+size_t Different( const Image< D > &img1, const Image< D > &img2 ) {
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img1.size( ); ++pxl ) {
+    if( img1[ pxl ] != img2[ pxl ] )
+      ++different;
+  }
+  return( different );
+}
+
+enum class Mode { RUNTIME, ENGINE, PARALLEL };
+
+/* Runs IFT from the queued seeds. Returns elapsed time. */
+template< Mode mode, class F, class Q >
+double Run( Image< int > &value, const Adjacency &adj, F &pf, Q &queue ) {
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  if( mode == Mode::ENGINE ) {
+    ImageIFTEngine< int, F, Q > ift( value, adj, &pf, &queue );
+    ift.Run( );
+  }
+  else {
+    ImageIFT< int > ift( value, adj, &pf, &queue );
+    if( mode == Mode::PARALLEL )
+      ift.EnableParallel( );
+    ift.Run( );
+  }
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  return( elapsed.count( ) );
+}
+
+/* Result of one mode. */
+struct Result {
+  Image< int > value;
+  Image< int > label;
+  Image< bial_index > pred;
+  double time;
+  Result( const Vector< size_t > &dim ) : value( dim ), label( dim ), pred( dim ), time( 0.0 ) {
+  }
+};
+
+/* Watershed from markers every 997 pixels, queued with value 0, so that all markers are roots. */
+template< Mode mode >
+void Markers( const Image< int > &gradient, const Adjacency &adj, Result &res ) {
+  size_t size = gradient.size( );
+  Image< int > handicap( gradient );
+  FastIncreasingFifoBucketQueue queue( size, 0, gradient.Maximum( ) + 2 );
+  res.value.Set( numeric_limits< int >::max( ) );
+  for( size_t pxl = 0; pxl < size; pxl += 997 ) {
+    handicap[ pxl ] = 0;
+    res.value[ pxl ] = 0;
+    queue.Insert( pxl, 0 );
+  }
+  MaxPathFunction< Image, int > pf( res.value, &res.label, &res.pred, true, handicap );
+  res.time = Run< mode >( res.value, adj, pf, queue );
+}
+
+/* Watershed from all pixels, queued with value gradient + 1, so that only regional minima are roots. */
+template< Mode mode >
+void Dense( const Image< int > &gradient, const Adjacency &adj, Result &res ) {
+  size_t size = gradient.size( );
+  FastIncreasingFifoBucketQueue queue( size, 0, gradient.Maximum( ) + 2 );
+  for( size_t pxl = 0; pxl < size; ++pxl ) {
+    res.value[ pxl ] = gradient[ pxl ] + 1;
+    queue.Insert( pxl, res.value[ pxl ] );
+  }
+  MaxPathFunction< Image, int > pf( res.value, &res.label, &res.pred, true, gradient );
+  res.time = Run< mode >( res.value, adj, pf, queue );
+}
+
+/* Connected components of a binary image, as in Segmentation::ConnectedComponents, with all pixels queued. */
+template< Mode mode >
+void Components( const Image< int > &binary, const Adjacency &adj, Result &res ) {
+  size_t size = binary.size( );
+  Image< int > handicap( binary.Dim( ) );
+  FastIncreasingFifoBucketQueue queue( size, 0, 2 );
+  res.value.Set( 1 );
+  for( size_t pxl = 0; pxl < size; ++pxl )
+    queue.Insert( pxl, res.value[ pxl ] );
+  ConnPathFunction< Image, int > pf( res.value, &res.label, &res.pred, true, handicap, binary );
+  res.time = Run< mode >( res.value, adj, pf, queue );
+}
+
+/* Geodesic star restriction from the central pixel. */
+template< Mode mode >
+void GeoStar( const Image< int > &gradient, const Adjacency &adj, Result &res ) {
+  size_t size = gradient.size( );
+  res.value = gradient;
+  GeodesicRestrictionPathFunction< int > pf( res.value, nullptr, &res.pred, false, gradient, gradient, adj, 0.5,
+                                             0.5 );
+  GrowingBucketQueue queue( size, 1, pf.Increasing( ), true );
+  res.value.Set( numeric_limits< int >::max( ) );
+  res.value[ size / 2 ] = 0;
+  queue.Insert( size / 2, 0 );
+  res.time = Run< mode >( res.value, adj, pf, queue );
+}
+
+/* Prints times and the number of different values, labels and predecessors against ImageIFT. */
+void Report( const string &title, const Result &runtime, const Result &engine, const Result &parallel,
+             bool labels ) {
+  cout << title << ". ImageIFT: " << runtime.time << " s, ImageIFTEngine: " << engine.time << " s, speedup: " <<
+    runtime.time / engine.time << ", parallel with " << ThreadPool::Global( ).Threads( ) << " threads: " <<
+    parallel.time << " s, speedup: " << runtime.time / parallel.time << "." << endl;
+  cout << "\tDifferent values, " << ( labels ? "labels, " : "" ) << "predecessors. Engine: " <<
+    Different( runtime.value, engine.value ) << ", ";
+  if( labels )
+    cout << Different( runtime.label, engine.label ) << ", ";
+  cout << Different( runtime.pred, engine.pred ) << ". Parallel, not equivalent on ties: " <<
+    Different( runtime.value, parallel.value ) << ", ";
+  if( labels )
+    cout << Different( runtime.label, parallel.label ) << ", ";
+  cout << Different( runtime.pred, parallel.pred ) << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <x size> <y size> <z size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 128 128 128" << endl;
+    return( 0 );
+  }
+  size_t x_size = atoi( argv[ 1 ] );
+  size_t y_size = atoi( argv[ 2 ] );
+  size_t z_size = atoi( argv[ 3 ] );
+  Image< int > gradient( x_size, y_size, z_size );
+  for( size_t pxl = 0; pxl < gradient.size( ); ++pxl )
+    gradient[ pxl ] = ( pxl * 2654435761u ) % 256;
+  cout << "Image: " << gradient.size( ) << " pixels." << endl;
+
+  Adjacency spheric( AdjacencyType::HyperSpheric( 1.0, gradient.Dims( ) ) );
+  Result runtime( gradient.Dim( ) );
+  Result engine( gradient.Dim( ) );
+  Result parallel( gradient.Dim( ) );
+  Markers< Mode::RUNTIME >( gradient, spheric, runtime );
+  Markers< Mode::ENGINE >( gradient, spheric, engine );
+  Markers< Mode::PARALLEL >( gradient, spheric, parallel );
+  Report( "Watershed from markers", runtime, engine, parallel, true );
+
+  Dense< Mode::RUNTIME >( gradient, spheric, runtime );
+  Dense< Mode::ENGINE >( gradient, spheric, engine );
+  Dense< Mode::PARALLEL >( gradient, spheric, parallel );
+  Report( "Watershed from all pixels", runtime, engine, parallel, true );
+
+  Image< int > binary( gradient.Dim( ) );
+  for( size_t pxl = 0; pxl < binary.size( ); ++pxl )
+    binary[ pxl ] = gradient[ pxl ] < 128 ? 1 : 0;
+  Components< Mode::RUNTIME >( binary, spheric, runtime );
+  Components< Mode::ENGINE >( binary, spheric, engine );
+  Components< Mode::PARALLEL >( binary, spheric, parallel );
+  Report( "Connected components", runtime, engine, parallel, true );
+  cout << "\tDifferent labels from Segmentation::ConnectedComponents: " <<
+    Different( runtime.label, Segmentation::ConnectedComponents( binary, spheric ) ) << "." << endl;
+
+  Adjacency adj( AdjacencyType::HyperSpheric( 1.5, gradient.Dims( ) ) );
+  GeoStar< Mode::RUNTIME >( gradient, adj, runtime );
+  GeoStar< Mode::ENGINE >( gradient, adj, engine );
+  GeoStar< Mode::PARALLEL >( gradient, adj, parallel );
+  Report( "Geodesic star", runtime, engine, parallel, false );
+
+  return( 0 );
+}
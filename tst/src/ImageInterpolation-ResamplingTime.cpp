@@ -0,0 +1,131 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of resampling a synthetic anisotropic volume to isotropic pixels, and of rotating it, by
+ * interpolating pixel by pixel through the virtual operator of PixelInterpolation and by the resampling engine. Set
+ * BIAL_THREADS to choose the number of threads. */
+
+#include "GeometricsAffine.hpp"
+#include "GeometricsRotate.hpp"
+#include "Image.hpp"
+#include "ImageInterpolation.hpp"
+#include "PixelInterpolation.hpp"
+#include "Resampling.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Derived classes are not inlined by the resampling engine, so they are interpolated pixel by pixel. */
+class VirtualNearest : public NearestInterpolation {
+};
+
+class VirtualLinear : public LinearInterpolation {
+};
+
+/* Number of different pixels and largest difference. */
+size_t Different( const Image< float > &img1, const Image< float > &img2, double &max_diff ) {
+  max_diff = 0.0;
+  if( img1.Dim( ) != img2.Dim( ) )
+    return( img1.size( ) );
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < img1.size( ); ++pxl ) {
+    double diff = std::abs( static_cast< double >( img1[ pxl ] ) - img2[ pxl ] );
+    if( diff > 0.0 )
+      ++different;
+    max_diff = std::max( max_diff, diff );
+  }
+  return( different );
+}
+
+void Compare( const Image< float > &img1, const Image< float > &img2, const string &title, double ref_time,
+              double time ) {
+  double max_diff;
+  size_t different = Different( img1, img2, max_diff );
+  cout << title << ": " << ref_time << " s pixel by pixel, " << time << " s by the engine, speedup " <<
+    ref_time / time << ". Different pixels: " << different << " of " << img1.size( ) << ", largest difference: " <<
+    max_diff << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 6 ) {
+    cout << "Usage: " << argv[ 0 ] << " <columns> <rows> <slices> <in-plane pixel size> <slice spacing>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256 256 60 0.9 3.0" << endl;
+    return( 0 );
+  }
+  Vector< size_t > dim = { static_cast< size_t >( atoi( argv[ 1 ] ) ), static_cast< size_t >( atoi( argv[ 2 ] ) ),
+                           static_cast< size_t >( atoi( argv[ 3 ] ) ) };
+  float pixel = atof( argv[ 4 ] );
+  float spacing = atof( argv[ 5 ] );
+  Image< float > img( dim, Vector< float >{ pixel, pixel, spacing } );
+  for( size_t z = 0; z < dim[ 2 ]; ++z ) {
+    for( size_t y = 0; y < dim[ 1 ]; ++y ) {
+      for( size_t x = 0; x < dim[ 0 ]; ++x )
+        img( x, y, z ) = 1000.0f * std::sin( 0.05f * x ) * std::cos( 0.03f * y ) + 20.0f * z + ( x * y ) % 17;
+    }
+  }
+  cout << "Volume: " << dim << ", pixel size " << img.PixelSize( ) << ", threads: " << ThreadPool::Global( ).Threads( )
+       << "." << endl;
+
+  VirtualLinear virtual_linear;
+  LinearInterpolation linear;
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Image< float > ref( ImageInterpolation::Interpolation( img, pixel, pixel, pixel, virtual_linear ) );
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Image< float > res( ImageInterpolation::Interpolation( img, pixel, pixel, pixel, linear ) );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Isotropic volume: " << res.Dim( ) << "." << endl;
+  Compare( ref, res, "Isotropic, linear", ref_time.count( ), elapsed.count( ) );
+
+  VirtualNearest virtual_nearest;
+  NearestInterpolation nearest;
+  start = chrono::high_resolution_clock::now( );
+  ref = ImageInterpolation::Interpolation( img, pixel, pixel, pixel, virtual_nearest );
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  res = ImageInterpolation::Interpolation( img, pixel, pixel, pixel, nearest );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  Compare( ref, res, "Isotropic, nearest", ref_time.count( ), elapsed.count( ) );
+
+  CubicBSplineInterpolation cubic;
+  start = chrono::high_resolution_clock::now( );
+  res = ImageInterpolation::Interpolation( img, pixel, pixel, pixel, cubic );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Isotropic, cubic B-spline: " << elapsed.count( ) << " s." << endl;
+  Vector< size_t > same = img.Dim( );
+  Vector< double > scale = { 1.0, 1.0, 1.0 };
+  Vector< double > translation = { 0.0, 0.0, 0.0 };
+  res = Resampling::Separable< CubicBSplineInterpolation >( img, same, img.PixelSize( ), scale, translation );
+  double max_diff;
+  size_t different = Different( img, res, max_diff );
+  cout << "Cubic B-spline at the original pixels. Different pixels: " << different << " of " << img.size( ) <<
+    ", largest difference: " << max_diff << "." << endl;
+
+  Matrix< float > transform( Geometrics::Rotate( 0.17, 2 ) );
+  transform = Geometrics::Rotate( transform, 0.09, 0 );
+  transform( 3, 0 ) = 12.5f;
+  transform( 3, 1 ) = -7.25f;
+  start = chrono::high_resolution_clock::now( );
+  ref = Geometrics::AffineTransform( img, transform, virtual_linear );
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  res = Geometrics::AffineTransform( img, transform, linear );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  Compare( ref, res, "Rotation, linear", ref_time.count( ), elapsed.count( ) );
+  start = chrono::high_resolution_clock::now( );
+  ref = Geometrics::AffineTransform( img, transform, virtual_nearest );
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  res = Geometrics::AffineTransform( img, transform, nearest );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  Compare( ref, res, "Rotation, nearest", ref_time.count( ), elapsed.count( ) );
+  start = chrono::high_resolution_clock::now( );
+  res = Geometrics::AffineTransform( img, transform, cubic );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Rotation, cubic B-spline: " << elapsed.count( ) << " s." << endl;
+
+  return( 0 );
+}
@@ -64,7 +64,7 @@ int main( int argc, char **argv ) {
 
   COMMENT( "Running LazyWalk.", 0 );
   Image< int > cost;
-  Image< int > pred;
+  Image< bial_index > pred;
   if( argc == 5 ) {
     COMMENT( "Creating mask.", 0 );
     Image< int > msk( Read< int >( argv[ 4 ] ) );
@@ -64,7 +64,7 @@ int main( int argc, char **argv ) {
 
   COMMENT( "Running LiveWire.", 0 );
   Image< int > cost;
-  Image< int > pred;
+  Image< bial_index > pred;
   float weight = atof( argv[ 4 ] );
   if( argc == 6 ) {
     COMMENT( "Creating mask.", 0 );
@@ -1,29 +1,109 @@
 /* Biomedical Image Analysis Library */
 /* See README file in the root instalation directory for more information. */
 
-/* Date: 2014/Oct/14 */
+/* Date: 2026/Oct/18 */
 /* Content: Test file. */
-/* Description: Test with Matrix class. */
+/* Description: Time of matrix product, inverse, determinant and solution of linear systems. Compares the product
+ * operator against the straightforward triple loop, and the LU based inverse against Gauss-Jordan elimination. Set
+ * BIAL_THREADS to choose the number of threads. */
 
 #include "Matrix.hpp"
+#include "MatrixDeterminant.hpp"
+#include "MatrixFactorization.hpp"
+#include "MatrixIdentity.hpp"
+#include "MatrixInverse.hpp"
+#include "MatrixTranspose.hpp"
+#include <chrono>
+#include <random>
 
 using namespace std;
 using namespace Bial;
 
-int main( int, char** ) {
-  Matrix< double > M1( 40000, 40000 );
-  Matrix< double > M2( 40000, 40000 );
-  for( size_t i = 0; i < M1.size( 1 ); ++i ) { /* static_cast< int > == ( int ) */
-    for( size_t j = 0; j < M1.size( 0 ); ++j ) {
-      M1[ i * M1.size( 0 ) + j ] = i + j;
-      M2[ i * M1.size( 0 ) + j ] = i - j;
+/* Maximum absolute value of the elements of mat * sol - rhs. */
+double Residual( const Matrix< double > &mat, const Matrix< double > &sol, const Matrix< double > &rhs ) {
+  Matrix< double > res( mat * sol );
+  double error = 0.0;
+  for( size_t elm = 0; elm < res.size( ); ++elm )
+    error = std::max( error, std::abs( res[ elm ] - rhs[ elm ] ) );
+  return( error );
+}
+
+/* Square matrix with pseudorandom elements in [ -1, 1 ). */
+Matrix< double > Pseudorandom( size_t size, unsigned int seed ) {
+  Matrix< double > res( size, size );
+  std::mt19937 generator( seed );
+  std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+  for( size_t elm = 0; elm < res.size( ); ++elm )
+    res[ elm ] = distribution( generator );
+  return( res );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 2 ) {
+    cout << "Usage: " << argv[ 0 ] << " <size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 1000" << endl;
+    return( 0 );
+  }
+  size_t size = atoi( argv[ 1 ] );
+  const Matrix< double > left( Pseudorandom( size, 1 ) );
+  const Matrix< double > right( Pseudorandom( size, 2 ) );
+  cout << "Matrices: " << size << "x" << size << ", threads: " << ThreadPool::Global( ).Threads( ) << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Matrix< double > ref( size, size );
+  for( size_t row = 0; row < size; ++row ) {
+    for( size_t col = 0; col < size; ++col ) {
+      for( size_t k = 0; k < size; ++k )
+        ref( col, row ) += left( k, row ) * right( col, k );
     }
   }
-  double total = 0.0;
-  for( size_t p = 0; p < M1.size( ); ++p ) {
-    total += M1[ p ] - M2[ p ];
+  chrono::duration< double > ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  Matrix< double > prod( left * right );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t elm = 0; elm < prod.size( ); ++elm ) {
+    if( prod[ elm ] != ref[ elm ] )
+      ++different;
   }
-  cout << total << endl;
+  cout << "Product: " << ref_time.count( ) << " s, " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Different elements: " << different << "." << endl;
+
+  start = chrono::high_resolution_clock::now( );
+  Matrix< double > ref_inv( MatrixOp::Inverse2( left ) );
+  ref_time = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  const Matrix< double > inv( MatrixOp::Inverse( left ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Inverse: " << ref_time.count( ) << " s, " << elapsed.count( ) << " s, speedup " <<
+    ref_time.count( ) / elapsed.count( ) << ". Maximum difference from identity: " <<
+    MatrixOp::CompareToIdentity( Matrix< double >( left * ref_inv ) ) << ", " <<
+    MatrixOp::CompareToIdentity( Matrix< double >( left * inv ) ) << "." << endl;
+
+  COMMENT( "Scaling rows to unit expected norm, so that the determinant does not overflow.", 0 );
+  const Matrix< double > scaled( left * std::sqrt( 3.0 / size ) );
+  start = chrono::high_resolution_clock::now( );
+  double det = MatrixOp::Determinant( scaled );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Determinant: " << elapsed.count( ) << " s. Product of the determinants of the matrix and its inverse: " <<
+    det * MatrixOp::Determinant( MatrixOp::Inverse( scaled ) ) << "." << endl;
+
+  Matrix< double > rhs( 1, size );
+  for( size_t row = 0; row < size; ++row )
+    rhs[ row ] = std::sin( 0.1 * row );
+  start = chrono::high_resolution_clock::now( );
+  Matrix< double > sol( MatrixOp::Solve( left, rhs ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "LU solution of a linear system: " << elapsed.count( ) << " s. Maximum residual: " <<
+    Residual( left, sol, rhs ) << "." << endl;
+  Matrix< double > spd( left * MatrixOp::Transpose( left ) );
+  for( size_t row = 0; row < size; ++row )
+    spd( row, row ) += size;
+  start = chrono::high_resolution_clock::now( );
+  sol = MatrixOp::Solve( spd, rhs );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Cholesky solution of a linear system: " << elapsed.count( ) << " s. Maximum residual: " <<
+    Residual( spd, sol, rhs ) << "." << endl;
 
   return( 0 );
 }
@@ -0,0 +1,86 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of all pairs feature distances computed by a scalar reference loop, one pair at a time by
+ * DFIDE::Distance, and in blocks of one query to many rows by DFIDE::Distances, with Euclidean and city block distance
+ * functions. Checks the blocks against the scalar reference. */
+
+#include "DFIDE.hpp"
+#include "Feature.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Scalar reference of the current distance function. */
+double Reference( const float *src, const float *tgt, size_t dms, bool euclidean ) {
+  double dist = 0.0;
+  for( size_t ftr = 0; ftr < dms; ++ftr ) {
+    double diff = static_cast< double >( src[ ftr ] ) - static_cast< double >( tgt[ ftr ] );
+    dist += euclidean ? diff * diff : std::abs( diff );
+  }
+  return( euclidean ? std::sqrt( dist ) : dist );
+}
+
+void Compare( const Feature< float > &feature, bool euclidean ) {
+  size_t elements = feature.Elements( );
+  size_t features = feature.Features( );
+  double reference_sum = 0.0;
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  for( size_t src = 0; src < elements; ++src ) {
+    for( size_t tgt = 0; tgt < elements; ++tgt )
+      reference_sum += Reference( feature.data( ) + src * features, feature.data( ) + tgt * features, features,
+                                  euclidean );
+  }
+  chrono::duration< double > scalar = chrono::high_resolution_clock::now( ) - start;
+  double pair_sum = 0.0;
+  start = chrono::high_resolution_clock::now( );
+  for( size_t src = 0; src < elements; ++src ) {
+    for( size_t tgt = 0; tgt < elements; ++tgt )
+      pair_sum += DFIDE::Distance( feature, src * features, tgt * features, features );
+  }
+  chrono::duration< double > pair = chrono::high_resolution_clock::now( ) - start;
+  Vector< double > distance( elements );
+  double block_sum = 0.0;
+  double max_error = 0.0;
+  double block_time = 0.0;
+  for( size_t src = 0; src < elements; ++src ) {
+    start = chrono::high_resolution_clock::now( );
+    DFIDE::Distances( feature.data( ) + src * features, feature.data( ), elements, features, distance.data( ) );
+    chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+    block_time += elapsed.count( );
+    for( size_t tgt = 0; tgt < elements; ++tgt ) {
+      block_sum += distance[ tgt ];
+      double reference = Reference( feature.data( ) + src * features, feature.data( ) + tgt * features, features,
+                                    euclidean );
+      max_error = std::max( max_error, std::abs( distance[ tgt ] - reference ) / std::max( 1.0, reference ) );
+    }
+  }
+  cout << ( euclidean ? "Euclidean" : "City block" ) << ". Scalar reference: " << scalar.count( ) << " s, pairs: " <<
+    pair.count( ) << " s, blocks: " << block_time << " s, speedup: " << scalar.count( ) / block_time <<
+    ". Maximum relative error: " << max_error << ". Sums: " << reference_sum << ", " << pair_sum << ", " <<
+    block_sum << "." << endl;
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 3 ) {
+    cout << "Usage: " << argv[ 0 ] << " <elements> <features>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 4000 32" << endl;
+    return( 0 );
+  }
+  size_t elements = atoi( argv[ 1 ] );
+  size_t features = atoi( argv[ 2 ] );
+  Feature< float > feature( elements, features );
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    for( size_t ftr = 0; ftr < features; ++ftr )
+      feature( elm, ftr ) = static_cast< float >( ( ( elm * features + ftr ) * 2654435761u ) % 1000 ) / 10.0f;
+  }
+  cout << "Elements: " << elements << ", features: " << features << "." << endl;
+  DFIDE::SetEuclideanDistanceFunction( );
+  Compare( feature, true );
+  DFIDE::SetCityBlockDistanceFunction( );
+  Compare( feature, false );
+  return( 0 );
+}
@@ -0,0 +1,69 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of knn graph construction by comparing all pairs of samples, with KnnGraphAdjacency, and by
+ * searching a kd-tree, with KdTreeGraphAdjacency. Checks that both graphs have the same arc weights. Arcs to
+ * equally distant samples may come in different order. Set BIAL_THREADS to choose the number of threads. */
+
+#include "Feature.hpp"
+#include "KdTreeGraphAdjacency.hpp"
+#include "KnnGraphAdjacency.hpp"
+#include "Sample.hpp"
+#include "SampleUniform.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <elements> <features> <scl_min> <scl_max>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 10000 3 0.1 0.2" << endl;
+    return( 0 );
+  }
+  size_t elements = atoi( argv[ 1 ] );
+  size_t features = atoi( argv[ 2 ] );
+  float scl_min = atof( argv[ 3 ] );
+  float scl_max = atof( argv[ 4 ] );
+  /* Clusters of points around a few centers, with some repeated coordinates. */
+  Feature< float > feature( elements, features );
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    for( size_t ftr = 0; ftr < features; ++ftr ) {
+      float center = 100.0f * ( ( elm % 5 ) + ftr );
+      feature( elm, ftr ) = center + static_cast< float >( ( ( elm * features + ftr ) * 2654435761u ) % 400 ) / 8.0f;
+    }
+  }
+  Sample sample( SampleType::Uniform( feature ) );
+  cout << "Elements: " << elements << ", features: " << features << "." << endl;
+
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  KdTreeGraphAdjacency tree;
+  tree.Initialize( feature, sample, scl_min, scl_max );
+  chrono::duration< double > tree_time = chrono::high_resolution_clock::now( ) - start;
+  size_t kmax = tree.HomogeneousSize( tree.Scales( ) - 1 );
+  cout << "kmax: " << kmax << ". Kd-tree search with " << ThreadPool::Global( ).Threads( ) << " threads: " <<
+    tree_time.count( ) << " s." << endl;
+
+  /* Both graphs have the same scales up to the maximum number of samples of KnnGraphAdjacency. */
+  if( elements > KnnGraphAdjacency::MaxSamples( ) ) {
+    cout << "All pairs comparison skipped above " << KnnGraphAdjacency::MaxSamples( ) << " elements." << endl;
+    return( 0 );
+  }
+  start = chrono::high_resolution_clock::now( );
+  KnnGraphAdjacency brute;
+  brute.Initialize( feature, sample, scl_min, scl_max );
+  chrono::duration< double > brute_time = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t src = 0; src < elements; ++src ) {
+    for( size_t knn = 0; knn < kmax; ++knn ) {
+      if( brute.ArcWeight( src, knn ) != tree.ArcWeight( src, knn ) )
+        ++different;
+    }
+  }
+  cout << "All pairs comparison: " << brute_time.count( ) << " s, speedup: " << brute_time.count( ) /
+    tree_time.count( ) << ". Different arc weights: " << different << "." << endl;
+
+  return( 0 );
+}
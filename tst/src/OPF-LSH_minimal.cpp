@@ -3,7 +3,8 @@
 
 /* Date: 2013/Sep/21 */
 /* Content: Test file. */
-/* Description: Test with OPF class and LSH. */
+/* Description: Test with OPF class and LSH. Builds two LSH indices at the same time, over the color features and over
+ * the features scaled by two, and queries them. */
 
 #include "AdjacencyRound.hpp"
 #include "BasicDefinitions.hpp"
@@ -28,27 +29,44 @@ int main( int argc, char *argv[] ) {
   Feature< int > feature = ColorFeature< int >( img, adj );
   Vector< float > radius( 1, 5.0 );
 
-  LSH_Init( &feature( 0, 0 ), feature.Elements( ), feature.Features( ), &radius[ 0 ], radius.size( ) );
+  Feature< int > scaled( feature );
+  for( size_t elm = 0; elm < scaled.Elements( ); ++elm ) {
+    for( size_t ftr = 0; ftr < scaled.Features( ); ++ftr )
+      scaled( elm, ftr ) *= 2;
+  }
+
+  PLSHIndexT lsh = LSH_Init( &feature( 0, 0 ), feature.Elements( ), feature.Features( ), &radius[ 0 ],
+                             radius.size( ) );
+  PLSHIndexT scaled_lsh = LSH_Init( &scaled( 0, 0 ), scaled.Elements( ), scaled.Features( ), &radius[ 0 ],
+                                    radius.size( ) );
+  PLSHQueryT query = LSH_NewQuery( lsh );
+  PLSHQueryT scaled_query = LSH_NewQuery( scaled_lsh );
 
   Vector< int > index( feature.Elements( ) - 1 );
   Vector< float > distance( feature.Elements( ) - 1 );
-  size_t adjs = LSH_Query( 0, 1.0, &( index[ 0 ] ), &( distance[ 0 ] ) );
-  std::cout << "# adjacents: " << adjs << std::endl;
-  std::cout << "Index(distance):" << std::endl;
-  for( size_t elm = 0; elm < adjs; ++elm ) {
-    std::cout << index[ elm ] << ", " << distance[ elm ] << "; ";
-  }
-  std::cout << std::endl;
+  size_t query_elm[ 2 ] = { 0, 1000 };
+  for( size_t qry = 0; qry < 2; ++qry ) {
+    size_t adjs = LSH_Query( query, query_elm[ qry ], 1.0, &( index[ 0 ] ), &( distance[ 0 ] ) );
+    std::cout << "# adjacents: " << adjs << std::endl;
+    std::cout << "Index(distance):" << std::endl;
+    for( size_t elm = 0; elm < adjs; ++elm ) {
+      std::cout << index[ elm ] << ", " << distance[ elm ] << "; ";
+    }
+    std::cout << std::endl;
 
-  adjs = LSH_Query( 1000, 1.0, &( index[ 0 ] ), &( distance[ 0 ] ) );
-  std::cout << "# adjacents: " << adjs << std::endl;
-  std::cout << "Index(distance):" << std::endl;
-  for( size_t elm = 0; elm < adjs; ++elm ) {
-    std::cout << index[ elm ] << ", " << distance[ elm ] << "; ";
+    adjs = LSH_Query( scaled_query, query_elm[ qry ], 2.0, &( index[ 0 ] ), &( distance[ 0 ] ) );
+    std::cout << "# adjacents of scaled features: " << adjs << std::endl;
+    std::cout << "Index(distance):" << std::endl;
+    for( size_t elm = 0; elm < adjs; ++elm ) {
+      std::cout << index[ elm ] << ", " << distance[ elm ] << "; ";
+    }
+    std::cout << std::endl;
   }
-  std::cout << std::endl;
 
-  LSH_Free( );
+  LSH_FreeQuery( query );
+  LSH_FreeQuery( scaled_query );
+  LSH_Free( lsh );
+  LSH_Free( scaled_lsh );
 
   return( 0 );
 }
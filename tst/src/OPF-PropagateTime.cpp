@@ -0,0 +1,112 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of the propagation of OPF labels from the clustered subsamples to the other samples. Compares
+ * the labels of OPFClassifier against those found by scanning the forest nodes in order for every sample, as
+ * Graph::PropagateLabelThread does, and times Graph::PropagateLabel after clustering. Set BIAL_THREADS to choose the
+ * number of threads. */
+
+#include "DFIDE.hpp"
+#include "Feature.hpp"
+#include "Graph.hpp"
+#include "KnnGraphAdjacency.hpp"
+#include "OPFClassifier.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Labels as computed before OPFClassifier, scanning the forest nodes in order for each unlabeled sample. */
+Vector< int > Reference( const Feature< float > &feature, const Vector< size_t > &element, const Vector< int > &label,
+                         const Vector< double > &radius ) {
+  Vector< int > result( feature.Elements( ) );
+  for( size_t elm = 0; elm < feature.Elements( ); ++elm ) {
+    result( elm ) = feature.Label( elm );
+    if( result( elm ) != -1 )
+      continue;
+    size_t bst = 0;
+    double min_distance = std::numeric_limits< double >::max( );
+    for( size_t idx = 0; idx < element.size( ); ++idx ) {
+      double distance = DFIDE::Distance( feature, feature, elm * feature.Features( ),
+                                         element( idx ) * feature.Features( ), feature.Features( ) );
+      if( distance <= radius( idx ) ) {
+        result( elm ) = label( idx );
+        break;
+      }
+      if( min_distance > distance ) {
+        min_distance = distance;
+        bst = idx;
+      }
+    }
+    if( result( elm ) == -1 )
+      result( elm ) = label( bst );
+  }
+  return( result );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 4 ) {
+    cout << "Usage: " << argv[ 0 ] << " <elements> <features> <nodes>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 50000 3 5000" << endl;
+    return( 0 );
+  }
+  size_t elements = atoi( argv[ 1 ] );
+  size_t features = atoi( argv[ 2 ] );
+  size_t nodes = atoi( argv[ 3 ] );
+  /* Clusters of points around a few centers. */
+  Feature< float > feature( elements, features );
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    for( size_t ftr = 0; ftr < features; ++ftr ) {
+      float center = 100.0f * ( ( elm % 5 ) + ftr );
+      feature( elm, ftr ) = center + static_cast< float >( ( ( elm * features + ftr ) * 2654435761u ) % 400 ) / 8.0f;
+    }
+  }
+  cout << "Elements: " << elements << ", features: " << features << ", forest nodes: " << nodes << "." << endl;
+
+  /* Forest nodes spread over the elements, in a scrambled order, with radii of a few unit distances. */
+  Vector< size_t > element( nodes );
+  Vector< int > label( nodes );
+  Vector< double > radius( nodes );
+  for( size_t idx = 0; idx < nodes; ++idx ) {
+    element( idx ) = ( ( idx * 2654435761u ) % nodes ) * ( elements / nodes );
+    label( idx ) = static_cast< int >( idx % 7 );
+    radius( idx ) = static_cast< double >( ( idx * 40503u ) % 16 ) / 4.0;
+  }
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    feature.Label( elm ) = -1;
+  }
+  for( size_t idx = 0; idx < nodes; ++idx ) {
+    feature.Label( element( idx ) ) = label( idx );
+  }
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Vector< int > reference( Reference( feature, element, label, radius ) );
+  chrono::duration< double > scan = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  OPFClassifier< float > classifier( feature, element, label, radius );
+  chrono::duration< double > build = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  classifier.Classify( feature );
+  chrono::duration< double > classify = chrono::high_resolution_clock::now( ) - start;
+  size_t different = 0;
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    if( feature.Label( elm ) != reference( elm ) )
+      ++different;
+  }
+  cout << "Classifier with " << ThreadPool::Global( ).Threads( ) << " threads. Scanning nodes: " << scan.count( ) <<
+    " s, building: " << build.count( ) << " s, classifying: " << classify.count( ) << " s, speedup: " <<
+    scan.count( ) / ( build.count( ) + classify.count( ) ) << ". Different labels: " << different << "." << endl;
+
+  Graph< KnnGraphAdjacency > graph;
+  graph.Initialize( feature, 0.01, 0.1 );
+  size_t scl = graph.ScaleSweep( );
+  graph.Clustering( scl );
+  start = chrono::high_resolution_clock::now( );
+  graph.PropagateLabel( feature, scl );
+  chrono::duration< double > propagate = chrono::high_resolution_clock::now( ) - start;
+  cout << "Graph with " << graph.Samples( ) << " subsamples, best scale " << scl << ". PropagateLabel: " <<
+    propagate.count( ) << " s." << endl;
+
+  return( 0 );
+}
@@ -0,0 +1,124 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of the search for the scale of minimum normalized cut in OPF spectral clustering. Compares plateau
+ * arcs found by scanning the knn arcs of each target against those found from the reverse ranks of
+ * KnnGraphAdjacency, and the cuts of Graph::Clustering and Graph::NormalizedCut at each scale against those of
+ * Graph::ScaleSweep. Set BIAL_THREADS to choose the number of threads. */
+
+#include "Feature.hpp"
+#include "Graph.hpp"
+#include "KdTreeGraphAdjacency.hpp"
+#include "Sample.hpp"
+#include "SampleUniform.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Plateau arcs as computed before reverse ranks, scanning the arcs of tgt for each arc from src to tgt. */
+Vector< Vector< size_t > > Reference( const Matrix< size_t > &arc, const Vector< double > &density, size_t neighbors,
+                                      double delta ) {
+  size_t elements = arc.size( 0 );
+  Vector< Vector< size_t > > plateau( elements, Vector< size_t >( ) );
+  for( size_t src = 0; src < elements; ++src ) {
+    for( size_t knn = 0; knn < neighbors; ++knn ) {
+      size_t tgt = arc( src, knn );
+      if( ( density( src ) + delta >= density( tgt ) ) && ( density( src ) - delta <= density( tgt ) ) ) {
+        bool insert_src = true;
+        for( size_t bck = 0; bck < neighbors; ++bck ) {
+          if( arc( tgt, bck ) == src ) {
+            insert_src = false;
+            break;
+          }
+        }
+        if( insert_src ) {
+          plateau( tgt ).push_back( src );
+        }
+      }
+    }
+  }
+  return( plateau );
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 5 ) {
+    cout << "Usage: " << argv[ 0 ] << " <elements> <features> <scl_min> <scl_max>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 10000 3 0.05 0.3" << endl;
+    return( 0 );
+  }
+  size_t elements = atoi( argv[ 1 ] );
+  size_t features = atoi( argv[ 2 ] );
+  float scl_min = atof( argv[ 3 ] );
+  float scl_max = atof( argv[ 4 ] );
+  /* Clusters of points around a few centers. */
+  Feature< float > feature( elements, features );
+  for( size_t elm = 0; elm < elements; ++elm ) {
+    for( size_t ftr = 0; ftr < features; ++ftr ) {
+      float center = 100.0f * ( ( elm % 5 ) + ftr );
+      feature( elm, ftr ) = center + static_cast< float >( ( ( elm * features + ftr ) * 2654435761u ) % 400 ) / 8.0f;
+    }
+  }
+  cout << "Elements: " << elements << ", features: " << features << "." << endl;
+
+  Sample sample( SampleType::Uniform( feature ) );
+  KdTreeGraphAdjacency adjacency;
+  adjacency.Initialize( feature, sample, scl_min, scl_max );
+  size_t scales = adjacency.Scales( );
+  cout << "Scales: " << scales << ", kmax: " << adjacency.HomogeneousSize( scales - 1 ) << "." << endl;
+  Vector< double > density( sample.size( ) );
+  for( size_t elm = 0; elm < density.size( ); ++elm ) {
+    density( elm ) = static_cast< double >( ( elm * 2654435761u ) % 16 );
+  }
+  double scan_time = 0.0;
+  double rank_time = 0.0;
+  size_t different = 0;
+  for( size_t scl = 0; scl < scales; ++scl ) {
+    chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+    Vector< Vector< size_t > > reference( Reference( adjacency.HomogeneousAdjacency( ), density,
+                                                     adjacency.HomogeneousSize( scl ), 1.0 ) );
+    chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+    scan_time += elapsed.count( );
+    start = chrono::high_resolution_clock::now( );
+    Vector< Vector< size_t > > &plateau = adjacency.HeterogeneousAdjacency( density, scl, 1.0 );
+    elapsed = chrono::high_resolution_clock::now( ) - start;
+    rank_time += elapsed.count( );
+    for( size_t elm = 0; elm < plateau.size( ); ++elm ) {
+      if( plateau( elm ) != reference( elm ) )
+        ++different;
+    }
+  }
+  cout << "Plateau arcs of all scales. Scanning arcs: " << scan_time << " s, reverse ranks: " << rank_time <<
+    " s, speedup: " << scan_time / rank_time << ". Different samples: " << different << "." << endl;
+
+  Graph< KdTreeGraphAdjacency > graph;
+  graph.Initialize( feature, scl_min, scl_max );
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  Vector< double > cut( scales );
+  size_t best_scl = 0;
+  for( size_t scl = 0; scl < scales; ++scl ) {
+    graph.Clustering( scl );
+    cut( scl ) = graph.NormalizedCut( scl );
+    if( cut( best_scl ) > cut( scl ) )
+      best_scl = scl;
+  }
+  chrono::duration< double > scratch = chrono::high_resolution_clock::now( ) - start;
+  start = chrono::high_resolution_clock::now( );
+  size_t sweep_scl = graph.ScaleSweep( );
+  chrono::duration< double > sweep = chrono::high_resolution_clock::now( ) - start;
+  double max_error = 0.0;
+  for( size_t scl = 0; scl < scales; ++scl ) {
+    max_error = std::max( max_error, std::abs( graph.ScaleCut( )( scl ) - cut( scl ) ) );
+  }
+  cout << "Scale sweep with " << ThreadPool::Global( ).Threads( ) << " threads. Clustering and NormalizedCut: " <<
+    scratch.count( ) << " s, ScaleSweep: " << sweep.count( ) << " s, speedup: " << scratch.count( ) / sweep.count( ) <<
+    ". Best scales: " << best_scl << ", " << sweep_scl << ". Maximum cut difference: " << max_error << "." << endl;
+  cout << "Scale, clustering time, cut time:" << endl;
+  for( size_t scl = 0; scl < scales; ++scl ) {
+    cout << scl << ", " << graph.ScaleTime( )( scl, 0 ) << ", " << graph.ScaleTime( )( scl, 1 ) << endl;
+  }
+
+  return( 0 );
+}
@@ -66,7 +66,7 @@ int main( int argc, char **argv ) {
 
   COMMENT( "Running RiverBed.", 0 );
   Image< float > cost;
-  Image< int > pred;
+  Image< bial_index > pred;
   if( argc == 5 ) {
     COMMENT( "Creating mask.", 0 );
     Image< float > msk( Read< float >( argv[ 4 ] ) );
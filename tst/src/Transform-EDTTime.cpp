@@ -0,0 +1,140 @@
+/* Biomedical Image Analysis Library */
+/* See README file in the root instalation directory for more information. */
+
+/* Date: 2026/Oct/18 */
+/* Content: Test file. */
+/* Description: Time of the Euclidean distance transform and its inverse of a synthetic volume with anisotropic
+ * pixels. Compares the distances and nearest roots of a small volume against those found by comparing all pixels
+ * against all border pixels, and the roots of the inverse transform against the nearest deep pixels. Set
+ * BIAL_THREADS to choose the number of threads. */
+
+#include "Image.hpp"
+#include "TransformEuclDist.hpp"
+#include "TransformEuclDistInv.hpp"
+#include <chrono>
+
+using namespace std;
+using namespace Bial;
+
+/* Border pixels scattered over the volume, and a spherical mask. */
+void Synthetic( size_t size, Image< float > &border, Image< float > &mask ) {
+  Vector< size_t > dim( 3, size );
+  dim( 2 ) = size / 2;
+  border = Image< float >( dim );
+  mask = Image< float >( dim );
+  border.PixelSize( 2, 2.0 );
+  mask.PixelSize( 2, 2.0 );
+  for( size_t pxl = 0; pxl < border.size( ); ++pxl ) {
+    if( ( pxl * 2654435761u ) % 1999 == 0 )
+      border[ pxl ] = 1;
+    Vector< size_t > crd( border.Coordinates( pxl ) );
+    double x = crd( 0 ) - size / 2.0;
+    double y = crd( 1 ) - size / 2.0;
+    double z = 2.0 * crd( 2 ) - size / 2.0;
+    if( x * x + y * y + z * z < size * size / 4.0 )
+      mask[ pxl ] = 1;
+  }
+}
+
+int main( int argc, char **argv ) {
+  if( argc != 2 ) {
+    cout << "Usage: " << argv[ 0 ] << " <size>" << endl;
+    cout << "\tExample: " << argv[ 0 ] << " 256" << endl;
+    return( 0 );
+  }
+  size_t size = atoi( argv[ 1 ] );
+
+  Image< float > border;
+  Image< float > mask;
+  Synthetic( 32, border, mask );
+  Image< bial_index > root;
+  Image< float > value( Transform::EDT( border, mask, root ) );
+  Image< float > unmasked( Transform::EDT( border ) );
+  size_t different = 0;
+  for( size_t pxl = 0; pxl < border.size( ); ++pxl ) {
+    Vector< size_t > crd( border.Coordinates( pxl ) );
+    double best = numeric_limits< double >::max( );
+    double best_masked = numeric_limits< double >::max( );
+    for( size_t src = 0; src < border.size( ); ++src ) {
+      if( border[ src ] == 0 )
+        continue;
+      Vector< size_t > src_crd( border.Coordinates( src ) );
+      double dist = 0.0;
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        double dlt = ( static_cast< double >( crd( dms ) ) - src_crd( dms ) ) * border.PixelSize( dms );
+        dist += dlt * dlt;
+      }
+      best = std::min( best, dist );
+      if( mask[ src ] != 0 )
+        best_masked = std::min( best_masked, dist );
+    }
+    if( std::abs( unmasked[ pxl ] - std::sqrt( best ) ) > 1.0e-4 )
+      ++different;
+    if( mask[ pxl ] == 0 ) {
+      if( ( value[ pxl ] != 0 ) || ( root[ pxl ] != -1 ) )
+        ++different;
+      continue;
+    }
+    Vector< size_t > root_crd( border.Coordinates( root[ pxl ] ) );
+    double root_dist = 0.0;
+    for( size_t dms = 0; dms < 3; ++dms ) {
+      double dlt = ( static_cast< double >( crd( dms ) ) - root_crd( dms ) ) * border.PixelSize( dms );
+      root_dist += dlt * dlt;
+    }
+    if( ( std::abs( value[ pxl ] - std::sqrt( best_masked ) ) > 1.0e-4 ) || ( border[ root[ pxl ] ] == 0 ) ||
+        ( mask[ root[ pxl ] ] == 0 ) || ( std::abs( root_dist - best_masked ) > 1.0e-4 ) )
+      ++different;
+  }
+  cout << "Brute force comparison of a 32x32x16 volume. Different pixels: " << different << "." << endl;
+
+  int deep = 3;
+  Image< float > inverse( Transform::InverseEDT( border, mask, deep ) );
+  different = 0;
+  for( size_t pxl = 0; pxl < border.size( ); ++pxl ) {
+    if( mask[ pxl ] == 0 )
+      continue;
+    Vector< size_t > crd( border.Coordinates( pxl ) );
+    double best = numeric_limits< double >::max( );
+    double inv_dist = 0.0;
+    for( size_t src = 0; src < border.size( ); ++src ) {
+      if( ( mask[ src ] == 0 ) || ( value[ src ] < deep ) )
+        continue;
+      Vector< size_t > src_crd( border.Coordinates( src ) );
+      double dist = 0.0;
+      for( size_t dms = 0; dms < 3; ++dms ) {
+        double dlt = ( static_cast< double >( crd( dms ) ) - src_crd( dms ) ) * border.PixelSize( dms );
+        dist += dlt * dlt;
+      }
+      best = std::min( best, dist );
+      if( src == static_cast< size_t >( inverse[ pxl ] ) )
+        inv_dist = dist;
+    }
+    size_t inv_root = static_cast< size_t >( inverse[ pxl ] );
+    if( ( value[ inv_root ] < deep ) || ( mask[ inv_root ] == 0 ) || ( std::abs( inv_dist - best ) > 1.0e-4 ) )
+      ++different;
+  }
+  cout << "Brute force comparison of the inverse EDT of a 32x32x16 volume. Different pixels: " << different << "." <<
+    endl;
+
+  Synthetic( size, border, mask );
+  cout << "Volume: " << size << "x" << size << "x" << size / 2 << ", threads: " << ThreadPool::Global( ).Threads( ) <<
+    "." << endl;
+  chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now( );
+  unmasked = Transform::EDT( border );
+  chrono::duration< double > elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "EDT: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  value = Transform::EDT( border, mask );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Masked EDT: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  value = Transform::EDT( border, mask, root );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Masked EDT with roots: " << elapsed.count( ) << " s." << endl;
+  start = chrono::high_resolution_clock::now( );
+  Image< float > inverse_roots( Transform::InverseEDT( border, mask, 3 ) );
+  elapsed = chrono::high_resolution_clock::now( ) - start;
+  cout << "Inverse EDT: " << elapsed.count( ) << " s." << endl;
+
+  return( 0 );
+}